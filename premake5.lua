@@ -279,10 +279,12 @@ filter {}
 include "src/zonetool.lua"
 include "src/common.lua"
 include "src/tlsdll.lua"
+include "src/bench.lua"
 
 common:project()
 zonetool:project()
 tlsdll:project()
+bench:project()
 
 group "Dependencies"
 dependencies.projects()
\ No newline at end of file
@@ -0,0 +1,43 @@
+bench = {}
+function bench:project()
+    project "zonetool-bench"
+		kind "ConsoleApp"
+		language "C++"
+
+		targetname "zonetool-bench"
+
+		pchheader "std_include.hpp"
+		pchsource "src/zonetool/std_include.cpp"
+
+		linkoptions {"/IGNORE:4254", "/LARGEADDRESSAWARE"}
+
+		files {
+			"./src/bench/**.hpp", 
+			"./src/bench/**.cpp", 
+			"./src/zonetool/**.rc", 
+			"./src/zonetool/**.hpp", 
+			"./src/zonetool/**.cpp", 
+			"./src/zonetool/resources/**.*"
+		}
+
+		-- the checks run on their own, without loading a game
+		removefiles {"./src/zonetool/main.cpp"}
+
+		includedirs {
+			"./src", 
+			"./src/bench", 
+			"./src/zonetool", 
+			"./src/common", 
+			"%{prj.location}/src"
+		}
+
+		resincludedirs {"$(ProjectDir)src"}
+
+		dependson {"tlsdll"}
+
+		links {"common"}
+
+		prebuildcommands {"pushd %{_MAIN_SCRIPT_DIR}", "tools\\premake5 generate-buildinfo", "popd"}
+
+		dependencies.imports()
+end
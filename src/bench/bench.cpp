@@ -0,0 +1,62 @@
+#include <std_include.hpp>
+#include "bench.hpp"
+
+#include "zonetool/utils/utils.hpp"
+
+namespace zonetool::bench
+{
+	namespace
+	{
+		std::map<std::string, check>& get_checks()
+		{
+			static std::map<std::string, check> checks;
+			return checks;
+		}
+	}
+
+	void add(const std::string& name, check check)
+	{
+		get_checks()[name] = std::move(check);
+	}
+
+	std::size_t run(const std::string& name)
+	{
+		const auto& checks = get_checks();
+		if (!name.empty() && !checks.contains(name))
+		{
+			ZONETOOL_ERROR("Unknown check \"%s\"", name.data());
+			return 1;
+		}
+
+		std::size_t failed = 0;
+		for (const auto& [check_name, check] : checks)
+		{
+			if (!name.empty() && check_name != name)
+			{
+				continue;
+			}
+
+			auto passed = false;
+			try
+			{
+				passed = check();
+			}
+			catch (const std::exception& ex)
+			{
+				ZONETOOL_ERROR("%s: %s", check_name.data(), ex.what());
+			}
+
+			if (passed)
+			{
+				ZONETOOL_INFO("%s: passed", check_name.data());
+			}
+			else
+			{
+				ZONETOOL_ERROR("%s: failed", check_name.data());
+				failed++;
+			}
+		}
+
+		return failed;
+	}
+}
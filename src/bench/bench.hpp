@@ -0,0 +1,25 @@
+#pragma once
+
+#include <functional>
+#include <string>
+
+namespace zonetool::bench
+{
+	// a check logs what went wrong and returns false when it fails, timings are printed as it goes
+	using check = std::function<bool()>;
+
+	void add(const std::string& name, check check);
+
+	// runs the check called `name`, every check when it is empty, and prints which ones passed.
+	// returns the number of checks that failed
+	std::size_t run(const std::string& name = {});
+
+	// checks register themselves when the program starts
+	struct registration
+	{
+		registration(const std::string& name, check check)
+		{
+			add(name, std::move(check));
+		}
+	};
+}
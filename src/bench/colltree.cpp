@@ -0,0 +1,259 @@
+#include <std_include.hpp>
+#include "bench.hpp"
+
+#include "zonetool/utils/collision_tree.hpp"
+#include "zonetool/utils/utils.hpp"
+
+#include <array>
+#include <random>
+
+namespace zonetool::bench
+{
+	namespace
+	{
+		using collision_tree::mesh;
+		using collision_tree::node;
+		using collision_tree::tree;
+
+		const float* get_position(const mesh& mesh, const std::size_t vertex)
+		{
+			return reinterpret_cast<const float*>(reinterpret_cast<const std::uint8_t*>(mesh.positions) + vertex * mesh.position_stride);
+		}
+
+		struct ray
+		{
+			std::array<float, 3> origin;
+			std::array<float, 3> direction;
+		};
+
+		// distance along the ray to the triangle, or a negative value when the ray misses it
+		float intersect_triangle(const ray& ray, const float* a, const float* b, const float* c)
+		{
+			const std::array<float, 3> e1 = {b[0] - a[0], b[1] - a[1], b[2] - a[2]};
+			const std::array<float, 3> e2 = {c[0] - a[0], c[1] - a[1], c[2] - a[2]};
+			const auto& d = ray.direction;
+
+			const std::array<float, 3> p = {d[1] * e2[2] - d[2] * e2[1], d[2] * e2[0] - d[0] * e2[2], d[0] * e2[1] - d[1] * e2[0]};
+			const auto det = e1[0] * p[0] + e1[1] * p[1] + e1[2] * p[2];
+			if (std::abs(det) < 1e-12f)
+			{
+				return -1.0f;
+			}
+
+			const auto inv_det = 1.0f / det;
+			const std::array<float, 3> s = {ray.origin[0] - a[0], ray.origin[1] - a[1], ray.origin[2] - a[2]};
+			const auto u = (s[0] * p[0] + s[1] * p[1] + s[2] * p[2]) * inv_det;
+			if (u < 0.0f || u > 1.0f)
+			{
+				return -1.0f;
+			}
+
+			const std::array<float, 3> q = {s[1] * e1[2] - s[2] * e1[1], s[2] * e1[0] - s[0] * e1[2], s[0] * e1[1] - s[1] * e1[0]};
+			const auto v = (d[0] * q[0] + d[1] * q[1] + d[2] * q[2]) * inv_det;
+			if (v < 0.0f || u + v > 1.0f)
+			{
+				return -1.0f;
+			}
+
+			return (e2[0] * q[0] + e2[1] * q[1] + e2[2] * q[2]) * inv_det;
+		}
+
+		float intersect_triangle(const mesh& mesh, const ray& ray, const std::size_t tri)
+		{
+			return intersect_triangle(ray, get_position(mesh, mesh.indices[tri * 3]), get_position(mesh, mesh.indices[tri * 3 + 1]),
+				get_position(mesh, mesh.indices[tri * 3 + 2]));
+		}
+
+		// whether the ray enters the node before `max_distance`, node bounds are turned back into model space
+		bool intersect_node(const tree& tree, const node& node, const ray& ray, const float max_distance)
+		{
+			auto enter = 0.0f;
+			auto exit = max_distance;
+			for (auto i = 0; i < 3; i++)
+			{
+				const auto min = node.mins[i] / tree.scale[i] - tree.trans[i];
+				const auto max = node.maxs[i] / tree.scale[i] - tree.trans[i];
+				const auto inv_direction = 1.0f / ray.direction[i];
+
+				auto near = (min - ray.origin[i]) * inv_direction;
+				auto far = (max - ray.origin[i]) * inv_direction;
+				if (near > far)
+				{
+					std::swap(near, far);
+				}
+
+				enter = std::max(enter, near);
+				exit = std::min(exit, far * 1.0001f);
+			}
+
+			return enter <= exit;
+		}
+
+		// closest hit by walking the tree, `mesh` has to be in the triangle order of the tree
+		float trace_tree(const mesh& mesh, const tree& tree, const ray& ray, std::size_t& tri_tests)
+		{
+			auto closest = std::numeric_limits<float>::max();
+
+			std::vector<std::uint16_t> stack = {0};
+			while (!stack.empty())
+			{
+				const auto& node = tree.nodes[stack.back()];
+				stack.pop_back();
+
+				if (!intersect_node(tree, node, ray, closest))
+				{
+					continue;
+				}
+
+				if (!node.child_count)
+				{
+					for (auto t = tree.leafs[node.child_begin]; t < tree.leafs[node.child_begin + 1]; t++)
+					{
+						tri_tests++;
+						const auto distance = intersect_triangle(mesh, ray, t);
+						if (distance >= 0.0f && distance < closest)
+						{
+							closest = distance;
+						}
+					}
+
+					continue;
+				}
+
+				for (auto i = 0u; i < node.child_count; i++)
+				{
+					stack.emplace_back(static_cast<std::uint16_t>(node.child_begin + i));
+				}
+			}
+
+			return closest;
+		}
+
+		float trace_brute_force(const mesh& mesh, const ray& ray, std::size_t& tri_tests)
+		{
+			auto closest = std::numeric_limits<float>::max();
+			for (auto t = 0u; t < mesh.tri_count; t++)
+			{
+				tri_tests++;
+				const auto distance = intersect_triangle(mesh, ray, t);
+				if (distance >= 0.0f && distance < closest)
+				{
+					closest = distance;
+				}
+			}
+
+			return closest;
+		}
+
+		// rays traced through a built tree have to find the same closest hits as testing every triangle, prints how
+		// long both took
+		bool check_ray_queries()
+		{
+			constexpr auto grid_size = 96u;
+			constexpr auto ray_count = 1024u;
+
+			// bumpy terrain, 2 triangles per cell
+			std::vector<float> positions;
+			for (auto y = 0u; y <= grid_size; y++)
+			{
+				for (auto x = 0u; x <= grid_size; x++)
+				{
+					const auto height = 40.0f * std::sin(x * 0.2f) * std::cos(y * 0.15f) + 5.0f * std::sin(x * y * 0.01f);
+					positions.insert(positions.end(), {x * 8.0f, y * 8.0f, height});
+				}
+			}
+
+			std::vector<std::uint16_t> indices;
+			for (auto y = 0u; y < grid_size; y++)
+			{
+				for (auto x = 0u; x < grid_size; x++)
+				{
+					const auto v = static_cast<std::uint16_t>(y * (grid_size + 1) + x);
+					const auto below = static_cast<std::uint16_t>(v + grid_size + 1);
+					indices.insert(indices.end(), {v, static_cast<std::uint16_t>(v + 1), static_cast<std::uint16_t>(below + 1)});
+					indices.insert(indices.end(), {v, static_cast<std::uint16_t>(below + 1), below});
+				}
+			}
+
+			mesh mesh{};
+			mesh.positions = positions.data();
+			mesh.position_stride = sizeof(float) * 3;
+			mesh.vertex_count = positions.size() / 3;
+			mesh.indices = indices.data();
+			mesh.tri_count = indices.size() / 3;
+
+			const auto build_start = std::chrono::high_resolution_clock::now();
+			const auto tree = collision_tree::build(mesh);
+			const auto build_duration = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - build_start);
+			if (!tree)
+			{
+				ZONETOOL_ERROR("No tree was built for %zu triangles", mesh.tri_count);
+				return false;
+			}
+
+			std::vector<std::uint16_t> ordered_indices(indices.size());
+			for (auto t = 0u; t < mesh.tri_count; t++)
+			{
+				std::memcpy(&ordered_indices[t * 3], &indices[tree->triangle_order[t] * 3], sizeof(std::uint16_t) * 3);
+			}
+
+			mesh.indices = ordered_indices.data();
+			if (!collision_tree::validate(mesh, tree->trans, tree->scale, tree->nodes.data(), tree->nodes.size(), tree->leafs.data(), tree->leafs.size()))
+			{
+				ZONETOOL_ERROR("The built tree doesn't validate");
+				return false;
+			}
+
+			// rays from above the terrain in every direction that points down, a fixed seed keeps runs comparable
+			std::mt19937 random(1337);
+			std::uniform_real_distribution<float> unit(0.0f, 1.0f);
+			std::vector<ray> rays(ray_count);
+			for (auto& ray : rays)
+			{
+				ray.origin = {unit(random) * grid_size * 8.0f, unit(random) * grid_size * 8.0f, 100.0f + unit(random) * 100.0f};
+				ray.direction = {unit(random) * 2.0f - 1.0f, unit(random) * 2.0f - 1.0f, -0.1f - unit(random)};
+			}
+
+			std::vector<float> tree_hits(ray_count);
+			std::vector<float> brute_force_hits(ray_count);
+			std::size_t tree_tests = 0;
+			std::size_t brute_force_tests = 0;
+
+			const auto tree_start = std::chrono::high_resolution_clock::now();
+			for (auto i = 0u; i < ray_count; i++)
+			{
+				tree_hits[i] = trace_tree(mesh, *tree, rays[i], tree_tests);
+			}
+
+			const auto brute_force_start = std::chrono::high_resolution_clock::now();
+			for (auto i = 0u; i < ray_count; i++)
+			{
+				brute_force_hits[i] = trace_brute_force(mesh, rays[i], brute_force_tests);
+			}
+
+			const auto end = std::chrono::high_resolution_clock::now();
+			const auto tree_duration = std::chrono::duration<double, std::milli>(brute_force_start - tree_start);
+			const auto brute_force_duration = std::chrono::duration<double, std::milli>(end - brute_force_start);
+
+			auto hit_count = 0u;
+			for (auto i = 0u; i < ray_count; i++)
+			{
+				if (tree_hits[i] != brute_force_hits[i])
+				{
+					ZONETOOL_ERROR("Ray %u hits at %g through the tree and at %g testing every triangle", i, tree_hits[i], brute_force_hits[i]);
+					return false;
+				}
+
+				hit_count += brute_force_hits[i] < std::numeric_limits<float>::max();
+			}
+
+			ZONETOOL_INFO("%zu triangles, %zu nodes built in %.2f ms", mesh.tri_count, tree->nodes.size(), build_duration.count());
+			ZONETOOL_INFO("%u rays (%u hits): %.2f ms and %zu triangle tests through the tree, %.2f ms and %zu testing every triangle",
+				ray_count, hit_count, tree_duration.count(), tree_tests, brute_force_duration.count(), brute_force_tests);
+
+			return true;
+		}
+
+		const registration ray_query_check("colltree", check_ray_queries);
+	}
+}
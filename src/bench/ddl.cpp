@@ -0,0 +1,476 @@
+#include <std_include.hpp>
+#include "bench.hpp"
+
+#include "zonetool/iw7/zonetool.hpp"
+#include "zonetool/iw7/common/ddl_codec.hpp"
+#include "zonetool/iw7/assets/ddl.hpp"
+
+namespace zonetool::iw7
+{
+	namespace ddl_codec
+	{
+		namespace
+		{
+			// version is the first thing in every header
+			constexpr auto header_version_bits = 16u;
+
+			std::uint64_t get_mask(const std::uint32_t bits)
+			{
+				return bits >= 64 ? std::numeric_limits<std::uint64_t>::max() : (1ull << bits) - 1;
+			}
+
+			// an empty buffer with the version of `def` in its header, values are packed lsb first
+			std::vector<std::uint8_t> make_buffer(const DDLDef* def)
+			{
+				std::vector<std::uint8_t> buffer(def->byteSize);
+				buffer[0] = static_cast<std::uint8_t>(def->version);
+				buffer[1] = static_cast<std::uint8_t>(def->version >> 8);
+				return buffer;
+			}
+
+			DDLMember make_member(const char* name, const int type, const int bit_size, const int array_size = 1, const int external_index = 0,
+				const int enum_index = -1)
+			{
+				DDLMember member{};
+				member.name = name;
+				member.type = type;
+				member.bitSize = bit_size;
+				member.arraySize = array_size;
+				member.externalIndex = external_index;
+				member.enumIndex = enum_index;
+
+				// single bit uints go in the lower hash table
+				const auto element_bits = bit_size / array_size;
+				member.limitSize = element_bits;
+				member.rangeLimit = type == DDL_UINT_TYPE ? static_cast<unsigned int>(get_mask(element_bits)) : 0;
+
+				return member;
+			}
+
+			void make_enum(DDLEnum& enum_def, const char* name, const std::vector<std::string>& members, zone_memory* mem)
+			{
+				enum_def.name = name;
+				enum_def.memberCount = static_cast<int>(members.size());
+				enum_def.members = mem->allocate<const char*>(members.size());
+				for (auto i = 0u; i < members.size(); i++)
+				{
+					enum_def.members[i] = mem->duplicate_string(members[i]);
+				}
+			}
+
+			void make_struct(DDLStruct& struct_def, const char* name, const std::vector<DDLMember>& members, zone_memory* mem)
+			{
+				struct_def.name = name;
+				struct_def.memberCount = static_cast<int>(members.size());
+				struct_def.members = mem->allocate<DDLMember>(members.size());
+				for (auto i = 0u; i < members.size(); i++)
+				{
+					struct_def.members[i] = members[i];
+					struct_def.members[i].index = static_cast<int>(i);
+					struct_def.bitSize += members[i].bitSize;
+				}
+			}
+
+			// the first struct is the root, member offsets are laid out by generateHashTables
+			DDLDef* make_def(DDLStruct* structs, const int struct_count, DDLEnum* enums, const int enum_count, zone_memory* mem)
+			{
+				auto* def = mem->allocate<DDLDef>();
+				def->name = const_cast<char*>("bench");
+				def->version = 7;
+				def->headerBitSize = header_version_bits;
+				def->headerByteSize = header_version_bits / 8;
+				def->bitSize = def->headerBitSize + structs[0].bitSize;
+				def->byteSize = (def->bitSize + 7) / 8;
+				def->structList = structs;
+				def->structCount = struct_count;
+				def->enumList = enums;
+				def->enumCount = enum_count;
+
+				generateHashTables(def, mem);
+				return def;
+			}
+
+			// every member type, arrays indexed by number and by enum, a nested struct, single bit uints and pads
+			DDLDef* make_test_def(zone_memory* mem)
+			{
+				auto* weapon = mem->allocate<DDLEnum>();
+				make_enum(*weapon, "weapon", {"iw7_ar57", "iw7_m4", "iw7_knife"}, mem);
+
+				const std::vector<DDLMember> stats_members =
+				{
+					make_member("kills", DDL_INT_TYPE, 32),
+					make_member("accuracy", DDL_FLOAT_TYPE, 32),
+					make_member("unlocked", DDL_UINT_TYPE, 1),
+					make_member("name", DDL_STRING_TYPE, 16 * 8),
+					make_member("__pad", DDL_PAD_TYPE, 7),
+				};
+
+				const std::vector<DDLMember> root_members =
+				{
+					make_member("xp", DDL_UINT_TYPE, 24),
+					make_member("rank", DDL_SHORT_TYPE, 16),
+					make_member("delta", DDL_INT_TYPE, 12),
+					make_member("total", DDL_UINT64_TYPE, 64),
+					make_member("primary", DDL_ENUM_TYPE, 8),
+					make_member("weapons", DDL_STRUCT_TYPE, 200 * 3, 3, 1, 0),
+					make_member("challenges", DDL_UINT_TYPE, 5, 5),
+					make_member("history", DDL_BYTE_TYPE, 8 * 4, 4),
+					make_member("__pad", DDL_PAD_TYPE, 7),
+				};
+
+				auto* structs = mem->allocate<DDLStruct>(2);
+				make_struct(structs[0], "root", root_members, mem);
+				make_struct(structs[1], "weapon_stats", stats_members, mem);
+
+				return make_def(structs, 2, weapon, 1, mem);
+			}
+
+			constexpr auto stats_weapon_count = 256;
+			constexpr auto stats_match_count = 1024;
+			constexpr auto stats_challenge_count = 4096;
+			const std::vector<std::string> stats_modes = {"war", "dom", "sd", "koth"};
+
+			// about 64 KB, laid out like the player data of a ranked profile: stats per weapon indexed by name, a match history
+			// and challenge progress
+			DDLDef* make_stats_def(zone_memory* mem)
+			{
+				std::vector<std::string> weapon_names;
+				for (auto i = 0; i < stats_weapon_count; i++)
+				{
+					weapon_names.emplace_back(utils::string::va("weapon_%d", i));
+				}
+
+				auto* enums = mem->allocate<DDLEnum>(2);
+				make_enum(enums[0], "weapon", weapon_names, mem);
+				make_enum(enums[1], "mode", stats_modes, mem);
+
+				const std::vector<DDLMember> weapon_members =
+				{
+					make_member("kills", DDL_INT_TYPE, 32),
+					make_member("deaths", DDL_INT_TYPE, 32),
+					make_member("headshots", DDL_UINT_TYPE, 20),
+					make_member("accuracy", DDL_FLOAT_TYPE, 32),
+					make_member("xp", DDL_UINT_TYPE, 24),
+					make_member("unlocked", DDL_UINT_TYPE, 1),
+					make_member("name", DDL_STRING_TYPE, 16 * 8),
+					make_member("attachments", DDL_UINT_TYPE, 4 * 16, 16),
+					make_member("__pad", DDL_PAD_TYPE, 7),
+				};
+
+				const std::vector<DDLMember> match_members =
+				{
+					make_member("map", DDL_STRING_TYPE, 32 * 8),
+					make_member("mode", DDL_ENUM_TYPE, 8, 1, 1),
+					make_member("score", DDL_INT_TYPE, 32),
+					make_member("kills", DDL_SHORT_TYPE, 16),
+					make_member("deaths", DDL_SHORT_TYPE, 16),
+					make_member("duration", DDL_UINT_TYPE, 16),
+					make_member("won", DDL_UINT_TYPE, 1),
+					make_member("__pad", DDL_PAD_TYPE, 7),
+				};
+
+				auto* structs = mem->allocate<DDLStruct>(3);
+				make_struct(structs[1], "weapon_stats", weapon_members, mem);
+				make_struct(structs[2], "match", match_members, mem);
+				make_struct(structs[0], "root", {
+					make_member("xp", DDL_UINT_TYPE, 32),
+					make_member("prestige", DDL_BYTE_TYPE, 8),
+					make_member("weapons", DDL_STRUCT_TYPE, structs[1].bitSize * stats_weapon_count, stats_weapon_count, 1, 0),
+					make_member("matches", DDL_STRUCT_TYPE, structs[2].bitSize * stats_match_count, stats_match_count, 2),
+					make_member("challenges", DDL_UINT_TYPE, 16 * stats_challenge_count, stats_challenge_count),
+				}, mem);
+
+				return make_def(structs, 3, enums, 2, mem);
+			}
+
+			// every member of the stats def, `seed` varies the values
+			ordered_json make_stats(const int seed)
+			{
+				auto weapons = ordered_json::array();
+				for (auto i = 0; i < stats_weapon_count; i++)
+				{
+					auto attachments = ordered_json::array();
+					for (auto o = 0; o < 16; o++)
+					{
+						attachments.push_back((i + o + seed) % 16);
+					}
+
+					weapons.push_back({
+						{"kills", i * 1000 + seed},
+						{"deaths", -(i + seed)},
+						{"headshots", (i * 37 + seed) % 0x100000},
+						{"accuracy", ((i + seed) % 400) / 4.0f},
+						{"xp", (i * 4099 + seed) % 0x1000000},
+						{"unlocked", (i + seed) % 2},
+						{"name", utils::string::va("weapon %d", i)},
+						{"attachments", attachments},
+					});
+				}
+
+				auto matches = ordered_json::array();
+				for (auto i = 0; i < stats_match_count; i++)
+				{
+					matches.push_back({
+						{"map", utils::string::va("mp_bench_%d", (i + seed) % 40)},
+						{"mode", stats_modes[(i + seed) % stats_modes.size()]},
+						{"score", (i - 512) * 100 + seed},
+						{"kills", (i + seed) % 100},
+						{"deaths", -((i + seed) % 50)},
+						{"duration", (i * 13 + seed) % 0x10000},
+						{"won", (i + seed) % 2},
+					});
+				}
+
+				auto challenges = ordered_json::array();
+				for (auto i = 0; i < stats_challenge_count; i++)
+				{
+					challenges.push_back((i * 7 + seed) % 0x10000);
+				}
+
+				return {
+					{"xp", 123456789 + seed},
+					{"prestige", (10 + seed) % 256},
+					{"weapons", weapons},
+					{"matches", matches},
+					{"challenges", challenges},
+				};
+			}
+
+			template <typename F>
+			double get_time(const int iterations, F&& func)
+			{
+				const auto start = std::chrono::high_resolution_clock::now();
+				for (auto i = 0; i < iterations; i++)
+				{
+					func(i);
+				}
+
+				return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count() / iterations;
+			}
+
+			// whole buffers and single paths on a buffer the size of real player data. refusing a value checks all of it
+			// before writing, which has to leave a large buffer untouched as well
+			bool check_ddl_stats()
+			{
+				constexpr auto iterations = 10;
+
+				zone_memory mem(0x1000000);
+				const auto _0 = gsl::finally([&]
+				{
+					mem.free();
+				});
+
+				auto* def = make_stats_def(&mem);
+				const codec codec(def);
+
+				auto buffer = make_buffer(def);
+				const auto expected = make_stats(0);
+
+				auto encoded = true;
+				const auto from_json_time = get_time(iterations, [&](int)
+				{
+					encoded &= codec.from_json(expected, buffer.data(), buffer.size());
+				});
+
+				ordered_json decoded;
+				const auto to_json_time = get_time(iterations, [&](int)
+				{
+					decoded = codec.to_json(buffer.data(), buffer.size());
+				});
+
+				if (!encoded || decoded != expected)
+				{
+					ZONETOOL_ERROR("The stats didn't decode to the values they were encoded from");
+					return false;
+				}
+
+				// a value that doesn't fit at the very end of the buffer
+				auto refused = expected;
+				refused["xp"] = 1;
+				refused["challenges"].back() = 0x10000;
+
+				const auto before = buffer;
+				if (codec.from_json(refused, buffer.data(), buffer.size()) || buffer != before)
+				{
+					ZONETOOL_ERROR("Stats with a value that doesn't fit weren't refused as a whole");
+					return false;
+				}
+
+				std::vector<std::pair<std::string, ordered_json>> paths;
+				for (auto i = 0; i < stats_weapon_count; i++)
+				{
+					paths.emplace_back(utils::string::va("weapons[weapon_%d].kills", i), -i);
+				}
+
+				for (auto i = 0; i < stats_match_count; i++)
+				{
+					paths.emplace_back(utils::string::va("matches[%d].mode", i), stats_modes[i % stats_modes.size()]);
+				}
+
+				for (auto i = 0; i < stats_challenge_count; i++)
+				{
+					paths.emplace_back(utils::string::va("challenges[%d]", i), 0xFFFF - i);
+				}
+
+				auto set = true;
+				const auto set_time = get_time(static_cast<int>(paths.size()), [&](const int i)
+				{
+					set &= codec.set(buffer.data(), buffer.size(), paths[i].first, paths[i].second);
+				});
+
+				auto read = true;
+				const auto get_time_each = get_time(static_cast<int>(paths.size()), [&](const int i)
+				{
+					const auto value = codec.get(buffer.data(), buffer.size(), paths[i].first);
+					read &= value && *value == paths[i].second;
+				});
+
+				if (!set || !read)
+				{
+					ZONETOOL_ERROR("Values set by path didn't read back the same");
+					return false;
+				}
+
+				ZONETOOL_INFO("%d byte buffer: to_json %.2f ms, from_json %.2f ms", def->byteSize, to_json_time, from_json_time);
+				ZONETOOL_INFO("%zu paths: set %.2f us, get %.2f us each", paths.size(), set_time * 1000.0, get_time_each * 1000.0);
+
+				return true;
+			}
+
+			// a buffer encoded from json has to decode to the same json and encode to the same bytes again, and paths
+			// have to reach the same values. values that don't fit their member are refused without touching the buffer
+			bool check_ddl_round_trip()
+			{
+				constexpr auto iterations = 10000;
+
+				zone_memory mem(0x100000);
+				const auto _0 = gsl::finally([&]
+				{
+					mem.free();
+				});
+
+				auto* def = make_test_def(&mem);
+				const codec codec(def);
+
+				const auto expected = ordered_json::parse(R"({
+					"xp": 16777215,
+					"rank": -32768,
+					"delta": -2048,
+					"total": 18446744073709551615,
+					"primary": "iw7_knife",
+					"weapons": [
+						{"kills": 2147483647, "accuracy": 0.25, "unlocked": 1, "name": "iw7_ar57 gold"},
+						{"kills": -1, "accuracy": -1.5, "unlocked": 0, "name": ""},
+						{"kills": -2147483648, "accuracy": 1024.5, "unlocked": 1, "name": "fifteen chars!!"}
+					],
+					"challenges": [1, 0, 1, 1, 0],
+					"history": [0, 255, 128, 7]
+				})");
+
+				auto buffer = make_buffer(def);
+
+				if (!codec.from_json(expected, buffer.data(), buffer.size()))
+				{
+					ZONETOOL_ERROR("The test values couldn't be encoded");
+					return false;
+				}
+
+				DDLFile file{const_cast<char*>("bench"), def};
+				if (find_def(&file, buffer.data(), buffer.size()) != def)
+				{
+					ZONETOOL_ERROR("The def wasn't found by the version in the header");
+					return false;
+				}
+
+				const auto decoded = codec.to_json(buffer.data(), buffer.size());
+				if (decoded != expected)
+				{
+					ZONETOOL_ERROR("Decoded to %s, expected %s", decoded.dump().data(), expected.dump().data());
+					return false;
+				}
+
+				auto encoded = make_buffer(def);
+				if (!codec.from_json(decoded, encoded.data(), encoded.size()) || encoded != buffer)
+				{
+					ZONETOOL_ERROR("Encoding the decoded values again gave different bytes");
+					return false;
+				}
+
+				const std::vector<std::pair<std::string, ordered_json>> paths =
+				{
+					{"weapons[iw7_m4].kills", -1},
+					{"weapons[2].name", "fifteen chars!!"},
+					{"weapons[iw7_ar57].accuracy", 0.25},
+					{"challenges[3]", 1},
+					{"primary", "iw7_knife"},
+				};
+
+				for (const auto& [path, value] : paths)
+				{
+					const auto result = codec.get(buffer.data(), buffer.size(), path);
+					if (!result || *result != value)
+					{
+						ZONETOOL_ERROR("\"%s\" read %s, expected %s", path.data(), result ? result->dump().data() : "nothing", value.dump().data());
+						return false;
+					}
+				}
+
+				const std::vector<std::pair<std::string, ordered_json>> refused =
+				{
+					{"xp", 16777216},
+					{"delta", -2049},
+					{"rank", 32768},
+					{"weapons[0].name", "sixteen chars!!!"},
+					{"weapons[3].kills", 1},
+					{"weapons[iw7_nope].kills", 1},
+					{"primary", "iw7_nope"},
+					{"challenges[0]", 2},
+					{"unlocked", 1},
+					{"__pad", 1},
+					{"challenges", {1, 1, 1, 1, 2}},
+					{"weapons[1]", {{"kills", 5}, {"nope", 1}}},
+					{"weapons", ordered_json::parse(R"([{"kills": 5}, {"kills": 6}, {"nope": 1}])")},
+				};
+
+				const auto before = buffer;
+				for (const auto& [path, value] : refused)
+				{
+					if (codec.set(buffer.data(), buffer.size(), path, value) || buffer != before)
+					{
+						ZONETOOL_ERROR("Setting \"%s\" to %s wasn't refused", path.data(), value.dump().data());
+						return false;
+					}
+				}
+
+				// members before and after the one that doesn't fit stay as they were too
+				if (codec.from_json({{"xp", 1}, {"delta", -4096}, {"rank", 1}}, buffer.data(), buffer.size()) || buffer != before)
+				{
+					ZONETOOL_ERROR("Values with a member that doesn't fit weren't refused as a whole");
+					return false;
+				}
+
+				const auto set = codec.set(buffer.data(), buffer.size(), "weapons[iw7_m4].unlocked", true);
+				const auto unlocked = codec.get(buffer.data(), buffer.size(), "weapons[1].unlocked");
+				if (!set || !unlocked || *unlocked != 1)
+				{
+					ZONETOOL_ERROR("Setting a single bit member by enum index didn't stick");
+					return false;
+				}
+
+				const auto start = std::chrono::high_resolution_clock::now();
+				for (auto i = 0; i < iterations; i++)
+				{
+					codec.from_json(codec.to_json(buffer.data(), buffer.size()), encoded.data(), encoded.size());
+				}
+
+				const auto duration = std::chrono::duration<double, std::micro>(std::chrono::high_resolution_clock::now() - start);
+				ZONETOOL_INFO("%d byte buffer decoded and encoded again %d times, %.2f us each", def->byteSize, iterations, duration.count() / iterations);
+
+				return true;
+			}
+
+			const bench::registration ddl_round_trip_check("ddl", check_ddl_round_trip);
+			const bench::registration ddl_stats_check("ddlstats", check_ddl_stats);
+		}
+	}
+}
@@ -0,0 +1,69 @@
+#include <std_include.hpp>
+#include "bench.hpp"
+
+#include "zonetool/utils/dump_queue.hpp"
+#include "zonetool/utils/utils.hpp"
+
+namespace zonetool::bench
+{
+	namespace
+	{
+		// stop_dumping relies on the queue starting tasks in push order and on wait() returning only once
+		// every task pushed before it has finished, including ones pushed by tasks that are still running
+		bool check_dump_queue()
+		{
+			constexpr auto task_count = 1000;
+
+			dump_queue queue;
+			std::vector<int> order;
+			std::atomic<int> finished = 0;
+
+			for (auto i = 0; i < task_count; i++)
+			{
+				queue.push([&, i]
+				{
+					order.emplace_back(i);
+					finished++;
+				});
+			}
+
+			queue.wait();
+			if (finished != task_count)
+			{
+				ZONETOOL_ERROR("wait() returned with %d of %d tasks finished", finished.load(), task_count);
+				return false;
+			}
+
+			for (auto i = 0; i < task_count; i++)
+			{
+				if (order[i] != i)
+				{
+					ZONETOOL_ERROR("Task %d ran in position %d", order[i], i);
+					return false;
+				}
+			}
+
+			// like dumping referenced assets after the zone's own, pushed from a task while the queue is busy
+			std::atomic<bool> nested_finished = false;
+			queue.push([&]
+			{
+				std::this_thread::sleep_for(10ms);
+				queue.push([&]
+				{
+					nested_finished = true;
+				});
+			});
+
+			queue.wait();
+			if (!nested_finished)
+			{
+				ZONETOOL_ERROR("wait() returned before a task pushed by another task finished");
+				return false;
+			}
+
+			return true;
+		}
+
+		const registration dump_queue_check("dumpqueue", check_dump_queue);
+	}
+}
@@ -0,0 +1,100 @@
+#include <std_include.hpp>
+#include "bench.hpp"
+
+#include "zonetool/h1/zonetool.hpp"
+
+namespace zonetool::bench
+{
+	namespace
+	{
+		template <typename T>
+		double get_curve_deviation(const T* original, const std::size_t original_count, const T* reduced, const std::size_t reduced_count)
+		{
+			constexpr auto stride = sizeof(T) / sizeof(float);
+			constexpr auto points = 10000;
+
+			const auto* original_values = reinterpret_cast<const float*>(original);
+			const auto* reduced_values = reinterpret_cast<const float*>(reduced);
+
+			auto deviation = 0.0;
+			for (auto c = 0u; c < stride; c++)
+			{
+				auto min = original_values[c];
+				auto max = original_values[c];
+				for (auto i = 1u; i <= original_count; i++)
+				{
+					min = std::min(min, original_values[i * stride + c]);
+					max = std::max(max, original_values[i * stride + c]);
+				}
+
+				const auto scale = std::max(1.0, static_cast<double>(max) - min);
+				for (auto i = 0; i <= points; i++)
+				{
+					const auto t = static_cast<double>(i) / points;
+					const auto diff = std::abs(h1::fx::curves::evaluate(original_values, stride, original_count, c, t) -
+						h1::fx::curves::evaluate(reduced_values, stride, reduced_count, c, t));
+					deviation = std::max(deviation, diff / scale);
+				}
+			}
+
+			return deviation;
+		}
+
+		// reduced curves have to stay within the tolerance everywhere between the samples too, and a straight line
+		// needs a single interval
+		bool check_fx_curves()
+		{
+			constexpr auto interval_count = 64;
+			constexpr auto max_deviation = 0.01f;
+
+			zone_memory mem(0x100000);
+
+			std::vector<h1::FxElemVelStateSample> line(interval_count + 1);
+			std::vector<h1::FxElemVisStateSample> wave(interval_count + 1);
+			for (auto i = 0; i <= interval_count; i++)
+			{
+				const auto t = static_cast<float>(i) / interval_count;
+
+				auto* line_values = reinterpret_cast<float*>(&line[i]);
+				for (auto c = 0u; c < sizeof(h1::FxElemVelStateSample) / sizeof(float); c++)
+				{
+					line_values[c] = 100.0f * c * t - 50.0f;
+				}
+
+				auto* wave_values = reinterpret_cast<float*>(&wave[i]);
+				for (auto c = 0u; c < sizeof(h1::FxElemVisStateSample) / sizeof(float); c++)
+				{
+					wave_values[c] = c % 2 ? 255.0f * t * t : 10.0f * std::sin(t * 3.14159265f * (1 + c % 3));
+				}
+			}
+
+			auto* line_samples = line.data();
+			unsigned char line_count = interval_count;
+			h1::fx::curves::reduce(&line_samples, &line_count, max_deviation, &mem);
+			if (line_count != 1)
+			{
+				ZONETOOL_ERROR("A straight line was reduced to %d intervals instead of 1", line_count);
+				return false;
+			}
+
+			auto* wave_samples = wave.data();
+			unsigned char wave_count = interval_count;
+			const auto reported = h1::fx::curves::reduce(&wave_samples, &wave_count, max_deviation, &mem);
+			const auto deviation = get_curve_deviation(wave.data(), interval_count, wave_samples, wave_count);
+
+			ZONETOOL_INFO("%d intervals reduced to %d, %zu bytes saved, max deviation %g (reported %g)", interval_count, wave_count,
+				(interval_count - wave_count) * sizeof(h1::FxElemVisStateSample), deviation, reported);
+
+			// float rounding of the resampled values
+			if (deviation > max_deviation + 1e-5 || deviation > reported + 1e-5)
+			{
+				ZONETOOL_ERROR("Reduced curve deviates by %g, more than the tolerance %g or the reported %g", deviation, max_deviation, reported);
+				return false;
+			}
+
+			return true;
+		}
+
+		const registration fx_curves_check("fxcurves", check_fx_curves);
+	}
+}
@@ -0,0 +1,167 @@
+#include <std_include.hpp>
+#include "bench.hpp"
+
+#include "zonetool/h1/zonetool.hpp"
+
+namespace zonetool::bench
+{
+	namespace
+	{
+		// the asset list of a zone the way zone_interface keeps it. the game isn't loaded here, so names are
+		// read from the entries instead of through DB_GetXAssetName
+		class localize_zone : public zone_base
+		{
+		public:
+			asset_interface* find_asset(const std::int32_t type, const std::string& name) override
+			{
+				for (const auto& asset : this->assets_)
+				{
+					if (asset->type() == type && asset->name() == name)
+					{
+						return asset.get();
+					}
+				}
+
+				return nullptr;
+			}
+
+			void* get_asset_pointer(std::int32_t, const std::string&) override
+			{
+				return nullptr;
+			}
+
+			// like zone_interface, every asset scans the whole zone
+			void add_asset_of_type_by_pointer(const std::int32_t type, void* pointer) override
+			{
+				if (pointer && !this->find_asset(type, get_name(pointer)))
+				{
+					this->add(pointer);
+				}
+			}
+
+			std::size_t add_assets_of_type_by_pointer(const std::int32_t type, const std::vector<void*>& pointers) override
+			{
+				return add_new_assets_by_pointer(this->assets_, type, pointers, get_name, [&](void* pointer, const std::string&)
+				{
+					this->add(pointer);
+				});
+			}
+
+			void add_asset_of_type(const std::string&, const std::string&) override
+			{
+			}
+
+			void add_asset_of_type(std::int32_t, const std::string&) override
+			{
+			}
+
+			std::int32_t get_type_by_name(const std::string& type) override
+			{
+				return type == "localize" ? h1::ASSET_TYPE_LOCALIZE_ENTRY : -1;
+			}
+
+			void build(zone_buffer*) override
+			{
+			}
+
+			const char* get_value(const std::string& key)
+			{
+				auto* asset = this->find_asset(h1::ASSET_TYPE_LOCALIZE_ENTRY, key);
+				return asset ? reinterpret_cast<h1::LocalizeEntry*>(asset->pointer())->value : nullptr;
+			}
+
+		private:
+			zone_memory mem_{0x1000000};
+			std::vector<std::shared_ptr<asset_interface>> assets_;
+
+			static std::string get_name(void* pointer)
+			{
+				return reinterpret_cast<h1::LocalizeEntry*>(pointer)->name;
+			}
+
+			void add(void* pointer)
+			{
+				auto asset = std::make_shared<h1::localize>();
+				asset->init(pointer, &this->mem_);
+				this->assets_.push_back(asset);
+			}
+		};
+
+		h1::localize::localized_strings make_strings(const int count)
+		{
+			h1::localize::localized_strings strings;
+			strings.reserve(count);
+			for (auto i = 0; i < count; i++)
+			{
+				strings.emplace_back(utils::string::va("BENCH_%d", i), std::to_string(i));
+			}
+
+			return strings;
+		}
+
+		double add_in_batch(const h1::localize::localized_strings& strings)
+		{
+			localize_zone zone;
+			const auto start = std::chrono::high_resolution_clock::now();
+			h1::localize::add_localized_strings(&zone, "bench", strings);
+			return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+		}
+
+		// a key repeated in a file keeps its first value and a key the zone already has keeps the value it was added with,
+		// like adding them one by one. the timings compare that with the batch on a large file
+		bool check_localize_batch()
+		{
+			constexpr auto key_count = 100000;
+
+			// adding one by one scans the zone for every key, so it is only timed on the start of the file
+			constexpr auto single_count = 5000;
+
+			const auto strings = make_strings(key_count);
+
+			localize_zone zone;
+			h1::localize::add_localized_strings(&zone, "bench_first", {{"BENCH_ZONE", "zone"}});
+
+			auto batch = strings;
+			batch.emplace_back("BENCH_ZONE", "file");
+			batch.emplace_back("BENCH_0", "repeated");
+			h1::localize::add_localized_strings(&zone, "bench_batch", batch);
+
+			const auto* zone_value = zone.get_value("BENCH_ZONE");
+			const auto* repeated_value = zone.get_value("BENCH_0");
+			const auto* last_value = zone.get_value(utils::string::va("BENCH_%d", key_count - 1));
+
+			if (!zone_value || zone_value != "zone"s || !repeated_value || repeated_value != "0"s ||
+				!last_value || last_value != std::to_string(key_count - 1))
+			{
+				ZONETOOL_ERROR("Localized strings don't keep the values they were first added with");
+				return false;
+			}
+
+			const auto batch_time = add_in_batch(strings);
+
+			const h1::localize::localized_strings single_strings(strings.begin(), strings.begin() + single_count);
+			const auto single_batch_time = add_in_batch(single_strings);
+
+			// the same strings one at a time, the way files were added before
+			localize_zone single_zone;
+			const auto single_start = std::chrono::high_resolution_clock::now();
+			for (const auto& [key, value] : single_strings)
+			{
+				h1::LocalizeEntry entry{};
+				entry.name = key.data();
+				entry.value = value.data();
+				single_zone.add_asset_of_type_by_pointer(h1::ASSET_TYPE_LOCALIZE_ENTRY, &entry);
+			}
+
+			const auto single_time = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - single_start);
+
+			ZONETOOL_INFO("%d localized strings in one batch: %.2f ms", key_count, batch_time);
+			ZONETOOL_INFO("%d localized strings: %.2f ms in one batch, %.2f ms one by one", single_count, single_batch_time,
+				single_time.count());
+
+			return true;
+		}
+
+		const registration localize_batch_check("localize", check_localize_batch);
+	}
+}
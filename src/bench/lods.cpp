@@ -0,0 +1,178 @@
+#include <std_include.hpp>
+#include "bench.hpp"
+
+#include "zonetool/utils/mesh_simplify.hpp"
+#include "zonetool/utils/utils.hpp"
+
+namespace zonetool::bench
+{
+	namespace
+	{
+		struct vec3
+		{
+			double x;
+			double y;
+			double z;
+		};
+
+		vec3 sub(const vec3& a, const vec3& b)
+		{
+			return {a.x - b.x, a.y - b.y, a.z - b.z};
+		}
+
+		vec3 cross(const vec3& a, const vec3& b)
+		{
+			return {a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x};
+		}
+
+		double dot(const vec3& a, const vec3& b)
+		{
+			return a.x * b.x + a.y * b.y + a.z * b.z;
+		}
+
+		struct test_mesh
+		{
+			std::vector<float> positions;
+			std::vector<std::uint16_t> indices;
+			std::vector<bool> border;
+		};
+
+		// grid of `columns` x `rows` quads, `wrap` closes it into a torus, otherwise it is a bumpy plane with a border
+		test_mesh make_test_mesh(const std::uint32_t columns, const std::uint32_t rows, const bool wrap)
+		{
+			constexpr auto pi = 3.14159265358979;
+
+			const auto vertex_columns = wrap ? columns : columns + 1;
+			const auto vertex_rows = wrap ? rows : rows + 1;
+
+			test_mesh mesh;
+			for (auto y = 0u; y < vertex_rows; y++)
+			{
+				for (auto x = 0u; x < vertex_columns; x++)
+				{
+					const auto u = 2.0 * pi * x / columns;
+					const auto v = 2.0 * pi * y / rows;
+
+					if (wrap)
+					{
+						mesh.positions.insert(mesh.positions.end(), {static_cast<float>((100.0 + 30.0 * std::cos(v)) * std::cos(u)),
+							static_cast<float>((100.0 + 30.0 * std::cos(v)) * std::sin(u)), static_cast<float>(30.0 * std::sin(v))});
+					}
+					else
+					{
+						mesh.positions.insert(mesh.positions.end(), {static_cast<float>(x * 10.0), static_cast<float>(y * 10.0),
+							static_cast<float>(20.0 * std::sin(u) * std::sin(v))});
+					}
+
+					mesh.border.emplace_back(!wrap && (x == 0 || y == 0 || x == columns || y == rows));
+				}
+			}
+
+			const auto get_vertex = [&](const std::uint32_t x, const std::uint32_t y)
+			{
+				return static_cast<std::uint16_t>((y % vertex_rows) * vertex_columns + x % vertex_columns);
+			};
+
+			for (auto y = 0u; y < rows; y++)
+			{
+				for (auto x = 0u; x < columns; x++)
+				{
+					mesh.indices.insert(mesh.indices.end(), {get_vertex(x, y), get_vertex(x + 1, y), get_vertex(x + 1, y + 1)});
+					mesh.indices.insert(mesh.indices.end(), {get_vertex(x, y), get_vertex(x + 1, y + 1), get_vertex(x, y + 1)});
+				}
+			}
+
+			return mesh;
+		}
+
+		vec3 get_position(const test_mesh& mesh, const std::uint32_t v)
+		{
+			return {mesh.positions[v * 3], mesh.positions[v * 3 + 1], mesh.positions[v * 3 + 2]};
+		}
+
+		vec3 get_normal(const test_mesh& mesh, const std::uint32_t a, const std::uint32_t b, const std::uint32_t c)
+		{
+			return cross(sub(get_position(mesh, b), get_position(mesh, a)), sub(get_position(mesh, c), get_position(mesh, a)));
+		}
+
+		bool check_lod(const char* name, const test_mesh& test, const float ratio)
+		{
+			const auto tri_count = test.indices.size() / 3;
+			const auto target = static_cast<std::size_t>(tri_count * ratio);
+
+			mesh_simplify::mesh mesh{};
+			mesh.positions = test.positions.data();
+			mesh.position_stride = sizeof(float) * 3;
+			mesh.vertex_count = test.positions.size() / 3;
+			mesh.indices = test.indices.data();
+			mesh.tri_count = tri_count;
+
+			const auto start = std::chrono::high_resolution_clock::now();
+			const auto result = mesh_simplify::simplify(mesh, target);
+			const auto duration = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start);
+
+			// every collapse removes at least one triangle, so it only stops short when nothing could collapse anymore
+			if (result.triangles.size() > target + tri_count / 20)
+			{
+				ZONETOOL_ERROR("%s: %zu triangles left of %zu, expected about %zu", name, result.triangles.size(), tri_count, target);
+				return false;
+			}
+
+			auto max_shift = 0.0;
+			for (auto v = 0u; v < mesh.vertex_count; v++)
+			{
+				if (test.border[v] && result.remap[v] != v)
+				{
+					ZONETOOL_ERROR("%s: border vertex %u was collapsed into %u", name, v, result.remap[v]);
+					return false;
+				}
+
+				const auto shift = sub(get_position(test, result.remap[v]), get_position(test, v));
+				max_shift = std::max(max_shift, std::sqrt(dot(shift, shift)));
+			}
+
+			for (const auto t : result.triangles)
+			{
+				const auto* face = &test.indices[t * 3];
+				const auto a = result.remap[face[0]];
+				const auto b = result.remap[face[1]];
+				const auto c = result.remap[face[2]];
+				if (a == b || b == c || a == c)
+				{
+					ZONETOOL_ERROR("%s: triangle %u is left degenerate", name, t);
+					return false;
+				}
+
+				if (dot(get_normal(test, face[0], face[1], face[2]), get_normal(test, a, b, c)) <= 0.0)
+				{
+					ZONETOOL_ERROR("%s: triangle %u is folded over", name, t);
+					return false;
+				}
+			}
+
+			ZONETOOL_INFO("%s at %g: %zu triangles reduced to %zu (target %zu) in %.2f ms, vertices moved up to %.2f units", name, ratio,
+				tri_count, result.triangles.size(), target, duration.count(), max_shift);
+
+			return true;
+		}
+
+		// generated lods have to get close to their triangle target without folding triangles over or moving the border
+		bool check_lods()
+		{
+			const auto torus = make_test_mesh(128, 64, true);
+			const auto plane = make_test_mesh(64, 64, false);
+
+			for (const auto ratio : {0.5f, 0.25f, 0.125f})
+			{
+				if (!check_lod("torus", torus, ratio) || !check_lod("plane", plane, ratio))
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		const registration lods_check("lods", check_lods);
+	}
+}
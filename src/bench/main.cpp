@@ -0,0 +1,8 @@
+#include <std_include.hpp>
+#include "bench.hpp"
+
+// zonetool-bench [check]: runs every check, or only the named one, exits with the number of checks that failed
+int main(const int argc, char** argv)
+{
+	return static_cast<int>(zonetool::bench::run(argc >= 2 ? argv[1] : ""));
+}
@@ -0,0 +1,183 @@
+#include <std_include.hpp>
+#include "bench.hpp"
+
+#include "zonetool/h1/converter/iw7/include.hpp"
+#include "zonetool/h1/converter/iw7/assets/gfxworld.hpp"
+
+#pragma warning( push )
+#pragma warning( disable : 4459 )
+#include <DirectXTex.h>
+#pragma warning( pop )
+
+namespace zonetool::bench
+{
+	namespace
+	{
+		// what the converter writes reflection probes as
+		constexpr auto reflection_probe_format = DXGI_FORMAT_BC6H_UF16;
+
+		HRESULT decode_to_float(const DirectX::Image& image, DirectX::ScratchImage& decoded)
+		{
+			if (DirectX::IsCompressed(image.format))
+			{
+				return DirectX::Decompress(image, DXGI_FORMAT_R32G32B32A32_FLOAT, decoded);
+			}
+
+			if (image.format == DXGI_FORMAT_R32G32B32A32_FLOAT)
+			{
+				return decoded.InitializeFromImage(image);
+			}
+
+			return DirectX::Convert(image, DXGI_FORMAT_R32G32B32A32_FLOAT, DirectX::TEX_FILTER_DEFAULT, DirectX::TEX_THRESHOLD_DEFAULT, decoded);
+		}
+
+		// relative rms error of the colors of two images, both decoded to float. negative values and values past the
+		// half float range of `expected` are clamped like the conversion does
+		std::optional<double> get_probe_error(const DirectX::Image& expected, const DirectX::Image& actual)
+		{
+			DirectX::ScratchImage expected_decoded;
+			DirectX::ScratchImage actual_decoded;
+			if (FAILED(decode_to_float(expected, expected_decoded)) || FAILED(decode_to_float(actual, actual_decoded)))
+			{
+				return {};
+			}
+
+			const auto* expected_texels = reinterpret_cast<const float*>(expected_decoded.GetPixels());
+			const auto* actual_texels = reinterpret_cast<const float*>(actual_decoded.GetPixels());
+
+			auto error = 0.0;
+			auto energy = 0.0;
+			for (auto i = 0u; i < expected.width * expected.height; i++)
+			{
+				for (auto c = 0u; c < 3; c++)
+				{
+					const auto value = static_cast<double>(std::clamp(expected_texels[i * 4 + c], 0.0f, 65504.0f));
+					const auto diff = actual_texels[i * 4 + c] - value;
+					error += diff * diff;
+					energy += value * value;
+				}
+			}
+
+			return energy > 0.0 ? std::sqrt(error / energy) : 0.0;
+		}
+
+		// converts a face made by `get_color` from `format` to bc6h and compares it with the source
+		bool check_probe_face(const char* name, const DXGI_FORMAT format, const double max_error,
+			const std::function<std::array<float, 3>(float u, float v)>& get_color)
+		{
+			constexpr auto size = 64u;
+
+			DirectX::ScratchImage colors;
+			if (FAILED(colors.Initialize2D(DXGI_FORMAT_R32G32B32A32_FLOAT, size, size, 1, 1)))
+			{
+				return false;
+			}
+
+			auto* texels = reinterpret_cast<float*>(colors.GetPixels());
+			for (auto y = 0u; y < size; y++)
+			{
+				for (auto x = 0u; x < size; x++)
+				{
+					const auto color = get_color((x + 0.5f) / size, (y + 0.5f) / size);
+					std::memcpy(&texels[(y * size + x) * 4], color.data(), sizeof(color));
+					texels[(y * size + x) * 4 + 3] = 1.0f;
+				}
+			}
+
+			DirectX::ScratchImage source;
+			HRESULT source_result = S_OK;
+			if (DirectX::IsCompressed(format))
+			{
+				source_result = DirectX::Compress(*colors.GetImage(0, 0, 0), format, DirectX::TEX_COMPRESS_DEFAULT, DirectX::TEX_THRESHOLD_DEFAULT, source);
+			}
+			else if (format != DXGI_FORMAT_R32G32B32A32_FLOAT)
+			{
+				source_result = DirectX::Convert(*colors.GetImage(0, 0, 0), format, DirectX::TEX_FILTER_DEFAULT, DirectX::TEX_THRESHOLD_DEFAULT, source);
+			}
+			else
+			{
+				source = std::move(colors);
+			}
+
+			if (FAILED(source_result))
+			{
+				ZONETOOL_ERROR("%s: couldn't make a source face in format %d", name, format);
+				return false;
+			}
+
+			DirectX::Image face{};
+			face.width = size;
+			face.height = size;
+			face.format = reflection_probe_format;
+			DirectX::ComputePitch(face.format, face.width, face.height, face.rowPitch, face.slicePitch);
+
+			std::vector<std::uint8_t> pixels(face.slicePitch);
+			face.pixels = pixels.data();
+
+			const auto& src = *source.GetImage(0, 0, 0);
+			const auto reported = h1::converter::iw7::gfxworld::convert_reflection_probe(src, face);
+			if (!reported.has_value())
+			{
+				ZONETOOL_ERROR("%s: a face in format %d couldn't be converted", name, format);
+				return false;
+			}
+
+			if (src.format == face.format && std::memcmp(src.pixels, face.pixels, face.slicePitch))
+			{
+				ZONETOOL_ERROR("%s: a face that already is bc6h wasn't copied as it is", name);
+				return false;
+			}
+
+			const auto error = get_probe_error(src, face);
+			if (!error.has_value())
+			{
+				ZONETOOL_ERROR("%s: the converted face couldn't be decoded", name);
+				return false;
+			}
+
+			ZONETOOL_INFO("%s: relative rms error %.5f (reported %.5f, at most %.2f)", name, *error, *reported, max_error);
+
+			// the reported error is measured the same way, up to float rounding
+			if (*error > max_error || std::abs(*error - *reported) > 1e-4)
+			{
+				ZONETOOL_ERROR("%s: relative rms error %g, reported %g, allowed %g", name, *error, *reported, max_error);
+				return false;
+			}
+
+			return true;
+		}
+
+		// reflection probes converted to bc6h have to decode to about what they were, whatever format they came in
+		bool check_reflection_probes()
+		{
+			// smooth hdr lighting over four orders of magnitude, like a sky next to a dark interior
+			const auto hdr = [](const float u, const float v)
+			{
+				const auto intensity = std::pow(10.0f, 4.0f * u - 2.0f);
+				return std::array<float, 3>{intensity, intensity * (0.5f + 0.5f * v), intensity * (1.0f - 0.5f * v)};
+			};
+
+			// ldr colors with edges in them
+			const auto ldr = [](const float u, const float v)
+			{
+				const auto checker = (static_cast<int>(u * 8.0f) + static_cast<int>(v * 8.0f)) % 2 ? 0.8f : 0.2f;
+				return std::array<float, 3>{checker, u, v};
+			};
+
+			// values bc6h uf16 can't hold are clamped to what it can
+			const auto out_of_range = [](const float u, const float v)
+			{
+				return std::array<float, 3>{u < 0.5f ? -1.0f : 1.0f, v < 0.5f ? 1e6f : 100.0f, u * v};
+			};
+
+			return check_probe_face("hdr rgba16f", DXGI_FORMAT_R16G16B16A16_FLOAT, 0.05, hdr)
+				&& check_probe_face("hdr rgba32f", DXGI_FORMAT_R32G32B32A32_FLOAT, 0.05, hdr)
+				&& check_probe_face("ldr bc1", DXGI_FORMAT_BC1_UNORM, 0.05, ldr)
+				&& check_probe_face("ldr bc3", DXGI_FORMAT_BC3_UNORM, 0.05, ldr)
+				&& check_probe_face("clamped rgba32f", DXGI_FORMAT_R32G32B32A32_FLOAT, 0.05, out_of_range)
+				&& check_probe_face("bc6h copy", DXGI_FORMAT_BC6H_UF16, 0.0, hdr);
+		}
+
+		const registration reflection_probe_check("probes", check_reflection_probes);
+	}
+}
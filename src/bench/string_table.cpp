@@ -0,0 +1,106 @@
+#include <std_include.hpp>
+#include "bench.hpp"
+
+#include "zonetool/utils/csv.hpp"
+#include "zonetool/utils/string_table_builder.hpp"
+#include "zonetool/utils/utils.hpp"
+
+#include <utils/io.hpp>
+#include <utils/string.hpp>
+
+#include <random>
+
+namespace zonetool::bench
+{
+	namespace
+	{
+		// a large table with the repetition string tables have, after rows covering the corner cases of the csv format
+		std::string make_test_table(const std::size_t row_count)
+		{
+			std::string data = "id,category,\"name, quoted\",value,flag,description\r\n"
+				"escaped\\nline,tab\\there,back\\slash,,trailing,\n"
+				"\n"
+				"\"\",\"a\"\"b\",single\n"
+				"one\n";
+
+			std::mt19937 random(1337);
+			for (auto row = 0u; row < row_count; row++)
+			{
+				const auto value = static_cast<std::uint32_t>(random());
+				data += utils::string::va("%u,category_%u,weapon_name_%u,%u,%u", row, value % 20, (value >> 5) % 200, (value >> 13) % 100,
+					(value >> 20) & 1);
+
+				// some rows end early, like columns a table only fills now and then
+				if ((value >> 21) % 8)
+				{
+					data += utils::string::va(",the description of entry number %u", (value >> 24) % 50);
+				}
+
+				data += "\n";
+			}
+
+			// the last line has no line break
+			return data + "last,row";
+		}
+
+		// pooled tables have to read exactly like csv::parser did, prints how long both took and the bytes pooling saves
+		bool check_string_table_pooling()
+		{
+			constexpr auto row_count = 50000u;
+
+			const auto path = filesystem::get_temp_path() + "bench_string_table.csv";
+			if (!utils::io::write_file(path, make_test_table(row_count)))
+			{
+				ZONETOOL_ERROR("Failed to write \"%s\"", path.data());
+				return false;
+			}
+
+			const auto _0 = gsl::finally([&]
+			{
+				std::error_code ec;
+				std::filesystem::remove(path, ec);
+			});
+
+			const auto csv_start = std::chrono::high_resolution_clock::now();
+			csv::parser parser(path);
+			const auto builder_start = std::chrono::high_resolution_clock::now();
+			string_table_builder builder;
+			builder.parse_file(path);
+			const auto end = std::chrono::high_resolution_clock::now();
+
+			if (builder.get_num_rows() != parser.get_num_rows() || builder.get_max_columns() != parser.get_max_columns())
+			{
+				ZONETOOL_ERROR("%d rows and %d columns pooled, %d rows and %d columns from csv::parser", builder.get_num_rows(),
+					builder.get_max_columns(), parser.get_num_rows(), parser.get_max_columns());
+				return false;
+			}
+
+			const auto& strings = builder.get_strings();
+			auto** rows = parser.get_rows();
+			for (auto row = 0; row < parser.get_num_rows(); row++)
+			{
+				for (auto column = 0; column < parser.get_max_columns(); column++)
+				{
+					const auto* expected = column < rows[row]->num_fields ? rows[row]->fields[column] : "";
+					const auto& value = strings[builder.get_cell(row, column)];
+					if (value != expected)
+					{
+						ZONETOOL_ERROR("Cell %d,%d is \"%s\" pooled and \"%s\" from csv::parser", row, column, value.data(), expected);
+						return false;
+					}
+				}
+			}
+
+			const auto csv_duration = std::chrono::duration<double, std::milli>(builder_start - csv_start);
+			const auto builder_duration = std::chrono::duration<double, std::milli>(end - builder_start);
+			ZONETOOL_INFO("%d rows, %d columns: csv::parser took %.2f ms, pooled %.2f ms", builder.get_num_rows(), builder.get_max_columns(),
+				csv_duration.count(), builder_duration.count());
+			ZONETOOL_INFO("cell strings %zu bytes, pooled %zu bytes (%zu distinct values)", builder.get_cell_bytes(), builder.get_pooled_bytes(),
+				strings.size());
+
+			return true;
+		}
+
+		const registration string_table_pooling_check("stringtable", check_string_table_pooling);
+	}
+}
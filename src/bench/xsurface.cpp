@@ -0,0 +1,441 @@
+#include <std_include.hpp>
+#include "bench.hpp"
+
+#include "zonetool/h1/zonetool.hpp"
+
+namespace zonetool::bench
+{
+	namespace
+	{
+		// a piece of a test model before it is laid out into a surface
+		struct model_part
+		{
+			std::vector<float> positions;
+			std::vector<h1::Face> faces;
+
+			// bone followed by bone and weight pairs, like XBlendInfo. empty for rigid parts
+			std::vector<std::vector<h1::XBlendInfo>> blend;
+
+			// vertices split at the uv seam
+			std::vector<bool> seam;
+		};
+
+		// open tube around the z axis, the first column is repeated at the end like an uv seam. vertices are
+		// skinned to `bone_count` bones along the height, the rows between two bones are weighted to both
+		model_part make_limb(const std::uint32_t columns, const std::uint32_t rows, const float radius, const float height,
+			const std::uint16_t first_bone, const std::uint16_t bone_count)
+		{
+			constexpr auto pi = 3.14159265358979;
+
+			model_part part;
+			for (auto y = 0u; y <= rows; y++)
+			{
+				const auto v = static_cast<double>(y) / rows;
+
+				std::vector<h1::XBlendInfo> bones;
+				const auto bone_position = v * bone_count;
+				const auto bone = std::min(static_cast<std::uint16_t>(bone_position), static_cast<std::uint16_t>(bone_count - 1));
+				const auto blend = bone_position - bone;
+				bones.emplace_back(static_cast<h1::XBlendInfo>(first_bone + bone));
+
+				// the upper quarter of each bone blends into the next one
+				if (bone + 1 < bone_count && blend > 0.75)
+				{
+					bones.emplace_back(static_cast<h1::XBlendInfo>(first_bone + bone + 1));
+					bones.emplace_back(static_cast<h1::XBlendInfo>((blend - 0.75) * 4.0 * 0xFFFF));
+				}
+
+				for (auto x = 0u; x <= columns; x++)
+				{
+					const auto u = 2.0 * pi * x / columns;
+					const auto bulge = 1.0 + 0.2 * std::sin(v * pi * 3.0);
+
+					part.positions.insert(part.positions.end(), {static_cast<float>(radius * bulge * std::cos(u)),
+						static_cast<float>(radius * bulge * std::sin(u)), static_cast<float>(height * v)});
+					part.blend.emplace_back(bones);
+					part.seam.emplace_back(x == 0 || x == columns);
+				}
+			}
+
+			const auto get_vertex = [&](const std::uint32_t x, const std::uint32_t y)
+			{
+				return static_cast<unsigned short>(y * (columns + 1) + x);
+			};
+
+			for (auto y = 0u; y < rows; y++)
+			{
+				for (auto x = 0u; x < columns; x++)
+				{
+					part.faces.push_back({get_vertex(x, y), get_vertex(x + 1, y), get_vertex(x + 1, y + 1)});
+					part.faces.push_back({get_vertex(x, y), get_vertex(x + 1, y + 1), get_vertex(x, y + 1)});
+				}
+			}
+
+			return part;
+		}
+
+		void set_vertex(h1::GfxPackedVertex* vertex, const model_part& part, const std::size_t index)
+		{
+			*vertex = {};
+			std::memcpy(vertex->xyz, &part.positions[index * 3], sizeof(vertex->xyz));
+
+			// marks the seam vertices, they have to survive in every lod
+			vertex->texCoord.packed = part.seam[index] ? 1 : 0;
+		}
+
+		// skinned surface, the vertices are laid out by the number of bones they are weighted to
+		h1::XSurface make_skinned_surface(const model_part& part, zone_memory* mem)
+		{
+			const auto vertex_count = part.positions.size() / 3;
+
+			std::vector<std::uint16_t> order(vertex_count);
+			for (auto i = 0u; i < vertex_count; i++)
+			{
+				order[i] = static_cast<std::uint16_t>(i);
+			}
+
+			std::stable_sort(order.begin(), order.end(), [&](const std::uint16_t a, const std::uint16_t b)
+			{
+				return part.blend[a].size() < part.blend[b].size();
+			});
+
+			std::vector<unsigned short> index_of(vertex_count);
+			for (auto i = 0u; i < vertex_count; i++)
+			{
+				index_of[order[i]] = static_cast<unsigned short>(i);
+			}
+
+			h1::XSurface surf{};
+			surf.vertCount = static_cast<unsigned short>(vertex_count);
+			surf.triCount = static_cast<unsigned short>(part.faces.size());
+			surf.verts0.packedVerts0 = mem->allocate<h1::GfxPackedVertex>(vertex_count);
+			surf.triIndices = mem->allocate<h1::Face>(part.faces.size());
+
+			std::vector<h1::XBlendInfo> blend_verts;
+			for (auto i = 0u; i < vertex_count; i++)
+			{
+				const auto& bones = part.blend[order[i]];
+				set_vertex(&surf.verts0.packedVerts0[i], part, order[i]);
+				blend_verts.insert(blend_verts.end(), bones.begin(), bones.end());
+				surf.blendVertCounts[bones.size() / 2]++;
+			}
+
+			surf.blendVerts = mem->allocate<h1::XBlendInfo>(blend_verts.size());
+			std::memcpy(surf.blendVerts, blend_verts.data(), blend_verts.size() * sizeof(h1::XBlendInfo));
+
+			for (auto i = 0u; i < part.faces.size(); i++)
+			{
+				const auto& face = part.faces[i];
+				surf.triIndices[i] = {index_of[face.v1], index_of[face.v2], index_of[face.v3]};
+			}
+
+			return surf;
+		}
+
+		// static surface with one rigid vertex list per part
+		h1::XSurface make_rigid_surface(const std::vector<model_part>& parts, zone_memory* mem)
+		{
+			std::size_t vertex_count = 0;
+			std::size_t tri_count = 0;
+			for (const auto& part : parts)
+			{
+				vertex_count += part.positions.size() / 3;
+				tri_count += part.faces.size();
+			}
+
+			h1::XSurface surf{};
+			surf.vertCount = static_cast<unsigned short>(vertex_count);
+			surf.triCount = static_cast<unsigned short>(tri_count);
+			surf.rigidVertListCount = static_cast<unsigned char>(parts.size());
+			surf.verts0.packedVerts0 = mem->allocate<h1::GfxPackedVertex>(vertex_count);
+			surf.triIndices = mem->allocate<h1::Face>(tri_count);
+			surf.rigidVertLists = mem->allocate<h1::XRigidVertList>(parts.size());
+
+			unsigned short vertex_offset = 0;
+			unsigned short tri_offset = 0;
+			for (auto i = 0u; i < parts.size(); i++)
+			{
+				const auto& part = parts[i];
+				const auto part_vertex_count = static_cast<unsigned short>(part.positions.size() / 3);
+
+				auto& list = surf.rigidVertLists[i];
+				list.boneOffset = static_cast<unsigned short>(i * 64);
+				list.vertCount = part_vertex_count;
+				list.triOffset = tri_offset;
+				list.triCount = static_cast<unsigned short>(part.faces.size());
+
+				for (auto v = 0u; v < part_vertex_count; v++)
+				{
+					set_vertex(&surf.verts0.packedVerts0[vertex_offset + v], part, v);
+				}
+
+				for (const auto& face : part.faces)
+				{
+					surf.triIndices[tri_offset++] = {static_cast<unsigned short>(vertex_offset + face.v1),
+						static_cast<unsigned short>(vertex_offset + face.v2), static_cast<unsigned short>(vertex_offset + face.v3)};
+				}
+
+				vertex_offset += part_vertex_count;
+			}
+
+			return surf;
+		}
+
+		h1::XModelSurfs* make_model(const char* name, const std::vector<h1::XSurface>& surfs, zone_memory* mem)
+		{
+			auto* asset = mem->allocate<h1::XModelSurfs>();
+			asset->name = mem->duplicate_string(name);
+			asset->numsurfs = static_cast<unsigned short>(surfs.size());
+			asset->surfs = mem->allocate<h1::XSurface>(surfs.size());
+			std::memcpy(asset->surfs, surfs.data(), surfs.size() * sizeof(h1::XSurface));
+			return asset;
+		}
+
+		std::size_t get_seam_vertex_count(const h1::XSurface* surf)
+		{
+			std::size_t count = 0;
+			for (auto i = 0u; i < surf->vertCount; i++)
+			{
+				count += surf->verts0.packedVerts0[i].texCoord.packed;
+			}
+
+			return count;
+		}
+
+		// offset of the blend entry of every vertex in blendVerts, followed by the end of the entries
+		std::vector<std::size_t> get_blend_offsets(const h1::XSurface* surf)
+		{
+			std::vector<std::size_t> offsets;
+			std::size_t offset = 0;
+			for (auto i = 0u; i < 8; i++)
+			{
+				for (auto o = 0; o < surf->blendVertCounts[i]; o++)
+				{
+					offsets.emplace_back(offset);
+					offset += 1 + i * 2;
+				}
+			}
+
+			offsets.emplace_back(offset);
+			return offsets;
+		}
+
+		bool check_surface(const char* name, const h1::XSurface* src, const h1::XSurface* lod)
+		{
+			for (auto i = 0u; i < lod->triCount; i++)
+			{
+				const auto& face = lod->triIndices[i];
+				if (face.v1 >= lod->vertCount || face.v2 >= lod->vertCount || face.v3 >= lod->vertCount)
+				{
+					ZONETOOL_ERROR("%s: triangle %u points past the %u vertices", name, i, lod->vertCount);
+					return false;
+				}
+
+				if (face.v1 == face.v2 || face.v2 == face.v3 || face.v1 == face.v3)
+				{
+					ZONETOOL_ERROR("%s: triangle %u is degenerate", name, i);
+					return false;
+				}
+			}
+
+			if (get_seam_vertex_count(lod) != get_seam_vertex_count(src))
+			{
+				ZONETOOL_ERROR("%s: %zu of %zu seam vertices are left", name, get_seam_vertex_count(lod), get_seam_vertex_count(src));
+				return false;
+			}
+
+			if (src->blendVerts)
+			{
+				const auto src_offsets = get_blend_offsets(src);
+				const auto lod_offsets = get_blend_offsets(lod);
+				if (lod_offsets.size() != lod->vertCount + 1u)
+				{
+					ZONETOOL_ERROR("%s: blend groups hold %zu vertices instead of %u", name, lod_offsets.size() - 1, lod->vertCount);
+					return false;
+				}
+
+				// kept vertices stay in order, so every vertex has to find itself and its weights further along the source
+				auto src_vertex = 0u;
+				for (auto i = 0u; i < lod->vertCount; i++)
+				{
+					while (src_vertex < src->vertCount && std::memcmp(&src->verts0.packedVerts0[src_vertex],
+						&lod->verts0.packedVerts0[i], sizeof(h1::GfxPackedVertex)))
+					{
+						src_vertex++;
+					}
+
+					if (src_vertex == src->vertCount)
+					{
+						ZONETOOL_ERROR("%s: vertex %u is out of order", name, i);
+						return false;
+					}
+
+					const auto size = src_offsets[src_vertex + 1] - src_offsets[src_vertex];
+					if (std::memcmp(&src->blendVerts[src_offsets[src_vertex]], &lod->blendVerts[lod_offsets[i]], size * sizeof(h1::XBlendInfo)))
+					{
+						ZONETOOL_ERROR("%s: vertex %u lost its skin weights", name, i);
+						return false;
+					}
+
+					src_vertex++;
+				}
+			}
+
+			// triangles of a rigid list only use the vertices of that list
+			std::uint32_t vertex_offset = 0;
+			std::uint32_t tri_offset = 0;
+			for (unsigned char i = 0; lod->rigidVertLists && i < lod->rigidVertListCount; i++)
+			{
+				const auto& list = lod->rigidVertLists[i];
+				if (list.triOffset != tri_offset || list.triOffset + list.triCount > lod->triCount)
+				{
+					ZONETOOL_ERROR("%s: rigid list %u covers triangles %u to %u", name, i, list.triOffset, list.triOffset + list.triCount);
+					return false;
+				}
+
+				for (auto t = list.triOffset; t < list.triOffset + list.triCount; t++)
+				{
+					const auto& face = lod->triIndices[t];
+					for (const auto v : {face.v1, face.v2, face.v3})
+					{
+						if (v < vertex_offset || v >= vertex_offset + list.vertCount)
+						{
+							ZONETOOL_ERROR("%s: triangle %u of rigid list %u uses vertex %u of another list", name, t, i, v);
+							return false;
+						}
+					}
+				}
+
+				vertex_offset += list.vertCount;
+				tri_offset += list.triCount;
+			}
+
+			return true;
+		}
+
+		std::size_t get_tri_count(const h1::XModelSurfs* asset)
+		{
+			std::size_t count = 0;
+			for (auto i = 0u; i < asset->numsurfs; i++)
+			{
+				count += asset->surfs[i].triCount;
+			}
+
+			return count;
+		}
+
+		bool check_lods_of(const h1::XModelSurfs* model, zone_memory* mem)
+		{
+			const auto tri_count = get_tri_count(model);
+
+			for (const auto ratio : {0.5f, 0.25f, 0.125f})
+			{
+				const auto start = std::chrono::high_resolution_clock::now();
+				const auto* lod = h1::xsurface::generate_lod(model, ratio, utils::string::va("%s_lod", model->name), mem);
+				const auto duration = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start);
+
+				for (auto i = 0u; i < model->numsurfs; i++)
+				{
+					if (!check_surface(utils::string::va("%s surface %u at %g", model->name, i, ratio), &model->surfs[i], &lod->surfs[i]))
+					{
+						return false;
+					}
+				}
+
+				// seams, bone influences and rigid lists keep some vertices in place, so it may stop short of the target
+				const auto target = static_cast<std::size_t>(tri_count * ratio);
+				const auto lod_tri_count = get_tri_count(lod);
+				if (lod_tri_count > target + tri_count / 10)
+				{
+					ZONETOOL_ERROR("%s at %g: %zu triangles left of %zu, expected about %zu", model->name, ratio, lod_tri_count, tri_count, target);
+					return false;
+				}
+
+				ZONETOOL_INFO("%s at %g: %u surfaces, %zu triangles reduced to %zu (target %zu) in %.2f ms", model->name, ratio,
+					model->numsurfs, tri_count, lod_tri_count, target, duration.count());
+			}
+
+			return true;
+		}
+
+		// generated lods of whole models: skin weights have to follow their vertices, seams have to stay closed and
+		// rigid lists have to keep their triangles within their own vertices
+		bool check_model_lods()
+		{
+			zone_memory mem(0x4000000);
+
+			// body, two arms and a head, 2 to 4 bones each
+			const auto* character = make_model("character", {
+				make_skinned_surface(make_limb(96, 96, 20.0f, 120.0f, 0, 4), &mem),
+				make_skinned_surface(make_limb(48, 64, 6.0f, 70.0f, 4, 3), &mem),
+				make_skinned_surface(make_limb(48, 64, 6.0f, 70.0f, 7, 3), &mem),
+				make_skinned_surface(make_limb(64, 48, 12.0f, 25.0f, 10, 2), &mem),
+			}, &mem);
+
+			// barrel with a lid and a handle
+			const auto* prop = make_model("prop", {
+				make_rigid_surface({make_limb(128, 96, 30.0f, 80.0f, 0, 1), make_limb(128, 16, 30.0f, 6.0f, 0, 1)}, &mem),
+				make_rigid_surface({make_limb(32, 64, 3.0f, 40.0f, 0, 1)}, &mem),
+			}, &mem);
+
+			return check_lods_of(character, &mem) && check_lods_of(prop, &mem);
+		}
+
+		bool is_triangle_range_equal(const h1::XSurface* surf, const std::vector<h1::Face>& faces, const std::size_t begin, const std::size_t count)
+		{
+			return !std::memcmp(surf->triIndices + begin, faces.data() + begin, count * sizeof(h1::Face));
+		}
+
+		// -buildcolltrees keeps trees that still cover their triangles and rebuilds the ones that don't. the vertex cache pass
+		// keeps built trees valid and leaves lists with trees from anywhere else in their order
+		bool check_surface_trees()
+		{
+			zone_memory mem(0x4000000);
+
+			auto* prop = make_model("prop", {
+				make_rigid_surface({make_limb(64, 48, 30.0f, 80.0f, 0, 1), make_limb(32, 16, 3.0f, 40.0f, 0, 1)}, &mem),
+			}, &mem);
+
+			auto* surf = &prop->surfs[0];
+			const auto& list = surf->rigidVertLists[0];
+
+			const auto built = h1::xsurface::build_collision_trees(prop, &mem);
+			if (built.size() != surf->rigidVertListCount)
+			{
+				ZONETOOL_ERROR("%zu collision trees were built for %u rigid lists", built.size(), surf->rigidVertListCount);
+				return false;
+			}
+
+			h1::xsurface::optimize(prop, built);
+			if (!h1::xsurface::build_collision_trees(prop, &mem).empty())
+			{
+				ZONETOOL_ERROR("The vertex cache pass moved triangles out of the leafs of a built tree");
+				return false;
+			}
+
+			// the same trees, but not known to be built here
+			const std::vector<h1::Face> faces(surf->triIndices, surf->triIndices + surf->triCount);
+			h1::xsurface::optimize(prop);
+			if (!is_triangle_range_equal(surf, faces, 0, surf->triCount))
+			{
+				ZONETOOL_ERROR("The vertex cache pass reordered the triangles of a list with a tree it didn't build");
+				return false;
+			}
+
+			// triangles that moved to other leafs, like after a conversion
+			std::reverse(surf->triIndices + list.triOffset, surf->triIndices + list.triOffset + list.triCount);
+			const auto* stale_tree = list.collisionTree;
+			const auto rebuilt = h1::xsurface::build_collision_trees(prop, &mem);
+			if (rebuilt.size() != 1 || list.collisionTree == stale_tree || !rebuilt.contains(list.collisionTree))
+			{
+				ZONETOOL_ERROR("%zu collision trees were rebuilt after the triangles of one list moved", rebuilt.size());
+				return false;
+			}
+
+			return true;
+		}
+
+		const registration model_lods_check("modellods", check_model_lods);
+		const registration surface_trees_check("surfacetrees", check_surface_trees);
+	}
+}
@@ -1,6 +1,10 @@
 #pragma once
 
+#include <algorithm>
+#include <atomic>
 #include <mutex>
+#include <thread>
+#include <vector>
 
 namespace utils::concurrency
 {
@@ -43,4 +47,47 @@ namespace utils::concurrency
 		mutable MutexType mutex_{};
 		T object_{};
 	};
+	// calls func(i) for every i in [0, count) on up to one thread per core. indices are handed out `grain` at
+	// a time and a thread is only started for a whole grain of work, so small inputs stay on the caller
+	template <typename F>
+	void parallel_for(const std::size_t count, const std::size_t grain, F&& func)
+	{
+		const auto chunk = std::max<std::size_t>(grain, 1);
+		const auto thread_count = std::min<std::size_t>(std::max(1u, std::thread::hardware_concurrency()), count / chunk);
+		if (thread_count <= 1)
+		{
+			for (std::size_t i = 0; i < count; i++)
+			{
+				func(i);
+			}
+			return;
+		}
+
+		std::atomic_size_t next = 0;
+		const auto worker = [&]
+		{
+			for (auto begin = next.fetch_add(chunk); begin < count; begin = next.fetch_add(chunk))
+			{
+				const auto end = std::min(begin + chunk, count);
+				for (auto i = begin; i < end; i++)
+				{
+					func(i);
+				}
+			}
+		};
+
+		std::vector<std::thread> threads;
+		threads.reserve(thread_count - 1);
+		for (std::size_t i = 1; i < thread_count; i++)
+		{
+			threads.emplace_back(worker);
+		}
+
+		worker();
+
+		for (auto& thread : threads)
+		{
+			thread.join();
+		}
+	}
 }
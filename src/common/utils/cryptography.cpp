@@ -631,6 +631,22 @@ namespace utils::cryptography
 		return hash;
 	}
 
+	std::uint64_t fnv1a::compute(const std::string& data, const std::uint64_t hash)
+	{
+		return compute(data.data(), data.size(), hash);
+	}
+
+	std::uint64_t fnv1a::compute(const void* data, const size_t len, std::uint64_t hash)
+	{
+		const auto* bytes = static_cast<const std::uint8_t*>(data);
+		for (size_t i = 0; i < len; ++i)
+		{
+			hash ^= bytes[i];
+			hash *= 0x100000001B3;
+		}
+		return hash;
+	}
+
 	uint32_t random::get_integer()
 	{
 		uint32_t result;
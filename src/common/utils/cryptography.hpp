@@ -114,6 +114,14 @@ namespace utils::cryptography
 		unsigned int compute(const char* key, size_t len);
 	};
 
+	namespace fnv1a
+	{
+		constexpr std::uint64_t offset_basis = 0xCBF29CE484222325;
+
+		std::uint64_t compute(const std::string& data, std::uint64_t hash = offset_basis);
+		std::uint64_t compute(const void* data, size_t len, std::uint64_t hash = offset_basis);
+	}
+
 	namespace random
 	{
 		uint32_t get_integer();
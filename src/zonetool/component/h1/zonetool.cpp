@@ -6,6 +6,7 @@
 #include "dvars.hpp"
 
 #include "zonetool/h1/zonetool.hpp"
+#include "zonetool/utils/archive_manifest.hpp"
 
 #include <utils/flags.hpp>
 #include <fstream>
@@ -95,12 +96,12 @@ namespace zonetool::h1
 			ZONETOOL_INFO("batchdumpzonewalk complete (%zu zones)", zones.size());
 		});
 
-		// batchdumpzonewalkarchive <folder> [output_folder]
+		// batchdumpzonewalkarchive <folder> [output_folder] [chunk_kb] [force]
 		::h1::command::add("batchdumpzonewalkarchive", [](const ::h1::command::params& params)
 		{
-			if (params.size() < 2 || params.size() > 3)
+			if (params.size() < 2 || params.size() > 5)
 			{
-				ZONETOOL_ERROR("usage: batchdumpzonewalkarchive <folder> [output_folder]");
+				ZONETOOL_ERROR("usage: batchdumpzonewalkarchive <folder> [output_folder] [chunk_kb] [force]");
 				return;
 			}
 			namespace fs = std::filesystem;
@@ -111,11 +112,24 @@ namespace zonetool::h1
 				return;
 			}
 
+			archive_manifest::settings settings{};
+
 			// Output folder for archive chunks (default: archive_chunks)
-			fs::path output_folder = params.size() == 3 ? fs::path(params.get(2)) : fs::path("archive_chunks");
-			if (!fs::exists(output_folder))
+			settings.output_folder = params.size() >= 3 ? fs::path(params.get(2)) : fs::path("archive_chunks");
+			if (!fs::exists(settings.output_folder))
+			{
+				fs::create_directories(settings.output_folder);
+			}
+
+			if (params.size() >= 4)
+			{
+				settings.chunk_budget = std::max(1ull, std::strtoull(params.get(3), nullptr, 10)) * 1024;
+			}
+
+			if (params.size() >= 5)
 			{
-				fs::create_directories(output_folder);
+				const std::string force = params.get(4);
+				settings.force = force == "1" || force == "true";
 			}
 
 			std::vector<fs::path> zones;
@@ -123,6 +137,13 @@ namespace zonetool::h1
 			{
 				if (e.is_regular_file() && e.path().extension() == ".ff")
 				{
+					const auto zone_name = e.path().stem().string();
+					if (zone_name == "hmw_launcher" || zone_name == "hmw_launcher_mp" || zone_name == "patch_common_mp")
+					{
+						ZONETOOL_INFO("Skipping launcher zone \"%s\" in archive listing", zone_name.c_str());
+						continue;
+					}
+
 					zones.emplace_back(e.path());
 				}
 			}
@@ -130,113 +151,46 @@ namespace zonetool::h1
 			// Sort zones alphabetically for consistent chunking
 			std::sort(zones.begin(), zones.end());
 
-			const size_t CHUNK_SIZE = 10; // Number of zones per chunk file
-			size_t total_chunks = (zones.size() + CHUNK_SIZE - 1) / CHUNK_SIZE;
+			ZONETOOL_INFO("Generating archive listing for %zu zones", zones.size());
 
-			ZONETOOL_INFO("Generating archive listing for %zu zones (%zu chunks)", zones.size(), total_chunks);
-
-			for (size_t chunk_idx = 0; chunk_idx < total_chunks; chunk_idx++)
+			const auto stats = archive_manifest::generate(zones, settings, [](const fs::path& zone_path)
 			{
-				size_t start_idx = chunk_idx * CHUNK_SIZE;
-				size_t end_idx = std::min(start_idx + CHUNK_SIZE, zones.size());
+				// Load zone
+				::h1::command::execute("loadzone " + zone_path.stem().string(), true);
 
-				std::string json_content = "{\n  \"zones\": [\n";
+				// Wait for zone to load
+				Sleep(100);
 
-				for (size_t i = start_idx; i < end_idx; i++)
-				{
-					auto& zone_path = zones[i];
-					auto zone_name = zone_path.stem().string();
+				// Collect all assets
+				std::vector<archive_manifest::asset_entry> assets;
 
-					if (zone_name == "hmw_launcher" || zone_name == "hmw_launcher_mp" || zone_name == "patch_common_mp")
+				for (int asset_type = 0; asset_type < ASSET_TYPE_COUNT; asset_type++)
+				{
+					const auto type_name = zonetool::h1::type_to_string(XAssetType(asset_type));
+					zonetool::h1::DB_EnumXAssets(XAssetType(asset_type), [&](XAssetHeader header)
 					{
-						ZONETOOL_INFO("Skipping launcher zone \"%s\" in archive listing", zone_name.c_str());
-						continue;
-					}
+						XAsset asset;
+						asset.type = XAssetType(asset_type);
+						asset.header = header;
 
-					ZONETOOL_INFO("Archiving zone %zu/%zu: \"%s\"", i + 1, zones.size(), zone_name.c_str());
-
-					// Load zone
-					::h1::command::execute("loadzone " + zone_name, true);
-					
-					// Wait for zone to load
-					Sleep(100);
-
-					// Collect all assets
-					std::vector<std::pair<std::string, std::string>> assets; // type, name
-
-					for (int asset_type = 0; asset_type < ASSET_TYPE_COUNT; asset_type++)
-					{
-						zonetool::h1::DB_EnumXAssets(XAssetType(asset_type), [&](XAssetHeader header)
+						const char* asset_name = zonetool::h1::get_asset_name(&asset);
+						if (asset_name && asset_name[0] && asset_name[0] != ',')
 						{
-							XAsset asset;
-							asset.type = XAssetType(asset_type);
-							asset.header = header;
-							
-							const char* asset_name = zonetool::h1::get_asset_name(&asset);
-							if (asset_name && asset_name[0] && asset_name[0] != ',')
-							{
-								assets.emplace_back(zonetool::h1::type_to_string(XAssetType(asset_type)), asset_name);
-							}
-						}, true);
-					}
-
-					// Generate JSON for this zone
-					json_content += "    {\n";
-					json_content += "      \"name\": \"" + zone_name + "\",\n";
-					json_content += "      \"children\": [\n";
-
-					for (size_t j = 0; j < assets.size(); j++)
-					{
-						auto& [type, name] = assets[j];
-						// Escape special characters in JSON
-						std::string escaped_name = name;
-						size_t pos = 0;
-						while ((pos = escaped_name.find("\\", pos)) != std::string::npos) {
-							escaped_name.replace(pos, 1, "\\\\");
-							pos += 2;
+							assets.emplace_back(archive_manifest::asset_entry{type_name, asset_name});
 						}
-						pos = 0;
-						while ((pos = escaped_name.find("\"", pos)) != std::string::npos) {
-							escaped_name.replace(pos, 1, "\\\"");
-							pos += 2;
-						}
-
-						std::string path = zone_name + "/" + type + "/" + escaped_name;
-						json_content += "        {\"name\": \"" + escaped_name + "\", \"path\": \"" + path + "\"}";
-						if (j < assets.size() - 1) json_content += ",";
-						json_content += "\n";
-					}
-
-					json_content += "      ]\n";
-					json_content += "    }";
-					if (i < end_idx - 1) json_content += ",";
-					json_content += "\n";
-
-					// Unload zone
-					::h1::command::execute("unloadzones", true);
+					}, true);
 				}
 
-				json_content += "  ]\n}\n";
-
-				// Write chunk file
-				char chunk_filename[32];
-				snprintf(chunk_filename, sizeof(chunk_filename), "file_structure_%03zu.json", chunk_idx + 1);
-				fs::path chunk_path = output_folder / chunk_filename;
+				// Unload zone
+				::h1::command::execute("unloadzones", true);
 
-				std::ofstream chunk_file(chunk_path);
-				if (chunk_file.is_open())
-				{
-					chunk_file << json_content;
-					chunk_file.close();
-					ZONETOOL_INFO("Written chunk %zu/%zu: %s", chunk_idx + 1, total_chunks, chunk_filename);
-				}
-				else
-				{
-					ZONETOOL_ERROR("Failed to write chunk file: %s", chunk_path.string().c_str());
-				}
-			}
+				return assets;
+			});
 
-			ZONETOOL_INFO("Archive listing complete. Generated %zu chunk files in '%s'", total_chunks, output_folder.string().c_str());
+			ZONETOOL_INFO("Archive listing complete. %zu zones enumerated, %zu unchanged, %zu removed",
+				stats.zones_enumerated, stats.zones_reused, stats.zones_removed);
+			ZONETOOL_INFO("Wrote %zu/%zu chunk files in '%s' (%zu stale chunks removed)",
+				stats.chunks_written, stats.chunks_total, settings.output_folder.string().c_str(), stats.chunks_removed);
 			ZONETOOL_INFO("");
 		});
 	}
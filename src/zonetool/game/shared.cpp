@@ -1,5 +1,7 @@
 #include <std_include.hpp>
 
+#include <intrin.h>
+
 #include "loader/component_loader.hpp"
 
 #include "shared.hpp"
@@ -299,8 +301,37 @@ namespace zonetool
 		}
 	}
 
+	thread_local unsigned int dump_stream_file_index = 0;
+
 	namespace QuatInt16
 	{
+		namespace
+		{
+			bool has_f16c_support()
+			{
+				int cpu_id[4];
+				__cpuid(cpu_id, 0);
+
+				if (cpu_id[0] < 1)
+				{
+					return false;
+				}
+
+				__cpuidex(cpu_id, 1, 0);
+
+				// f16c is vex encoded, so it also needs avx and an os that saves the ymm state (osxsave, xcr0 bits 1 and 2)
+				constexpr auto osxsave = 1 << 27;
+				constexpr auto avx = 1 << 28;
+				constexpr auto f16c = 1 << 29;
+				if ((cpu_id[2] & (osxsave | avx | f16c)) != (osxsave | avx | f16c))
+				{
+					return false;
+				}
+
+				return (_xgetbv(0) & 0x6) == 0x6;
+			}
+		}
+
 		short ToInt16(const float quat)
 		{
 			return static_cast<short>(quat * INT16_MAX);
@@ -310,6 +341,30 @@ namespace zonetool
 		{
 			return static_cast<float>(quat) / static_cast<float>(INT16_MAX);
 		}
+
+		void HalfToInt16(short* dst, const unsigned short* src, const std::size_t count)
+		{
+			static const auto f16c = has_f16c_support();
+
+			std::size_t i = 0;
+			if (f16c)
+			{
+				// same truncation as ToInt16, values of unit quaternions never reach the saturation of the pack
+				const auto scale = _mm_set1_ps(static_cast<float>(INT16_MAX));
+				for (; i + 8 <= count; i += 8)
+				{
+					const auto halves = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+					const auto lo = _mm_cvttps_epi32(_mm_mul_ps(_mm_cvtph_ps(halves), scale));
+					const auto hi = _mm_cvttps_epi32(_mm_mul_ps(_mm_cvtph_ps(_mm_srli_si128(halves, 8)), scale));
+					_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_packs_epi32(lo, hi));
+				}
+			}
+
+			for (; i < count; i++)
+			{
+				dst[i] = ToInt16(half_float::half_to_float(src[i]));
+			}
+		}
 	}
 
 	namespace half_float
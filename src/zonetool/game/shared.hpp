@@ -147,6 +147,9 @@ namespace zonetool
 	{
 		short ToInt16(const float quat);
 		float ToFloat(const short quat);
+
+		// ToInt16 of `count` half floats, uses F16C when the cpu supports it
+		void HalfToInt16(short* dst, const unsigned short* src, std::size_t count);
 	}
 
 	namespace half_float
@@ -198,6 +201,10 @@ namespace zonetool
 	WEAK symbol<XStreamFile> stream_files;
 	WEAK symbol<unsigned int> stream_file_index;
 
+	// stream_file_index of the image a dump task is dumping. dump tasks run behind loading, by then
+	// stream_file_index has moved on, so it is captured when the image is linked
+	extern thread_local unsigned int dump_stream_file_index;
+
 	template <typename T>
 	T db_find_x_asset_header(int type, const char* name, int create_default)
 	{
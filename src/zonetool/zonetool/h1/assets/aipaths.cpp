@@ -1,6 +1,8 @@
 #include "std_include.hpp"
 #include "aipaths.hpp"
 
+#include <utils/concurrency.hpp>
+
 namespace zonetool::h1
 {
 	void path_data::add_script_string(scr_string_t* ptr, const char* str)
@@ -239,6 +241,672 @@ namespace zonetool::h1
 	}
 
 
+	namespace path_generator
+	{
+		constexpr auto contents_solid = 0x1;
+		constexpr auto contents_ai_nosight = 0x1000;
+		constexpr auto contents_playerclip = 0x10000;
+		constexpr auto contents_monsterclip = 0x20000;
+
+		constexpr auto sight_mask = contents_solid | contents_ai_nosight;
+		constexpr auto walk_mask = contents_solid | contents_playerclip | contents_monsterclip;
+
+		constexpr auto eye_height = 60.0f;
+		constexpr auto step_height = 18.0f;
+		constexpr auto actor_radius = 15.0f;
+		constexpr auto actor_height = 70.0f;
+
+		constexpr auto max_link_distance = 256.0f;
+		constexpr auto max_link_height = 64.0f;
+		constexpr auto ground_sample_spacing = 24.0f;
+		constexpr auto max_ground_drop = 40.0f;
+		constexpr auto max_generated_links = 16u;
+
+		constexpr auto bvh_leaf_size = 4u;
+
+		std::atomic_bool generate_enabled = false;
+
+		struct point3
+		{
+			float x, y, z;
+
+			point3 operator+(const point3& other) const { return {x + other.x, y + other.y, z + other.z}; }
+			point3 operator-(const point3& other) const { return {x - other.x, y - other.y, z - other.z}; }
+			point3 operator*(const float scale) const { return {x * scale, y * scale, z * scale}; }
+			float operator[](const int axis) const { return axis == 0 ? x : axis == 1 ? y : z; }
+		};
+
+		float dot(const point3& a, const point3& b)
+		{
+			return a.x * b.x + a.y * b.y + a.z * b.z;
+		}
+
+		point3 cross(const point3& a, const point3& b)
+		{
+			return {a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x};
+		}
+
+		point3 to_point(const float* v)
+		{
+			return {v[0], v[1], v[2]};
+		}
+
+		struct primitive
+		{
+			float mins[3];
+			float maxs[3];
+			int contents;
+			std::uint32_t index;
+			bool is_triangle;
+		};
+
+		struct bvh_node
+		{
+			float mins[3];
+			float maxs[3];
+			std::uint32_t first; // first primitive for leaves, right child otherwise (left child follows the node)
+			std::uint32_t count; // 0 for inner nodes
+		};
+
+		// ray queries against the world brushes and patch triangles of a clipmap
+		class collision_world
+		{
+		public:
+			explicit collision_world(const clipMap_t* clip_map)
+				: info_(&clip_map->info)
+			{
+				this->add_brushes();
+				this->add_triangles();
+
+				if (!this->primitives_.empty())
+				{
+					this->nodes_.reserve(this->primitives_.size() * 2 / bvh_leaf_size + 1);
+					this->build(0, static_cast<std::uint32_t>(this->primitives_.size()));
+				}
+			}
+
+			std::size_t primitive_count() const
+			{
+				return this->primitives_.size();
+			}
+
+			// true if the segment touches anything with the given contents
+			bool trace(const point3& start, const point3& end, const int mask) const
+			{
+				if (this->nodes_.empty())
+				{
+					return false;
+				}
+
+				const auto dir = end - start;
+				const point3 inv_dir = {1.0f / dir.x, 1.0f / dir.y, 1.0f / dir.z};
+
+				std::uint32_t stack[64];
+				auto stack_size = 0u;
+				stack[stack_size++] = 0;
+
+				while (stack_size)
+				{
+					const auto& node = this->nodes_[stack[--stack_size]];
+					if (!intersects_bounds(start, inv_dir, node.mins, node.maxs))
+					{
+						continue;
+					}
+
+					if (node.count)
+					{
+						for (auto i = node.first; i < node.first + node.count; i++)
+						{
+							const auto& prim = this->primitives_[i];
+							if ((prim.contents & mask) && this->trace_primitive(prim, start, end))
+							{
+								return true;
+							}
+						}
+
+						continue;
+					}
+
+					const auto index = static_cast<std::uint32_t>(&node - this->nodes_.data());
+					stack[stack_size++] = node.first;
+					stack[stack_size++] = index + 1;
+				}
+
+				return false;
+			}
+
+		private:
+			const ClipInfo* info_;
+			std::vector<primitive> primitives_;
+			std::vector<bvh_node> nodes_;
+			std::vector<int> triangle_contents_;
+
+			void add_brushes()
+			{
+				const auto& data = this->info_->bCollisionData;
+				if (!data.brushes || !data.brushBounds)
+				{
+					return;
+				}
+
+				for (auto i = 0u; i < data.numBrushes; i++)
+				{
+					const auto& bounds = data.brushBounds[i];
+
+					primitive prim{};
+					for (auto axis = 0; axis < 3; axis++)
+					{
+						prim.mins[axis] = bounds.midPoint[axis] - bounds.halfSize[axis];
+						prim.maxs[axis] = bounds.midPoint[axis] + bounds.halfSize[axis];
+					}
+
+					prim.contents = data.brushContents ? data.brushContents[i] : contents_solid;
+					prim.index = i;
+					this->primitives_.emplace_back(prim);
+				}
+			}
+
+			void add_triangles()
+			{
+				const auto& data = this->info_->pCollisionData;
+				const auto& tree = this->info_->pCollisionTree;
+				if (!data.verts || !data.triIndices || !data.partitions || !tree.aabbTrees)
+				{
+					return;
+				}
+
+				// partition contents come from the material of the aabb tree leaf referencing them
+				for (auto i = 0; i < tree.aabbTreeCount; i++)
+				{
+					const auto& node = tree.aabbTrees[i];
+					if (node.childCount || node.u.partitionIndex < 0 || node.u.partitionIndex >= data.partitionCount)
+					{
+						continue;
+					}
+
+					const auto contents = node.materialIndex < this->info_->numMaterials
+						? this->info_->materials[node.materialIndex].contents
+						: contents_solid;
+
+					const auto& partition = data.partitions[node.u.partitionIndex];
+					for (auto tri = partition.firstTri; tri < partition.firstTri + partition.triCount; tri++)
+					{
+						if (tri < 0 || tri >= data.triCount)
+						{
+							continue;
+						}
+
+						primitive prim{};
+						prim.contents = contents;
+						prim.index = static_cast<std::uint32_t>(tri);
+						prim.is_triangle = true;
+
+						for (auto axis = 0; axis < 3; axis++)
+						{
+							prim.mins[axis] = std::numeric_limits<float>::max();
+							prim.maxs[axis] = -std::numeric_limits<float>::max();
+						}
+
+						for (auto c = 0; c < 3; c++)
+						{
+							const auto* vert = data.verts[data.triIndices[tri * 3 + c]];
+							for (auto axis = 0; axis < 3; axis++)
+							{
+								prim.mins[axis] = std::min(prim.mins[axis], vert[axis]);
+								prim.maxs[axis] = std::max(prim.maxs[axis], vert[axis]);
+							}
+						}
+
+						this->primitives_.emplace_back(prim);
+					}
+				}
+			}
+
+			// median split on the longest axis of the primitive centers
+			void build(const std::uint32_t first, const std::uint32_t count)
+			{
+				const auto index = static_cast<std::uint32_t>(this->nodes_.size());
+				this->nodes_.emplace_back();
+
+				bvh_node node{};
+				float center_mins[3]{};
+				float center_maxs[3]{};
+				for (auto axis = 0; axis < 3; axis++)
+				{
+					node.mins[axis] = center_mins[axis] = std::numeric_limits<float>::max();
+					node.maxs[axis] = center_maxs[axis] = -std::numeric_limits<float>::max();
+				}
+
+				for (auto i = first; i < first + count; i++)
+				{
+					const auto& prim = this->primitives_[i];
+					for (auto axis = 0; axis < 3; axis++)
+					{
+						const auto center = (prim.mins[axis] + prim.maxs[axis]) * 0.5f;
+						node.mins[axis] = std::min(node.mins[axis], prim.mins[axis]);
+						node.maxs[axis] = std::max(node.maxs[axis], prim.maxs[axis]);
+						center_mins[axis] = std::min(center_mins[axis], center);
+						center_maxs[axis] = std::max(center_maxs[axis], center);
+					}
+				}
+
+				auto split_axis = 0;
+				for (auto axis = 1; axis < 3; axis++)
+				{
+					if (center_maxs[axis] - center_mins[axis] > center_maxs[split_axis] - center_mins[split_axis])
+					{
+						split_axis = axis;
+					}
+				}
+
+				if (count <= bvh_leaf_size || center_maxs[split_axis] <= center_mins[split_axis])
+				{
+					node.first = first;
+					node.count = count;
+					this->nodes_[index] = node;
+					return;
+				}
+
+				const auto half = count / 2;
+				const auto begin = this->primitives_.begin() + first;
+				std::nth_element(begin, begin + half, begin + count, [&](const primitive& a, const primitive& b)
+				{
+					return a.mins[split_axis] + a.maxs[split_axis] < b.mins[split_axis] + b.maxs[split_axis];
+				});
+
+				this->build(first, half);
+				node.first = static_cast<std::uint32_t>(this->nodes_.size());
+				node.count = 0;
+				this->build(first + half, count - half);
+
+				this->nodes_[index] = node;
+			}
+
+			static bool intersects_bounds(const point3& start, const point3& inv_dir, const float* mins, const float* maxs)
+			{
+				auto t_min = 0.0f;
+				auto t_max = 1.0f;
+
+				for (auto axis = 0; axis < 3; axis++)
+				{
+					auto t0 = (mins[axis] - start[axis]) * inv_dir[axis];
+					auto t1 = (maxs[axis] - start[axis]) * inv_dir[axis];
+					if (t0 > t1)
+					{
+						std::swap(t0, t1);
+					}
+
+					// nan when the segment runs inside a slab boundary, treat it as inside
+					t_min = t0 > t_min ? t0 : t_min;
+					t_max = t1 < t_max ? t1 : t_max;
+					if (t_min > t_max)
+					{
+						return false;
+					}
+				}
+
+				return true;
+			}
+
+			// clips the segment against one plane of a convex brush, false once nothing is left
+			static bool clip_plane(const point3& normal, const float dist, const point3& start, const point3& end,
+				float& t_enter, float& t_leave)
+			{
+				const auto d0 = dot(normal, start) - dist;
+				const auto d1 = dot(normal, end) - dist;
+				if (d0 > 0.0f && d1 > 0.0f)
+				{
+					return false;
+				}
+
+				if (d0 <= 0.0f && d1 <= 0.0f)
+				{
+					return true;
+				}
+
+				const auto t = d0 / (d0 - d1);
+				if (d0 > 0.0f)
+				{
+					t_enter = std::max(t_enter, t);
+				}
+				else
+				{
+					t_leave = std::min(t_leave, t);
+				}
+
+				return t_enter <= t_leave;
+			}
+
+			bool trace_brush(const std::uint32_t index, const point3& start, const point3& end) const
+			{
+				const auto& data = this->info_->bCollisionData;
+				const auto& brush = data.brushes[index];
+				const auto& bounds = data.brushBounds[index];
+
+				auto t_enter = 0.0f;
+				auto t_leave = 1.0f;
+
+				// the axial sides are implied by the bounds, the side list only holds the other planes
+				for (auto axis = 0; axis < 3; axis++)
+				{
+					point3 normal{};
+					(axis == 0 ? normal.x : axis == 1 ? normal.y : normal.z) = 1.0f;
+
+					if (!clip_plane(normal, bounds.midPoint[axis] + bounds.halfSize[axis], start, end, t_enter, t_leave) ||
+						!clip_plane(normal * -1.0f, -(bounds.midPoint[axis] - bounds.halfSize[axis]), start, end, t_enter, t_leave))
+					{
+						return false;
+					}
+				}
+
+				for (auto i = 0; i < brush.numsides; i++)
+				{
+					const auto plane_index = brush.sides[i].planeIndex;
+					if (plane_index >= static_cast<unsigned int>(this->info_->planeCount))
+					{
+						continue;
+					}
+
+					const auto& plane = this->info_->planes[plane_index];
+					if (!clip_plane(to_point(plane.normal), plane.dist, start, end, t_enter, t_leave))
+					{
+						return false;
+					}
+				}
+
+				return true;
+			}
+
+			bool trace_triangle(const std::uint32_t index, const point3& start, const point3& end) const
+			{
+				const auto& data = this->info_->pCollisionData;
+				const auto v0 = to_point(data.verts[data.triIndices[index * 3 + 0]]);
+				const auto v1 = to_point(data.verts[data.triIndices[index * 3 + 1]]);
+				const auto v2 = to_point(data.verts[data.triIndices[index * 3 + 2]]);
+
+				const auto dir = end - start;
+				const auto edge1 = v1 - v0;
+				const auto edge2 = v2 - v0;
+				const auto p = cross(dir, edge2);
+				const auto det = dot(edge1, p);
+				if (std::abs(det) < 1e-8f)
+				{
+					return false;
+				}
+
+				const auto inv_det = 1.0f / det;
+				const auto s = start - v0;
+				const auto u = dot(s, p) * inv_det;
+				if (u < 0.0f || u > 1.0f)
+				{
+					return false;
+				}
+
+				const auto q = cross(s, edge1);
+				const auto v = dot(dir, q) * inv_det;
+				if (v < 0.0f || u + v > 1.0f)
+				{
+					return false;
+				}
+
+				const auto t = dot(edge2, q) * inv_det;
+				return t >= 0.0f && t <= 1.0f;
+			}
+
+			bool trace_primitive(const primitive& prim, const point3& start, const point3& end) const
+			{
+				return prim.is_triangle
+					? this->trace_triangle(prim.index, start, end)
+					: this->trace_brush(prim.index, start, end);
+			}
+		};
+
+		// an actor can walk from a to b: nothing blocks a capsule swept between them (approximated by rays
+		// along its axis and sides at a few heights) and there is ground under the whole path
+		bool can_walk(const collision_world& world, const point3& a, const point3& b)
+		{
+			const auto delta = b - a;
+			const auto horizontal = std::sqrt(delta.x * delta.x + delta.y * delta.y);
+			if (horizontal > max_link_distance || std::abs(delta.z) > max_link_height ||
+				std::abs(delta.z) > horizontal + step_height)
+			{
+				return false;
+			}
+
+			const point3 up = {0.0f, 0.0f, 1.0f};
+			auto side = horizontal > 0.001f ? cross(delta * (1.0f / horizontal), up) : point3{1.0f, 0.0f, 0.0f};
+			side = side * (actor_radius / std::max(std::sqrt(dot(side, side)), 0.001f));
+
+			const float heights[] = {step_height + actor_radius, actor_height * 0.5f, actor_height - actor_radius};
+			for (const auto height : heights)
+			{
+				const auto start = a + up * height;
+				const auto end = b + up * height;
+				if (world.trace(start, end, walk_mask) ||
+					world.trace(start + side, end + side, walk_mask) ||
+					world.trace(start - side, end - side, walk_mask))
+				{
+					return false;
+				}
+			}
+
+			const auto samples = std::max(1, static_cast<int>(horizontal / ground_sample_spacing));
+			for (auto i = 1; i < samples; i++)
+			{
+				const auto p = a + delta * (static_cast<float>(i) / static_cast<float>(samples));
+				if (!world.trace(p + up * step_height, p - up * max_ground_drop, walk_mask))
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		// pathVis holds the strictly lower triangle of the node visibility matrix, bit j * (j - 1) / 2 + i for i < j
+		void generate_vis(PathData* asset, const collision_world& world, zone_memory* mem)
+		{
+			const auto node_count = asset->nodeCount;
+			const auto bit_count = static_cast<std::uint64_t>(node_count) * (node_count - 1) / 2;
+
+			std::vector<std::vector<bool>> rows(node_count);
+			utils::concurrency::parallel_for(node_count, 16, [&](const std::size_t index)
+			{
+				// rows get longer with the node index, start with the longest ones
+				const auto j = node_count - 1 - index;
+				const auto eye_j = to_point(asset->nodes[j].constant.vLocalOrigin) + point3{0.0f, 0.0f, eye_height};
+
+				auto& row = rows[j];
+				row.resize(j);
+				for (auto i = 0u; i < j; i++)
+				{
+					const auto eye_i = to_point(asset->nodes[i].constant.vLocalOrigin) + point3{0.0f, 0.0f, eye_height};
+					row[i] = !world.trace(eye_i, eye_j, sight_mask);
+				}
+			});
+
+			asset->visBytes = static_cast<int>((bit_count + 7) / 8);
+			asset->pathVis = mem->allocate<unsigned char>(asset->visBytes);
+
+			std::uint64_t bit = 0;
+			for (auto j = 1u; j < node_count; j++)
+			{
+				for (auto i = 0u; i < j; i++, bit++)
+				{
+					if (rows[j][i])
+					{
+						asset->pathVis[bit >> 3] |= static_cast<unsigned char>(1 << (bit & 7));
+					}
+				}
+			}
+		}
+
+		void generate_links(PathData* asset, const collision_world& world, zone_memory* mem)
+		{
+			const auto node_count = asset->nodeCount;
+
+			// bucket the nodes on a 2d grid so each node only tests its neighbourhood
+			const auto cell_of = [](const float value)
+			{
+				return static_cast<std::int32_t>(std::floor(value / max_link_distance));
+			};
+
+			const auto cell_key = [](const std::int32_t x, const std::int32_t y)
+			{
+				return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32) | static_cast<std::uint32_t>(y);
+			};
+
+			std::unordered_map<std::uint64_t, std::vector<std::uint32_t>> grid;
+			for (auto i = 0u; i < node_count; i++)
+			{
+				const auto* origin = asset->nodes[i].constant.vLocalOrigin;
+				grid[cell_key(cell_of(origin[0]), cell_of(origin[1]))].emplace_back(i);
+			}
+
+			struct node_links
+			{
+				std::vector<std::uint32_t> generated;
+				std::vector<bool> imported_walkable;
+			};
+
+			std::vector<node_links> links(node_count);
+			utils::concurrency::parallel_for(node_count, 16, [&](const std::size_t i)
+			{
+				const auto& node = asset->nodes[i].constant;
+				const auto origin = to_point(node.vLocalOrigin);
+
+				auto& result = links[i];
+				result.imported_walkable.resize(node.totalLinkCount);
+				for (auto o = 0; o < node.totalLinkCount; o++)
+				{
+					const auto other = to_point(asset->nodes[node.Links[o].nodeNum].constant.vLocalOrigin);
+					result.imported_walkable[o] = can_walk(world, origin, other);
+				}
+
+				if (node.spawnflags & PNF_DONTLINK)
+				{
+					return;
+				}
+
+				std::vector<std::pair<float, std::uint32_t>> candidates;
+
+				const auto cell_x = cell_of(origin.x);
+				const auto cell_y = cell_of(origin.y);
+				for (auto x = cell_x - 1; x <= cell_x + 1; x++)
+				{
+					for (auto y = cell_y - 1; y <= cell_y + 1; y++)
+					{
+						const auto cell = grid.find(cell_key(x, y));
+						if (cell == grid.end())
+						{
+							continue;
+						}
+
+						for (const auto j : cell->second)
+						{
+							if (j == i || (asset->nodes[j].constant.spawnflags & PNF_DONTLINK))
+							{
+								continue;
+							}
+
+							const auto delta = to_point(asset->nodes[j].constant.vLocalOrigin) - origin;
+							const auto dist = std::sqrt(delta.x * delta.x + delta.y * delta.y);
+							if (dist <= max_link_distance)
+							{
+								candidates.emplace_back(dist, j);
+							}
+						}
+					}
+				}
+
+				std::sort(candidates.begin(), candidates.end());
+				for (const auto& [dist, j] : candidates)
+				{
+					if (result.generated.size() >= max_generated_links)
+					{
+						break;
+					}
+
+					if (can_walk(world, origin, to_point(asset->nodes[j].constant.vLocalOrigin)))
+					{
+						result.generated.emplace_back(j);
+					}
+				}
+			});
+
+			// merge: imported links stay, walkable ones become regular links and the generated ones are added both ways
+			std::vector<std::vector<pathlink_s>> merged(node_count);
+			std::vector<std::unordered_set<std::uint32_t>> linked(node_count);
+
+			const auto add_link = [&](const std::uint32_t from, const std::uint32_t to, const bool negotiation)
+			{
+				if (!linked[from].insert(to).second)
+				{
+					return;
+				}
+
+				pathlink_s link{};
+				link.nodeNum = static_cast<unsigned short>(to);
+				link.negotiationLink = negotiation ? 1 : 0;
+				link.fDist = distance(asset->nodes[from].constant.vLocalOrigin, asset->nodes[to].constant.vLocalOrigin);
+				merged[from].emplace_back(link);
+			};
+
+			auto kept_negotiation = 0u;
+			for (auto i = 0u; i < node_count; i++)
+			{
+				const auto& node = asset->nodes[i].constant;
+				for (auto o = 0; o < node.totalLinkCount; o++)
+				{
+					const auto walkable = links[i].imported_walkable[o];
+					kept_negotiation += walkable ? 0 : 1;
+					add_link(i, node.Links[o].nodeNum, !walkable);
+				}
+			}
+
+			auto generated_count = 0u;
+			for (auto i = 0u; i < node_count; i++)
+			{
+				for (const auto j : links[i].generated)
+				{
+					const auto before = merged[i].size() + merged[j].size();
+					add_link(i, j, false);
+					add_link(j, i, false);
+					generated_count += static_cast<unsigned int>(merged[i].size() + merged[j].size() - before);
+				}
+			}
+
+			for (auto i = 0u; i < node_count; i++)
+			{
+				auto& node = asset->nodes[i].constant;
+				node.totalLinkCount = static_cast<unsigned short>(merged[i].size());
+				node.Links = mem->allocate<pathlink_s>(merged[i].size());
+				std::copy(merged[i].begin(), merged[i].end(), node.Links);
+			}
+
+			ZONETOOL_INFO("Generated %u path links, %u imported links kept as negotiation links", generated_count, kept_negotiation);
+		}
+
+		void generate(PathData* asset, const clipMap_t* clip_map, zone_memory* mem)
+		{
+			const auto start = std::chrono::high_resolution_clock::now();
+
+			const collision_world world(clip_map);
+			if (!world.primitive_count())
+			{
+				ZONETOOL_WARNING("Clipmap \"%s\" has no collision, not generating paths", clip_map->name);
+				return;
+			}
+
+			generate_links(asset, world, mem);
+			generate_vis(asset, world, mem);
+
+			const auto end = std::chrono::high_resolution_clock::now();
+			ZONETOOL_INFO("Generated paths for %u nodes against %zu collision primitives in %lld ms", asset->nodeCount,
+				world.primitive_count(), std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count());
+		}
+	}
+
 	PathData* parse_from_botwarfare(const std::string& path, 
 		const std::string& name, zone_memory* mem)
 	{
@@ -421,6 +1089,7 @@ namespace zonetool::h1
 		this->asset_ = parse_from_botwarfare(name, this->name_, mem);
 		if (this->asset_)
 		{
+			this->from_botwarfare_ = true;
 			return;
 		}
 
@@ -436,6 +1105,11 @@ namespace zonetool::h1
 	{
 		auto* data = this->asset_;
 
+		if (this->clip_map_)
+		{
+			path_generator::generate(data, this->clip_map_, mem);
+		}
+
 		for (auto i = 0u; i < data->nodeCount; i++)
 		{
 			WRITE_SCRIPT_STRING(targetname);
@@ -455,6 +1129,25 @@ namespace zonetool::h1
 
 	void path_data::load_depending(zone_base* zone)
 	{
+		if (!path_generator::generate_enabled || !this->from_botwarfare_ || !this->asset_->nodeCount)
+		{
+			return;
+		}
+
+		// the paths are traced against the map's collision, the clipmap has to come before them in the csv
+		const auto clip_map = zone->find_asset(ASSET_TYPE_CLIPMAP, this->name_);
+		if (!clip_map || !clip_map->pointer())
+		{
+			ZONETOOL_FATAL("Generating paths for \"%s\" needs its clipmap, add \"clipmap,%s\" to the zone before the aipaths",
+				this->name_.data(), this->name_.data());
+		}
+
+		this->clip_map_ = reinterpret_cast<clipMap_t*>(clip_map->pointer());
+	}
+
+	void path_data::set_generate_paths(const bool enabled)
+	{
+		path_generator::generate_enabled = enabled;
 	}
 
 	std::string path_data::name()
@@ -9,6 +9,9 @@ namespace zonetool::h1
 		std::string name_;
 		PathData* asset_ = nullptr;
 
+		bool from_botwarfare_ = false;
+		clipMap_t* clip_map_ = nullptr;
+
 		std::vector<std::pair<scr_string_t*, const char*>> script_strings;
 		void add_script_string(scr_string_t* ptr, const char* str);
 		const char* get_script_string(scr_string_t* ptr);
@@ -26,5 +29,8 @@ namespace zonetool::h1
 		void write(zone_base* zone, zone_buffer* buffer) override;
 
 		static void dump(PathData* asset);
+
+		// rebuild links and node visibility of botwarfare waypoints against the map collision, enabled with -generatepaths
+		static void set_generate_paths(bool enabled);
 	};
 }
\ No newline at end of file
@@ -1,6 +1,8 @@
 #include <std_include.hpp>
 #include "fxeffectdef.hpp"
 
+#include "zonetool/utils/asset_cache.hpp"
+
 //#define DUMP_JSON
 
 namespace zonetool::h1
@@ -497,22 +499,12 @@ namespace zonetool::h1
 			emission_count = static_cast<int>(categorized_data[elem_type_emission].size());
 		}
 
-		FxEffectDef* parse(const std::string& name, zone_memory* mem)
+		FxEffectDef* parse(const std::string& name, const std::vector<std::uint8_t>& bytes, zone_memory* mem)
 		{
-			const auto path = "effects\\"s + name + ".json"s;
-
-			auto file = filesystem::file(path);
-			if (!file.exists())
-			{
-				return nullptr;
-			}
-
 			ZONETOOL_INFO("Parsing fx \"%s\"...", name.data());
 
 			// parse json file
-			file.open("rb");
-			ordered_json data = ::json::parse(file.read_bytes(file.size()));
-			file.close();
+			ordered_json data = ::json::parse(bytes);
 
 			// allocate asset
 			auto asset = mem->allocate<FxEffectDef>();
@@ -991,18 +983,8 @@ namespace zonetool::h1
 			}
 		}
 
-		FxEffectDef* parse(const std::string& name, zone_memory* mem)
+		FxEffectDef* read(assetmanager::reader& read)
 		{
-			assetmanager::reader read(mem);
-
-			const auto path = "effects\\"s + name + ".fxe"s;
-			if (!read.open(path))
-			{
-				return nullptr;
-			}
-
-			ZONETOOL_INFO("Parsing fx \"%s\"...", name.data());
-
 			const auto asset = read.read_single<FxEffectDef>();
 			asset->name = read.read_string();
 			asset->elemDefs = read.read_array<FxElemDef>();
@@ -1114,6 +1096,22 @@ namespace zonetool::h1
 				}
 			}
 
+			return asset;
+		}
+
+		FxEffectDef* parse(const std::string& name, zone_memory* mem)
+		{
+			assetmanager::reader read(mem);
+
+			const auto path = "effects\\"s + name + ".fxe"s;
+			if (!read.open(path))
+			{
+				return nullptr;
+			}
+
+			ZONETOOL_INFO("Parsing fx \"%s\"...", name.data());
+
+			const auto asset = binary::read(read);
 			read.close();
 
 			return asset;
@@ -1154,16 +1152,8 @@ namespace zonetool::h1
 			}
 		}
 
-		void dump(FxEffectDef* asset)
+		void write(FxEffectDef* asset, assetmanager::dumper& dump)
 		{
-			assetmanager::dumper dump;
-
-			const auto path = "effects\\"s + asset->name + ".fxe"s;
-			if (!dump.open(path))
-			{
-				return;
-			}
-
 			dump.dump_single(asset);
 			dump.dump_string(asset->name);
 			dump.dump_array(asset->elemDefs,
@@ -1282,14 +1272,240 @@ namespace zonetool::h1
 					}
 				}
 			}
+		}
+
+		void dump(FxEffectDef* asset)
+		{
+			assetmanager::dumper dump;
+
+			const auto path = "effects\\"s + asset->name + ".fxe"s;
+			if (!dump.open(path))
+			{
+				return;
+			}
 
+			binary::write(asset, dump);
 			dump.close();
 		}
 	}
 
+	namespace fx::curves
+	{
+		// largest deviation a reduced curve may have, in units of each value's range over the curve (at least 1).
+		// 0 keeps the samples as they are, set with -simplifyfx
+		std::atomic<float> tolerance = 0.0f;
+
+		double evaluate(const float* values, const std::size_t stride, const std::size_t interval_count, const std::size_t component, const double t)
+		{
+			const auto pos = t * static_cast<double>(interval_count);
+			const auto index = std::min(static_cast<std::size_t>(pos), interval_count - 1);
+			const auto frac = pos - static_cast<double>(index);
+
+			const double from = values[index * stride + component];
+			const double to = values[(index + 1) * stride + component];
+			return from + (to - from) * frac;
+		}
+
+		// both curves are piecewise linear, so they differ the most at one of the sample times of either curve
+		template <typename T>
+		double reduce_curve(T** samples, unsigned char* interval_count, const float max_deviation, zone_memory* mem)
+		{
+			static_assert(sizeof(T) % sizeof(float) == 0, "Samples must only hold floats");
+			constexpr auto stride = sizeof(T) / sizeof(float);
+
+			const std::size_t count = *interval_count;
+			if (!*samples || count < 2)
+			{
+				return 0.0;
+			}
+
+			const auto* values = reinterpret_cast<const float*>(*samples);
+
+			std::array<double, stride> scale{};
+			for (auto c = 0u; c < stride; c++)
+			{
+				auto min = values[c];
+				auto max = values[c];
+				for (auto i = 1u; i <= count; i++)
+				{
+					min = std::min(min, values[i * stride + c]);
+					max = std::max(max, values[i * stride + c]);
+				}
+
+				scale[c] = std::max(1.0, static_cast<double>(max) - min);
+			}
+
+			std::vector<float> reduced;
+			for (std::size_t target = 1; target < count; target++)
+			{
+				reduced.resize((target + 1) * stride);
+				for (auto k = 0u; k <= target; k++)
+				{
+					for (auto c = 0u; c < stride; c++)
+					{
+						reduced[k * stride + c] = static_cast<float>(evaluate(values, stride, count, c, static_cast<double>(k) / target));
+					}
+				}
+
+				auto deviation = 0.0;
+				const auto measure = [&](const double t)
+				{
+					for (auto c = 0u; c < stride; c++)
+					{
+						const auto diff = std::abs(evaluate(values, stride, count, c, t) - evaluate(reduced.data(), stride, target, c, t));
+						deviation = std::max(deviation, diff / scale[c]);
+					}
+				};
+
+				for (auto i = 0u; i <= count && deviation <= max_deviation; i++)
+				{
+					measure(static_cast<double>(i) / count);
+				}
+
+				for (auto k = 0u; k <= target && deviation <= max_deviation; k++)
+				{
+					measure(static_cast<double>(k) / target);
+				}
+
+				if (deviation <= max_deviation)
+				{
+					*samples = mem->allocate<T>(target + 1);
+					std::memcpy(*samples, reduced.data(), sizeof(T) * (target + 1));
+					*interval_count = static_cast<unsigned char>(target);
+					return deviation;
+				}
+			}
+
+			return 0.0;
+		}
+
+		double reduce(FxElemVelStateSample** samples, unsigned char* interval_count, const float max_deviation, zone_memory* mem)
+		{
+			return reduce_curve(samples, interval_count, max_deviation, mem);
+		}
+
+		double reduce(FxElemVisStateSample** samples, unsigned char* interval_count, const float max_deviation, zone_memory* mem)
+		{
+			return reduce_curve(samples, interval_count, max_deviation, mem);
+		}
+
+		void simplify(FxEffectDef* asset, zone_memory* mem)
+		{
+			const auto max_deviation = tolerance.load();
+			if (max_deviation <= 0.0f)
+			{
+				return;
+			}
+
+			std::size_t saved = 0;
+			auto deviation = 0.0;
+
+			for (auto i = 0; i < asset->elemDefCountLooping + asset->elemDefCountOneShot + asset->elemDefCountEmission; i++)
+			{
+				auto def = &asset->elemDefs[i];
+
+				const auto vel_interval_count = def->velIntervalCount;
+				deviation = std::max(deviation, reduce(&def->velSamples, &def->velIntervalCount, max_deviation, mem));
+				saved += (vel_interval_count - def->velIntervalCount) * sizeof(FxElemVelStateSample);
+
+				const auto vis_interval_count = def->visStateIntervalCount;
+				deviation = std::max(deviation, reduce(&def->visSamples, &def->visStateIntervalCount, max_deviation, mem));
+				saved += (vis_interval_count - def->visStateIntervalCount) * sizeof(FxElemVisStateSample);
+			}
+
+			if (saved)
+			{
+				ZONETOOL_INFO("Simplified sample curves of fx \"%s\", saved %zu bytes (max deviation %g)", asset->name, saved, deviation);
+			}
+		}
+	}
+
+	namespace fx::cache
+	{
+		// bump when fx::json::parse or the binary layout changes what ends up in the parsed asset
+		constexpr auto parser_version = 1u;
+
+		FxEffectDef* read_entry(const std::string& entry, const std::string& name, zone_memory* mem)
+		{
+			assetmanager::reader read(mem);
+			if (!read.open(entry, false))
+			{
+				return nullptr;
+			}
+
+			try
+			{
+				const auto asset = binary::read(read);
+				ZONETOOL_INFO("Parsing fx \"%s\"... (cached)", name.data());
+				return asset;
+			}
+			catch (const std::exception& ex)
+			{
+				ZONETOOL_WARNING("Ignoring asset cache entry of fx \"%s\": %s", name.data(), ex.what());
+				return nullptr;
+			}
+		}
+
+		// the json source is only parsed when its content wasn't seen before, see asset_cache
+		FxEffectDef* parse(const std::string& name, zone_memory* mem)
+		{
+			const auto path = "effects\\"s + name + ".json"s;
+
+			auto file = filesystem::file(path);
+			if (!file.exists())
+			{
+				return nullptr;
+			}
+
+			file.open("rb");
+			const auto bytes = file.read_bytes(file.size());
+			file.close();
+
+			const auto start = std::chrono::steady_clock::now();
+
+			const auto entry = asset_cache::get_entry("fx", parser_version, name, bytes);
+			if (!entry.empty())
+			{
+				if (const auto asset = read_entry(entry, name, mem))
+				{
+					asset_cache::add_result(true, std::chrono::steady_clock::now() - start);
+
+					curves::simplify(asset, mem);
+					return asset;
+				}
+			}
+
+			const auto asset = json::parse(name, bytes, mem);
+			if (asset)
+			{
+				asset_cache::store(entry, [&](const std::string& staged)
+				{
+					assetmanager::dumper dump;
+					if (!dump.open(staged, false))
+					{
+						return false;
+					}
+
+					binary::write(asset, dump);
+					return true;
+				});
+
+				if (!entry.empty())
+				{
+					asset_cache::add_result(false, std::chrono::steady_clock::now() - start);
+				}
+
+				// entries hold the curves as authored, the tolerance isn't part of their key
+				curves::simplify(asset, mem);
+			}
+
+			return asset;
+		}
+	}
+
 	FxEffectDef* fx_effect_def::parse(const std::string& name, zone_memory* mem)
 	{
-		FxEffectDef* asset = fx::json::parse(name, mem);
+		FxEffectDef* asset = fx::cache::parse(name, mem);
 		if (asset)
 		{
 			return asset;
@@ -1297,6 +1513,11 @@ namespace zonetool::h1
 		return fx::binary::parse(name, mem);
 	}
 
+	void fx_effect_def::set_simplify_tolerance(const float tolerance)
+	{
+		fx::curves::tolerance = tolerance;
+	}
+
 	void fx_effect_def::init(const std::string& name, zone_memory* mem)
 	{
 		this->name_ = name;
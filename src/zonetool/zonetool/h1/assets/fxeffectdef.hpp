@@ -23,5 +23,19 @@ namespace zonetool::h1
 		void write(zone_base* zone, zone_buffer* buffer) override;
 
 		static void dump(FxEffectDef* asset);
+
+		// resample velocity and visual state curves of json effects to fewer samples within a tolerance, enabled with -simplifyfx
+		static void set_simplify_tolerance(float tolerance);
 	};
+
+	namespace fx::curves
+	{
+		// samples are spread evenly over the element's life, evaluates one value of the curve at `t` in [0, 1]
+		double evaluate(const float* values, std::size_t stride, std::size_t interval_count, std::size_t component, double t);
+
+		// resamples a curve to the fewest evenly spaced intervals that stay within `max_deviation` (in units of each
+		// value's range) and returns the deviation, the samples are kept when no fewer intervals do
+		double reduce(FxElemVelStateSample** samples, unsigned char* interval_count, float max_deviation, zone_memory* mem);
+		double reduce(FxElemVisStateSample** samples, unsigned char* interval_count, float max_deviation, zone_memory* mem);
+	}
 }
\ No newline at end of file
@@ -9,6 +9,8 @@
 #include "zonetool/utils/iwi.hpp"
 
 #include "zonetool/utils/compression.hpp"
+#include "zonetool/utils/io/pak_reader.hpp"
+#include "zonetool/utils/texture_cook.hpp"
 
 #include <utils/cryptography.hpp>
 #include <utils/flags.hpp>
@@ -114,7 +116,7 @@ namespace zonetool::h1
 
 	namespace directxtex
 	{
-		bool load_image(const std::string& name, DirectX::ScratchImage* image)
+		std::optional<std::string> find_image(const std::string& name)
 		{
 			std::string c_name = clean_name(name);
 			c_name = utils::string::va("images\\%s", c_name.data());
@@ -127,72 +129,225 @@ namespace zonetool::h1
 			else if (filesystem::file(c_name + ".png").exists())
 				c_name.append(".png"); // PNG Found
 			else
-				return false; // No image found
+				return {}; // No image found
 
-			std::string path = filesystem::get_file_path(c_name) + c_name;
+			return {filesystem::get_file_path(c_name) + c_name};
+		}
 
+		bool load_image(const std::string& path, DirectX::ScratchImage* image)
+		{
 			std::wstring wname = utils::string::convert(path);
 
 			HRESULT hr = E_FAIL;
-			if (c_name.ends_with(".dds"))
+			if (path.ends_with(".dds"))
 				hr = LoadFromDDSFile(wname.data(), DirectX::DDS_FLAGS_NONE, nullptr, *image);
-			else if (c_name.ends_with(".tga"))
+			else if (path.ends_with(".tga"))
 				hr = LoadFromTGAFile(wname.data(), nullptr, *image);
-			else if (c_name.ends_with(".png"))
+			else if (path.ends_with(".png"))
 				hr = LoadFromWICFile(wname.data(), DirectX::WIC_FLAGS_NONE, nullptr, *image);
 
 			return SUCCEEDED(hr);
 		}
 
-		GfxImage* parse(const std::string& name, zone_memory* mem)
+		bool load_metadata(const std::string& path, DirectX::TexMetadata* metadata)
 		{
-			DirectX::ScratchImage image;
+			std::wstring wname = utils::string::convert(path);
+
+			HRESULT hr = E_FAIL;
+			if (path.ends_with(".dds"))
+				hr = GetMetadataFromDDSFile(wname.data(), DirectX::DDS_FLAGS_NONE, *metadata);
+			else if (path.ends_with(".tga"))
+				hr = GetMetadataFromTGAFile(wname.data(), *metadata);
+			else if (path.ends_with(".png"))
+				hr = GetMetadataFromWICFile(wname.data(), DirectX::WIC_FLAGS_NONE, *metadata);
+
+			return SUCCEEDED(hr);
+		}
 
-			if (load_image(name, &image))
-			{
-				ZONETOOL_INFO("Parsing custom image \"%s\"", name.data());
-
-				auto* pixels = image.GetPixels();
-				auto pixels_size = image.GetPixelsSize();
-				const auto& metadata = image.GetMetadata();
-
-				auto* gfx_image = mem->allocate<GfxImage>();
-
-				gfx_image->imageFormat = metadata.format;
-				gfx_image->mapType = static_cast<MapType>(metadata.dimension);
-				gfx_image->semantic = TS_COLOR_MAP; // material changes this
-				gfx_image->category = IMG_CATEGORY_LOAD_FROM_FILE;
-				gfx_image->width = static_cast<unsigned short>(metadata.width);
-				gfx_image->height = static_cast<unsigned short>(metadata.height);
-				gfx_image->depth = static_cast<unsigned short>(metadata.depth);
-				gfx_image->numElements = static_cast<unsigned short>(metadata.arraySize);
-				gfx_image->levelCount = static_cast<unsigned char>(metadata.mipLevels);
-				gfx_image->streamed = 0;
-				gfx_image->dataLen1 = static_cast<int>(pixels_size);
-				gfx_image->dataLen2 = static_cast<int>(pixels_size);
-				gfx_image->pixelData = mem->allocate<unsigned char>(pixels_size);
-				memcpy(gfx_image->pixelData, pixels, pixels_size);
-				gfx_image->name = mem->duplicate_string(name);
-
-				if (metadata.IsCubemap())
+		std::size_t get_pixels_size(const DirectX::TexMetadata& metadata)
+		{
+			std::size_t size = 0;
+			for (auto item = 0u; item < metadata.arraySize; item++)
+			{
+				for (auto level = 0u; level < metadata.mipLevels; level++)
 				{
-					gfx_image->mapType = MAPTYPE_CUBE;
-					gfx_image->numElements = 1;
+					std::size_t row_pitch{};
+					std::size_t slice_pitch{};
+					DirectX::ComputePitch(metadata.format, std::max<std::size_t>(1, metadata.width >> level),
+						std::max<std::size_t>(1, metadata.height >> level), row_pitch, slice_pitch);
+
+					size += slice_pitch * std::max<std::size_t>(1, metadata.depth >> level);
 				}
+			}
+
+			return size;
+		}
+
+		// dds files with a fourcc or dx10 header hold their pixels in the layout the game uses,
+		// so they are read straight into zone memory. legacy formats DirectXTex has to convert return nullptr
+		unsigned char* read_dds_pixels(const std::string& path, const DirectX::TexMetadata& metadata, std::size_t* size, zone_memory* mem)
+		{
+			constexpr auto dds_header_size = 128; // magic + DDS_HEADER
+			constexpr auto dds_header_dxt10_size = 20;
+			constexpr auto ddpf_fourcc = 0x4;
+			constexpr auto fourcc_dx10 = 0x30315844; // DX10
 
-				add_loaded_image_flags(gfx_image);
+			std::ifstream stream(path, std::ios::binary | std::ios::ate);
+			if (!stream.is_open())
+			{
+				return nullptr;
+			}
+
+			const auto file_size = static_cast<std::size_t>(stream.tellg());
 
-				return gfx_image;
+			std::uint32_t header[dds_header_size / 4]{};
+			stream.seekg(0);
+			if (!stream.read(reinterpret_cast<char*>(header), dds_header_size))
+			{
+				return nullptr;
 			}
 
-			return nullptr;
+			// DDS_PIXELFORMAT flags and fourcc, behind the magic and 18 dwords of DDS_HEADER
+			const auto pixel_format_flags = header[20];
+			const auto fourcc = header[21];
+			if (!(pixel_format_flags & ddpf_fourcc))
+			{
+				return nullptr;
+			}
+
+			// the metadata comes from the same header, a file that can't hold the pixels it claims is never allocated for
+			const auto offset = static_cast<std::size_t>(dds_header_size + (fourcc == fourcc_dx10 ? dds_header_dxt10_size : 0));
+			const auto pixels_size = get_pixels_size(metadata);
+			if (!pixels_size || file_size < offset || pixels_size > file_size - offset)
+			{
+				return nullptr;
+			}
+
+			auto* pixels = mem->allocate<unsigned char>(pixels_size);
+			stream.seekg(offset);
+			if (!stream.read(reinterpret_cast<char*>(pixels), static_cast<std::streamsize>(pixels_size)))
+			{
+				return nullptr;
+			}
+
+			*size = pixels_size;
+			return pixels;
+		}
+
+		GfxImage* create_image(const std::string& name, const DirectX::TexMetadata& metadata, zone_memory* mem)
+		{
+			auto* gfx_image = mem->allocate<GfxImage>();
+
+			gfx_image->imageFormat = metadata.format;
+			gfx_image->mapType = static_cast<MapType>(metadata.dimension);
+			gfx_image->semantic = TS_COLOR_MAP; // material changes this
+			gfx_image->category = IMG_CATEGORY_LOAD_FROM_FILE;
+			gfx_image->width = static_cast<unsigned short>(metadata.width);
+			gfx_image->height = static_cast<unsigned short>(metadata.height);
+			gfx_image->depth = static_cast<unsigned short>(metadata.depth);
+			gfx_image->numElements = static_cast<unsigned short>(metadata.arraySize);
+			gfx_image->levelCount = static_cast<unsigned char>(metadata.mipLevels);
+			gfx_image->streamed = 0;
+			gfx_image->name = mem->duplicate_string(name);
+
+			if (metadata.IsCubemap())
+			{
+				gfx_image->mapType = MAPTYPE_CUBE;
+				gfx_image->numElements = 1;
+			}
+
+			add_loaded_image_flags(gfx_image);
+
+			return gfx_image;
+		}
+
+		void set_pixels(GfxImage* gfx_image, unsigned char* pixels, const std::size_t pixels_size)
+		{
+			gfx_image->dataLen1 = static_cast<int>(pixels_size);
+			gfx_image->dataLen2 = static_cast<int>(pixels_size);
+			gfx_image->pixelData = pixels;
+		}
+
+		bool load_pixels(GfxImage* gfx_image, const std::string& path, zone_memory* mem)
+		{
+			DirectX::ScratchImage image;
+			if (!load_image(path, &image))
+			{
+				return false;
+			}
+
+			auto* pixels = image.GetPixels();
+			auto pixels_size = image.GetPixelsSize();
+
+			set_pixels(gfx_image, mem->allocate<unsigned char>(pixels_size), pixels_size);
+			memcpy(gfx_image->pixelData, pixels, pixels_size);
+
+			return true;
+		}
+
+		GfxImage* parse(const std::string& name, const std::string& path, zone_memory* mem)
+		{
+			DirectX::TexMetadata metadata{};
+			if (!load_metadata(path, &metadata))
+			{
+				return nullptr;
+			}
+
+			ZONETOOL_INFO("Parsing custom image \"%s\"", name.data());
+
+			auto* gfx_image = create_image(name, metadata, mem);
+
+			std::size_t pixels_size{};
+			if (path.ends_with(".dds"))
+			{
+				if (auto* pixels = read_dds_pixels(path, metadata, &pixels_size, mem))
+				{
+					set_pixels(gfx_image, pixels, pixels_size);
+					return gfx_image;
+				}
+			}
+
+			return load_pixels(gfx_image, path, mem) ? gfx_image : nullptr;
+		}
+
+		void set_cooked_image(GfxImage* gfx_image, const texture_cook::cooked_image& cooked)
+		{
+			gfx_image->imageFormat = cooked.format;
+			gfx_image->width = static_cast<unsigned short>(cooked.width);
+			gfx_image->height = static_cast<unsigned short>(cooked.height);
+			gfx_image->levelCount = static_cast<unsigned char>(cooked.level_count);
+			set_pixels(gfx_image, cooked.pixels, cooked.size);
+
+			gfx_image->flags &= ~IMAGE_FLAG_NOMIPMAPS;
+			add_loaded_image_flags(gfx_image);
 		}
 	}
 
 	GfxImage* gfx_image::parse_custom(const std::string& name, zone_memory* mem)
 	{
 		GfxImage* image = nullptr;
-		image = directxtex::parse(name, mem);
+
+		const auto path = directxtex::find_image(name);
+		if (path.has_value())
+		{
+			if (texture_cook::is_enabled() && !path->ends_with(".dds"))
+			{
+				// pixels are filled in once the semantic is known, see cook
+				DirectX::TexMetadata metadata{};
+				if (directxtex::load_metadata(*path, &metadata) && metadata.dimension == DirectX::TEX_DIMENSION_TEXTURE2D)
+				{
+					ZONETOOL_INFO("Parsing custom image \"%s\"", name.data());
+
+					image = directxtex::create_image(name, metadata, mem);
+					this->cook_source_ = *path;
+					this->cook_mem_ = mem;
+					return image;
+				}
+			}
+
+			image = directxtex::parse(name, *path, mem);
+		}
+
 		if (!image)
 		{
 			image = iwi::parse(name, mem);
@@ -205,6 +360,38 @@ namespace zonetool::h1
 		return image;
 	}
 
+	void gfx_image::cook(const unsigned char semantic)
+	{
+		if (this->cook_source_.empty() || this->cook_result_.valid())
+		{
+			return;
+		}
+
+		texture_cook::usage usage;
+		switch (semantic)
+		{
+		case TS_COLOR_MAP:
+		case TS_DETAIL_MAP:
+			usage = texture_cook::usage::color;
+			break;
+		case TS_NORMAL_MAP:
+			usage = texture_cook::usage::normal;
+			break;
+		case TS_SPECULAR_MAP:
+			usage = texture_cook::usage::specular;
+			break;
+		default:
+			// anything else is sampled raw, it is loaded uncompressed in prepare
+			return;
+		}
+
+		auto* mem = this->cook_mem_;
+		this->cook_result_ = texture_cook::cook_async(this->cook_source_, usage, [mem](const std::size_t size)
+		{
+			return mem->allocate<std::uint8_t>(size);
+		});
+	}
+
 	std::optional<std::string> get_streamed_image_pixels(const std::string& name, int stream)
 	{
 		const auto image_path = utils::string::va("streamed_images\\%s_stream%i.pixels", 
@@ -416,6 +603,25 @@ namespace zonetool::h1
 
 	void gfx_image::prepare(zone_buffer* buf, zone_memory* mem)
 	{
+		if (this->cook_source_.empty())
+		{
+			return;
+		}
+
+		if (this->cook_result_.valid())
+		{
+			if (const auto& cooked = this->cook_result_.get(); cooked.has_value())
+			{
+				directxtex::set_cooked_image(this->asset_, *cooked);
+				return;
+			}
+		}
+
+		// never cooked, ship the source as it is
+		if (!directxtex::load_pixels(this->asset_, this->cook_source_, mem))
+		{
+			ZONETOOL_FATAL("Failed to load image \"%s\"", this->cook_source_.data());
+		}
 	}
 
 	void gfx_image::load_depending(zone_base* zone)
@@ -476,103 +682,118 @@ namespace zonetool::h1
 		}
 	}
 
-	void dump_streamed_image(GfxImage* image, bool is_self = false, bool dump_dds = false)
+	// false when a stream couldn't be read from its pak, the image header isn't written then since
+	// building from it would need the missing .pixels
+	bool dump_streamed_image(GfxImage* image, bool is_self = false, bool dump_dds = false)
 	{
+		const auto name = clean_name(image->name);
+		const auto parent_path = filesystem::get_dump_path() + "streamed_images\\";
+
+		auto read_all = true;
 		for (auto i = 0u; i < 4; i++)
 		{
-			const auto stream_file = &stream_files[*stream_file_index + i];
+			const auto stream_file = &stream_files[dump_stream_file_index + i];
+			if (stream_file->offset == 0 || stream_file->offsetEnd == 0)
+			{
+				continue;
+			}
 
 			std::string filename = utils::string::va("imagefile%d.pak", stream_file->fileIndex);
 			if (is_self)
 			{
 				filename = utils::string::va("%s.pak", filesystem::get_fastfile().data());
 			}
-			const auto folder = filesystem::get_zone_path(filename);
+			const auto imagefile_path = filesystem::get_zone_path(filename) + filename;
 
-			const auto imagefile_path = utils::string::va("%s%s", folder.data(), filename.data());
-			std::ifstream imagefile;
-			imagefile.open(imagefile_path, std::ios::binary);
+			// decompression and writes happen on the pak reader workers, which must not touch the image
+			const std::string image_name = image->name;
+			const auto width = image->streams[i].width;
+			const auto height = image->streams[i].height;
+			const auto format = DXGI_FORMAT(image->imageFormat);
 
-			if (!imagefile.is_open() || stream_file->offset == 0 || stream_file->offsetEnd == 0)
+			const auto queued = filesystem::pak_reader::request(imagefile_path, stream_file->offset, stream_file->offsetEnd - stream_file->offset,
+				[=](const std::uint8_t* data, const std::size_t size)
 			{
-				continue;
-			}
-
-			std::string buffer;
-			const auto size = stream_file->offsetEnd - stream_file->offset;
-			buffer.resize(size);
-			imagefile.seekg(stream_file->offset);
-			imagefile.read(buffer.data(), size);
-
-			try
-			{
-				auto pixel_data = compression::lz4::decompress_lz4_block(buffer);
-				const auto name = clean_name(image->name);
-
-				{
-					std::string parent_path = filesystem::get_dump_path() + "streamed_images\\";
-					std::string raw_path = utils::string::va("%s%s_stream%i.pixels", parent_path.data(), name.data(), i);
-					utils::io::write_file(raw_path, pixel_data, false);
-				}
-
-				if (dump_dds)
+				try
 				{
-					DirectX::Image img = {};
+					auto pixel_data = compression::lz4::decompress_lz4_block(data, size);
 
-					img.width = image->streams[i].width;
-					img.height = image->streams[i].height;
-					img.pixels = reinterpret_cast<uint8_t*>(pixel_data.data());
-					img.format = DXGI_FORMAT(image->imageFormat);
-
-					size_t row_pitch{};
-					size_t slice_pitch{};
-
-					DirectX::ComputePitch(img.format, img.width, img.height, row_pitch, slice_pitch);
-
-					img.rowPitch = row_pitch;
-					img.slicePitch = slice_pitch;
-
-					const auto parent_path = filesystem::get_dump_path() + "streamed_images\\";
-					const std::string spath = utils::string::va("%s\\%s_stream%i.dds", parent_path.data(),
-						name.data(), i);
-					const std::wstring wpath(spath.begin(), spath.end());
-					if (!std::filesystem::exists(parent_path))
 					{
-						std::filesystem::create_directories(parent_path);
+						std::string raw_path = utils::string::va("%s%s_stream%i.pixels", parent_path.data(), name.data(), i);
+						utils::io::write_file(raw_path, {reinterpret_cast<const char*>(pixel_data.data()), pixel_data.size()}, false);
 					}
 
-					auto result = DirectX::SaveToDDSFile(img, DirectX::DDS_FLAGS_NONE, wpath.data());
-					if (FAILED(result))
+					if (dump_dds)
 					{
-						ZONETOOL_WARNING("Failed to dump image \"%s.dds\"", image->name);
+						DirectX::Image img = {};
+
+						img.width = width;
+						img.height = height;
+						img.pixels = pixel_data.data();
+						img.format = format;
+
+						size_t row_pitch{};
+						size_t slice_pitch{};
+
+						DirectX::ComputePitch(img.format, img.width, img.height, row_pitch, slice_pitch);
+
+						img.rowPitch = row_pitch;
+						img.slicePitch = slice_pitch;
+
+						const std::string spath = utils::string::va("%s\\%s_stream%i.dds", parent_path.data(),
+							name.data(), i);
+						const std::wstring wpath(spath.begin(), spath.end());
+						if (!std::filesystem::exists(parent_path))
+						{
+							std::filesystem::create_directories(parent_path);
+						}
+
+						auto result = DirectX::SaveToDDSFile(img, DirectX::DDS_FLAGS_NONE, wpath.data());
+						if (FAILED(result))
+						{
+							ZONETOOL_WARNING("Failed to dump image \"%s.dds\"", image_name.data());
+						}
 					}
 				}
-			}
-			catch (...)
+				catch (...)
+				{
+					ZONETOOL_ERROR("Failed to dump streamed image \"%s\"", image_name.data());
+				}
+			});
+
+			if (!queued)
 			{
-				ZONETOOL_ERROR("Failed to dump streamed image \"%s\"", image->name);
+				ZONETOOL_ERROR("Failed to read stream %u of image \"%s\" from \"%s\" (offset %llu, end %llu)", i,
+					image->name, imagefile_path.data(), static_cast<unsigned long long>(stream_file->offset),
+					static_cast<unsigned long long>(stream_file->offsetEnd));
+				read_all = false;
 			}
 		}
 
+		if (!read_all)
 		{
-			const auto path = "streamed_images\\"s + clean_name(image->name) + ".h1Image"s;
-			assetmanager::dumper write;
-			if (!write.open(path))
-			{
-				return;
-			}
+			return false;
+		}
 
-			write.dump_single(image);
-			write.dump_string(image->name);
-			write.close();
+		const auto path = "streamed_images\\"s + clean_name(image->name) + ".h1Image"s;
+		assetmanager::dumper write;
+		if (!write.open(path))
+		{
+			return false;
 		}
+
+		write.dump_single(image);
+		write.dump_string(image->name);
+		write.close();
+
+		return true;
 	}
 
 	void dump_image_dds(GfxImage* image)
 	{
 		if (image->streamed)
 		{
-			dump_streamed_image(image, stream_files[*stream_file_index].fileIndex == 96, true);
+			dump_streamed_image(image, stream_files[dump_stream_file_index].fileIndex == 96, true);
 			return;
 		}
 
@@ -659,23 +880,9 @@ namespace zonetool::h1
 		// Always dump DDS (forced)
 		dump_image_dds(asset);
 
-		// Handle streamed images
+		// streamed images were dumped (once, with their DDS) by dump_image_dds
 		if (asset->streamed)
 		{
-			if (stream_files[*stream_file_index].fileIndex == 96)
-			{
-				dump_streamed_image(asset, true, true);
-				return;
-			}
-
-			if (utils::flags::has_flag("dump_streamed_image"))
-			{
-				dump_streamed_image(asset, false, true);
-				return;
-			}
-
-			// Also dump DDS for streamed images by default
-			dump_streamed_image(asset, false, true);
 			return;
 		}
 
@@ -708,7 +915,7 @@ namespace zonetool::h1
 			{
 				for (auto i = 0u; i < 4; i++)
 				{
-					const auto stream_file = &stream_files[*stream_file_index + i];
+					const auto stream_file = &stream_files[dump_stream_file_index + i];
 					write.dump_single(stream_file);
 				}
 			}
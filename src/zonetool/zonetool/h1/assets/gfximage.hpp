@@ -1,6 +1,8 @@
 #pragma once
 #include "../zonetool.hpp"
 
+#include "zonetool/utils/texture_cook.hpp"
+
 namespace zonetool::h1
 {
 	class gfx_image : public asset_interface
@@ -9,6 +11,11 @@ namespace zonetool::h1
 		std::string name_;
 		GfxImage* asset_ = nullptr;
 
+		// png/tga source that is block compressed once a material sets its semantic (-cookimages)
+		std::string cook_source_;
+		zone_memory* cook_mem_ = nullptr;
+		std::shared_future<std::optional<texture_cook::cooked_image>> cook_result_;
+
 	public:
 		std::array<XStreamFile*, 4> image_stream_files;
 		std::array<std::optional<std::string>, 4> image_stream_blocks_paths;
@@ -19,6 +26,9 @@ namespace zonetool::h1
 
 		GfxImage* parse_custom(const std::string& name, zone_memory* mem);
 
+		// starts cooking a png/tga image for the given semantic, prepare picks up the result
+		void cook(unsigned char semantic);
+
 		GfxImage* parse_streamed_image(const std::string& name, zone_memory* mem);
 		GfxImage* parse(const std::string& name, zone_memory* mem);
 
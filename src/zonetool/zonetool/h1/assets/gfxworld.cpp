@@ -1,6 +1,8 @@
 #include <std_include.hpp>
 #include "gfxworld.hpp"
 
+#include <utils/concurrency.hpp>
+
 namespace zonetool::h1
 {
 	namespace
@@ -61,131 +63,353 @@ namespace zonetool::h1
 				material->info.sortKey < 7;
 		}
 
+		enum dpvs_surface_bucket : std::uint32_t
+		{
+			DPVS_BUCKET_OPAQUE,
+			DPVS_BUCKET_DECAL,
+			DPVS_BUCKET_TRANS,
+			DPVS_BUCKET_SHADOW_CASTER,
+			DPVS_BUCKET_EMISSIVE,
+			DPVS_BUCKET_COUNT,
+		};
+
+		struct dpvs_material_class
+		{
+			dpvs_surface_bucket bucket;
+			std::string techset;
+			std::string material;
+			unsigned char sort_key;
+			std::uint32_t rank;
+		};
+
+		dpvs_surface_bucket classify_dpvs_material(Material* material, zone_base* zone)
+		{
+			if (Material_IsOpaque(material, zone))
+				return DPVS_BUCKET_OPAQUE;
+			if (Material_IsDecal(material, zone))
+				return DPVS_BUCKET_DECAL;
+			if (Material_IsTransparent(material, zone))
+				return DPVS_BUCKET_TRANS;
+			if (Material_IsShadowCaster(material, zone))
+				return DPVS_BUCKET_SHADOW_CASTER;
+			if (Material_IsEmissive(material, zone))
+				return DPVS_BUCKET_EMISSIVE;
+
+			return DPVS_BUCKET_OPAQUE; // this is most likely "missing" material
+		}
+
+		std::uint32_t spread_morton_bits(std::uint32_t value)
+		{
+			value &= 0x3FF;
+			value = (value | (value << 16)) & 0x030000FF;
+			value = (value | (value << 8)) & 0x0300F00F;
+			value = (value | (value << 4)) & 0x030C30C3;
+			value = (value | (value << 2)) & 0x09249249;
+			return value;
+		}
+
+		// 30 bit z-order code of a point inside the given bounds, 10 bits per axis
+		std::uint32_t morton_code(const float* point, const float* mins, const float* scale)
+		{
+			std::uint32_t code = 0;
+			for (auto axis = 0; axis < 3; axis++)
+			{
+				const auto cell = std::clamp((point[axis] - mins[axis]) * scale[axis], 0.0f, 1023.0f);
+				code |= spread_morton_bits(static_cast<std::uint32_t>(cell)) << axis;
+			}
+
+			return code;
+		}
+
+		// surfaces are grouped into the lit opaque/decal/trans, shadow caster and emissive ranges the renderer expects,
+		// inside a range they are ordered by techset and material to keep state changes down and by z-order of
+		// their bounds so neighbouring surfaces end up next to each other, ties keep the original order
 		void sort_dpvs_surfaces(GfxWorld* asset, zone_base* zone)
 		{
+			// the umbra tome references surfaces by index and we can't rewrite it, worlds that have one keep the order they were built with
+			if (asset->umbraTomeData && asset->umbraTomeSize)
+			{
+				return;
+			}
+
 			try
 			{
-				auto mem = utils::memory::get_allocator();
 				const unsigned int surfaceCount = asset->models->surfaceCount;
 
-				// Categorize surfaces into different types
-				std::vector<unsigned int> opaque, decal, trans, shadow_caster, emissive;
+				// classify every material once, surfaces share a handful of them
+				std::unordered_map<std::string, dpvs_material_class> material_classes;
+				std::vector<dpvs_material_class*> surface_classes(surfaceCount);
 
 				for (unsigned int surf_idx = 0; surf_idx < surfaceCount; ++surf_idx)
 				{
-					auto& surf = asset->dpvs.surfaces[surf_idx];
-					auto* surf_material = get_asset<Material>(ASSET_TYPE_MATERIAL, surf.material->name, zone);
-
-					if (Material_IsOpaque(surf_material, zone))
-						opaque.push_back(surf_idx);
-					else if (Material_IsDecal(surf_material, zone))
-						decal.push_back(surf_idx);
-					else if (Material_IsTransparent(surf_material, zone))
-						trans.push_back(surf_idx);
-					else if (Material_IsShadowCaster(surf_material, zone))
-						shadow_caster.push_back(surf_idx);
-					else if (Material_IsEmissive(surf_material, zone))
-						emissive.push_back(surf_idx);
-					else
-						opaque.push_back(surf_idx); // this is most likely "missing" material
+					const auto* name = asset->dpvs.surfaces[surf_idx].material->name;
+					auto entry = material_classes.find(name);
+					if (entry == material_classes.end())
+					{
+						auto* surf_material = get_asset<Material>(ASSET_TYPE_MATERIAL, name, zone);
+
+						dpvs_material_class material_class{};
+						material_class.bucket = classify_dpvs_material(surf_material, zone);
+						material_class.techset = surf_material->techniqueSet ? surf_material->techniqueSet->name : "";
+						material_class.material = name;
+						material_class.sort_key = surf_material->info.sortKey;
+
+						entry = material_classes.emplace(name, std::move(material_class)).first;
+					}
+
+					surface_classes[surf_idx] = &entry->second;
 				}
 
-				// Allocate arrays for sorted surfaces and their bounds
-				auto surfaces_sorted = mem->allocate_array<GfxSurface>(surfaceCount);
-				auto surface_bounds_sorted = mem->allocate_array<GfxSurfaceBounds>(surfaceCount);
+				// rank the materials so surfaces compare by a single integer
+				std::vector<dpvs_material_class*> ranked;
+				ranked.reserve(material_classes.size());
+				for (auto& [name, material_class] : material_classes)
+				{
+					ranked.push_back(&material_class);
+				}
 
-				std::unordered_map<unsigned int, unsigned int> old_to_new_surface_index;
-				unsigned int index = 0;
+				std::sort(ranked.begin(), ranked.end(), [](const dpvs_material_class* a, const dpvs_material_class* b)
+				{
+					return std::tie(a->techset, a->material, a->sort_key) < std::tie(b->techset, b->material, b->sort_key);
+				});
 
-				// Lambda to append surfaces and update the index mapping
-				const auto append_surfaces = [&](const std::vector<unsigned int>& surfaces)
+				for (auto i = 0u; i < ranked.size(); i++)
 				{
-					for (const auto surf_idx : surfaces)
+					ranked[i]->rank = i;
+				}
+
+				// z-order is relative to the bounds of all surface centers
+				float mins[3] = { std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max() };
+				float maxs[3] = { std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest() };
+				for (unsigned int surf_idx = 0; surf_idx < surfaceCount; ++surf_idx)
+				{
+					const auto* mid_point = asset->dpvs.surfacesBounds[surf_idx].bounds.midPoint;
+					for (auto axis = 0; axis < 3; axis++)
 					{
-						old_to_new_surface_index[surf_idx] = index;
-						surfaces_sorted[index] = asset->dpvs.surfaces[surf_idx];
-						surface_bounds_sorted[index] = asset->dpvs.surfacesBounds[surf_idx];
-						++index;
+						mins[axis] = std::min(mins[axis], mid_point[axis]);
+						maxs[axis] = std::max(maxs[axis], mid_point[axis]);
 					}
-				};
+				}
 
-				append_surfaces(opaque);
-				append_surfaces(decal);
-				append_surfaces(trans);
-				append_surfaces(shadow_caster);
-				append_surfaces(emissive);
+				float scale[3]{};
+				for (auto axis = 0; axis < 3; axis++)
+				{
+					const auto extent = maxs[axis] - mins[axis];
+					scale[axis] = extent > 0.0f ? 1023.0f / extent : 0.0f;
+				}
+
+				std::vector<std::uint64_t> sort_keys(surfaceCount);
+				utils::concurrency::parallel_for(surfaceCount, 1024, [&](const std::size_t surf_idx)
+				{
+					const auto morton = morton_code(asset->dpvs.surfacesBounds[surf_idx].bounds.midPoint, mins, scale);
+					sort_keys[surf_idx] = (static_cast<std::uint64_t>(surface_classes[surf_idx]->rank) << 30) | morton;
+				});
+
+				std::vector<unsigned int> buckets[DPVS_BUCKET_COUNT];
+				for (unsigned int surf_idx = 0; surf_idx < surfaceCount; ++surf_idx)
+				{
+					buckets[surface_classes[surf_idx]->bucket].push_back(surf_idx);
+				}
+
+				// buckets are independent, ties are broken by the original index so the result doesn't depend on timing.
+				// small worlds sort all of them on this thread
+				const std::size_t sort_grain = surfaceCount >= 0x4000 ? 1 : DPVS_BUCKET_COUNT;
+				utils::concurrency::parallel_for(DPVS_BUCKET_COUNT, sort_grain, [&](const std::size_t bucket_idx)
+				{
+					auto& bucket = buckets[bucket_idx];
+					std::sort(bucket.begin(), bucket.end(), [&](const unsigned int a, const unsigned int b)
+					{
+						return std::tie(sort_keys[a], a) < std::tie(sort_keys[b], b);
+					});
+				});
+
+				// Allocate arrays for sorted surfaces and their bounds
+				std::vector<GfxSurface> surfaces_sorted;
+				std::vector<GfxSurfaceBounds> surface_bounds_sorted;
+				std::vector<GfxDrawSurf> surface_materials_sorted;
+				surfaces_sorted.reserve(surfaceCount);
+				surface_bounds_sorted.reserve(surfaceCount);
+				surface_materials_sorted.reserve(asset->dpvs.surfaceMaterials ? surfaceCount : 0);
+
+				std::vector<unsigned int> old_to_new_surface_index(surfaceCount);
+				for (const auto& bucket : buckets)
+				{
+					for (const auto surf_idx : bucket)
+					{
+						old_to_new_surface_index[surf_idx] = static_cast<unsigned int>(surfaces_sorted.size());
+						surfaces_sorted.push_back(asset->dpvs.surfaces[surf_idx]);
+						surface_bounds_sorted.push_back(asset->dpvs.surfacesBounds[surf_idx]);
+						if (asset->dpvs.surfaceMaterials)
+						{
+							surface_materials_sorted.push_back(asset->dpvs.surfaceMaterials[surf_idx]);
+						}
+					}
+				}
 
 				// Exception check if index doesn't match the surface count
-				if (index != surfaceCount)
+				if (surfaces_sorted.size() != surfaceCount)
 				{
 					throw std::runtime_error("Index count mismatch with surface count.");
 				}
 
-				// Replace original surface and bounds arrays with sorted ones
-				std::memcpy(asset->dpvs.surfaces, surfaces_sorted, sizeof(GfxSurface) * surfaceCount);
-				std::memcpy(asset->dpvs.surfacesBounds, surface_bounds_sorted, sizeof(GfxSurfaceBounds) * surfaceCount);
+				// per surface bitsets, indexed by surface
+				std::vector<std::pair<unsigned int*, unsigned int>> surface_bits;
+				for (auto i = 0; i < 4; i++)
+				{
+					surface_bits.emplace_back(asset->dpvs.surfaceVisData[i], asset->dpvs.surfaceVisDataCount);
+					surface_bits.emplace_back(asset->dpvs.surfaceUmbraVisData[i], asset->dpvs.surfaceVisDataCount);
+				}
 
-				// Remap sorted surface indices based on new order
-				std::unordered_map<unsigned int*, bool> replaced_addresses;
-				const auto replace_index_at_address = [&](unsigned int* address, unsigned int val)
+				for (auto i = 0; i < 27; i++)
 				{
-					if (replaced_addresses.find(address) != replaced_addresses.end())
-						return;
+					surface_bits.emplace_back(asset->dpvs.surfaceUnknownVisData[i], asset->dpvs.surfaceVisDataCount);
+				}
 
-					*address = val;
-					replaced_addresses[address] = true;
-				};
+				surface_bits.emplace_back(asset->dpvs.surfaceCastsSunShadow, asset->dpvs.surfaceVisDataCount);
 
-				// Now remap the sortedSurfIndex based on the new surface positions
-				for (unsigned int i = 0; i < asset->dpvs.staticSurfaceCount; ++i)
+				if (asset->dpvs.surfaceCastsSunShadowOpt)
 				{
-					const auto old_index = asset->dpvs.sortedSurfIndex[i];
-					const auto new_index = old_to_new_surface_index.at(old_index);
-					replace_index_at_address(&asset->dpvs.sortedSurfIndex[i], new_index);
+					for (unsigned int i = 0; i < asset->dpvs.sunShadowOptCount; ++i)
+					{
+						surface_bits.emplace_back(asset->dpvs.surfaceCastsSunShadowOpt + i * asset->dpvs.sunSurfVisDataCount,
+							asset->dpvs.sunSurfVisDataCount);
+					}
 				}
 
-				// Remap shadow geometry if present
-				if (asset->shadowGeom)
+				// everything that gets remapped is checked first so a bad world is left untouched
+				for (const auto& [bits, word_count] : surface_bits)
 				{
-					for (unsigned int s = 0; s < asset->primaryLightCount; ++s)
+					if (bits && word_count * 32 < surfaceCount)
+					{
+						throw std::runtime_error("Surface bitset is smaller than the surface count.");
+					}
+				}
+
+				if (asset->dpvs.surfaceDeptAndSurf)
+				{
+					for (unsigned int i = 0; i < asset->dpvs.staticSurfaceCount; ++i)
 					{
-						for (unsigned int i = 0; i < asset->shadowGeom[s].surfaceCount; ++i)
+						if (static_cast<unsigned int>(asset->dpvs.surfaceDeptAndSurf[i].surfIndex) >= surfaceCount)
 						{
-							const auto old_index = asset->shadowGeom[s].sortedSurfIndex[i];
-							const auto new_index = old_to_new_surface_index.at(old_index);
-							replace_index_at_address(&asset->shadowGeom[s].sortedSurfIndex[i], new_index);
+							throw std::runtime_error("Depth sorted surface index out of range.");
 						}
 					}
 				}
 
+				// surface index arrays, shadow geometry and skies
+				std::vector<std::pair<unsigned int*, unsigned int>> surface_indices;
+				surface_indices.emplace_back(asset->dpvs.sortedSurfIndex, asset->dpvs.staticSurfaceCount);
+
+				if (asset->shadowGeom)
+				{
+					for (unsigned int s = 0; s < asset->primaryLightCount; ++s)
+					{
+						surface_indices.emplace_back(asset->shadowGeom[s].sortedSurfIndex, asset->shadowGeom[s].surfaceCount);
+					}
+				}
+
 				if (asset->shadowGeomOptimized)
 				{
 					for (unsigned int s = 0; s < asset->primaryLightCount; ++s)
 					{
-						for (unsigned int i = 0; i < asset->shadowGeomOptimized[s].surfaceCount; ++i)
+						surface_indices.emplace_back(asset->shadowGeomOptimized[s].sortedSurfIndex, asset->shadowGeomOptimized[s].surfaceCount);
+					}
+				}
+
+				for (int i = 0; i < asset->skyCount; ++i)
+				{
+					surface_indices.emplace_back(reinterpret_cast<unsigned int*>(asset->skies[i].skyStartSurfs),
+						static_cast<unsigned int>(asset->skies[i].skySurfCount));
+				}
+
+				for (const auto& [indices, count] : surface_indices)
+				{
+					for (unsigned int i = 0; indices && i < count; ++i)
+					{
+						if (indices[i] >= surfaceCount)
+						{
+							throw std::runtime_error("Surface index out of range.");
+						}
+					}
+				}
+
+				// Replace original surface and bounds arrays with sorted ones
+				std::memcpy(asset->dpvs.surfaces, surfaces_sorted.data(), sizeof(GfxSurface) * surfaceCount);
+				std::memcpy(asset->dpvs.surfacesBounds, surface_bounds_sorted.data(), sizeof(GfxSurfaceBounds) * surfaceCount);
+
+				// draw surfaces of static surfaces carry their surface index as object id
+				if (asset->dpvs.surfaceMaterials)
+				{
+					for (unsigned int surf_idx = 0; surf_idx < surfaceCount; ++surf_idx)
+					{
+						auto& fields = surface_materials_sorted[old_to_new_surface_index[surf_idx]].fields;
+						if (fields.objectId == surf_idx)
 						{
-							const auto old_index = asset->shadowGeomOptimized[s].sortedSurfIndex[i];
-							const auto new_index = old_to_new_surface_index.at(old_index);
-							replace_index_at_address(&asset->shadowGeomOptimized[s].sortedSurfIndex[i], new_index);
+							fields.objectId = old_to_new_surface_index[surf_idx];
 						}
 					}
+
+					std::memcpy(asset->dpvs.surfaceMaterials, surface_materials_sorted.data(), sizeof(GfxDrawSurf) * surfaceCount);
+				}
+
+				// bitsets can be shared as well, so every address is only remapped once
+				std::unordered_set<unsigned int*> replaced_bits;
+				for (const auto& [bits, word_count] : surface_bits)
+				{
+					if (!bits || !replaced_bits.insert(bits).second)
+						continue;
+
+					std::vector<unsigned int> remapped(bits, bits + word_count);
+					for (unsigned int surf_idx = 0; surf_idx < surfaceCount; ++surf_idx)
+					{
+						remapped[surf_idx >> 5] &= ~(1u << (surf_idx & 31));
+					}
+
+					for (unsigned int surf_idx = 0; surf_idx < surfaceCount; ++surf_idx)
+					{
+						if (bits[surf_idx >> 5] & (1u << (surf_idx & 31)))
+						{
+							const auto new_idx = old_to_new_surface_index[surf_idx];
+							remapped[new_idx >> 5] |= 1u << (new_idx & 31);
+						}
+					}
+
+					std::memcpy(bits, remapped.data(), sizeof(unsigned int) * word_count);
+				}
+
+				// Remap sorted surface indices based on new order, index arrays can be shared so every address is only remapped once
+				std::unordered_set<unsigned int*> replaced_addresses;
+				for (const auto& [indices, count] : surface_indices)
+				{
+					if (!indices || !replaced_addresses.insert(indices).second)
+						continue;
+
+					for (unsigned int i = 0; i < count; ++i)
+					{
+						indices[i] = old_to_new_surface_index[indices[i]];
+					}
+				}
+
+				if (asset->dpvs.surfaceDeptAndSurf)
+				{
+					for (unsigned int i = 0; i < asset->dpvs.staticSurfaceCount; ++i)
+					{
+						auto& depth_and_surf = asset->dpvs.surfaceDeptAndSurf[i];
+						depth_and_surf.surfIndex = static_cast<int>(old_to_new_surface_index[depth_and_surf.surfIndex]);
+					}
 				}
 
 				// Update surface range information
 				asset->dpvs.litOpaqueSurfsBegin = 0;
-				asset->dpvs.litOpaqueSurfsEnd = static_cast<unsigned int>(opaque.size());
+				asset->dpvs.litOpaqueSurfsEnd = static_cast<unsigned int>(buckets[DPVS_BUCKET_OPAQUE].size());
 				asset->dpvs.litDecalSurfsBegin = asset->dpvs.litOpaqueSurfsEnd;
-				asset->dpvs.litDecalSurfsEnd = asset->dpvs.litDecalSurfsBegin + static_cast<unsigned int>(decal.size());
+				asset->dpvs.litDecalSurfsEnd = asset->dpvs.litDecalSurfsBegin + static_cast<unsigned int>(buckets[DPVS_BUCKET_DECAL].size());
 				asset->dpvs.litTransSurfsBegin = asset->dpvs.litDecalSurfsEnd;
-				asset->dpvs.litTransSurfsEnd = asset->dpvs.litTransSurfsBegin + static_cast<unsigned int>(trans.size());
+				asset->dpvs.litTransSurfsEnd = asset->dpvs.litTransSurfsBegin + static_cast<unsigned int>(buckets[DPVS_BUCKET_TRANS].size());
 				asset->dpvs.shadowCasterSurfsBegin = asset->dpvs.litTransSurfsEnd;
-				asset->dpvs.shadowCasterSurfsEnd = asset->dpvs.shadowCasterSurfsBegin + static_cast<unsigned int>(shadow_caster.size());
+				asset->dpvs.shadowCasterSurfsEnd = asset->dpvs.shadowCasterSurfsBegin + static_cast<unsigned int>(buckets[DPVS_BUCKET_SHADOW_CASTER].size());
 				asset->dpvs.emissiveSurfsBegin = asset->dpvs.shadowCasterSurfsEnd;
-				asset->dpvs.emissiveSurfsEnd = asset->dpvs.emissiveSurfsBegin + static_cast<unsigned int>(emissive.size());
-
-				// Free allocated memory
-				mem->free(surfaces_sorted);
-				mem->free(surface_bounds_sorted);
+				asset->dpvs.emissiveSurfsEnd = asset->dpvs.emissiveSurfsBegin + static_cast<unsigned int>(buckets[DPVS_BUCKET_EMISSIVE].size());
 			}
 			catch (const std::exception& e)
 			{
@@ -398,6 +398,7 @@ namespace zonetool::h1
 				{
 					auto* image = reinterpret_cast<GfxImage*>(img->pointer());
 					image->semantic = data->textureTable[i].semantic;
+					img->cook(image->semantic);
 
 					if (image->semantic == TS_NORMAL_MAP && img->is_iwi && !material::fixed_nml_images_map.contains(image))
 					{
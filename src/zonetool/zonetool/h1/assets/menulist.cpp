@@ -1,6 +1,8 @@
 #include <std_include.hpp>
 #include "menulist.hpp"
 
+#include <utils/cryptography.hpp>
+
 // trash code, ignore all warnings
 #pragma warning( push )
 #pragma warning( disable : 4309)
@@ -729,6 +731,8 @@ namespace zonetool::h1
 		punctuation_s** punctuationtable;
 		token_s token;					//available token
 		script_s* next;					//next script in a chain
+		const include_tokens* cachedtokens;	//pre-tokenized include the tokens are read from
+		std::size_t cachedtoken;		//next token in cachedtokens
 	};
 
 	//macro definitions
@@ -877,10 +881,11 @@ namespace zonetool::h1
 	//list with global defines added to every source loaded
 	define_s* globaldefines;
 
-	source_s* sourceFile;
-	int numtokens;
+	// parser state is kept per thread, so menulists can be parsed side by side
+	thread_local source_s* sourceFile;
+	thread_local int numtokens;
 
-	MenuList* menuList;
+	thread_local MenuList* menuList;
 
 	class menu_memory
 	{
@@ -957,8 +962,10 @@ namespace zonetool::h1
 			return reinterpret_cast<T*>(pointer);
 		}
 	};
-	menu_memory* mmem;
-	zone_memory* zmem;
+	thread_local menu_memory* mmem;
+	thread_local zone_memory* zmem;
+
+	struct include_tokens;
 
 	//read a token from the source
 	int PC_ReadToken(source_s* source, token_s* token);
@@ -1519,6 +1526,62 @@ namespace zonetool::h1
 		return 1;
 	}
 
+	//included files are lexed once, their tokens are cached with the offsets into the
+	//compressed buffer so whitespace and line tracking behave like reading the text
+	struct cached_token
+	{
+		std::string string;
+		int type;
+		int subtype;
+		unsigned int intvalue;
+		long double floatvalue;
+		std::size_t whitespace;
+		std::size_t endwhitespace;
+		std::size_t end;
+		int line;
+		int linescrossed;
+		int endline;
+	};
+
+	struct include_tokens
+	{
+		std::string buffer;
+		std::vector<cached_token> tokens;
+	};
+
+	int PS_ReadCachedToken(script_s* script, token_s* token)
+	{
+		script->lastscript_p = script->script_p;
+		script->lastline = script->line;
+		memset(token, 0, sizeof(token_s));
+
+		const auto& tokens = script->cachedtokens->tokens;
+		if (script->cachedtoken >= tokens.size())
+		{
+			script->script_p = script->end_p;
+			return 0;
+		}
+
+		const auto& cached = tokens[script->cachedtoken++];
+		strncpy_s(token->string, cached.string.data(), _TRUNCATE);
+		token->type = cached.type;
+		token->subtype = cached.subtype;
+		token->intvalue = cached.intvalue;
+		token->floatvalue = cached.floatvalue;
+		token->whitespace_p = script->buffer + cached.whitespace;
+		token->endwhitespace_p = script->buffer + cached.endwhitespace;
+		token->line = cached.line;
+		token->linescrossed = cached.linescrossed;
+
+		script->whitespace_p = token->whitespace_p;
+		script->endwhitespace_p = token->endwhitespace_p;
+		script->script_p = script->buffer + cached.end;
+		script->line = cached.endline;
+
+		memcpy(&script->token, token, sizeof(script->token));
+		return 1;
+	}
+
 	int PS_ReadToken(script_s* script, token_s* token)
 	{
 		if (script->tokenavailable)
@@ -1527,6 +1590,8 @@ namespace zonetool::h1
 			memcpy(token, &script->token, sizeof(token_s));
 			return 1;
 		}
+		if (script->cachedtokens)
+			return PS_ReadCachedToken(script, token);
 		script->lastscript_p = script->script_p;
 		script->lastline = script->line;
 		memset(token, 0, sizeof(token_s));
@@ -3083,7 +3148,17 @@ namespace zonetool::h1
 
 	void SetScriptPunctuations(script_s* script)
 	{
-		PS_CreatePunctuationTable(script, default_punctuations);
+		//the table links the entries of default_punctuations together, so it is built once and shared by all scripts
+		static punctuation_s* punctuationtable[256];
+		static std::once_flag punctuationtable_once;
+		std::call_once(punctuationtable_once, []
+		{
+			script_s table_script{};
+			table_script.punctuationtable = punctuationtable;
+			PS_CreatePunctuationTable(&table_script, default_punctuations);
+		});
+
+		script->punctuationtable = punctuationtable;
 		script->punctuations = default_punctuations;
 	}
 
@@ -3159,6 +3234,95 @@ namespace zonetool::h1
 		return script;
 	}
 
+	std::mutex include_cache_mutex;
+	std::unordered_map<std::string, std::shared_ptr<const include_tokens>> include_cache;
+
+	std::shared_ptr<const include_tokens> TokenizeInclude(const char* filename, std::string data)
+	{
+		auto entry = std::make_shared<include_tokens>();
+		entry->buffer = std::move(data);
+		entry->buffer.resize(Com_Compress(entry->buffer.data()));
+
+		//errors are left to the uncached script, which reports them while parsing
+		auto script = std::make_unique<script_s>();
+		strncpy_s(script->filename, filename, _TRUNCATE);
+		script->buffer = entry->buffer.data();
+		script->length = static_cast<int>(entry->buffer.size());
+		script->script_p = script->buffer;
+		script->lastscript_p = script->buffer;
+		script->end_p = script->buffer + entry->buffer.size();
+		script->line = 1;
+		script->lastline = 1;
+		script->flags = SCFL_NOERRORS;
+		SetScriptPunctuations(script.get());
+
+		auto token = std::make_unique<token_s>();
+		while (PS_ReadToken(script.get(), token.get()))
+		{
+			entry->tokens.push_back({token->string, token->type, token->subtype, token->intvalue, token->floatvalue,
+				static_cast<std::size_t>(token->whitespace_p - script->buffer),
+				static_cast<std::size_t>(token->endwhitespace_p - script->buffer),
+				static_cast<std::size_t>(script->script_p - script->buffer),
+				token->line, token->linescrossed, script->line});
+		}
+
+		if (!EndOfScript(script.get()))
+		{
+			return nullptr;
+		}
+
+		return entry;
+	}
+
+	script_s* LoadIncludeScript(const char* filename)
+	{
+		auto file = filesystem::file(filename);
+		file.open("rb");
+		if (!file.get_fp()) return 0;
+		const auto bytes = file.read_bytes(file.size());
+		file.close();
+
+		std::string data(bytes.begin(), bytes.end());
+		const std::string key = utils::string::va("%s:%016llX", filename, utils::cryptography::fnv1a::compute(data));
+
+		std::shared_ptr<const include_tokens> entry;
+		auto cached = false;
+		{
+			std::lock_guard _(include_cache_mutex);
+			const auto itr = include_cache.find(key);
+			if (itr != include_cache.end())
+			{
+				entry = itr->second;
+				cached = true;
+			}
+		}
+
+		if (!cached)
+		{
+			//lexed without the lock, when two threads lex the same file the first one to finish is kept
+			auto tokens = TokenizeInclude(filename, std::move(data));
+
+			std::lock_guard _(include_cache_mutex);
+			entry = include_cache.try_emplace(key, std::move(tokens)).first->second;
+		}
+
+		if (!entry) return LoadScriptFile(filename);
+
+		//cache entries are never removed, so scripts can point into them
+		auto* script = mmem->allocate<script_s>();
+		strcpy(script->filename, filename);
+		script->buffer = const_cast<char*>(entry->buffer.data());
+		script->length = static_cast<int>(entry->buffer.size());
+		script->script_p = script->buffer;
+		script->lastscript_p = script->buffer;
+		script->end_p = script->buffer + entry->buffer.size();
+		script->line = 1;
+		script->lastline = 1;
+		script->cachedtokens = entry.get();
+		SetScriptPunctuations(script);
+		return script;
+	}
+
 	int PC_Evaluate(source_s* source, int* intvalue, long double* floatvalue, int integer)
 	{
 		int result;
@@ -3454,12 +3618,12 @@ namespace zonetool::h1
 		{
 			StripDoubleQuotes(token.string);
 			PC_ConvertPath(token.string);
-			script = LoadScriptFile(token.string);
+			script = LoadIncludeScript(token.string);
 			if (!script)
 			{
 				strcpy(path, source->includepath);
 				strcat(path, token.string);
-				script = LoadScriptFile(path);
+				script = LoadIncludeScript(path);
 			}
 		}
 		else if (token.type == TT_PUNCTUATION && *token.string == '<')
@@ -3485,7 +3649,7 @@ namespace zonetool::h1
 				return 0;
 			}
 			PC_ConvertPath(path);
-			script = LoadScriptFile(path);
+			script = LoadIncludeScript(path);
 		}
 		else
 		{
@@ -7034,7 +7198,8 @@ namespace zonetool::h1
 
 	parse_itemdef_func* find_itemdef_func(const char* keyword)
 	{
-		if (p_id_funcs.empty())
+		static std::once_flag p_id_funcs_once;
+		std::call_once(p_id_funcs_once, []
 		{
 			p_id_funcs.push_back({ "name", ItemParse_name });
 			p_id_funcs.push_back({ "text", ItemParse_text });
@@ -7117,7 +7282,7 @@ namespace zonetool::h1
 			p_id_funcs.push_back({ "newsfeed", ItemParse_newsfeed });
 			p_id_funcs.push_back({ "glowColor", ItemParse_glowColor });
 			p_id_funcs.push_back({ "decodeEffect", ItemParse_decodeEffect });
-		}
+		});
 
 		for (auto i = 0; i < p_id_funcs.size(); i++)
 		{
@@ -7190,7 +7355,8 @@ namespace zonetool::h1
 
 	parse_menudef_func* find_menudef_func(const char* keyword)
 	{
-		if (p_md_funcs.empty())
+		static std::once_flag p_md_funcs_once;
+		std::call_once(p_md_funcs_once, []
 		{
 			p_md_funcs.push_back({ "name", MenuParse_name });
 			p_md_funcs.push_back({ "fullscreen", MenuParse_fullscreen });
@@ -7236,7 +7402,7 @@ namespace zonetool::h1
 			p_md_funcs.push_back({ "hiddenDuringUI", MenuParse_hiddenDuringUI });
 			p_md_funcs.push_back({ "allowedBinding", MenuParse_allowedBinding });
 			p_md_funcs.push_back({ "textOnlyFocus", MenuParse_textOnlyFocus });
-		}
+		});
 
 		for (auto i = 0; i < p_md_funcs.size(); i++)
 		{
@@ -7385,6 +7551,20 @@ namespace zonetool::h1
 		MenuList* asset = nullptr;
 		menu_memory menu_memory;
 
+		// a menulist parsed while another one is being parsed on this thread gets its own state
+		const auto previous_source = sourceFile;
+		const auto previous_menu_list = menuList;
+		const auto previous_mmem = mmem;
+		const auto previous_zmem = zmem;
+		const auto restore_state = gsl::finally([&]
+		{
+			sourceFile = previous_source;
+			menuList = previous_menu_list;
+			mmem = previous_mmem;
+			zmem = previous_zmem;
+		});
+
+		sourceFile = nullptr;
 		menuList = mem->allocate<MenuList>();
 		menuList->name = mem->duplicate_string(name.data());
 		menuList->menus = mem->allocate<menuDef_t*>(MAX_MENUDEFS_PER_MENULIST);
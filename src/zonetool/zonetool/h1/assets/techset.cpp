@@ -249,11 +249,10 @@ namespace zonetool::h1
 			const auto path = material_data::get_parse_path("constantbuffer", ".cbi", techset, material);
 			auto file = filesystem::file(path);
 			file.open("rb");
-			auto fp = file.get_fp();
 
-			if (fp)
+			if (file.is_open())
 			{
-				fread(indexes, MaterialTechniqueType::TECHNIQUE_COUNT, 1, fp);
+				file.read(indexes, MaterialTechniqueType::TECHNIQUE_COUNT, 1);
 				file.close();
 #ifndef DEEP_LOOK_TECHNIQUES
 				return;
@@ -381,11 +380,10 @@ namespace zonetool::h1
 			const auto path = material_data::get_parse_path("state", ".statebits", techset, material);
 			auto file = filesystem::file(path);
 			file.open("rb");
-			auto fp = file.get_fp();
 
-			if (fp)
+			if (file.is_open())
 			{
-				fread(statebits, MaterialTechniqueType::TECHNIQUE_COUNT, 1, fp);
+				file.read(statebits, MaterialTechniqueType::TECHNIQUE_COUNT, 1);
 				file.close();
 #ifndef DEEP_LOOK_TECHNIQUES
 				return;
@@ -2,6 +2,8 @@
 #include "weaponattachment.hpp"
 #include "weapondef.hpp"
 
+#include "zonetool/utils/json_fields.hpp"
+
 namespace zonetool::h1
 {
 	namespace
@@ -889,73 +891,69 @@ namespace zonetool::h1
 		return nullptr;
 	}
 
-#define ATTACHMENT_READ_FIELD(__type__, __field__) \
-	if(!data[#__field__].is_null()) \
-	{ \
-		attachment->__field__ = data[#__field__].get<__type__>(); \
-	}
-
-#define ATTACHMENT_READ_FIELD_RENAME(__type__, __field__, __name__) \
-	if(!data[__name__].is_null()) \
-	{ \
-		attachment->__field__ = data[__name__].get<__type__>(); \
-	}
-
-#define ATTACHMENT_READ_ASSET_ARR(__type__, __field__, __size__) \
-	if (!data[#__field__].is_null()) \
-	{ \
-		attachment->__field__ = mem->allocate<typename std::remove_reference<decltype(*attachment->__field__)>::type>(__size__); \
-		for (auto idx##__field__ = 0; idx##__field__ < __size__; idx##__field__++) \
-		{ \
-			auto asset##__field__ = data[#__field__][idx##__field__].get<std::string>(); \
-			if (asset##__field__.empty()) \
-			{ \
-				attachment->__field__[idx##__field__] = nullptr; \
-			} \
-			else \
-			{ \
-				attachment->__field__[idx##__field__] = mem->manual_allocate<typename std::remove_reference<decltype(*attachment->__field__[idx##__field__])>::type>(sizeof(const char*)); \
-				attachment->__field__[idx##__field__]->name = mem->duplicate_string(asset##__field__); \
-			} \
-		} \
-	} \
-	else \
-	{ \
-		attachment->__field__ = nullptr; \
-	}
-
-	void parse_charge_info(AttChargeInfo* attachment, ordered_json& data, zone_memory* mem)
+	constexpr auto charge_info_fields = json_fields::make_field_table<AttChargeInfo>(
 	{
-		ATTACHMENT_READ_FIELD(float, minChargeTime);
-		ATTACHMENT_READ_FIELD(float, overChargeTime);
-		ATTACHMENT_READ_FIELD(float, timePerChargeShot);
-		ATTACHMENT_READ_FIELD(int, maxChargeShots);
-		ATTACHMENT_READ_FIELD(float, minChargeAngle);
-		ATTACHMENT_READ_FIELD(float, maxChargeAngle);
-		ATTACHMENT_READ_FIELD(bool, autoFireOnMaxCharge);
-	}
-
-	void parse_hybrid_settings(AttHybridSettings* attachment, ordered_json& data, zone_memory* mem)
+		JSON_FIELD(AttChargeInfo, float, minChargeTime),
+		JSON_FIELD(AttChargeInfo, float, overChargeTime),
+		JSON_FIELD(AttChargeInfo, float, timePerChargeShot),
+		JSON_FIELD(AttChargeInfo, int, maxChargeShots),
+		JSON_FIELD(AttChargeInfo, float, minChargeAngle),
+		JSON_FIELD(AttChargeInfo, float, maxChargeAngle),
+		JSON_FIELD(AttChargeInfo, bool, autoFireOnMaxCharge)
+	});
+
+	constexpr auto hybrid_settings_fields = json_fields::make_field_table<AttHybridSettings>(
 	{
-		ATTACHMENT_READ_FIELD(float, adsSpread);
-		ATTACHMENT_READ_FIELD(float, adsAimPitch);
-		ATTACHMENT_READ_FIELD(float, adsTransInTime);
-		ATTACHMENT_READ_FIELD(float, adsTransInFromSprintTime);
-		ATTACHMENT_READ_FIELD(float, adsTransOutTime);
-		ATTACHMENT_READ_FIELD(int, adsReloadTransTime);
-		ATTACHMENT_READ_FIELD(float, adsCrosshairInFrac);
-		ATTACHMENT_READ_FIELD(float, adsCrosshairOutFrac);
-		ATTACHMENT_READ_FIELD(float, adsZoomFov);
-		ATTACHMENT_READ_FIELD(float, adsZoomInFrac);
-		ATTACHMENT_READ_FIELD(float, adsZoomOutFrac);
-		ATTACHMENT_READ_FIELD(float, adsFovLerpInTime);
-		ATTACHMENT_READ_FIELD(float, adsFovLerpOutTime);
-		ATTACHMENT_READ_FIELD(float, adsBobFactor);
-		ATTACHMENT_READ_FIELD(float, adsViewBobMult);
-		ATTACHMENT_READ_FIELD(float, adsViewErrorMin);
-		ATTACHMENT_READ_FIELD(float, adsViewErrorMax);
-		ATTACHMENT_READ_FIELD(float, adsFireAnimFrac);
-	}
+		JSON_FIELD(AttHybridSettings, float, adsSpread),
+		JSON_FIELD(AttHybridSettings, float, adsAimPitch),
+		JSON_FIELD(AttHybridSettings, float, adsTransInTime),
+		JSON_FIELD(AttHybridSettings, float, adsTransInFromSprintTime),
+		JSON_FIELD(AttHybridSettings, float, adsTransOutTime),
+		JSON_FIELD(AttHybridSettings, int, adsReloadTransTime),
+		JSON_FIELD(AttHybridSettings, float, adsCrosshairInFrac),
+		JSON_FIELD(AttHybridSettings, float, adsCrosshairOutFrac),
+		JSON_FIELD(AttHybridSettings, float, adsZoomFov),
+		JSON_FIELD(AttHybridSettings, float, adsZoomInFrac),
+		JSON_FIELD(AttHybridSettings, float, adsZoomOutFrac),
+		JSON_FIELD(AttHybridSettings, float, adsFovLerpInTime),
+		JSON_FIELD(AttHybridSettings, float, adsFovLerpOutTime),
+		JSON_FIELD(AttHybridSettings, float, adsBobFactor),
+		JSON_FIELD(AttHybridSettings, float, adsViewBobMult),
+		JSON_FIELD(AttHybridSettings, float, adsViewErrorMin),
+		JSON_FIELD(AttHybridSettings, float, adsViewErrorMax),
+		JSON_FIELD(AttHybridSettings, float, adsFireAnimFrac)
+	});
+
+	constexpr auto attachment_fields = json_fields::make_field_table<WeaponAttachment>(
+	{
+		JSON_FIELD_STRING_NAMED(WeaponAttachment, szInternalName, "internalName"),
+		JSON_FIELD_STRING_NAMED(WeaponAttachment, szDisplayName, "displayName"),
+
+		JSON_FIELD(WeaponAttachment, AttachmentType, type),
+		JSON_FIELD(WeaponAttachment, weapType_t, weaponType),
+		JSON_FIELD_NAMED(WeaponAttachment, weapClass_t, weapClass, "weaponClass"),
+		JSON_FIELD(WeaponAttachment, weapGreebleType_t, greebleType),
+
+		JSON_FIELD_ASSET_ARR(WeaponAttachment, worldModels, 2),
+		JSON_FIELD_ASSET_ARR(WeaponAttachment, viewModels, 2),
+		JSON_FIELD_ASSET_ARR(WeaponAttachment, reticleViewModels, 64),
+
+		JSON_FIELD_ASSET_ARR(WeaponAttachment, bounceSounds, 53),
+		JSON_FIELD_ASSET_ARR(WeaponAttachment, rollingSounds, 53),
+
+		//JSON_FIELD(WeaponAttachment, int, loadIndex), // runtime data, most likely
+
+		//JSON_FIELD(WeaponAttachment, int, unused1),
+		JSON_FIELD(WeaponAttachment, bool, isAlternateAmmo),
+		JSON_FIELD(WeaponAttachment, bool, hideIronSightsWithThisAttachment),
+		JSON_FIELD(WeaponAttachment, bool, showMasterRail),
+		JSON_FIELD(WeaponAttachment, bool, showSideRail),
+		JSON_FIELD(WeaponAttachment, bool, shareAmmoWithAlt),
+		JSON_FIELD(WeaponAttachment, bool, knifeAlwaysAttached),
+		JSON_FIELD(WeaponAttachment, bool, riotShield),
+		JSON_FIELD(WeaponAttachment, bool, automaticAttachment),
+		//JSON_FIELD(WeaponAttachment, int, unused3),
+	});
 
 	WeaponAttachment* weapon_attachment::parse(const std::string& name, zone_memory* mem)
 	{
@@ -974,100 +972,75 @@ namespace zonetool::h1
 		auto size = file.size();
 		auto bytes = file.read_bytes(size);
 		file.close();
-		ordered_json data = json::parse(bytes);
+		const json data = json::parse(bytes);
 
 		auto* attachment = mem->allocate<WeaponAttachment>();
 
-		if (!data["internalName"].is_null())
-		{
-			attachment->szInternalName = mem->duplicate_string(data["internalName"].get<std::string>());
-		}
-
-		if (!data["displayName"].is_null())
-		{
-			attachment->szDisplayName = mem->duplicate_string(data["displayName"].get<std::string>());
-		}
-
-		ATTACHMENT_READ_FIELD(AttachmentType, type);
-		ATTACHMENT_READ_FIELD_RENAME(weapType_t, weaponType, "weaponType");
-		ATTACHMENT_READ_FIELD_RENAME(weapClass_t, weapClass, "weaponClass");
-		ATTACHMENT_READ_FIELD_RENAME(weapGreebleType_t, greebleType, "greebleType");
-
-		ATTACHMENT_READ_ASSET_ARR(ASSET_TYPE_XMODEL, worldModels, 2);
-		ATTACHMENT_READ_ASSET_ARR(ASSET_TYPE_XMODEL, viewModels, 2);
-		ATTACHMENT_READ_ASSET_ARR(ASSET_TYPE_XMODEL, reticleViewModels, 64);
-
-		ATTACHMENT_READ_ASSET_ARR(ASSET_TYPE_SOUND, bounceSounds, 53);
-		ATTACHMENT_READ_ASSET_ARR(ASSET_TYPE_SOUND, rollingSounds, 53);
+		attachment_fields.read(attachment, data, mem);
 
-		if (!data["chargeInfo"].is_null())
+		if (const auto& charge_info = json_fields::get(data, "chargeInfo"); !charge_info.is_null())
 		{
 			attachment->chargeInfo = mem->allocate<AttChargeInfo>();
-			parse_charge_info(attachment->chargeInfo, data["chargeInfo"], mem);
-		}
-		else
-		{
-			attachment->chargeInfo = nullptr;
+			charge_info_fields.read(attachment->chargeInfo, charge_info, mem);
 		}
 
-		if (!data["hybridSettings"].is_null())
+		if (const auto& hybrid_settings = json_fields::get(data, "hybridSettings"); !hybrid_settings.is_null())
 		{
 			attachment->hybridSettings = mem->allocate<AttHybridSettings>();
-			parse_hybrid_settings(attachment->hybridSettings, data["hybridSettings"], mem);
-		}
-		else
-		{
-			attachment->hybridSettings = nullptr;
+			hybrid_settings_fields.read(attachment->hybridSettings, hybrid_settings, mem);
 		}
 
+		const auto& hide_tags = json_fields::get(data, "hideTags");
 		attachment->hideTags = mem->allocate<scr_string_t>(4);
 		for (auto i = 0; i < 4; i++)
 		{
-			this->add_script_string(&attachment->hideTags[i], mem->duplicate_string(data["hideTags"][i].get<std::string>()));
+			this->add_script_string(&attachment->hideTags[i], mem->duplicate_string(hide_tags.at(i).get<std::string>()));
 		}
 
+		const auto& show_tags = json_fields::get(data, "showTags");
 		attachment->showTags = mem->allocate<scr_string_t>(4);
 		for (auto i = 0; i < 4; i++)
 		{
-			this->add_script_string(&attachment->showTags[i], mem->duplicate_string(data["showTags"][i].get<std::string>()));
+			this->add_script_string(&attachment->showTags[i], mem->duplicate_string(show_tags.at(i).get<std::string>()));
 		}
 
-		if (!data["fields"].is_null())
+		if (const auto& fields = json_fields::get(data, "fields"); !fields.is_null())
 		{
-			attachment->numFields = static_cast<unsigned int>(data["fields"].size());
+			attachment->numFields = static_cast<unsigned int>(fields.size());
 			attachment->fieldOffsets = mem->allocate<unsigned short>(attachment->numFields);
 			attachment->fields = mem->allocate<WAField>(attachment->numFields);
 
 			std::vector<field_info> sorted_fields;
 			for (auto i = 0u; i < attachment->numFields; i++)
 			{
+				const auto& entry = fields[i];
 				field_info info{};
 
 				info.json_index = i;
-				info.type = data["fields"][i]["type"].get<unsigned char>();
-				info.code = data["fields"][i]["code"].get<unsigned char>();
+				info.type = entry.at("type").get<unsigned char>();
+				info.code = entry.at("code").get<unsigned char>();
 
-				if (data["fields"][i]["offset"].is_number())
+				if (const auto& offset = json_fields::get(entry, "offset"); offset.is_number())
 				{
-					info.offset = data["fields"][i]["offset"].get<unsigned short>();
+					info.offset = offset.get<unsigned short>();
 
 				}
-				else if (data["fields"][i]["name"].is_string())
+				else if (const auto& field_name = json_fields::get(entry, "name"); field_name.is_string())
 				{
-					info.offset = weapon_field_to_offset(data["fields"][i]["name"].get<std::string>());
+					info.offset = weapon_field_to_offset(field_name.get<std::string>());
 				}
 				else
 				{
 					ZONETOOL_FATAL("Invalid WAField offset/name value");
 				}
 
-				if (data["fields"][i]["index"].is_number())
+				if (const auto& index = json_fields::get(entry, "index"); index.is_number())
 				{
-					info.index = data["fields"][i]["index"].get<unsigned char>();
+					info.index = index.get<unsigned char>();
 				}
-				else if (info.type == WAFIELD_TYPE_ANIM && data["fields"][i]["anim"].is_string())
+				else if (const auto& anim = json_fields::get(entry, "anim"); info.type == WAFIELD_TYPE_ANIM && anim.is_string())
 				{
-					info.index = get_anim_index(data["fields"][i]["anim"].get<std::string>());
+					info.index = get_anim_index(anim.get<std::string>());
 				}
 				else
 				{
@@ -1090,7 +1063,7 @@ namespace zonetool::h1
 			for (auto f = 0; f < sorted_fields.size(); f++)
 			{
 				const auto& field = sorted_fields[f];
-				const auto i = field.json_index;
+				const auto& value = json_fields::get(fields[field.json_index], "value");
 
 				attachment->fieldOffsets[f] = field.offset;
 				attachment->fields[f].code = field.code;
@@ -1107,23 +1080,23 @@ namespace zonetool::h1
 					type == WAFIELD_TYPE_SOUND ||
 					type == WAFIELD_TYPE_TRACER)
 				{
-					attachment->fields[f].parm.string = mem->duplicate_string(data["fields"][i]["value"].get<std::string>());
+					attachment->fields[f].parm.string = mem->duplicate_string(value.get<std::string>());
 				}
 				else if (type == WAFIELD_TYPE_INT)
 				{
-					attachment->fields[f].parm.p_float = static_cast<float>(data["fields"][i]["value"].get<int>());
+					attachment->fields[f].parm.p_float = static_cast<float>(value.get<int>());
 				}
 				else if (type == WAFIELD_TYPE_BOOL)
 				{
-					attachment->fields[f].parm.p_bool = data["fields"][i]["value"].get<bool>();
+					attachment->fields[f].parm.p_bool = value.get<bool>();
 				}
 				else if (type == WAFIELD_TYPE_FLOAT)
 				{
-					attachment->fields[f].parm.p_float = data["fields"][i]["value"].get<float>();
+					attachment->fields[f].parm.p_float = value.get<float>();
 				}
 				else if (type == WAFIELD_TYPE_FLOAT32)
 				{
-					attachment->fields[f].parm.p_float = static_cast<float>(data["fields"][i]["value"].get<int>() / 1000.0f);
+					attachment->fields[f].parm.p_float = static_cast<float>(value.get<int>() / 1000.0f);
 				}
 				else
 				{
@@ -1131,25 +1104,6 @@ namespace zonetool::h1
 				}
 			}
 		}
-		else
-		{
-			attachment->fieldOffsets = nullptr;
-			attachment->fields = nullptr;
-			attachment->numFields = 0;
-		}
-
-		//ATTACHMENT_READ_FIELD(int, loadIndex); // runtime data, most likely
-
-		//ATTACHMENT_READ_FIELD(int, unused1);
-		ATTACHMENT_READ_FIELD(bool, isAlternateAmmo);
-		ATTACHMENT_READ_FIELD(bool, hideIronSightsWithThisAttachment);
-		ATTACHMENT_READ_FIELD(bool, showMasterRail);
-		ATTACHMENT_READ_FIELD(bool, showSideRail);
-		ATTACHMENT_READ_FIELD(bool, shareAmmoWithAlt);
-		ATTACHMENT_READ_FIELD(bool, knifeAlwaysAttached);
-		ATTACHMENT_READ_FIELD(bool, riotShield);
-		ATTACHMENT_READ_FIELD(bool, automaticAttachment);
-		//ATTACHMENT_READ_FIELD(int, unused3);
 
 		return attachment;
 	}
@@ -1,8 +1,38 @@
 #include "std_include.hpp"
 #include "xmodel.hpp"
 
+#include "xsurface.hpp"
+
 namespace zonetool::h1
 {
+	namespace
+	{
+		// generated lods have to save at least this much over the previous lod
+		constexpr auto max_generated_lod_tri_share = 0.95f;
+
+		std::vector<xmodel::generated_lod> generated_lods;
+
+		std::size_t get_tri_count(const XModelSurfs* surfs)
+		{
+			std::size_t count = 0;
+			for (unsigned short i = 0; i < surfs->numsurfs; i++)
+			{
+				count += surfs->surfs[i].triCount;
+			}
+
+			return count;
+		}
+	}
+
+	void xmodel::set_generated_lods(const std::vector<generated_lod>& lods)
+	{
+		generated_lods = lods;
+		std::sort(generated_lods.begin(), generated_lods.end(), [](const generated_lod& a, const generated_lod& b)
+		{
+			return a.dist < b.dist;
+		});
+	}
+
 	void xmodel::add_script_string(scr_string_t* ptr, const char* str)
 	{
 		for (std::uint32_t i = 0; i < this->script_strings.size(); i++)
@@ -123,6 +153,7 @@ namespace zonetool::h1
 	void xmodel::init(const std::string& name, zone_memory* mem)
 	{
 		this->name_ = name;
+		this->mem_ = mem;
 
 		if (this->referenced())
 		{
@@ -180,6 +211,117 @@ namespace zonetool::h1
 		}
 	}
 
+	void xmodel::generate_lods(zone_base* zone)
+	{
+		auto* data = this->asset_;
+		if (generated_lods.empty() || this->referenced() || data->numLods != 1 || !data->lodInfo[0].modelSurfs)
+		{
+			return;
+		}
+
+		auto* source_asset = zone->find_asset(ASSET_TYPE_XMODEL_SURFS, data->lodInfo[0].modelSurfs->name);
+		if (!source_asset || source_asset->referenced() || !source_asset->pointer())
+		{
+			return;
+		}
+
+		const auto* source = reinterpret_cast<XModelSurfs*>(source_asset->pointer());
+		const auto& lod0 = data->lodInfo[0];
+		if (!source->surfs || source->numsurfs != lod0.numsurfs || lod0.surfIndex + lod0.numsurfs > data->numsurfs)
+		{
+			return;
+		}
+
+		// lod0 used to be drawn up to this distance, 0 draws it at any distance
+		const auto max_dist = lod0.dist;
+
+		std::vector<XModelSurfs*> lods = {data->lodInfo[0].modelSurfs};
+		std::vector<float> dists;
+		auto previous_tri_count = get_tri_count(source);
+
+		for (const auto& lod : generated_lods)
+		{
+			if (lods.size() >= 6 || data->numsurfs + source->numsurfs * lods.size() > 255)
+			{
+				break;
+			}
+
+			if (max_dist > 0.0f && lod.dist >= max_dist)
+			{
+				break;
+			}
+
+			const auto name = utils::string::va("%s_glod%zu", source->name, lods.size());
+			auto* surfs = xsurface::generate_lod(source, lod.ratio, name, this->mem_);
+
+			const auto tri_count = get_tri_count(surfs);
+			if (tri_count > previous_tri_count * max_generated_lod_tri_share)
+			{
+				continue;
+			}
+
+			ZONETOOL_INFO("Generated LOD%zu of \"%s\": %zu -> %zu triangles", lods.size(), data->name,
+				get_tri_count(source), tri_count);
+
+			lods.emplace_back(surfs);
+			dists.emplace_back(lod.dist);
+			previous_tri_count = tri_count;
+		}
+
+		if (lods.size() == 1)
+		{
+			return;
+		}
+
+		// every lod gets its own copy of the lod0 materials
+		const auto numsurfs = data->numsurfs + source->numsurfs * (lods.size() - 1);
+
+		auto* material_handles = this->mem_->allocate<Material*>(numsurfs);
+		std::memcpy(material_handles, data->materialHandles, sizeof(Material*) * data->numsurfs);
+
+		unsigned short* inv_high_mip_radius = nullptr;
+		if (data->invHighMipRadius)
+		{
+			inv_high_mip_radius = this->mem_->allocate<unsigned short>(numsurfs);
+			std::memcpy(inv_high_mip_radius, data->invHighMipRadius, sizeof(unsigned short) * data->numsurfs);
+		}
+
+		std::vector<void*> pointers;
+		for (auto i = 1u; i < lods.size(); i++)
+		{
+			const auto surf_index = data->numsurfs + source->numsurfs * (i - 1);
+			for (unsigned short o = 0; o < source->numsurfs; o++)
+			{
+				material_handles[surf_index + o] = data->materialHandles[lod0.surfIndex + o];
+				if (inv_high_mip_radius)
+				{
+					inv_high_mip_radius[surf_index + o] = data->invHighMipRadius[lod0.surfIndex + o];
+				}
+			}
+
+			auto& info = data->lodInfo[i];
+			info = lod0;
+			info.surfIndex = static_cast<unsigned short>(surf_index);
+			info.modelSurfs = lods[i];
+			info.surfs = nullptr;
+			info.subdivLodValidMask = 0;
+			info.flags &= ~(XMODEL_LODINFO_FLAG_SUBDIV | XMODEL_LODINFO_FLAG_SUBDIV_NON_ADAPTIVE);
+
+			// each lod is drawn until the next one takes over, the last one as far as lod0 used to be
+			data->lodInfo[i - 1].dist = dists[i - 1];
+			info.dist = i + 1 < lods.size() ? dists[i] : max_dist;
+
+			pointers.emplace_back(lods[i]);
+		}
+
+		data->materialHandles = material_handles;
+		data->invHighMipRadius = inv_high_mip_radius;
+		data->numsurfs = static_cast<unsigned char>(numsurfs);
+		data->numLods = static_cast<char>(lods.size());
+
+		zone->add_assets_of_type_by_pointer(ASSET_TYPE_XMODEL_SURFS, pointers);
+	}
+
 	void xmodel::load_depending(zone_base* zone)
 	{
 		auto* data = this->asset_;
@@ -202,6 +344,8 @@ namespace zonetool::h1
 			}
 		}
 
+		this->generate_lods(zone);
+
 		// PhysCollmap
 		if (data->physCollmap)
 		{
@@ -8,12 +8,21 @@ namespace zonetool::h1
 	private:
 		std::string name_;
 		XModel* asset_ = nullptr;
+		zone_memory* mem_ = nullptr;
 
 		std::vector<std::pair<scr_string_t*, const char*>> script_strings;
 		void add_script_string(scr_string_t* ptr, const char* str);
 		const char* get_script_string(scr_string_t* ptr);
 
+		void generate_lods(zone_base* zone);
+
 	public:
+		struct generated_lod
+		{
+			float ratio; // share of the lod0 triangles to keep
+			float dist; // distance the lod is drawn from
+		};
+
 		XModel* parse(std::string name, zone_memory* mem);
 
 		void init(const std::string& name, zone_memory* mem) override;
@@ -27,5 +36,8 @@ namespace zonetool::h1
 		void write(zone_base* zone, zone_buffer* buffer) override;
 
 		static void dump(XModel* asset);
+
+		// models that only have lod0 get these lods generated when building (-generatelods), empty disables it
+		static void set_generated_lods(const std::vector<generated_lod>& lods);
 	};
 }
\ No newline at end of file
@@ -1,6 +1,12 @@
 #include "std_include.hpp"
 #include "xsurface.hpp"
 
+#include "zonetool/utils/collision_tree.hpp"
+#include "zonetool/utils/mesh_simplify.hpp"
+#include "zonetool/utils/vertex_cache.hpp"
+
+#include <utils/concurrency.hpp>
+
 namespace zonetool::h1
 {
 	void parse_subdiv(XSurface* surf, assetmanager::reader& reader)
@@ -33,6 +39,685 @@ namespace zonetool::h1
 		}
 	}
 
+	namespace
+	{
+		struct surface_statistics
+		{
+			std::size_t triangles;
+			std::size_t misses_before;
+			std::size_t misses_after;
+		};
+
+		void reorder_vertex_stream(void* data, const std::size_t stride, const std::vector<std::uint16_t>& order)
+		{
+			if (!data)
+			{
+				return;
+			}
+
+			auto* bytes = static_cast<std::uint8_t*>(data);
+			const std::vector<std::uint8_t> copy(bytes, bytes + stride * order.size());
+			for (auto i = 0u; i < order.size(); i++)
+			{
+				std::memcpy(bytes + i * stride, copy.data() + order[i] * stride, stride);
+			}
+		}
+
+		// vertices of skinned, subdivided or tension surfaces are laid out in blend groups that
+		// other streams depend on, only their triangles are reordered
+		bool can_reorder_vertices(const XSurface* surf)
+		{
+			for (const auto count : surf->blendVertCounts)
+			{
+				if (count)
+				{
+					return false;
+				}
+			}
+
+			return surf->verts0.verts0 && !surf->subdiv && !surf->tensionData && !surf->tensionAccumTable;
+		}
+
+		void reorder_triangles(XSurface* surf, const xsurface::collision_trees& built_trees)
+		{
+			std::vector<std::uint32_t> bounds = {0, surf->triCount};
+			std::vector<bool> locked(surf->triCount, false);
+			for (unsigned char i = 0; surf->rigidVertLists && i < surf->rigidVertListCount; i++)
+			{
+				const auto& list = surf->rigidVertLists[i];
+				const auto begin = std::min<std::uint32_t>(list.triOffset, surf->triCount);
+				const auto end = std::min<std::uint32_t>(list.triOffset + list.triCount, surf->triCount);
+				bounds.emplace_back(begin);
+				bounds.emplace_back(end);
+
+				if (!list.collisionTree)
+				{
+					continue;
+				}
+
+				// leafs of the trees built by collision_tree::build own the triangles up to the next leaf, so triangles
+				// only move within a leaf. other trees index their list in a layout that isn't known, those lists stay as they are
+				if (!built_trees.contains(list.collisionTree))
+				{
+					std::fill(locked.begin() + begin, locked.begin() + end, true);
+					continue;
+				}
+
+				for (auto o = 0u; o < list.collisionTree->leafCount; o++)
+				{
+					bounds.emplace_back(std::min<std::uint32_t>(list.collisionTree->leafs[o].triangleBeginIndex, surf->triCount));
+				}
+			}
+
+			std::sort(bounds.begin(), bounds.end());
+			bounds.erase(std::unique(bounds.begin(), bounds.end()), bounds.end());
+
+			const std::vector<Face> faces(surf->triIndices, surf->triIndices + surf->triCount);
+			std::vector<Face> faces2;
+			if (surf->triIndices2)
+			{
+				faces2.assign(surf->triIndices2, surf->triIndices2 + surf->triCount);
+			}
+
+			// each rigid list draws its own triangle range, reorder within those ranges only
+			for (auto i = 0u; i + 1 < bounds.size(); i++)
+			{
+				const auto begin = bounds[i];
+				const auto end = bounds[i + 1];
+				if (end - begin < 2 || locked[begin])
+				{
+					continue;
+				}
+
+				const auto order = vertex_cache::optimize_triangle_order(
+					reinterpret_cast<const std::uint16_t*>(&faces[begin]), end - begin);
+
+				for (auto o = 0u; o < order.size(); o++)
+				{
+					surf->triIndices[begin + o] = faces[begin + order[o]];
+					if (surf->triIndices2)
+					{
+						surf->triIndices2[begin + o] = faces2[begin + order[o]];
+					}
+				}
+			}
+		}
+
+		void reorder_vertices(XSurface* surf)
+		{
+			const auto vert_count = surf->vertCount;
+
+			// rigid lists own consecutive vertex ranges, vertices never move between them
+			std::vector<std::uint16_t> segment_of(vert_count);
+			std::vector<std::uint32_t> next_slot;
+			{
+				std::uint32_t offset = 0;
+				for (unsigned char i = 0; surf->rigidVertLists && i < surf->rigidVertListCount; i++)
+				{
+					const auto end = std::min<std::uint32_t>(offset + surf->rigidVertLists[i].vertCount, vert_count);
+					for (auto v = offset; v < end; v++)
+					{
+						segment_of[v] = static_cast<std::uint16_t>(next_slot.size());
+					}
+
+					next_slot.emplace_back(offset);
+					offset = end;
+				}
+
+				for (auto v = offset; v < vert_count; v++)
+				{
+					segment_of[v] = static_cast<std::uint16_t>(next_slot.size());
+				}
+
+				next_slot.emplace_back(offset);
+			}
+
+			constexpr auto unassigned = std::numeric_limits<std::uint16_t>::max();
+			std::vector<std::uint16_t> remap(vert_count, unassigned);
+			std::vector<std::uint16_t> order(vert_count);
+
+			const auto assign = [&](const std::uint16_t vertex)
+			{
+				if (vertex >= vert_count || remap[vertex] != unassigned)
+				{
+					return;
+				}
+
+				const auto slot = static_cast<std::uint16_t>(next_slot[segment_of[vertex]]++);
+				remap[vertex] = slot;
+				order[slot] = vertex;
+			};
+
+			// fetch order follows first use, unused vertices keep their relative order at the end of their range
+			const auto* indices = reinterpret_cast<const std::uint16_t*>(surf->triIndices);
+			for (auto i = 0u; i < surf->triCount * 3u; i++)
+			{
+				assign(indices[i]);
+			}
+
+			for (auto v = 0u; v < vert_count; v++)
+			{
+				assign(static_cast<std::uint16_t>(v));
+			}
+
+			const auto remap_faces = [&](Face* faces)
+			{
+				for (auto i = 0u; faces && i < surf->triCount; i++)
+				{
+					if (faces[i].v1 < vert_count) faces[i].v1 = remap[faces[i].v1];
+					if (faces[i].v2 < vert_count) faces[i].v2 = remap[faces[i].v2];
+					if (faces[i].v3 < vert_count) faces[i].v3 = remap[faces[i].v3];
+				}
+			};
+
+			remap_faces(surf->triIndices);
+			remap_faces(surf->triIndices2);
+
+			for (unsigned int i = 0; surf->blendShapes && i < surf->blendShapesCount; i++)
+			{
+				auto& shape = surf->blendShapes[i];
+				for (unsigned int o = 0; shape.verts && o < shape.vertCount; o++)
+				{
+					const auto index = shape.verts[o].vertIndex;
+					if (index >= 0 && index < vert_count)
+					{
+						shape.verts[o].vertIndex = remap[index];
+					}
+				}
+			}
+
+			reorder_vertex_stream(surf->verts0.verts0,
+				(surf->flags & 8) != 0 ? sizeof(GfxPackedMotionVertex) : sizeof(GfxPackedVertex), order);
+			reorder_vertex_stream(surf->unknown0, sizeof(UnknownXSurface0), order);
+			reorder_vertex_stream(surf->blendVertsTable, sizeof(BlendVertsUnknown), order);
+			reorder_vertex_stream(surf->lmapUnwrap, sizeof(alignVertBufFloat16Vec2_t), order);
+		}
+
+		surface_statistics optimize_surface(XSurface* surf, const xsurface::collision_trees& built_trees)
+		{
+			surface_statistics stats{};
+			stats.triangles = surf->triCount;
+
+			if (!surf->triIndices || !surf->triCount)
+			{
+				return stats;
+			}
+
+			const auto* indices = reinterpret_cast<const std::uint16_t*>(surf->triIndices);
+			stats.misses_before = vertex_cache::count_cache_misses(indices, surf->triCount);
+
+			// subdiv levels reference the base triangles and vertices directly
+			if (surf->subdiv)
+			{
+				stats.misses_after = stats.misses_before;
+				return stats;
+			}
+
+			reorder_triangles(surf, built_trees);
+
+			if (can_reorder_vertices(surf))
+			{
+				reorder_vertices(surf);
+			}
+
+			stats.misses_after = vertex_cache::count_cache_misses(indices, surf->triCount);
+			return stats;
+		}
+	}
+
+	namespace
+	{
+		collision_tree::mesh get_collision_mesh(const XSurface* surf, const XRigidVertList& list)
+		{
+			collision_tree::mesh mesh{};
+			mesh.positions = surf->verts0.packedVerts0->xyz;
+			mesh.position_stride = (surf->flags & 8) != 0 ? sizeof(GfxPackedMotionVertex) : sizeof(GfxPackedVertex);
+			mesh.vertex_count = surf->vertCount;
+			mesh.indices = reinterpret_cast<const std::uint16_t*>(surf->triIndices + list.triOffset);
+			mesh.tri_count = list.triCount;
+			return mesh;
+		}
+
+		// trees that don't cover the triangles of their list (anymore), converted models can have those
+		bool is_collision_tree_valid(const XSurface* surf, const XRigidVertList& list)
+		{
+			const auto* tree = list.collisionTree;
+			if (!tree->nodes || !tree->leafs || list.triOffset + list.triCount > surf->triCount)
+			{
+				return false;
+			}
+
+			std::vector<collision_tree::node> nodes(tree->nodeCount);
+			for (auto i = 0u; i < tree->nodeCount; i++)
+			{
+				const auto& node = tree->nodes[i];
+				std::memcpy(nodes[i].mins, node.aabb.mins, sizeof(nodes[i].mins));
+				std::memcpy(nodes[i].maxs, node.aabb.maxs, sizeof(nodes[i].maxs));
+				nodes[i].child_begin = node.childBeginIndex;
+				nodes[i].child_count = node.childCount;
+			}
+
+			// leafs index the triangles of the whole surface
+			std::vector<std::uint16_t> leafs(tree->leafCount);
+			for (auto i = 0u; i < tree->leafCount; i++)
+			{
+				if (tree->leafs[i].triangleBeginIndex < list.triOffset)
+				{
+					return false;
+				}
+
+				leafs[i] = static_cast<std::uint16_t>(tree->leafs[i].triangleBeginIndex - list.triOffset);
+			}
+
+			return collision_tree::validate(get_collision_mesh(surf, list), tree->trans, tree->scale, nodes.data(), nodes.size(),
+				leafs.data(), leafs.size());
+		}
+
+		XSurfaceCollisionTree* build_collision_tree(XSurface* surf, const XRigidVertList& list, zone_memory* mem)
+		{
+			if (list.triOffset + list.triCount > surf->triCount || !list.triCount)
+			{
+				return nullptr;
+			}
+
+			auto* faces = surf->triIndices + list.triOffset;
+			auto mesh = get_collision_mesh(surf, list);
+
+			const auto tree = collision_tree::build(mesh);
+			if (!tree)
+			{
+				return nullptr;
+			}
+
+			// the leafs own consecutive triangles
+			std::vector<Face> new_faces(list.triCount);
+			std::vector<Face> new_faces2(surf->triIndices2 ? list.triCount : 0);
+			for (auto i = 0u; i < list.triCount; i++)
+			{
+				new_faces[i] = faces[tree->triangle_order[i]];
+				if (surf->triIndices2)
+				{
+					new_faces2[i] = surf->triIndices2[list.triOffset + tree->triangle_order[i]];
+				}
+			}
+
+			mesh.indices = reinterpret_cast<const std::uint16_t*>(new_faces.data());
+			if (!collision_tree::validate(mesh, tree->trans, tree->scale, tree->nodes.data(), tree->nodes.size(),
+				tree->leafs.data(), tree->leafs.size()))
+			{
+				return nullptr;
+			}
+
+			std::memcpy(faces, new_faces.data(), sizeof(Face) * list.triCount);
+			if (surf->triIndices2)
+			{
+				std::memcpy(surf->triIndices2 + list.triOffset, new_faces2.data(), sizeof(Face) * list.triCount);
+			}
+
+			auto* new_tree = mem->allocate<XSurfaceCollisionTree>();
+			std::memcpy(new_tree->trans, tree->trans, sizeof(new_tree->trans));
+			std::memcpy(new_tree->scale, tree->scale, sizeof(new_tree->scale));
+
+			new_tree->nodeCount = static_cast<unsigned int>(tree->nodes.size());
+			new_tree->nodes = mem->allocate<XSurfaceCollisionNode>(tree->nodes.size());
+			for (auto i = 0u; i < tree->nodes.size(); i++)
+			{
+				const auto& node = tree->nodes[i];
+				auto& new_node = new_tree->nodes[i];
+				std::memcpy(new_node.aabb.mins, node.mins, sizeof(new_node.aabb.mins));
+				std::memcpy(new_node.aabb.maxs, node.maxs, sizeof(new_node.aabb.maxs));
+				new_node.childBeginIndex = node.child_begin;
+				new_node.childCount = node.child_count;
+			}
+
+			// leafs index the triangles of the whole surface
+			new_tree->leafCount = static_cast<unsigned int>(tree->leafs.size());
+			new_tree->leafs = mem->allocate<XSurfaceCollisionLeaf>(tree->leafs.size());
+			for (auto i = 0u; i < tree->leafs.size(); i++)
+			{
+				new_tree->leafs[i].triangleBeginIndex = static_cast<unsigned short>(list.triOffset + tree->leafs[i]);
+			}
+
+			return new_tree;
+		}
+
+		std::vector<const XSurfaceCollisionTree*> build_surface_collision_trees(XSurface* surf, zone_memory* mem)
+		{
+			// subdiv levels reference the base triangles directly
+			if (!surf->rigidVertLists || !surf->verts0.verts0 || !surf->triIndices || surf->subdiv)
+			{
+				return {};
+			}
+
+			std::vector<const XSurfaceCollisionTree*> built;
+			for (unsigned char i = 0; i < surf->rigidVertListCount; i++)
+			{
+				auto& list = surf->rigidVertLists[i];
+				if (list.collisionTree && is_collision_tree_valid(surf, list))
+				{
+					continue;
+				}
+
+				list.collisionTree = build_collision_tree(surf, list, mem);
+				if (list.collisionTree)
+				{
+					built.emplace_back(list.collisionTree);
+				}
+			}
+
+			return built;
+		}
+
+		// surfaces below this are copied into generated lods as they are
+		constexpr auto min_simplify_tri_count = 16u;
+
+		std::size_t get_blend_vert_count(const XSurface* surf)
+		{
+			std::size_t count = 0;
+			for (const auto group_count : surf->blendVertCounts)
+			{
+				count += group_count;
+			}
+
+			return count;
+		}
+
+		std::size_t get_vertex_stride(const XSurface* surf)
+		{
+			return (surf->flags & 8) != 0 ? sizeof(GfxPackedMotionVertex) : sizeof(GfxPackedVertex);
+		}
+
+		bool can_simplify(const XSurface* surf)
+		{
+			if (!surf->verts0.verts0 || !surf->triIndices || surf->triCount < min_simplify_tri_count)
+			{
+				return false;
+			}
+
+			// subdivision, tension and blend shapes index the base vertices and triangles directly
+			if (surf->subdiv || surf->tensionData || surf->tensionAccumTable || surf->blendShapes)
+			{
+				return false;
+			}
+
+			const auto blend_vert_count = get_blend_vert_count(surf);
+			if (!blend_vert_count)
+			{
+				return true;
+			}
+
+			// skinned vertices are laid out by blend group and rigid lists would claim the same vertices
+			return surf->blendVerts && !surf->rigidVertListCount && blend_vert_count == surf->vertCount;
+		}
+
+		// vertices of one rigid list or with the same bone influences, collapsing across those would tear the mesh apart
+		std::vector<std::uint32_t> get_vertex_groups(const XSurface* surf)
+		{
+			std::vector<std::uint32_t> groups(surf->vertCount);
+
+			if (surf->rigidVertLists && surf->rigidVertListCount)
+			{
+				std::uint32_t offset = 0;
+				for (unsigned char i = 0; i < surf->rigidVertListCount; i++)
+				{
+					const auto end = std::min<std::uint32_t>(offset + surf->rigidVertLists[i].vertCount, surf->vertCount);
+					for (auto v = offset; v < end; v++)
+					{
+						groups[v] = i;
+					}
+
+					offset = end;
+				}
+
+				for (auto v = offset; v < surf->vertCount; v++)
+				{
+					groups[v] = surf->rigidVertListCount;
+				}
+
+				return groups;
+			}
+
+			if (!get_blend_vert_count(surf))
+			{
+				return {};
+			}
+
+			// blend group `i` holds the bone of the vertex followed by `i` pairs of bone and weight, weights may differ
+			std::map<std::vector<std::uint16_t>, std::uint32_t> ids;
+			const auto* blend = surf->blendVerts;
+			std::uint32_t vertex = 0;
+
+			for (auto i = 0u; i < 8; i++)
+			{
+				for (auto o = 0; o < surf->blendVertCounts[i]; o++)
+				{
+					std::vector<std::uint16_t> bones = {blend[0]};
+					for (auto b = 0u; b < i; b++)
+					{
+						bones.emplace_back(blend[1 + b * 2]);
+					}
+
+					groups[vertex++] = ids.try_emplace(std::move(bones), static_cast<std::uint32_t>(ids.size())).first->second;
+					blend += 1 + i * 2;
+				}
+			}
+
+			return groups;
+		}
+
+		void compact_vertex_stream(const void* src, void** dst, const std::size_t stride, const std::vector<std::uint16_t>& kept, zone_memory* mem)
+		{
+			if (!src)
+			{
+				return;
+			}
+
+			auto* bytes = mem->allocate<std::uint8_t>(stride * kept.size());
+			for (auto i = 0u; i < kept.size(); i++)
+			{
+				std::memcpy(bytes + i * stride, static_cast<const std::uint8_t*>(src) + kept[i] * stride, stride);
+			}
+
+			*dst = bytes;
+		}
+
+		void simplify_surface(const XSurface* src, XSurface* dst, const float ratio, zone_memory* mem)
+		{
+			*dst = *src;
+
+			if (!can_simplify(src))
+			{
+				return;
+			}
+
+			mesh_simplify::mesh mesh{};
+			mesh.positions = src->verts0.packedVerts0->xyz;
+			mesh.position_stride = get_vertex_stride(src);
+			mesh.vertex_count = src->vertCount;
+			mesh.indices = reinterpret_cast<const std::uint16_t*>(src->triIndices);
+			mesh.tri_count = src->triCount;
+			mesh.groups = get_vertex_groups(src);
+
+			const auto target = std::max<std::size_t>(1, static_cast<std::size_t>(src->triCount * ratio));
+			const auto result = mesh_simplify::simplify(mesh, target);
+			if (result.triangles.size() == src->triCount)
+			{
+				return;
+			}
+
+			const auto remap_face = [&](const Face& face)
+			{
+				return Face{result.remap[face.v1], result.remap[face.v2], result.remap[face.v3]};
+			};
+
+			// vertices still in use keep their relative order, so rigid list ranges and blend groups stay in one piece
+			std::vector<bool> used(src->vertCount, false);
+			for (const auto t : result.triangles)
+			{
+				for (const auto* faces : {src->triIndices, src->triIndices2})
+				{
+					if (faces)
+					{
+						const auto face = remap_face(faces[t]);
+						used[face.v1] = used[face.v2] = used[face.v3] = true;
+					}
+				}
+			}
+
+			constexpr auto unused = std::numeric_limits<std::uint16_t>::max();
+			std::vector<std::uint16_t> index_of(src->vertCount, unused);
+			std::vector<std::uint16_t> kept;
+			for (auto v = 0u; v < src->vertCount; v++)
+			{
+				if (used[v])
+				{
+					index_of[v] = static_cast<std::uint16_t>(kept.size());
+					kept.emplace_back(static_cast<std::uint16_t>(v));
+				}
+			}
+
+			dst->vertCount = static_cast<unsigned short>(kept.size());
+			dst->triCount = static_cast<unsigned short>(result.triangles.size());
+
+			compact_vertex_stream(src->verts0.verts0, reinterpret_cast<void**>(&dst->verts0.verts0), get_vertex_stride(src), kept, mem);
+			compact_vertex_stream(src->unknown0, reinterpret_cast<void**>(&dst->unknown0), sizeof(UnknownXSurface0), kept, mem);
+			compact_vertex_stream(src->blendVertsTable, reinterpret_cast<void**>(&dst->blendVertsTable), sizeof(BlendVertsUnknown), kept, mem);
+			compact_vertex_stream(src->lmapUnwrap, reinterpret_cast<void**>(&dst->lmapUnwrap), sizeof(alignVertBufFloat16Vec2_t), kept, mem);
+
+			const auto build_faces = [&](const Face* faces) -> Face*
+			{
+				if (!faces)
+				{
+					return nullptr;
+				}
+
+				auto* new_faces = mem->allocate<Face>(result.triangles.size());
+				for (auto i = 0u; i < result.triangles.size(); i++)
+				{
+					const auto face = remap_face(faces[result.triangles[i]]);
+					new_faces[i] = {index_of[face.v1], index_of[face.v2], index_of[face.v3]};
+				}
+
+				return new_faces;
+			};
+
+			dst->triIndices = build_faces(src->triIndices);
+			dst->triIndices2 = build_faces(src->triIndices2);
+
+			if (src->rigidVertLists && src->rigidVertListCount)
+			{
+				dst->rigidVertLists = mem->allocate<XRigidVertList>(src->rigidVertListCount);
+
+				std::uint32_t vert_offset = 0;
+				for (unsigned char i = 0; i < src->rigidVertListCount; i++)
+				{
+					const auto& list = src->rigidVertLists[i];
+					auto& new_list = dst->rigidVertLists[i];
+					new_list = list;
+
+					// collision is traced against the collision lod, the generated lods never are
+					new_list.collisionTree = nullptr;
+
+					const auto vert_end = std::min<std::uint32_t>(vert_offset + list.vertCount, src->vertCount);
+					new_list.vertCount = static_cast<unsigned short>(std::count(used.begin() + vert_offset, used.begin() + vert_end, true));
+					vert_offset = vert_end;
+
+					const auto tri_begin = std::lower_bound(result.triangles.begin(), result.triangles.end(), list.triOffset);
+					const auto tri_end = std::lower_bound(result.triangles.begin(), result.triangles.end(), list.triOffset + list.triCount);
+					new_list.triOffset = static_cast<unsigned short>(tri_begin - result.triangles.begin());
+					new_list.triCount = static_cast<unsigned short>(tri_end - tri_begin);
+				}
+			}
+
+			if (get_blend_vert_count(src))
+			{
+				std::vector<XBlendInfo> blend_verts;
+				const auto* blend = src->blendVerts;
+				std::uint32_t vertex = 0;
+
+				for (auto i = 0u; i < 8; i++)
+				{
+					const auto entry_size = 1 + i * 2;
+					dst->blendVertCounts[i] = 0;
+
+					for (auto o = 0; o < src->blendVertCounts[i]; o++)
+					{
+						if (used[vertex++])
+						{
+							blend_verts.insert(blend_verts.end(), blend, blend + entry_size);
+							dst->blendVertCounts[i]++;
+						}
+
+						blend += entry_size;
+					}
+				}
+
+				dst->blendVerts = mem->allocate<XBlendInfo>(blend_verts.size());
+				std::memcpy(dst->blendVerts, blend_verts.data(), blend_verts.size() * sizeof(XBlendInfo));
+			}
+		}
+
+		// surfaces handed to a worker at once, so that every worker gets about `triangles` triangles and small
+		// models are processed on the calling thread
+		std::size_t get_surface_grain(const XModelSurfs* asset, const std::size_t triangles)
+		{
+			std::size_t total_triangles = 0;
+			for (unsigned short i = 0; i < asset->numsurfs; i++)
+			{
+				total_triangles += asset->surfs[i].triCount;
+			}
+
+			return total_triangles ? (asset->numsurfs * triangles + total_triangles - 1) / total_triangles : asset->numsurfs;
+		}
+	}
+
+	xsurface::collision_trees xsurface::build_collision_trees(XModelSurfs* asset, zone_memory* mem)
+	{
+		if (!asset->surfs || !asset->numsurfs)
+		{
+			return {};
+		}
+
+		std::vector<std::vector<const XSurfaceCollisionTree*>> surface_trees(asset->numsurfs);
+		utils::concurrency::parallel_for(asset->numsurfs, get_surface_grain(asset, 0x4000), [&](const std::size_t i)
+		{
+			surface_trees[i] = build_surface_collision_trees(&asset->surfs[i], mem);
+		});
+
+		collision_trees built;
+		for (const auto& trees : surface_trees)
+		{
+			built.insert(trees.begin(), trees.end());
+		}
+
+		if (!built.empty())
+		{
+			ZONETOOL_INFO("Built %zu collision trees for \"%s\"", built.size(), asset->name);
+		}
+
+		return built;
+	}
+
+	XModelSurfs* xsurface::generate_lod(const XModelSurfs* source, const float ratio, const std::string& name, zone_memory* mem)
+	{
+		auto* asset = mem->allocate<XModelSurfs>();
+		*asset = *source;
+		asset->name = mem->duplicate_string(name);
+		asset->surfs = mem->allocate<XSurface>(source->numsurfs);
+
+		utils::concurrency::parallel_for(source->numsurfs, get_surface_grain(source, 0x1000), [&](const std::size_t i)
+		{
+			simplify_surface(&source->surfs[i], &asset->surfs[i], ratio, mem);
+		});
+
+		if (vertex_cache::is_enabled())
+		{
+			optimize(asset);
+		}
+
+		return asset;
+	}
+
 	XModelSurfs* xsurface::parse(const std::string& name, zone_memory* mem)
 	{
 		const auto path = "xsurface\\" + name + ".xsb";
@@ -102,9 +787,50 @@ namespace zonetool::h1
 
 		read.close();
 
+		// building a tree reorders the triangles of its rigid list by leaf, the cache order is then made within the leafs
+		collision_trees built_trees;
+		if (collision_tree::is_enabled())
+		{
+			built_trees = build_collision_trees(asset, mem);
+		}
+
+		if (vertex_cache::is_enabled())
+		{
+			optimize(asset, built_trees);
+		}
+
 		return asset;
 	}
 
+	void xsurface::optimize(XModelSurfs* asset, const collision_trees& built_trees)
+	{
+		if (!asset->surfs || !asset->numsurfs)
+		{
+			return;
+		}
+
+		std::vector<surface_statistics> stats(asset->numsurfs);
+		utils::concurrency::parallel_for(asset->numsurfs, get_surface_grain(asset, 0x4000), [&](const std::size_t i)
+		{
+			stats[i] = optimize_surface(&asset->surfs[i], built_trees);
+		});
+
+		surface_statistics total{};
+		for (const auto& surf : stats)
+		{
+			total.triangles += surf.triangles;
+			total.misses_before += surf.misses_before;
+			total.misses_after += surf.misses_after;
+		}
+
+		if (total.triangles)
+		{
+			ZONETOOL_INFO("Optimized surfaces of \"%s\": ACMR %.3f -> %.3f (%zu triangles)", asset->name,
+				static_cast<double>(total.misses_before) / total.triangles,
+				static_cast<double>(total.misses_after) / total.triangles, total.triangles);
+		}
+	}
+
 	void xsurface::init(const std::string& name, zone_memory* mem)
 	{
 		this->name_ = name;
@@ -123,6 +849,12 @@ namespace zonetool::h1
 		}
 	}
 
+	void xsurface::init(void* asset, zone_memory* mem)
+	{
+		this->asset_ = reinterpret_cast<XModelSurfs*>(asset);
+		this->name_ = this->asset_->name;
+	}
+
 	void xsurface::prepare(zone_buffer* buf, zone_memory* mem)
 	{
 	}
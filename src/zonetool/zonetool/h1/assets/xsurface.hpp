@@ -13,6 +13,7 @@ namespace zonetool::h1
 		XModelSurfs* parse(const std::string& name, zone_memory* mem);
 
 		void init(const std::string& name, zone_memory* mem) override;
+		void init(void* asset, zone_memory* mem) override;
 
 		void prepare(zone_buffer* buf, zone_memory* mem) override;
 		void load_depending(zone_base* zone) override;
@@ -23,6 +24,18 @@ namespace zonetool::h1
 		std::int32_t type() override;
 		void write(zone_base* zone, zone_buffer* buffer) override;
 
+		using collision_trees = std::unordered_set<const XSurfaceCollisionTree*>;
+
+		// triangles of rigid lists with a tree only move within the leafs of `built_trees`, lists with other trees are left as they are
+		static void optimize(XModelSurfs* asset, const collision_trees& built_trees = {});
+
+		// builds collision trees for rigid vertex lists without one or whose tree fails collision_tree::validate,
+		// returns the trees it built
+		static collision_trees build_collision_trees(XModelSurfs* asset, zone_memory* mem);
+
+		// copy of `source` with every surface simplified to about `ratio` of its triangles, see mesh_simplify
+		static XModelSurfs* generate_lod(const XModelSurfs* source, float ratio, const std::string& name, zone_memory* mem);
+
 		static void dump(XModelSurfs* asset);
 	};
 }
\ No newline at end of file
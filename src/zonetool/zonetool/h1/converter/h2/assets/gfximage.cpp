@@ -44,7 +44,7 @@ namespace zonetool::h1
 			{
 				for (auto i = 0u; i < 4; i++)
 				{
-					const auto stream_file = &stream_files[*stream_file_index + i];
+					const auto stream_file = &stream_files[dump_stream_file_index + i];
 
 					const char* filename = nullptr;
 					if (stream_file->fileIndex == 96)
@@ -5,7 +5,6 @@
 #include "zonetool/utils/gsc.hpp"
 
 #include <utils/string.hpp>
-#include <utils/compression.hpp>
 
 namespace zonetool::h1
 {
@@ -33,32 +32,19 @@ namespace zonetool::h1
 				return gsc_name;
 			}
 
-			std::string decompile_script(ScriptFile* asset)
-			{
-				auto& decompiler = gsc::h1::gsc_ctx->decompiler();
-				auto& disassembler = gsc::h1::gsc_ctx->disassembler();
-
-				const std::string stack_compressed{asset->buffer, static_cast<std::uint32_t>(asset->compressedLen)};
-				const auto decompressed_stack = utils::compression::zlib::decompress(stack_compressed);
-
-				const std::vector<std::uint8_t> stack{decompressed_stack.begin(), decompressed_stack.end()};
-				const std::vector<std::uint8_t> bytecode{asset->bytecode, asset->bytecode + asset->bytecodeLen};
-
-				const auto disasm = disassembler.disassemble(bytecode, stack);
-				const auto decomp = decompiler.decompile(*disasm);
-
-				const auto decomp_data = gsc::h1::gsc_ctx->source().dump(*decomp);
-				return {decomp_data.begin(), decomp_data.end()};
-			}
-
 			void dump_as_gsc(ScriptFile* asset)
 			{
-				const auto decompiled_data = decompile_script(asset);
-
-				filesystem::file file(convert_name(asset->name));
-				file.open("wb");
-				file.write(decompiled_data.data(), decompiled_data.size());
-				file.close();
+				// decompiled on the gsc decompiler threads, stop_dumping waits for them before the zone is done
+				gsc::decompile_async(gsc::engine::h1, asset->name,
+					{asset->bytecode, asset->bytecode + asset->bytecodeLen},
+					{asset->buffer, static_cast<std::uint32_t>(asset->compressedLen)},
+					[name = convert_name(asset->name)](const std::string& source)
+				{
+					filesystem::file file(name);
+					file.open("wb");
+					file.write(source.data(), source.size());
+					file.close();
+				});
 			}
 
 			void dump(ScriptFile* asset)
@@ -9,6 +9,8 @@
 #include <DirectXTex.h>
 #pragma warning( pop )
 
+#include <utils/concurrency.hpp>
+
 namespace zonetool::h1
 {
 	namespace converter::iw7
@@ -31,32 +33,105 @@ namespace zonetool::h1
 
 				return new_name;
 			}
+
+			// iw7 samples the probe array as unsigned half float bc6h
+			constexpr auto reflection_probe_format = DXGI_FORMAT_BC6H_UF16;
+
+			// block compressed faces can't go through DirectX::Convert or Compress directly, so they are decompressed to
+			// float first. DirectX::Convert refuses to convert to the format an image already has
+			HRESULT decode_to_float(const DirectX::Image& image, DirectX::ScratchImage& decoded)
+			{
+				if (DirectX::IsCompressed(image.format))
+				{
+					return DirectX::Decompress(image, DXGI_FORMAT_R32G32B32A32_FLOAT, decoded);
+				}
+
+				if (image.format == DXGI_FORMAT_R32G32B32A32_FLOAT)
+				{
+					return decoded.InitializeFromImage(image);
+				}
+
+				return DirectX::Convert(image, DXGI_FORMAT_R32G32B32A32_FLOAT, DirectX::TEX_FILTER_DEFAULT, DirectX::TEX_THRESHOLD_DEFAULT, decoded);
+			}
 		}
 
 		namespace gfxworld
 		{
-//#define CONVERT
+			// h1 probes are linear hdr radiance like iw7's, they only differ in format
+			std::optional<double> convert_reflection_probe(const DirectX::Image& src, const DirectX::Image& dst)
+			{
+				if (src.format == dst.format)
+				{
+					std::memcpy(dst.pixels, src.pixels, dst.slicePitch);
+					return 0.0;
+				}
+
+				DirectX::ScratchImage decoded;
+				if (FAILED(decode_to_float(src, decoded)))
+				{
+					return {};
+				}
+
+				// bc6h uf16 holds neither negative values nor anything past the half float range
+				const auto* image = decoded.GetImage(0, 0, 0);
+				const auto pixel_count = image->width * image->height;
+				auto* texels = reinterpret_cast<float*>(image->pixels);
+				for (auto i = 0u; i < pixel_count * 4; i++)
+				{
+					texels[i] = std::clamp(texels[i], 0.0f, 65504.0f);
+				}
+
+				DirectX::ScratchImage encoded;
+				if (FAILED(DirectX::Compress(*image, dst.format, DirectX::TEX_COMPRESS_DEFAULT, DirectX::TEX_THRESHOLD_DEFAULT, encoded)))
+				{
+					return {};
+				}
+
+				std::memcpy(dst.pixels, encoded.GetPixels(), dst.slicePitch);
+
+				// decode what was written again and compare the colors, alpha is dropped by bc6h
+				DirectX::ScratchImage round_trip;
+				if (FAILED(DirectX::Decompress(*encoded.GetImage(0, 0, 0), DXGI_FORMAT_R32G32B32A32_FLOAT, round_trip)))
+				{
+					return {};
+				}
+
+				const auto* result = reinterpret_cast<const float*>(round_trip.GetImage(0, 0, 0)->pixels);
+				auto error = 0.0;
+				auto energy = 0.0;
+				for (auto i = 0u; i < pixel_count; i++)
+				{
+					for (auto c = 0u; c < 3; c++)
+					{
+						const auto diff = static_cast<double>(result[i * 4 + c]) - texels[i * 4 + c];
+						error += diff * diff;
+						energy += static_cast<double>(texels[i * 4 + c]) * texels[i * 4 + c];
+					}
+				}
+
+				return energy > 0.0 ? std::sqrt(error / energy) : 0.0;
+			}
+
 			zonetool::iw7::GfxImage* generate_reflection_probe_array_image(GfxWorldDraw* draw, utils::memory::allocator& allocator)
 			{
 				const std::string image_name = "*reflection_probe_array";
 				const std::string image_name_clean = "_reflection_probe_array";
 
-				std::uint8_t* data = nullptr;
-				bool once = false;
 				std::uint32_t width = 0;
 				std::uint32_t height = 0;
 				std::uint16_t depth = 0;
 				std::uint32_t mip_levels = 0;
 				std::int32_t format = 0;
 
-				std::vector<DirectX::Image> images{};
+				// one entry per mip of every face, in the order of the array image
+				std::vector<DirectX::Image> sources{};
 
 				for (unsigned int image_index = 1; image_index < draw->reflectionProbeCount; image_index++)
 				{
 					GfxImage* probe_image = draw->reflectionProbes[image_index];
-					data = probe_image->pixelData;
+					auto* data = probe_image->pixelData;
 
-					if (once)
+					if (image_index > 1)
 					{
 						assert(width == probe_image->width &&
 							height == probe_image->height &&
@@ -70,59 +145,100 @@ namespace zonetool::h1
 					mip_levels = probe_image->levelCount;
 					format = probe_image->imageFormat;
 
-					once = true;
-
 					std::size_t used_data = 0;
 
 					for (auto a = 0; a < 6; a++)
 					{
-						int divider = 1;
 						for (auto i = 0; i < probe_image->levelCount; i++)
 						{
 							DirectX::Image img{};
 							img.pixels = data;
-							img.width = probe_image->width / divider;
-							img.height = probe_image->height / divider;
+							img.width = std::max(1, probe_image->width >> i);
+							img.height = std::max(1, probe_image->height >> i);
 							img.format = DXGI_FORMAT(probe_image->imageFormat);
+							DirectX::ComputePitch(img.format, img.width, img.height, img.rowPitch, img.slicePitch);
 
-							size_t rowPitch;
-							size_t slicePitch;
-							DirectX::ComputePitch(img.format, img.width, img.height, rowPitch, slicePitch);
+							sources.push_back(img);
 
-							img.rowPitch = rowPitch;
-							img.slicePitch = slicePitch;
-							
-#ifdef CONVERT
-							// Doesn't work
-							DirectX::ScratchImage destImage;
-							auto hr = DirectX::Convert(img, DXGI_FORMAT_R8G8B8A8_UNORM, DirectX::TEX_FILTER_DEFAULT , DirectX::TEX_THRESHOLD_DEFAULT, destImage);
-							if (FAILED(hr))
-							{
-								ZONETOOL_FATAL("Failed to convert image \"%s\"", probe_image->name);
-								return nullptr;
-							}
+							data += img.slicePitch;
+							used_data += img.slicePitch;
+						}
+					}
 
-							auto* pixels = allocator.allocate_array<unsigned char>(destImage.GetPixelsSize());
-							memcpy(pixels, destImage.GetPixels(), destImage.GetPixelsSize());
-							img.pixels = pixels;
+					assert(used_data == probe_image->dataLen1);
+				}
 
-							img.format = DXGI_FORMAT_R8G8B8A8_UNORM;
+				// every face lands in one allocation, each at its final offset
+				std::vector<DirectX::Image> images(sources.size());
+				std::size_t total_size = 0;
+				for (auto i = 0u; i < sources.size(); i++)
+				{
+					images[i].width = sources[i].width;
+					images[i].height = sources[i].height;
+					images[i].format = reflection_probe_format;
+					DirectX::ComputePitch(images[i].format, images[i].width, images[i].height, images[i].rowPitch, images[i].slicePitch);
+					total_size += images[i].slicePitch;
+				}
+
+				auto* pixels = allocator.allocate_array<std::uint8_t>(total_size);
+				std::size_t offset = 0;
+				for (auto& image : images)
+				{
+					image.pixels = pixels + offset;
+					offset += image.slicePitch;
+				}
 
-							DirectX::ComputePitch(img.format, img.width, img.height, rowPitch, slicePitch);
+				std::vector<double> errors(images.size());
+				std::atomic_bool failed = false;
+				utils::concurrency::parallel_for(images.size(), 1, [&](const std::size_t i)
+				{
+					if (failed)
+					{
+						return;
+					}
 
-							img.rowPitch = rowPitch;
-							img.slicePitch = slicePitch;
-#endif
+					const auto error = convert_reflection_probe(sources[i], images[i]);
+					if (!error.has_value())
+					{
+						failed = true;
+						return;
+					}
 
-							images.push_back(img);
+					errors[i] = *error;
+				});
 
-							data += slicePitch;
-							used_data += slicePitch;
-							divider += divider;
+				if (failed)
+				{
+					ZONETOOL_FATAL("Failed to convert reflection probes of \"%s\" from format %d", image_name.data(), format);
+					return nullptr;
+				}
+
+				if (format != reflection_probe_format && mip_levels)
+				{
+					// mips of a face are weighted by their pixel count, the worst face is what shows up in game
+					auto worst_error = 0.0;
+					auto worst_face = 0u;
+					for (auto face = 0u; face < images.size() / mip_levels; face++)
+					{
+						auto error = 0.0;
+						auto pixel_count = 0.0;
+						for (auto i = face * mip_levels; i < (face + 1) * mip_levels; i++)
+						{
+							const auto count = static_cast<double>(images[i].width * images[i].height);
+							error += errors[i] * errors[i] * count;
+							pixel_count += count;
+						}
+
+						error = std::sqrt(error / pixel_count);
+						if (error > worst_error)
+						{
+							worst_error = error;
+							worst_face = face;
 						}
 					}
 
-					assert(used_data == probe_image->dataLen1);
+					ZONETOOL_INFO("Converted %u reflection probes from format %d, worst relative error %.4f (probe %u, face %u)",
+						draw->reflectionProbeCount - 1, format, worst_error, worst_face / 6 + 1, worst_face % 6);
 				}
 
 				DirectX::TexMetadata mdata{};
@@ -131,7 +247,7 @@ namespace zonetool::h1
 				mdata.depth = depth;
 				mdata.arraySize = (draw->reflectionProbeCount - 1) * 6;
 				mdata.mipLevels = mip_levels;
-				mdata.format = DXGI_FORMAT(format);
+				mdata.format = reflection_probe_format;
 				mdata.dimension = DirectX::TEX_DIMENSION::TEX_DIMENSION_TEXTURE2D;
 				mdata.miscFlags |= DirectX::TEX_MISC_FLAG::TEX_MISC_TEXTURECUBE;
 
@@ -144,30 +260,12 @@ namespace zonetool::h1
 					std::filesystem::create_directories(parent_path);//
 				}
 
-#ifdef COMPRESS
-				// Doesn't work
-				DirectX::ScratchImage destImage;
-				auto hr = DirectX::Compress(images.data(), images.size(), mdata, DXGI_FORMAT_BC6H_UF16, DirectX::TEX_COMPRESS_DEFAULT, DirectX::TEX_THRESHOLD_DEFAULT, destImage);
-				if (FAILED(hr))
-				{
-					ZONETOOL_FATAL("Failed to convert image \"%s\"", spath.data());
-					return nullptr;
-				}
-
-				auto result = DirectX::SaveToDDSFile(destImage.GetImages(), destImage.GetImageCount(), destImage.GetMetadata(), DirectX::DDS_FLAGS_NONE, wpath.data());
-				if (FAILED(result))
-				{
-					ZONETOOL_FATAL("Failed to dump image \"%s\"", spath.data());
-					return nullptr;
-				}
-#else
 				auto result = DirectX::SaveToDDSFile(images.data(), images.size(), mdata, DirectX::DDS_FLAGS_NONE, wpath.data());
 				if (FAILED(result))
 				{
 					ZONETOOL_FATAL("Failed to dump image \"%s\"", spath.data());
 					return nullptr;
 				}
-#endif
 
 				auto* image = allocator.allocate<zonetool::iw7::GfxImage>();
 				image->name = allocator.duplicate_string(image_name);
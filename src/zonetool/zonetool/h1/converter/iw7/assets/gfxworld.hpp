@@ -1,5 +1,10 @@
 #pragma once
 
+namespace DirectX
+{
+	struct Image;
+}
+
 namespace zonetool::h1
 {
 	namespace converter::iw7
@@ -8,6 +13,10 @@ namespace zonetool::h1
 		{
 			zonetool::iw7::GfxWorld* convert(GfxWorld* asset, utils::memory::allocator& allocator);
 			void dump(GfxWorld* asset);
+
+			// converts a reflection probe face to the bc6h format iw7 samples probes in, `dst` has that format, its pitches and pixels set.
+			// returns the relative rms error of the converted face, empty if it couldn't be converted
+			std::optional<double> convert_reflection_probe(const DirectX::Image& src, const DirectX::Image& dst);
 		}
 	}
 }
@@ -82,6 +82,22 @@ namespace zonetool::h1
 			}
 		}
 
+		this->add_asset_by_pointer(type, pointer, name);
+	}
+
+	std::size_t zone_interface::add_assets_of_type_by_pointer(std::int32_t type, const std::vector<void*>& pointers)
+	{
+		return add_new_assets_by_pointer(m_assets, type, pointers, [&](void* pointer) -> std::string
+		{
+			return get_asset_name(XAssetType(type), pointer);
+		}, [&](void* pointer, const std::string& name)
+		{
+			this->add_asset_by_pointer(type, pointer, name);
+		});
+	}
+
+	void zone_interface::add_asset_by_pointer(std::int32_t type, void* pointer, const std::string& name)
+	{
 #define ADD_ASSET_PTR(__type__, ___) \
 		if (type == __type__) \
 		{ \
@@ -96,6 +112,7 @@ namespace zonetool::h1
 			// declare asset interfaces
 			ADD_ASSET_PTR(ASSET_TYPE_MENU, menu_def);
 			ADD_ASSET_PTR(ASSET_TYPE_LOCALIZE_ENTRY, localize);
+			ADD_ASSET_PTR(ASSET_TYPE_XMODEL_SURFS, xsurface);
 		}
 		catch (std::exception& ex)
 		{
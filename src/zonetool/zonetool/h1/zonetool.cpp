@@ -4,7 +4,14 @@
 #include "converter/converter.hpp"
 
 #include "../utils/gsc.hpp"
+#include "../utils/asset_cache.hpp"
+#include "../utils/collision_tree.hpp"
 #include "../utils/csv_generator.hpp"
+#include "../utils/dump_queue.hpp"
+#include "../utils/io/dump_store.hpp"
+#include "../utils/io/pak_reader.hpp"
+#include "../utils/texture_cook.hpp"
+#include "../utils/vertex_cache.hpp"
 
 #include <utils/io.hpp>
 
@@ -19,6 +26,7 @@ namespace zonetool::h1
 	};
 
 	zonetool_globals_t globals{};
+	dump_queue dump_worker;
 	std::vector<std::pair<XAssetType, std::string>> referenced_assets;
 	std::unordered_set<XAssetType> asset_type_filter;
 
@@ -515,7 +523,39 @@ namespace zonetool::h1
 			return;
 		}
 
-		dump_func->second(asset);
+		// serialization and disk writes run on the dump worker, the asset stays valid until
+		// db_finish_load_x_file waits for it in stop_dumping. an image's pixel data and stream file
+		// index are only valid while it is being linked though, so the task gets copies of those
+		auto stream_index = 0u;
+		std::shared_ptr<std::vector<std::uint8_t>> pixels;
+		if (asset->type == ASSET_TYPE_IMAGE)
+		{
+			const auto* image = asset->header.image;
+			if (image->streamed)
+			{
+				stream_index = *stream_file_index;
+			}
+
+			if (image->pixelData)
+			{
+				pixels = std::make_shared<std::vector<std::uint8_t>>(image->pixelData, image->pixelData + image->dataLen1);
+			}
+		}
+
+		dump_worker.push([dump = dump_func->second, copy = *asset, stream_index, pixels]() mutable
+		{
+			dump_stream_file_index = stream_index;
+
+			GfxImage image{};
+			if (pixels)
+			{
+				image = *copy.header.image;
+				image.pixelData = pixels->data();
+				copy.header.image = &image;
+			}
+
+			dump(&copy);
+		});
 	}
 
 	void dump_refs()
@@ -578,7 +618,13 @@ namespace zonetool::h1
 			return;
 		}
 
+		dump_worker.wait();
 		dump_refs();
+		dump_worker.wait();
+		gsc::wait_for_decompiler();
+		filesystem::pak_reader::finish();
+
+		filesystem::dump_store::report(filesystem::get_fastfile());
 
 		ZONETOOL_INFO("Zone \"%s\" dumped.", filesystem::get_fastfile().data());
 
@@ -1154,6 +1200,8 @@ namespace zonetool::h1
 			return;
 		}
 
+		asset_cache::report();
+
 		// allocate zone buffer
 		auto buffer = alloc_buffer();
 
@@ -1394,6 +1442,9 @@ namespace zonetool::h1
 			asset.header = header;
 			globals.target_game = game::h1;
 			dump_asset(&asset);
+			dump_worker.wait();
+			gsc::wait_for_decompiler();
+			filesystem::pak_reader::finish();
 
 			ZONETOOL_INFO("Dumped to dump/assets");
 		});
@@ -1530,6 +1581,88 @@ namespace zonetool::h1
 			return;
 		}
 
+		// options for the commands below, regardless of where they appear
+		if (std::find(args.begin(), args.end(), "-optimizesurfaces") != args.end())
+		{
+			vertex_cache::set_enabled(true);
+		}
+
+		if (std::find(args.begin(), args.end(), "-buildcolltrees") != args.end())
+		{
+			collision_tree::set_enabled(true);
+		}
+
+		if (std::find(args.begin(), args.end(), "-generatepaths") != args.end())
+		{
+			path_data::set_generate_paths(true);
+		}
+
+		if (std::find(args.begin(), args.end(), "-cookimages") != args.end())
+		{
+			texture_cook::set_enabled(true);
+		}
+
+		if (std::find(args.begin(), args.end(), "-assetcache") != args.end())
+		{
+			asset_cache::set_enabled(true);
+		}
+
+		if (const auto simplify_fx = std::find(args.begin(), args.end(), "-simplifyfx"); simplify_fx != args.end())
+		{
+			// takes an optional tolerance, in units of each value's range over the curve
+			auto tolerance = 0.01f;
+			if (simplify_fx + 1 != args.end())
+			{
+				char* end = nullptr;
+				const auto value = std::strtof((simplify_fx + 1)->data(), &end);
+				if (end && !*end && value > 0.0f)
+				{
+					tolerance = value;
+				}
+			}
+
+			fx_effect_def::set_simplify_tolerance(tolerance);
+		}
+
+		if (const auto generate_lods = std::find(args.begin(), args.end(), "-generatelods"); generate_lods != args.end())
+		{
+			// takes an optional list of ratio:distance pairs, the ratio being the share of lod0 triangles to keep
+			std::string levels = "0.5:750,0.25:1500,0.125:3000";
+			if (generate_lods + 1 != args.end() && !(generate_lods + 1)->starts_with("-"))
+			{
+				levels = *(generate_lods + 1);
+			}
+
+			std::vector<xmodel::generated_lod> lods;
+			for (const auto& level : utils::string::split(levels, ','))
+			{
+				const auto values = utils::string::split(level, ':');
+				if (values.size() != 2)
+				{
+					continue;
+				}
+
+				const auto ratio = std::strtof(values[0].data(), nullptr);
+				const auto dist = std::strtof(values[1].data(), nullptr);
+				if (ratio > 0.0f && ratio < 1.0f && dist > 0.0f)
+				{
+					lods.emplace_back(xmodel::generated_lod{ratio, dist});
+				}
+			}
+
+			xmodel::set_generated_lods(lods);
+		}
+
+		if (std::find(args.begin(), args.end(), "-dumpstore") != args.end())
+		{
+			filesystem::dump_store::set_shared(true);
+		}
+
+		if (std::find(args.begin(), args.end(), "-dumppack") != args.end())
+		{
+			filesystem::dump_store::set_packed(true);
+		}
+
 		for (std::size_t i = 0; i < args.size(); ++i)
 		{
 			const auto& arg = args[i];
@@ -1613,6 +1746,15 @@ namespace zonetool::h1
 				ZONETOOL_INFO("  -dumpzone <zone>     Dump a zone");
 				ZONETOOL_INFO("  -dumpcsv <zone>      Dump a CSV of a zone");
 				ZONETOOL_INFO("  -unloadzones         Unload all zones");
+				ZONETOOL_INFO("  -optimizesurfaces    Reorder xmodel surfaces for vertex cache locality when building or converting");
+				ZONETOOL_INFO("  -generatepaths       Generate links and node visibility for botwarfare waypoints from the map collision");
+				ZONETOOL_INFO("  -buildcolltrees      Build collision trees for rigid xmodel surfaces that have none when building");
+				ZONETOOL_INFO("  -cookimages          Block compress custom png/tga images and generate their mips when building");
+				ZONETOOL_INFO("  -assetcache          Keep parsed json effects in dump\\_cache\\assets and load them from there while unchanged");
+				ZONETOOL_INFO("  -simplifyfx [tol]    Resample json effect curves to fewer samples within a tolerance (default 0.01)");
+				ZONETOOL_INFO("  -generatelods [r:d,...] Generate lower lods for models with only lod0 (default 0.5:750,0.25:1500,0.125:3000)");
+				ZONETOOL_INFO("  -dumpstore           Deduplicate dumped files across zones into dump\\_store");
+				ZONETOOL_INFO("  -dumppack            Dump into a single dump\\<zone>.zpk pack instead of loose files");
 
 				do_exit = true;
 			}
@@ -492,7 +492,7 @@ namespace zonetool::h2
 
 		for (auto i = 0u; i < 4; i++)
 		{
-			const auto stream_file = &stream_files[*stream_file_index + i];
+			const auto stream_file = &stream_files[dump_stream_file_index + i];
 
 			const auto db_fs = ::h2::game::DB_FSInitialize();
 			const char* imagefile_path = nullptr;
@@ -652,7 +652,7 @@ namespace zonetool::h2
 			dump_image_dds(asset);
 		}
 
-		if (asset->streamed && stream_files[*stream_file_index].fileIndex == custom_imagefile_index)
+		if (asset->streamed && stream_files[dump_stream_file_index].fileIndex == custom_imagefile_index)
 		{
 			dump_streamed_image_dds(asset);
 			return;
@@ -684,7 +684,7 @@ namespace zonetool::h2
 		{
 			for (auto i = 0u; i < 4; i++)
 			{
-				const auto stream_file = &stream_files[*stream_file_index + i];
+				const auto stream_file = &stream_files[dump_stream_file_index + i];
 				write.dump_single(stream_file);
 			}
 		}
@@ -1,6 +1,8 @@
 #include <std_include.hpp>
 #include "weaponattachment.hpp"
 
+#include "zonetool/utils/json_fields.hpp"
+
 namespace zonetool::h2
 {
 	namespace
@@ -943,34 +945,22 @@ namespace zonetool::h2
 		return nullptr;
 	}
 
-#define ATTACHMENT_READ_ASSET_ARR(__type__, __datafield__, __field__, __struct__, __size__) \
-	if (!data[#__field__].is_null()) \
-	{ \
-		attachment->__field__ = mem->allocate<__struct__*>(__size__); \
-		for (auto idx##__field__ = 0; idx##__field__ < __size__; idx##__field__++) \
-		{ \
-			if (!data[#__field__][idx##__field__].is_null()) \
-			{ \
-				auto asset##__field__ = data[#__field__][idx##__field__].get<std::string>(); \
-				if (asset##__field__.empty()) \
-				{ \
-					attachment->__field__[idx##__field__] = nullptr; \
-				} \
-				else \
-				{ \
-					attachment->__field__[idx##__field__] = db_find_x_asset_header(XAssetType::__type__, asset##__field__.data(), 1).__datafield__; \
-				} \
-			} \
-			else \
-			{ \
-				attachment->__field__[idx##__field__] = nullptr; \
-			} \
-		} \
-	} \
-	else \
-	{ \
-		attachment->__field__ = nullptr; \
-	}
+	constexpr auto attachment_fields = json_fields::make_field_table<WeaponAttachment>(
+	{
+		JSON_FIELD_STRING_NAMED(WeaponAttachment, szInternalName, "internalName"),
+		JSON_FIELD_STRING_NAMED(WeaponAttachment, szDisplayName, "displayName"),
+
+		JSON_FIELD(WeaponAttachment, AttachmentType, type),
+		JSON_FIELD(WeaponAttachment, weapType_t, weaponType),
+		JSON_FIELD_NAMED(WeaponAttachment, weapClass_t, weapClass, "weaponClass"),
+
+		JSON_FIELD_ASSET_HEADER_ARR(WeaponAttachment, worldModels, 2, db_find_x_asset_data<ASSET_TYPE_XMODEL>),
+		JSON_FIELD_ASSET_HEADER_ARR(WeaponAttachment, viewModels, 2, db_find_x_asset_data<ASSET_TYPE_XMODEL>),
+		JSON_FIELD_ASSET_HEADER_ARR(WeaponAttachment, reticleViewModels, 64, db_find_x_asset_data<ASSET_TYPE_XMODEL>),
+
+		JSON_FIELD_ASSET_HEADER_ARR(WeaponAttachment, bounceSounds, 53, db_find_x_asset_data<ASSET_TYPE_SOUND>),
+		JSON_FIELD_ASSET_HEADER_ARR(WeaponAttachment, rollingSounds, 53, db_find_x_asset_data<ASSET_TYPE_SOUND>)
+	});
 
 	WeaponAttachment* weapon_attachment::parse(const std::string& name, zone_memory* mem)
 	{
@@ -989,113 +979,86 @@ namespace zonetool::h2
 		auto size = file.size();
 		auto bytes = file.read_bytes(size);
 		file.close();
-		json data = json::parse(bytes);
+		const json data = json::parse(bytes);
 
 		auto* attachment = mem->allocate<WeaponAttachment>();
 
 		// base asset
-		auto base = data["baseAsset"].get<std::string>();
-		WeaponAttachment* baseAsset = nullptr;
+		const auto& base_asset = json_fields::get(data, "baseAsset");
+		const auto base = base_asset.is_string() ? base_asset.get<std::string>() : ""s;
 		if (!base.empty())
 		{
-			baseAsset = db_find_x_asset_header(ASSET_TYPE_ATTACHMENT, base.data(), 1).attachment;
-			if (baseAsset == nullptr)
+			const auto* base_attachment = db_find_x_asset_header(ASSET_TYPE_ATTACHMENT, base.data(), 1).attachment;
+			if (base_attachment == nullptr)
 			{
 				ZONETOOL_FATAL("Could not load base asset \"%s\" into memory...", base.data());
 			}
-			memcpy(attachment, baseAsset, sizeof(WeaponAttachment));
+			memcpy(attachment, base_attachment, sizeof(WeaponAttachment));
 		}
 		else
 		{
 			ZONETOOL_WARNING("No base asset is defined for attachment \"%s\", stuff might go wrong!", name.data());
 		}
 
-		if (!data["internalName"].is_null())
-		{
-			attachment->szInternalName = mem->duplicate_string(data["internalName"].get<std::string>());
-		}
-
-		if (!data["displayName"].is_null())
-		{
-			attachment->szDisplayName = mem->duplicate_string(data["displayName"].get<std::string>());
-		}
-
-		if (!data["type"].is_null())
-		{
-			attachment->type = data["type"].get<AttachmentType>();
-		}
-
-		if (!data["weaponType"].is_null())
-		{
-			attachment->weaponType = data["weaponType"].get<weapType_t>();
-		}
-
-		if (!data["weaponClass"].is_null())
-		{
-			attachment->weapClass = data["weaponClass"].get<weapClass_t>();
-		}
-
-		ATTACHMENT_READ_ASSET_ARR(ASSET_TYPE_XMODEL, model, worldModels, XModel, 2);
-		ATTACHMENT_READ_ASSET_ARR(ASSET_TYPE_XMODEL, model, viewModels, XModel, 2);
-		ATTACHMENT_READ_ASSET_ARR(ASSET_TYPE_XMODEL, model, reticleViewModels, XModel, 64);
-
-		ATTACHMENT_READ_ASSET_ARR(ASSET_TYPE_SOUND, sound, bounceSounds, snd_alias_list_t, 53);
-		ATTACHMENT_READ_ASSET_ARR(ASSET_TYPE_SOUND, sound, rollingSounds, snd_alias_list_t, 53);
+		attachment_fields.read(attachment, data, mem);
 
+		const auto& string_array1 = json_fields::get(data, "stringArray1");
 		attachment->stringArray1 = mem->allocate<scr_string_t>(4);
-		if (!data["stringArray1"].is_null())
+		if (!string_array1.is_null())
 		{
 			for (auto i = 0; i < 4; i++)
 			{
-				this->add_script_string(&attachment->stringArray1[i], mem->duplicate_string(data["stringArray1"][i].get<std::string>()));
+				this->add_script_string(&attachment->stringArray1[i], mem->duplicate_string(string_array1.at(i).get<std::string>()));
 			}
 		}
 
+		const auto& string_array2 = json_fields::get(data, "stringArray2");
 		attachment->stringArray2 = mem->allocate<scr_string_t>(4);
-		if (!data["stringArray2"].is_null())
+		if (!string_array2.is_null())
 		{
 			for (auto i = 0; i < 4; i++)
 			{
-				this->add_script_string(&attachment->stringArray2[i], mem->duplicate_string(data["stringArray2"][i].get<std::string>()));
+				this->add_script_string(&attachment->stringArray2[i], mem->duplicate_string(string_array2.at(i).get<std::string>()));
 			}
 		}
 
-		if (!data["waFields"].is_null())
+		if (const auto& fields = json_fields::get(data, "waFields"); !fields.is_null())
 		{
-			attachment->waFieldsCount = static_cast<unsigned int>(data["waFields"].size());
+			attachment->waFieldsCount = static_cast<unsigned int>(fields.size());
 			attachment->waFieldOffsets = mem->allocate<unsigned short>(attachment->waFieldsCount);
 			attachment->waFields = mem->allocate<WAField>(attachment->waFieldsCount);
 
 			std::vector<field_info> sorted_fields;
 			for (auto i = 0u; i < attachment->waFieldsCount; i++)
 			{
+				const auto& entry = fields[i];
 				field_info info{};
 
 				info.json_index = i;
-				info.type = data["waFields"][i]["type"].get<unsigned char>();
-				info.code = data["waFields"][i]["code"].get<unsigned char>();
+				info.type = entry.at("type").get<unsigned char>();
+				info.code = entry.at("code").get<unsigned char>();
 
-				if (data["waFields"][i]["offset"].is_number())
+				if (const auto& offset = json_fields::get(entry, "offset"); offset.is_number())
 				{
-					info.offset = data["waFields"][i]["offset"].get<unsigned short>();
+					info.offset = offset.get<unsigned short>();
 
 				}
-				else if (data["waFields"][i]["name"].is_string())
+				else if (const auto& field_name = json_fields::get(entry, "name"); field_name.is_string())
 				{
-					info.offset = weapon_field_to_offset(data["waFields"][i]["name"].get<std::string>());
+					info.offset = weapon_field_to_offset(field_name.get<std::string>());
 				}
 				else
 				{
 					ZONETOOL_FATAL("Invalid WAField offset/name value");
 				}
 
-				if (data["waFields"][i]["index"].is_number())
+				if (const auto& index = json_fields::get(entry, "index"); index.is_number())
 				{
-					info.index = data["waFields"][i]["index"].get<unsigned char>();
+					info.index = index.get<unsigned char>();
 				}
-				else if (info.type == WAFIELD_TYPE_ANIM && data["waFields"][i]["anim"].is_string())
+				else if (const auto& anim = json_fields::get(entry, "anim"); info.type == WAFIELD_TYPE_ANIM && anim.is_string())
 				{
-					info.index = get_anim_index(data["waFields"][i]["anim"].get<std::string>());
+					info.index = get_anim_index(anim.get<std::string>());
 				}
 				else
 				{
@@ -1118,7 +1081,7 @@ namespace zonetool::h2
 			for (auto f = 0; f < sorted_fields.size(); f++)
 			{
 				const auto& field = sorted_fields[f];
-				const auto i = field.json_index;
+				const auto& value = json_fields::get(fields[field.json_index], "value");
 
 				attachment->waFieldOffsets[f] = field.offset;
 				attachment->waFields[f].code = field.code;
@@ -1135,23 +1098,23 @@ namespace zonetool::h2
 					type == WAFIELD_TYPE_SOUND ||
 					type == WAFIELD_TYPE_TRACER)
 				{
-					attachment->waFields[f].parm.string = mem->duplicate_string(data["waFields"][i]["value"].get<std::string>());
+					attachment->waFields[f].parm.string = mem->duplicate_string(value.get<std::string>());
 				}
 				else if (type == WAFIELD_TYPE_INT)
 				{
-					attachment->waFields[f].parm.p_float = static_cast<float>(data["waFields"][i]["value"].get<int>());
+					attachment->waFields[f].parm.p_float = static_cast<float>(value.get<int>());
 				}
 				else if (type == WAFIELD_TYPE_BOOL)
 				{
-					attachment->waFields[f].parm.p_bool = data["waFields"][i]["value"].get<bool>();
+					attachment->waFields[f].parm.p_bool = value.get<bool>();
 				}
 				else if (type == WAFIELD_TYPE_FLOAT)
 				{
-					attachment->waFields[f].parm.p_float = data["waFields"][i]["value"].get<float>();
+					attachment->waFields[f].parm.p_float = value.get<float>();
 				}
 				else if (type == WAFIELD_TYPE_FLOAT32)
 				{
-					attachment->waFields[f].parm.p_float = static_cast<float>(data["waFields"][i]["value"].get<int>() / 1000.0f);
+					attachment->waFields[f].parm.p_float = static_cast<float>(value.get<int>() / 1000.0f);
 				}
 				else
 				{
@@ -1,6 +1,8 @@
 #include "std_include.hpp"
 #include "weapondef.hpp"
 
+#include "zonetool/utils/json_fields.hpp"
+
 namespace zonetool::h2
 {
 	const char* get_anim_name_from_index(weapAnimFiles_t index)
@@ -52,295 +54,807 @@ namespace zonetool::h2
 		return nullptr;
 	}
 
-#define WEAPON_READ_FIELD(__type__, __field__) \
-	if (!data[#__field__].is_null()) *(__type__*)(&weapon->__field__) = (__type__)data[#__field__].get<__type__>()
-
-#define WEAPON_READ_FIELD_ARR(__type__, __field__, __size__) \
-	if (!data[#__field__].is_null()) \
-	{ \
-		if constexpr (std::is_pointer<decltype(weapon->__field__)>::value) \
-		{ \
-			*reinterpret_cast<__type__**>(reinterpret_cast<size_t>(&weapon->__field__)) = mem->allocate<__type__>(__size__); \
-		} \
-		for (auto idx##__field__ = 0; idx##__field__ < __size__; idx##__field__++) \
-		{ \
-			*(__type__*)(&weapon->__field__[idx##__field__]) = (__type__)data[#__field__][idx##__field__].get<__type__>(); \
-		} \
-	}
+#define WEAPON_FIELD(__type__, __field__) JSON_FIELD(WeaponDef, __type__, __field__)
+#define WEAPON_FIELD_ARR(__type__, __field__, __size__) JSON_FIELD_ARR(WeaponDef, __type__, __field__, __size__)
+#define WEAPON_FIELD_STRING(__field__) JSON_FIELD_STRING(WeaponDef, __field__)
+#define WEAPON_FIELD_ASSET(__type__, __field__) \
+	JSON_FIELD_ASSET_HEADER(WeaponDef, __field__, db_find_x_asset_data<__type__>)
+#define WEAPON_FIELD_ASSET_ARR(__type__, __field__, __size__) \
+	JSON_FIELD_ASSET_HEADER_ARR(WeaponDef, __field__, __size__, db_find_x_asset_data<__type__>)
 
-#define WEAPON_READ_STRING(__field__) \
-	if (!data[#__field__].is_null()) weapon->__field__ = mem->duplicate_string(data[#__field__].get<std::string>())
+	constexpr auto overlay_fields = json_fields::make_field_table<ADSOverlay>(
+	{
+		JSON_FIELD_ASSET_HEADER(ADSOverlay, shader, db_find_x_asset_data<ASSET_TYPE_MATERIAL>),
+		JSON_FIELD_ASSET_HEADER(ADSOverlay, shaderLowRes, db_find_x_asset_data<ASSET_TYPE_MATERIAL>),
+		JSON_FIELD_ASSET_HEADER(ADSOverlay, shaderEMP, db_find_x_asset_data<ASSET_TYPE_MATERIAL>),
+		JSON_FIELD_ASSET_HEADER(ADSOverlay, shaderEMPLowRes, db_find_x_asset_data<ASSET_TYPE_MATERIAL>),
+		JSON_FIELD(ADSOverlay, int, reticle),
+		JSON_FIELD(ADSOverlay, float, xU_01),
+		JSON_FIELD(ADSOverlay, float, xU_02),
+		JSON_FIELD(ADSOverlay, float, width),
+		JSON_FIELD(ADSOverlay, float, height),
+		JSON_FIELD(ADSOverlay, float, widthSplitscreen),
+		JSON_FIELD(ADSOverlay, float, heightSplitscreen)
+	});
+
+	constexpr auto state_timer_fields = json_fields::make_field_table<StateTimers>(
+	{
+		JSON_FIELD(StateTimers, int, fireDelay),
+		JSON_FIELD(StateTimers, int, meleeDelay),
+		JSON_FIELD(StateTimers, int, meleeChargeDelay),
+		JSON_FIELD(StateTimers, int, detonateDelay),
+		JSON_FIELD(StateTimers, int, fireTime),
+		JSON_FIELD(StateTimers, int, rechamberTime),
+		JSON_FIELD(StateTimers, int, rechamberTimeOneHanded),
+		JSON_FIELD(StateTimers, int, rechamberBoltTime),
+		JSON_FIELD(StateTimers, int, holdFireTime),
+		JSON_FIELD(StateTimers, int, grenadePrimeReadyToThrowTime),
+		JSON_FIELD(StateTimers, int, detonateTime),
+		JSON_FIELD(StateTimers, int, meleeTime),
+		JSON_FIELD(StateTimers, int, meleeChargeTime),
+		JSON_FIELD(StateTimers, int, reloadTime),
+		JSON_FIELD(StateTimers, int, reloadShowRocketTime),
+		JSON_FIELD(StateTimers, int, reloadEmptyTime),
+		JSON_FIELD(StateTimers, int, reloadAddTime),
+		JSON_FIELD(StateTimers, int, reloadEmptyAddTime),
+		JSON_FIELD(StateTimers, int, reloadStartTime),
+		JSON_FIELD(StateTimers, int, reloadStartAddTime),
+		JSON_FIELD(StateTimers, int, reloadEndTime),
+		JSON_FIELD(StateTimers, int, reloadTimeDualWield),
+		JSON_FIELD(StateTimers, int, reloadAddTimeDualWield),
+		JSON_FIELD(StateTimers, int, reloadEmptyDualMag),
+		JSON_FIELD(StateTimers, int, reloadEmptyAddTimeDualMag),
+		//JSON_FIELD(StateTimers, int, u25),
+		//JSON_FIELD(StateTimers, int, u26),
+		JSON_FIELD(StateTimers, int, dropTime),
+		JSON_FIELD(StateTimers, int, raiseTime),
+		JSON_FIELD(StateTimers, int, altDropTime),
+		JSON_FIELD(StateTimers, int, altRaiseTime),
+		JSON_FIELD(StateTimers, int, quickDropTime),
+		JSON_FIELD(StateTimers, int, quickRaiseTime),
+		JSON_FIELD(StateTimers, int, firstRaiseTime),
+		JSON_FIELD(StateTimers, int, breachRaiseTime),
+		JSON_FIELD(StateTimers, int, emptyRaiseTime),
+		JSON_FIELD(StateTimers, int, emptyDropTime),
+		JSON_FIELD(StateTimers, int, sprintInTime),
+		JSON_FIELD(StateTimers, int, sprintLoopTime),
+		JSON_FIELD(StateTimers, int, sprintOutTime),
+		JSON_FIELD(StateTimers, int, stunnedTimeBegin),
+		JSON_FIELD(StateTimers, int, stunnedTimeLoop),
+		JSON_FIELD(StateTimers, int, stunnedTimeEnd),
+		JSON_FIELD(StateTimers, int, nightVisionWearTime),
+		JSON_FIELD(StateTimers, int, nightVisionWearTimeFadeOutEnd),
+		JSON_FIELD(StateTimers, int, nightVisionWearTimePowerUp),
+		JSON_FIELD(StateTimers, int, nightVisionRemoveTime),
+		JSON_FIELD(StateTimers, int, nightVisionRemoveTimePowerDown),
+		JSON_FIELD(StateTimers, int, nightVisionRemoveTimeFadeInStart),
+		JSON_FIELD(StateTimers, int, aiFuseTime),
+		JSON_FIELD(StateTimers, int, fuseTime),
+		JSON_FIELD(StateTimers, int, missileTime),
+		JSON_FIELD(StateTimers, int, primeTime),
+		JSON_FIELD(StateTimers, bool, bHoldFullPrime),
+		JSON_FIELD(StateTimers, int, blastFrontTime),
+		JSON_FIELD(StateTimers, int, blastRightTime),
+		JSON_FIELD(StateTimers, int, blastBackTime),
+		JSON_FIELD(StateTimers, int, blastLeftTime),
+		//JSON_FIELD(StateTimers, int, u58),
+		//JSON_FIELD(StateTimers, int, u59),
+		//JSON_FIELD(StateTimers, int, u60),
+		//JSON_FIELD(StateTimers, int, u61),
+		//JSON_FIELD(StateTimers, int, u62),
+		//JSON_FIELD(StateTimers, int, u63),
+		//JSON_FIELD(StateTimers, int, u64),
+		//JSON_FIELD(StateTimers, int, u65),
+		//JSON_FIELD(StateTimers, int, u66),
+		//JSON_FIELD(StateTimers, int, u67),
+		//JSON_FIELD(StateTimers, int, u68),
+		JSON_FIELD(StateTimers, int, offhandSwitchTime),
+		//JSON_FIELD(StateTimers, int, u70),
+		//JSON_FIELD(StateTimers, int, u71),
+		//JSON_FIELD(StateTimers, int, u72),
+		//JSON_FIELD(StateTimers, int, u73),
+		//JSON_FIELD(StateTimers, int, u74)
+	});
+
+	constexpr auto weapon_fields = json_fields::make_field_table<WeaponDef>(
+	{
+		WEAPON_FIELD_STRING(szInternalName),
+		WEAPON_FIELD_STRING(szDisplayName),
+		WEAPON_FIELD_STRING(szOverlayName),
+		WEAPON_FIELD_STRING(szAttachmentName),
+		WEAPON_FIELD_STRING(szUnknownName),
+
+		WEAPON_FIELD_ASSET_ARR(ASSET_TYPE_XMODEL, gunModel, 2),
+		WEAPON_FIELD_ASSET_ARR(ASSET_TYPE_XMODEL, worldModel, 2),
+
+		WEAPON_FIELD_ASSET_ARR(ASSET_TYPE_XMODEL, reticleViewModels, 64),
+
+		WEAPON_FIELD_ASSET(ASSET_TYPE_XMODEL, handModel),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_XMODEL, unknownModel),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_XMODEL, worldClipModel),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_XMODEL, rocketModel),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_XMODEL, knifeModel),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_XMODEL, worldKnifeModel),
+
+		WEAPON_FIELD_STRING(szModeName),
+		WEAPON_FIELD_STRING(szAltWeaponName),
+		WEAPON_FIELD_STRING(szAmmoName),
+		WEAPON_FIELD_STRING(szClipName),
+		WEAPON_FIELD_STRING(szSharedAmmoCapName),
+
+		WEAPON_FIELD_ASSET(ASSET_TYPE_FX, viewFlashEffect),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_FX, viewBodyFlashEffect),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_FX, worldFlashEffect),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_FX, viewFlashADSEffect),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_FX, viewBodyFlashADSEffect),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_FX, effect06),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_FX, effect07),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_FX, effect08),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_FX, effect09),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_FX, effect10),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_FX, effect11),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_FX, effect12),
+
+		WEAPON_FIELD_ASSET_ARR(ASSET_TYPE_SOUND, bounceSound, 53),
+		WEAPON_FIELD_ASSET_ARR(ASSET_TYPE_SOUND, rollingSound, 53),
+
+		WEAPON_FIELD_ASSET(ASSET_TYPE_FX, viewShellEjectEffect),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_FX, worldShellEjectEffect),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_FX, viewLastShotEjectEffect),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_FX, worldLastShotEjectEffect),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_FX, viewMagEjectEffect),
+
+		WEAPON_FIELD_ASSET(ASSET_TYPE_MATERIAL, reticleCenter),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_MATERIAL, reticleSide),
+
+		WEAPON_FIELD_ASSET(ASSET_TYPE_MATERIAL, hudIcon),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_MATERIAL, pickupIcon),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_MATERIAL, unknownIcon2),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_MATERIAL, unknownIcon3),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_MATERIAL, unknownIcon4),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_MATERIAL, ammoCounterIcon),
+
+		WEAPON_FIELD_ASSET(ASSET_TYPE_PHYSCOLLMAP, physCollmap),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_PHYSPRESET, physPreset),
+
+		WEAPON_FIELD_STRING(szUseHintString),
+		WEAPON_FIELD_STRING(dropHintString),
+
+		WEAPON_FIELD_ARR(float, locationDamageMultipliers, 22),
+
+		WEAPON_FIELD_STRING(fireRumble),
+		WEAPON_FIELD_STRING(fireMedRumble),
+		WEAPON_FIELD_STRING(fireHighRumble),
+		WEAPON_FIELD_STRING(meleeImpactRumble),
+
+		WEAPON_FIELD_ASSET(ASSET_TYPE_TRACER, tracer1),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_TRACER, tracer2),
+
+		WEAPON_FIELD_ASSET(ASSET_TYPE_LASER, laser),
+
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, turretOverheatSound),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_FX, turretOverheatEffect),
+		WEAPON_FIELD_STRING(turretBarrelSpinRumble),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, turretBarrelSpinMaxSnd),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, missileConeSoundAlias),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, missileConeSoundAliasAtBase),
+
+		WEAPON_FIELD_ASSET(ASSET_TYPE_XMODEL, stowOffsetModel),
+
+		WEAPON_FIELD_ASSET(ASSET_TYPE_MATERIAL, killIcon),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_MATERIAL, dpadIcon),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_MATERIAL, hudProximityWarningIcon),
+
+		WEAPON_FIELD_STRING(projectileName),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_XMODEL, projectileModel),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_FX, projExplosionEffect),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_FX, projDudEffect),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, projExplosionSound),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, projDudSound),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_FX, projTrailEffect),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_FX, projBeaconEffect),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_FX, projIgnitionEffect),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, projIgnitionSound),
+
+		WEAPON_FIELD_STRING(szScript),
+
+		WEAPON_FIELD(int, altWeapon),
+		WEAPON_FIELD(playerAnimType_t, playerAnimType),
+		WEAPON_FIELD(weapType_t, weapType),
+		WEAPON_FIELD(weapClass_t, weapClass),
+		WEAPON_FIELD(PenetrateType, penetrateType),
+		WEAPON_FIELD(float, penetrateDepth),
+		WEAPON_FIELD(ImpactType, impactType),
+		WEAPON_FIELD(weapInventoryType_t, inventoryType),
+		WEAPON_FIELD(weapFireType_t, fireType),
+		WEAPON_FIELD(weapFireBarrels_t, fireBarrels),
+		WEAPON_FIELD(weapAdsFireMode_t, adsFireMode),
+		WEAPON_FIELD(float, burstFireCooldown),
+		WEAPON_FIELD(weapGreebleType_t, greebleType),
+		WEAPON_FIELD(weapAutoReloadType_t, autoReloadType),
+		WEAPON_FIELD(WeaponSlotRestriction, slotRestriction),
+		WEAPON_FIELD(OffhandClass, offhandClass),
+		WEAPON_FIELD(weapStance_t, stance),
+		WEAPON_FIELD(int, reticleCenterSize),
+		WEAPON_FIELD(int, reticleSideSize),
+		WEAPON_FIELD(int, reticleMinOfs),
+		WEAPON_FIELD(activeReticleType_t, activeReticleType),
+		WEAPON_FIELD_ARR(float, standMove, 3),
+		WEAPON_FIELD_ARR(float, standRot, 3),
+		WEAPON_FIELD_ARR(float, strafeMove, 3),
+		WEAPON_FIELD_ARR(float, strafeRot, 3),
+		WEAPON_FIELD_ARR(float, duckedOfs, 3),
+		WEAPON_FIELD_ARR(float, duckedMove, 3),
+		WEAPON_FIELD_ARR(float, duckedRot, 3),
+		WEAPON_FIELD_ARR(float, proneOfs, 3),
+		WEAPON_FIELD_ARR(float, proneMove, 3),
+		WEAPON_FIELD_ARR(float, proneRot, 3),
+		WEAPON_FIELD_ARR(float, unkVec1, 3),
+		WEAPON_FIELD_ARR(float, unkVec2, 3),
+		WEAPON_FIELD(float, posMoveRate),
+		WEAPON_FIELD(float, posProneMoveRate),
+		WEAPON_FIELD(float, standMoveMinSpeed),
+		WEAPON_FIELD(float, duckedMoveMinSpeed),
+		WEAPON_FIELD(float, proneMoveMinSpeed),
+		WEAPON_FIELD(float, posRotRate),
+		WEAPON_FIELD(float, posProneRotRate),
+		WEAPON_FIELD(weaponIconRatioType_t, hudIconRatio),
+		WEAPON_FIELD(weaponIconRatioType_t, pickupIconRatio),
+		WEAPON_FIELD(weaponIconRatioType_t, ammoCounterIconRatio),
+		WEAPON_FIELD(int, ammoCounterClip),
+		WEAPON_FIELD(int, startAmmo),
+		WEAPON_FIELD(int, ammoIndex),
+		WEAPON_FIELD(int, clipIndex),
+		WEAPON_FIELD(int, maxAmmo),
+		WEAPON_FIELD(int, minAmmoReq),
+		WEAPON_FIELD(int, clipSize),
+		WEAPON_FIELD(int, shotCount),
+		WEAPON_FIELD(int, sharedAmmoCapIndex),
+		WEAPON_FIELD(int, sharedAmmoCap),
+		WEAPON_FIELD(int, damage),
+		WEAPON_FIELD(int, playerDamage),
+		WEAPON_FIELD(int, meleeDamage),
+		WEAPON_FIELD(int, damageType),
+		WEAPON_FIELD(float, autoAimRange),
+		WEAPON_FIELD(float, aimAssistRange),
+		WEAPON_FIELD(float, aimAssistRangeAds),
+		WEAPON_FIELD(float, aimPadding),
+		WEAPON_FIELD(float, enemyCrosshairRange),
+		WEAPON_FIELD(float, moveSpeedScale),
+		WEAPON_FIELD(float, adsMoveSpeedScale),
+		WEAPON_FIELD(float, sprintDurationScale),
+		WEAPON_FIELD(float, adsZoomFov),
+		WEAPON_FIELD(float, adsZoomInFrac),
+		WEAPON_FIELD(float, adsZoomOutFrac),
+		WEAPON_FIELD(float, adsSceneBlur),
+		WEAPON_FIELD(float, adsBobFactor),
+		WEAPON_FIELD(float, adsViewBobMult),
+		WEAPON_FIELD(float, hipSpreadStandMin),
+		WEAPON_FIELD(float, hipSpreadDuckedMin),
+		WEAPON_FIELD(float, hipSpreadProneMin),
+		WEAPON_FIELD(float, hipSpreadStandMax),
+		WEAPON_FIELD(float, hipSpreadDuckedMax),
+		WEAPON_FIELD(float, hipSpreadProneMax),
+		WEAPON_FIELD(float, hipSpreadDecayRate),
+		WEAPON_FIELD(float, hipSpreadFireAdd),
+		WEAPON_FIELD(float, hipSpreadTurnAdd),
+		WEAPON_FIELD(float, hipSpreadMoveAdd),
+		WEAPON_FIELD(float, hipSpreadDuckedDecay),
+		WEAPON_FIELD(float, hipSpreadProneDecay),
+		WEAPON_FIELD(float, hipReticleSidePos),
+		WEAPON_FIELD(float, adsIdleAmount),
+		WEAPON_FIELD(float, hipIdleAmount),
+		WEAPON_FIELD(float, adsIdleSpeed),
+		WEAPON_FIELD(float, hipIdleSpeed),
+		WEAPON_FIELD(float, idleCrouchFactor),
+		WEAPON_FIELD(float, idleProneFactor),
+		WEAPON_FIELD(float, gunMaxPitch),
+		WEAPON_FIELD(float, gunMaxYaw),
+		WEAPON_FIELD(float, adsIdleLerpStartTime),
+		WEAPON_FIELD(float, adsIdleLerpTime),
+		WEAPON_FIELD(int, adsTransInTime),
+		WEAPON_FIELD(int, adsTransOutTime),
+		WEAPON_FIELD(float, swayMaxAngle),
+		WEAPON_FIELD(float, swayLerpSpeed),
+		WEAPON_FIELD(float, swayPitchScale),
+		WEAPON_FIELD(float, swayYawScale),
+		WEAPON_FIELD(float, swayVertScale),
+		WEAPON_FIELD(float, swayHorizScale),
+		WEAPON_FIELD(float, swayShellShockScale),
+		WEAPON_FIELD(float, adsSwayMaxAngle),
+		WEAPON_FIELD(float, adsSwayLerpSpeed),
+		WEAPON_FIELD(float, adsSwayPitchScale),
+		WEAPON_FIELD(float, adsSwayYawScale),
+		WEAPON_FIELD(float, adsSwayHorizScale),
+		WEAPON_FIELD(float, adsSwayVertScale),
+		WEAPON_FIELD(float, adsViewErrorMin),
+		WEAPON_FIELD(float, adsViewErrorMax),
+		WEAPON_FIELD(float, adsFireAnimFrac),
+		WEAPON_FIELD(float, dualWieldViewModelOffset),
+		WEAPON_FIELD(float, scopeDriftDelay),
+		WEAPON_FIELD(float, scopeDriftLerpInTime),
+		WEAPON_FIELD(float, scopeDriftSteadyTime),
+		WEAPON_FIELD(float, scopeDriftLerpOutTime),
+		WEAPON_FIELD(float, scopeDriftSteadyFactor),
+		WEAPON_FIELD(float, scopeDriftUnsteadyFactor),
+		WEAPON_FIELD(float, bobVerticalFactor),
+		WEAPON_FIELD(float, bobHorizontalFactor),
+		WEAPON_FIELD(float, bobViewVerticalFactor),
+		WEAPON_FIELD(float, bobViewHorizontalFactor),
+		WEAPON_FIELD(float, stationaryZoomFov),
+		WEAPON_FIELD(float, stationaryZoomDelay),
+		WEAPON_FIELD(float, stationaryZoomLerpInTime),
+		WEAPON_FIELD(float, stationaryZoomLerpOutTime),
+		WEAPON_FIELD(float, adsDofStart),
+		WEAPON_FIELD(float, adsDofEnd),
+		WEAPON_FIELD(weaponIconRatioType_t, killIconRatio),
+		WEAPON_FIELD(weaponIconRatioType_t, dpadIconRatio),
+		WEAPON_FIELD(int, fireAnimLength),
+		WEAPON_FIELD(int, fireAnimLengthAkimbo),
+		WEAPON_FIELD(int, inspectAnimTime),
+		WEAPON_FIELD(int, reloadAmmoAdd),
+		WEAPON_FIELD(int, reloadStartAdd),
+		WEAPON_FIELD(int, ammoDropStockMin),
+		WEAPON_FIELD(int, ammoDropStockMax),
+		WEAPON_FIELD(int, ammoDropClipPercentMin),
+		WEAPON_FIELD(int, ammoDropClipPercentMax),
+		WEAPON_FIELD(int, explosionRadius),
+		WEAPON_FIELD(int, explosionRadiusMin),
+		WEAPON_FIELD(int, explosionInnerDamage),
+		WEAPON_FIELD(int, explosionOuterDamage),
+		WEAPON_FIELD(float, damageConeAngle),
+		WEAPON_FIELD(float, bulletExplDmgMult),
+		WEAPON_FIELD(float, bulletExplRadiusMult),
+		WEAPON_FIELD(int, projectileSpeed),
+		WEAPON_FIELD(int, projectileSpeedUp),
+		WEAPON_FIELD(int, projectileSpeedForward),
+		WEAPON_FIELD(int, projectileActivateDist),
+		WEAPON_FIELD(float, projLifetime),
+		WEAPON_FIELD(float, timeToAccelerate),
+		WEAPON_FIELD(float, projectileCurvature),
+		WEAPON_FIELD(weapProjExposion_t, projExplosion),
+		WEAPON_FIELD(WeapStickinessType, stickiness),
+		WEAPON_FIELD(float, lowAmmoWarningThreshold),
+		WEAPON_FIELD(float, ricochetChance),
+		WEAPON_FIELD(int, riotShieldHealth),
+		WEAPON_FIELD(float, riotShieldDamageMult),
+		WEAPON_FIELD_ARR(float, parallelBounce, 53),
+		WEAPON_FIELD_ARR(float, perpendicularBounce, 53),
+		WEAPON_FIELD_ARR(float, projectileColor, 3),
+		WEAPON_FIELD(guidedMissileType_t, guidedMissileType),
+		WEAPON_FIELD(float, maxSteeringAccel),
+		WEAPON_FIELD(int, projIgnitionDelay),
+		WEAPON_FIELD(float, adsAimPitch),
+		WEAPON_FIELD(float, adsCrosshairInFrac),
+		WEAPON_FIELD(float, adsCrosshairOutFrac),
+		WEAPON_FIELD(int, adsGunKickReducedKickBullets),
+		WEAPON_FIELD(float, adsGunKickReducedKickPercent),
+		WEAPON_FIELD(float, adsGunKickPitchMin),
+		WEAPON_FIELD(float, adsGunKickPitchMax),
+		WEAPON_FIELD(float, adsGunKickYawMin),
+		WEAPON_FIELD(float, adsGunKickYawMax),
+		WEAPON_FIELD(float, adsGunKickMagMin),
+		WEAPON_FIELD(float, adsGunKickAccel),
+		WEAPON_FIELD(float, adsGunKickSpeedMax),
+		WEAPON_FIELD(float, adsGunKickSpeedDecay),
+		WEAPON_FIELD(float, adsGunKickStaticDecay),
+		WEAPON_FIELD(float, adsViewKickPitchMin),
+		WEAPON_FIELD(float, adsViewKickPitchMax),
+		WEAPON_FIELD(float, adsViewKickYawMin),
+		WEAPON_FIELD(float, adsViewKickYawMax),
+		WEAPON_FIELD(float, adsViewKickMagMin),
+		WEAPON_FIELD(float, adsViewKickCenterSpeed),
+		WEAPON_FIELD(float, adsViewScatterMin),
+		WEAPON_FIELD(float, adsViewScatterMax),
+		WEAPON_FIELD(float, adsSpread),
+		WEAPON_FIELD(int, hipGunKickReducedKickBullets),
+		WEAPON_FIELD(float, hipGunKickReducedKickPercent),
+		WEAPON_FIELD(float, hipGunKickPitchMin),
+		WEAPON_FIELD(float, hipGunKickPitchMax),
+		WEAPON_FIELD(float, hipGunKickYawMin),
+		WEAPON_FIELD(float, hipGunKickYawMax),
+		WEAPON_FIELD(float, hipGunKickMagMin),
+		WEAPON_FIELD(float, hipGunKickAccel),
+		WEAPON_FIELD(float, hipGunKickSpeedMax),
+		WEAPON_FIELD(float, hipGunKickSpeedDecay),
+		WEAPON_FIELD(float, hipGunKickStaticDecay),
+		WEAPON_FIELD(float, hipViewKickPitchMin),
+		WEAPON_FIELD(float, hipViewKickPitchMax),
+		WEAPON_FIELD(float, hipViewKickYawMin),
+		WEAPON_FIELD(float, hipViewKickYawMax),
+		WEAPON_FIELD(float, hipViewKickMagMin),
+		WEAPON_FIELD(float, hipViewKickCenterSpeed),
+		WEAPON_FIELD(float, hipViewScatterMin),
+		WEAPON_FIELD(float, hipViewScatterMax),
+		WEAPON_FIELD(int, adsReloadTransTime),
+		WEAPON_FIELD(float, fightDist),
+		WEAPON_FIELD(float, maxDist),
+		WEAPON_FIELD(int, positionReloadTransTime),
+		WEAPON_FIELD(float, leftArc),
+		WEAPON_FIELD(float, rightArc),
+		WEAPON_FIELD(float, topArc),
+		WEAPON_FIELD(float, bottomArc),
+		WEAPON_FIELD(float, accuracy),
+		WEAPON_FIELD(float, aiSpread),
+		WEAPON_FIELD(float, playerSpread),
+		WEAPON_FIELD_ARR(float, minTurnSpeed, 2),
+		WEAPON_FIELD_ARR(float, maxTurnSpeed, 2),
+		WEAPON_FIELD(float, pitchConvergenceTime),
+		WEAPON_FIELD(float, yawConvergenceTime),
+		WEAPON_FIELD(float, suppressTime),
+		WEAPON_FIELD(float, maxRange),
+		WEAPON_FIELD(float, animHorRotateInc),
+		WEAPON_FIELD(float, playerPositionDist),
+		WEAPON_FIELD(float, horizViewJitter),
+		WEAPON_FIELD(float, vertViewJitter),
+		WEAPON_FIELD(float, scanSpeed),
+		WEAPON_FIELD(float, scanAccel),
+		WEAPON_FIELD(int, scanPauseTime),
+		WEAPON_FIELD(int, minDamage),
+		WEAPON_FIELD(int, midDamage),
+		WEAPON_FIELD(int, minPlayerDamage),
+		WEAPON_FIELD(int, midPlayerDamage),
+		WEAPON_FIELD(float, maxDamageRange),
+		WEAPON_FIELD(float, minDamageRange),
+		WEAPON_FIELD_ARR(char, __pad, 12),
+		WEAPON_FIELD(float, destabilizationRateTime),
+		WEAPON_FIELD(float, destabilizationCurvatureMax),
+		WEAPON_FIELD(int, destabilizeDistance),
+		WEAPON_FIELD(float, turretADSTime),
+		WEAPON_FIELD(float, turretFov),
+		WEAPON_FIELD(float, turretFovADS),
+		WEAPON_FIELD(float, turretScopeZoomRate),
+		WEAPON_FIELD(float, turretScopeZoomMin),
+		WEAPON_FIELD(float, turretScopeZoomMax),
+		WEAPON_FIELD(float, turretBarrelSpinSpeed),
+		WEAPON_FIELD(float, turretBarrelSpinUpTime),
+		WEAPON_FIELD(float, turretBarrelSpinDownTime),
+		WEAPON_FIELD(float, missileConeSoundRadiusAtTop),
+		WEAPON_FIELD(float, missileConeSoundRadiusAtBase),
+		WEAPON_FIELD(float, missileConeSoundHeight),
+		WEAPON_FIELD(float, missileConeSoundOriginOffset),
+		WEAPON_FIELD(float, missileConeSoundVolumescaleAtCore),
+		WEAPON_FIELD(float, missileConeSoundVolumescaleAtEdge),
+		WEAPON_FIELD(float, missileConeSoundVolumescaleCoreSize),
+		WEAPON_FIELD(float, missileConeSoundPitchAtTop),
+		WEAPON_FIELD(float, missileConeSoundPitchAtBottom),
+		WEAPON_FIELD(float, missileConeSoundPitchTopSize),
+		WEAPON_FIELD(float, missileConeSoundPitchBottomSize),
+		WEAPON_FIELD(float, missileConeSoundCrossfadeTopSize),
+		WEAPON_FIELD(float, missileConeSoundCrossfadeBottomSize),
+		WEAPON_FIELD(float, aim_automelee_lerp),
+		WEAPON_FIELD(float, aim_automelee_range),
+		WEAPON_FIELD(float, aim_automelee_region_height),
+		WEAPON_FIELD(float, aim_automelee_region_width),
+		WEAPON_FIELD(float, player_meleeHeight),
+		WEAPON_FIELD(float, player_meleeRange),
+		WEAPON_FIELD(float, player_meleeWidth),
+		WEAPON_FIELD(float, signatureFireTime),
+		WEAPON_FIELD(int, signatureNumBullets),
+		WEAPON_FIELD(weapFireTimeInterpolation_t, fireTimeInterpolationType),
+		WEAPON_FIELD(int, ammoUsedPerShot),
+		WEAPON_FIELD(bool, turretADSEnabled),
+		WEAPON_FIELD(bool, knifeAttachTagLeft),
+		WEAPON_FIELD(bool, knifeAlwaysAttached),
+		WEAPON_FIELD(bool, meleeOverrideValues),
+		WEAPON_FIELD(bool, sharedAmmo),
+		WEAPON_FIELD(bool, lockonSupported),
+		WEAPON_FIELD(bool, requireLockonToFire),
+		WEAPON_FIELD(bool, isAirburstWeapon),
+		WEAPON_FIELD(bool, bigExplosion),
+		WEAPON_FIELD(bool, noAdsWhenMagEmpty),
+		WEAPON_FIELD(bool, avoidDropCleanup),
+		WEAPON_FIELD(bool, inheritsPerks),
+		WEAPON_FIELD(bool, crosshairColorChange),
+		WEAPON_FIELD(bool, rifleBullet),
+		WEAPON_FIELD(bool, armorPiercing),
+		WEAPON_FIELD(bool, boltAction),
+		WEAPON_FIELD(bool, aimDownSight),
+		WEAPON_FIELD(bool, canHoldBreath),
+		WEAPON_FIELD(bool, meleeOnly),
+		WEAPON_FIELD(bool, canVariableZoom),
+		WEAPON_FIELD(bool, rechamberWhileAds),
+		WEAPON_FIELD(bool, bulletExplosiveDamage),
+		WEAPON_FIELD(bool, cookOffHold),
+		WEAPON_FIELD(bool, reticleSpin45),
+		WEAPON_FIELD(bool, reticleSideEnabled),
+		WEAPON_FIELD(bool, clipOnly),
+		WEAPON_FIELD(bool, noAmmoPickup),
+		WEAPON_FIELD(bool, disableSwitchToWhenEmpty),
+		WEAPON_FIELD(bool, hasMotionTracker),
+		WEAPON_FIELD(bool, noDualWield),
+		WEAPON_FIELD(bool, flipKillIcon),
+		WEAPON_FIELD(bool, actionSlotShowAmmo),
+		WEAPON_FIELD(bool, noPartialReload),
+		WEAPON_FIELD(bool, segmentedReload),
+		WEAPON_FIELD(bool, multipleReload),
+		WEAPON_FIELD(bool, blocksProne),
+		WEAPON_FIELD(bool, silenced),
+		WEAPON_FIELD(bool, isRollingGrenade),
+		WEAPON_FIELD(bool, projExplosionEffectForceNormalUp),
+		WEAPON_FIELD(bool, projExplosionEffectInheritParentDirection),
+		WEAPON_FIELD(bool, projImpactExplode),
+		WEAPON_FIELD(bool, projTrajectoryEvents),
+		WEAPON_FIELD(bool, projWhizByEnabled),
+		WEAPON_FIELD(bool, stickToPlayers),
+		WEAPON_FIELD(bool, stickToVehicles),
+		WEAPON_FIELD(bool, stickToTurrets),
+		WEAPON_FIELD(bool, thrownSideways),
+		WEAPON_FIELD(bool, hasDetonatorEmptyThrow),
+		WEAPON_FIELD(bool, hasDetonatorDoubleTap),
+		WEAPON_FIELD(bool, disableFiring),
+		WEAPON_FIELD(bool, timedDetonation),
+		WEAPON_FIELD(bool, rotate),
+		WEAPON_FIELD(bool, holdButtonToThrow),
+		WEAPON_FIELD(bool, freezeMovementWhenFiring),
+		WEAPON_FIELD(bool, thermalScope),
+		WEAPON_FIELD(bool, thermalToggle),
+		WEAPON_FIELD(bool, outlineEnemies),
+		WEAPON_FIELD(bool, altModeSameWeapon),
+		WEAPON_FIELD(bool, turretBarrelSpinEnabled),
+		WEAPON_FIELD(bool, missileConeSoundEnabled),
+		WEAPON_FIELD(bool, missileConeSoundPitchshiftEnabled),
+		WEAPON_FIELD(bool, missileConeSoundCrossfadeEnabled),
+		WEAPON_FIELD(bool, offhandHoldIsCancelable),
+		WEAPON_FIELD(bool, doNotAllowAttachmentsToOverrideSpread),
+		WEAPON_FIELD(bool, useFastReloadAnims),
+		WEAPON_FIELD(bool, dualMagReloadSupported),
+		WEAPON_FIELD(bool, reloadStopsAlt),
+		WEAPON_FIELD(bool, alwaysShatterGlassOnImpact),
+		WEAPON_FIELD(bool, oldWeapon),
+		WEAPON_FIELD(bool, hasCounterSilencer),
+		WEAPON_FIELD(bool, disableVariableAutosimRate),
+		WEAPON_FIELD(bool, cloakedWeapon),
+		WEAPON_FIELD(bool, adsHideWeapon),
+		WEAPON_FIELD(bool, adsHideHands),
+		WEAPON_FIELD(bool, adsBlurSceneEnabled),
+		WEAPON_FIELD(bool, usesSniperScope),
+		WEAPON_FIELD(float, adsDofPhysicalFStop),
+		WEAPON_FIELD(float, adsDofPhysicalFocusDistance),
+		WEAPON_FIELD(float, autosimSpeedScalar),
+		WEAPON_FIELD_ARR(float, explosionReactiveMotionParts, 5),
+
+		//WEAPON_FIELD(float, fU_007),
+		//WEAPON_FIELD(float, xU_008),
+		//WEAPON_FIELD(float, xU_009),
+		//WEAPON_FIELD(float, xU_010),
+		//WEAPON_FIELD(int, xU_011),
+		//WEAPON_FIELD(int, xU_012),
+		//WEAPON_FIELD(float, xU_020),
+		//WEAPON_FIELD(float, xU_021),
+		//WEAPON_FIELD(float, xU_043),
+		//WEAPON_FIELD(unsigned int, iUseHintStringIndex),
+		//WEAPON_FIELD(unsigned int, dropHintStringIndex),
+		//WEAPON_FIELD(int, iU_045),
+		//WEAPON_FIELD(int, iU_046),
+		//WEAPON_FIELD(int, iU_047),
+		//WEAPON_FIELD(int, iU_048),
+		//WEAPON_FIELD(float, fU_049),
+		//WEAPON_FIELD(float, fU_050),
+		//WEAPON_FIELD(float, xU_056),
+		//WEAPON_FIELD(float, xU_057),
+		//WEAPON_FIELD(float, xU_058),
+		//WEAPON_FIELD(float, xU_059),
+		//WEAPON_FIELD(int, xU_075),
+		//WEAPON_FIELD(int, xU_076),
+		//WEAPON_FIELD(int, xU_077),
+		//WEAPON_FIELD(int, xU_078),
+		//WEAPON_FIELD(int, iU_079),
+		//WEAPON_FIELD(int, iU_080),
+		//WEAPON_FIELD(bool, bU_081),
+		//WEAPON_FIELD(bool, unknownReticleBooleanValue1),
+		//WEAPON_FIELD(bool, unknownReticleBooleanValue2),
+		//WEAPON_FIELD(bool, bU_083),
+		//WEAPON_FIELD(bool, bU_084),
+		//WEAPON_FIELD(bool, bU_085),
+		//WEAPON_FIELD(bool, bU_086),
+		//WEAPON_FIELD(bool, bU_088),
+		//WEAPON_FIELD(bool, bU_089),
+		//WEAPON_FIELD(bool, bU_090),
+		//WEAPON_FIELD(bool, bU_091),
+		//WEAPON_FIELD(bool, bU_092),
+		//WEAPON_FIELD(bool, bU_093),
+		//WEAPON_FIELD(bool, bU_094),
+		//WEAPON_FIELD(bool, bU_095),
+		//WEAPON_FIELD(bool, xU_097),
+		//WEAPON_FIELD(bool, xU_098),
+		//WEAPON_FIELD(bool, bU_100),
+		//WEAPON_FIELD(bool, bU_101),
+		//WEAPON_FIELD(bool, bU_102),
+		//WEAPON_FIELD(bool, bU_103),
+		//WEAPON_FIELD(bool, bU_104),
+		//WEAPON_FIELD(bool, bU_108),
+		//WEAPON_FIELD(bool, bU_111),
+		//WEAPON_FIELD(bool, bU_112),
+		//WEAPON_FIELD(bool, bU_113),
+		//WEAPON_FIELD(bool, bU_114),
+		//WEAPON_FIELD(bool, bU_115),
+	});
+
+	// the "sounds" object of a weapon
+	constexpr auto weapon_sound_fields = json_fields::make_field_table<WeaponDef>(
+	{
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, pickupSound),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, pickupSoundPlayer),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, ammoPickupSound),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, ammoPickupSoundPlayer),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, projectileSound),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, pullbackSound),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, pullbackSoundPlayer),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, pullbackSoundQuick),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, pullbackSoundQuickPlayer),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, fireSound),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, fireSoundPlayer),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, fireSoundPlayerLeft),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, fireSoundPlayerRight),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, sound14),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, sound15),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, sound16),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, sound17),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, sound18),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, fireLoopSound),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, fireLoopSoundPlayer),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, sound21),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, sound22),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, sound23),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, sound24),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, sound25),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, sound26),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, fireStopSound),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, fireStopSoundPlayer),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, sound29),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, sound30),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, sound31),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, sound32),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, sound33),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, fireFirstSound),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, fireFirstSoundPlayer),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, fireSound2),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, fireSoundPlayer2),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, fireSpecialSound),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, fireSpecialSoundPlayer),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, emptyFireSound),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, emptyFireSoundPlayer),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, emptyFireSoundPlayerLeft),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, emptyFireSoundPlayerRight),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, emptyFireSoundReleasePlayer),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, emptyFireSoundReleasePlayerLeft),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, emptyFireSoundReleasePlayerRight),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, sound47),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, meleeSwipeSound),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, meleeSwipeSoundPlayer),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, meleeHitSound),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, meleeHitSoundPlayer),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, meleeMissSound),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, meleeMissSoundPlayer),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, sound54),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, sound55),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, sound56),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, sound57),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, sound58),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, sound59),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, sound60),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, sound61),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, sound62),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, sound63),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, sound64),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, sound65),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, nightVisionWearSound),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, nightVisionWearSoundPlayer),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, nightVisionRemoveSound),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, nightVisionRemoveSoundPlayer),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, raiseSound),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, raiseSoundPlayer),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, raiseSoundPlayerLeft),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, raiseSoundPlayerRight),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, sound74),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, quickRaiseSoundPlayer),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, quickRaiseSoundPlayerLeft),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, quickRaiseSoundPlayerRight),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, raiseSound2),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, sound79),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, sound80),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, sound81),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, putawaySound),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, putawaySoundPlayer),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, putawaySoundPlayerLeft),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, putawaySoundPlayerRight),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, sound86),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, sound87),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, adsEnterSoundPlayer),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, adsLeaveSoundPlayer),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, adsCrosshairEnemySound)
+	});
+
+	constexpr auto hydraulic_settings_fields = json_fields::make_field_table<TurretHydraulicSettings>(
+	{
+		JSON_FIELD(TurretHydraulicSettings, float, minVelocity),
+		JSON_FIELD(TurretHydraulicSettings, float, maxVelocity),
+		JSON_FIELD_ASSET(TurretHydraulicSettings, verticalSound),
+		JSON_FIELD_ASSET(TurretHydraulicSettings, verticalStopSound),
+		JSON_FIELD_ASSET(TurretHydraulicSettings, horizontalSound),
+		JSON_FIELD_ASSET(TurretHydraulicSettings, horizontalStopSound)
+	});
+
+	template <typename T>
+	T* parse_asset_header(const XAssetType type, const json& value)
+	{
+		const auto name = value.is_string() ? value.get<std::string>() : ""s;
+		if (name.empty())
+		{
+			return nullptr;
+		}
 
-#define WEAPON_READ_ASSET(__type__, __datafield__, __field__) \
-	if (!data[#__field__].is_null() && data[#__field__].is_string()) \
-	{ \
-		auto asset##__field__ = data[#__field__].get<std::string>(); \
-		if (asset##__field__.empty()) \
-		{ \
-			weapon->__field__ = nullptr; \
-		} \
-		else \
-		{ \
-			weapon->__field__ = db_find_x_asset_header(XAssetType::__type__, asset##__field__.data(), 1).__datafield__; \
-		} \
-	} \
-	else \
-	{ \
-		weapon->__field__ = nullptr; \
+		return reinterpret_cast<T*>(db_find_x_asset_header(type, name.data(), 1).data);
 	}
 
-#define WEAPON_READ_ASSET_ARR(__type__, __datafield__, __field__, __struct__, __size__) \
-	if (!data[#__field__].is_null()) \
-	{ \
-		weapon->__field__ = mem->allocate<__struct__*>(__size__); \
-		for (auto idx##__field__ = 0; idx##__field__ < __size__; idx##__field__++) \
-		{ \
-			auto asset##__field__ = data[#__field__][idx##__field__].get<std::string>(); \
-			if (asset##__field__.empty()) \
-			{ \
-				weapon->__field__[idx##__field__] = nullptr; \
-			} \
-			else \
-			{ \
-				weapon->__field__[idx##__field__] = db_find_x_asset_header(XAssetType::__type__, asset##__field__.data(), 1).__datafield__; \
-			} \
-		} \
-	} \
-	else \
-	{ \
-		weapon->__field__ = nullptr; \
-	}
+	void parse_anims(XAnimParts**& anims, const json& data, zone_memory* mem)
+	{
+		if (data.is_null())
+		{
+			anims = nullptr;
+			return;
+		}
 
-#define WEAPON_READ_ANIM_ARR(__field__, __size__) \
-	if (!data[#__field__].is_null()) \
-	{ \
-		weapon->__field__ = mem->allocate<XAnimParts*>(__size__); \
-		for (auto idx##__field__ = 0; idx##__field__ < __size__; idx##__field__++) \
-		{ \
-			auto asset##__field__ = data[#__field__][get_anim_name_from_index(idx##__field__)]; \
-			if (asset##__field__.is_null()) \
-			{ \
-				weapon->__field__[idx##__field__] = nullptr; \
-			} \
-			else \
-			{ \
-				const auto asset_str_##__field__ = asset##__field__.get<std::string>(); \
-				if (asset_str_##__field__.empty()) \
-				{ \
-					weapon->__field__[idx##__field__] = nullptr; \
-				} \
-				else \
-				{ \
-					weapon->__field__[idx##__field__] = db_find_x_asset_header(XAssetType::ASSET_TYPE_XANIM, asset_str_##__field__.data(), 1).parts; \
-				} \
-			} \
-		} \
-	} \
-	else \
-	{ \
-		weapon->__field__ = nullptr; \
+		anims = mem->allocate<XAnimParts*>(NUM_WEAP_ANIMS);
+		for (auto i = 0; i < NUM_WEAP_ANIMS; i++)
+		{
+			anims[i] = parse_asset_header<XAnimParts>(ASSET_TYPE_XANIM, json_fields::get(data, get_anim_name_from_index(i)));
+		}
 	}
 
-#define WEAPON_READ_SOUND(__field__) \
-	if (!data["sounds"][#__field__].is_null() && data["sounds"][#__field__].is_string()) \
-	{ \
-		auto asset##__field__ = data["sounds"][#__field__]; \
-		if (asset##__field__.is_null()) \
-		{ \
-			weapon->__field__ = nullptr; \
-		} \
-		else \
-		{ \
-			const auto asset_str_##__field__ = asset##__field__.get<std::string>(); \
-			if (asset_str_##__field__.empty()) \
-			{ \
-				weapon->__field__ = nullptr; \
-			} \
-			else \
-			{ \
-				weapon->__field__ = db_find_x_asset_header(XAssetType::ASSET_TYPE_SOUND, asset_str_##__field__.data(), 1).sound; \
-			} \
-		} \
-	} \
-	else \
-	{ \
-		weapon->__field__ = nullptr; \
+	void parse_overlay(ADSOverlay* weapon, const json& data, zone_memory* mem)
+	{
+		overlay_fields.read(weapon, data, mem);
 	}
 
-	void parse_overlay(ADSOverlay * weapon, json & data)
+	void parse_turret_hydraulic_settings(TurretHydraulicSettings* settings, const json& data, zone_memory* mem)
 	{
-		WEAPON_READ_ASSET(ASSET_TYPE_MATERIAL, material, shader);
-		WEAPON_READ_ASSET(ASSET_TYPE_MATERIAL, material, shaderLowRes);
-		WEAPON_READ_ASSET(ASSET_TYPE_MATERIAL, material, shaderEMP);
-		WEAPON_READ_ASSET(ASSET_TYPE_MATERIAL, material, shaderEMPLowRes);
-		WEAPON_READ_FIELD(int, reticle);
-		WEAPON_READ_FIELD(float, xU_01);
-		WEAPON_READ_FIELD(float, xU_02);
-		WEAPON_READ_FIELD(float, width);
-		WEAPON_READ_FIELD(float, height);
-		WEAPON_READ_FIELD(float, widthSplitscreen);
-		WEAPON_READ_FIELD(float, heightSplitscreen);
+		hydraulic_settings_fields.read(settings, data, mem);
 	}
 
-	void parse_turret_hydraulic_settings(TurretHydraulicSettings* settings, json& data, zone_memory* mem)
+	void parse_accuracy_graph_knots(vec2_t*& knots, short& knot_count, const json& data, zone_memory* mem)
 	{
-		settings->minVelocity = data["minVelocity"].is_number() ? data["minVelocity"].get<float>() : 0.0f;
-		settings->maxVelocity = data["maxVelocity"].is_number() ? data["maxVelocity"].get<float>() : 0.0f;
-
-		if (!data["verticalSound"].is_null())
+		if (!data.is_array())
 		{
-			auto string = data["verticalSound"].get<std::string>();
-			if (!string.empty())
-			{
-				settings->verticalSound = mem->allocate<snd_alias_list_t>();
-				settings->verticalSound->name = mem->duplicate_string(string);
-			}
+			return;
 		}
 
-		if (!data["verticalStopSound"].is_null())
-		{
-			auto string = data["verticalStopSound"].get<std::string>();
-			if (!string.empty())
-			{
-				settings->verticalStopSound = mem->allocate<snd_alias_list_t>();
-				settings->verticalStopSound->name = mem->duplicate_string(string);
-			}
-		}
+		const auto count = data.size();
+		knots = mem->allocate<vec2_t>(count);
+		knot_count = static_cast<short>(count);
 
-		if (!data["horizontalSound"].is_null())
+		for (auto o = 0u; o < count; o++)
 		{
-			auto string = data["horizontalSound"].get<std::string>();
-			if (!string.empty())
-			{
-				settings->horizontalSound = mem->allocate<snd_alias_list_t>();
-				settings->horizontalSound->name = mem->duplicate_string(string);
-			}
-		}
-
-		if (!data["horizontalStopSound"].is_null())
-		{
-			auto string = data["horizontalStopSound"].get<std::string>();
-			if (!string.empty())
-			{
-				settings->horizontalStopSound = mem->allocate<snd_alias_list_t>();
-				settings->horizontalStopSound->name = mem->duplicate_string(string);
-			}
+			knots[o][0] = data[o].at(0).get<float>();
+			knots[o][1] = data[o].at(1).get<float>();
 		}
 	}
 
-	void parse_accuracy_graph(WeaponDef* def, json& data, zone_memory* mem)
+	void parse_accuracy_graph(WeaponDef* def, const json& data, zone_memory* mem)
 	{
+		const auto& names = json_fields::get(data, "accuracyGraphName");
+		const auto& knots = json_fields::get(data, "accuracyGraphKnots");
+		const auto& original_knots = json_fields::get(data, "originalAccuracyGraphKnots");
+
 		for (auto i = 0; i < 2; i++)
 		{
-			def->accuracyGraphName[i] = data["accuracyGraphName"][i].is_string()
-				? mem->duplicate_string(data["accuracyGraphName"][i].get<std::string>())
+			const auto& graph_name = json_fields::get(names, i);
+			def->accuracyGraphName[i] = graph_name.is_string()
+				? mem->duplicate_string(graph_name.get<std::string>())
 				: nullptr;
-			
-			if (data["accuracyGraphKnots"][i].is_array())
-			{
-				const auto count = data["accuracyGraphKnots"][i].size();
-				def->accuracyGraphKnots[i] = mem->allocate<vec2_t>(count);
-				def->accuracyGraphKnotCount[i] = static_cast<short>(count);
 
-				for (auto o = 0; o < count; o++)
-				{
-					def->accuracyGraphKnots[i][o][0] = data["accuracyGraphKnots"][i][o][0].get<float>();
-					def->accuracyGraphKnots[i][o][1] = data["accuracyGraphKnots"][i][o][1].get<float>();
-				}
-			}
-			
-			if (data["originalAccuracyGraphKnots"][i].is_array())
-			{
-				const auto count = data["originalAccuracyGraphKnots"][i].size();
-				def->originalAccuracyGraphKnots[i] = mem->allocate<vec2_t>(count);
-				def->accuracyGraphKnotCount[i] = static_cast<short>(count);
-
-				for (auto o = 0; o < count; o++)
-				{
-					def->originalAccuracyGraphKnots[i][o][0] = data["originalAccuracyGraphKnots"][i][o][0].get<float>();
-					def->originalAccuracyGraphKnots[i][o][1] = data["originalAccuracyGraphKnots"][i][o][1].get<float>();
-				}
-			}
+			// both knot sets share one count
+			parse_accuracy_graph_knots(def->accuracyGraphKnots[i], def->accuracyGraphKnotCount[i],
+				json_fields::get(knots, i), mem);
+			parse_accuracy_graph_knots(def->originalAccuracyGraphKnots[i], def->accuracyGraphKnotCount[i],
+				json_fields::get(original_knots, i), mem);
 		}
 	}
 	
-	void parse_statetimers(StateTimers* weapon, json& data)
+	void parse_statetimers(StateTimers* weapon, const json& data, zone_memory* mem)
 	{
-		WEAPON_READ_FIELD(int, fireDelay);
-		WEAPON_READ_FIELD(int, meleeDelay);
-		WEAPON_READ_FIELD(int, meleeChargeDelay);
-		WEAPON_READ_FIELD(int, detonateDelay);
-		WEAPON_READ_FIELD(int, fireTime);
-		WEAPON_READ_FIELD(int, rechamberTime);
-		WEAPON_READ_FIELD(int, rechamberTimeOneHanded);
-		WEAPON_READ_FIELD(int, rechamberBoltTime);
-		WEAPON_READ_FIELD(int, holdFireTime);
-		WEAPON_READ_FIELD(int, grenadePrimeReadyToThrowTime);
-		WEAPON_READ_FIELD(int, detonateTime);
-		WEAPON_READ_FIELD(int, meleeTime);
-		WEAPON_READ_FIELD(int, meleeChargeTime);
-		WEAPON_READ_FIELD(int, reloadTime);
-		WEAPON_READ_FIELD(int, reloadShowRocketTime);
-		WEAPON_READ_FIELD(int, reloadEmptyTime);
-		WEAPON_READ_FIELD(int, reloadAddTime);
-		WEAPON_READ_FIELD(int, reloadEmptyAddTime);
-		WEAPON_READ_FIELD(int, reloadStartTime);
-		WEAPON_READ_FIELD(int, reloadStartAddTime);
-		WEAPON_READ_FIELD(int, reloadEndTime);
-		WEAPON_READ_FIELD(int, reloadTimeDualWield);
-		WEAPON_READ_FIELD(int, reloadAddTimeDualWield);
-		WEAPON_READ_FIELD(int, reloadEmptyDualMag);
-		WEAPON_READ_FIELD(int, reloadEmptyAddTimeDualMag);
-		//WEAPON_READ_FIELD(int, u25);
-		//WEAPON_READ_FIELD(int, u26);
-		WEAPON_READ_FIELD(int, dropTime);
-		WEAPON_READ_FIELD(int, raiseTime);
-		WEAPON_READ_FIELD(int, altDropTime);
-		WEAPON_READ_FIELD(int, altRaiseTime);
-		WEAPON_READ_FIELD(int, quickDropTime);
-		WEAPON_READ_FIELD(int, quickRaiseTime);
-		WEAPON_READ_FIELD(int, firstRaiseTime);
-		WEAPON_READ_FIELD(int, breachRaiseTime);
-		WEAPON_READ_FIELD(int, emptyRaiseTime);
-		WEAPON_READ_FIELD(int, emptyDropTime);
-		WEAPON_READ_FIELD(int, sprintInTime);
-		WEAPON_READ_FIELD(int, sprintLoopTime);
-		WEAPON_READ_FIELD(int, sprintOutTime);
-		WEAPON_READ_FIELD(int, stunnedTimeBegin);
-		WEAPON_READ_FIELD(int, stunnedTimeLoop);
-		WEAPON_READ_FIELD(int, stunnedTimeEnd);
-		WEAPON_READ_FIELD(int, nightVisionWearTime);
-		WEAPON_READ_FIELD(int, nightVisionWearTimeFadeOutEnd);
-		WEAPON_READ_FIELD(int, nightVisionWearTimePowerUp);
-		WEAPON_READ_FIELD(int, nightVisionRemoveTime);
-		WEAPON_READ_FIELD(int, nightVisionRemoveTimePowerDown);
-		WEAPON_READ_FIELD(int, nightVisionRemoveTimeFadeInStart);
-		WEAPON_READ_FIELD(int, aiFuseTime);
-		WEAPON_READ_FIELD(int, fuseTime);
-		WEAPON_READ_FIELD(int, missileTime);
-		WEAPON_READ_FIELD(int, primeTime);
-		WEAPON_READ_FIELD(bool, bHoldFullPrime);
-		WEAPON_READ_FIELD(int, blastFrontTime);
-		WEAPON_READ_FIELD(int, blastRightTime);
-		WEAPON_READ_FIELD(int, blastBackTime);
-		WEAPON_READ_FIELD(int, blastLeftTime);
-		//WEAPON_READ_FIELD(int, u58);
-		//WEAPON_READ_FIELD(int, u59);
-		//WEAPON_READ_FIELD(int, u60);
-		//WEAPON_READ_FIELD(int, u61);
-		//WEAPON_READ_FIELD(int, u62);
-		//WEAPON_READ_FIELD(int, u63);
-		//WEAPON_READ_FIELD(int, u64);
-		//WEAPON_READ_FIELD(int, u65);
-		//WEAPON_READ_FIELD(int, u66);
-		//WEAPON_READ_FIELD(int, u67);
-		//WEAPON_READ_FIELD(int, u68);
-		WEAPON_READ_FIELD(int, offhandSwitchTime);
-		//WEAPON_READ_FIELD(int, u70);
-		//WEAPON_READ_FIELD(int, u71);
-		//WEAPON_READ_FIELD(int, u72);
-		//WEAPON_READ_FIELD(int, u73);
-		//WEAPON_READ_FIELD(int, u74);
+		state_timer_fields.read(weapon, data, mem);
 	}
 
 	WeaponDef* weapon_def::parse(const std::string& name, zone_memory* mem)
@@ -360,20 +874,17 @@ namespace zonetool::h2
 		auto size = file.size();
 		auto bytes = file.read_bytes(size);
 		file.close();
-		json data = json::parse(bytes);
+		const json data = json::parse(bytes);
 
 		auto* weapon = mem->allocate<WeaponDef>();
 
-		std::vector<std::uint8_t> base_asset_bytes;
-
 		// base asset
-		auto base = data["baseAsset"].get<std::string>();
-
-		char* baseAsset = nullptr;
+		const auto& base_asset = json_fields::get(data, "baseAsset");
+		const auto base = base_asset.is_string() ? base_asset.get<std::string>() : ""s;
 		if (!base.empty())
 		{
-			baseAsset = reinterpret_cast<char*>(db_find_x_asset_header(ASSET_TYPE_WEAPON, base.data(), 1).weapon);
-			if (baseAsset == nullptr)
+			const auto* base_weapon = db_find_x_asset_header(ASSET_TYPE_WEAPON, base.data(), 1).weapon;
+			if (base_weapon == nullptr)
 			{
 				ZONETOOL_FATAL("Could not load base asset \"%s\" into memory...", base.data());
 			}
@@ -383,855 +894,236 @@ namespace zonetool::h2
 				ZONETOOL_WARNING("Using default weapon base asset for weapon \"%s\"", name.data());
 			}
 
-			std::memcpy(weapon, baseAsset, sizeof(WeaponDef));
+			std::memcpy(weapon, base_weapon, sizeof(WeaponDef));
 		}
 		else
 		{
 			ZONETOOL_WARNING("No base asset is defined for weapon \"%s\", stuff might go wrong!", name.data());
 		}
 
-		WEAPON_READ_STRING(szInternalName);
-		WEAPON_READ_STRING(szDisplayName);
-		WEAPON_READ_STRING(szOverlayName);
-		WEAPON_READ_STRING(szAttachmentName);
-		WEAPON_READ_STRING(szUnknownName);
-
-		WEAPON_READ_ASSET_ARR(ASSET_TYPE_XMODEL, model, gunModel, XModel, 2);
-		WEAPON_READ_ASSET_ARR(ASSET_TYPE_XMODEL, model, worldModel, XModel, 2);
+		weapon_fields.read(weapon, data, mem);
+		weapon_sound_fields.read(weapon, json_fields::get(data, "sounds"), mem);
 
-		WEAPON_READ_ASSET_ARR(ASSET_TYPE_XMODEL, model, reticleViewModels, XModel, 64);
-
-		WEAPON_READ_ASSET(ASSET_TYPE_XMODEL, model, handModel);
-		WEAPON_READ_ASSET(ASSET_TYPE_XMODEL, model, unknownModel);
-		WEAPON_READ_ASSET(ASSET_TYPE_XMODEL, model, worldClipModel);
-		WEAPON_READ_ASSET(ASSET_TYPE_XMODEL, model, rocketModel);
-		WEAPON_READ_ASSET(ASSET_TYPE_XMODEL, model, knifeModel);
-		WEAPON_READ_ASSET(ASSET_TYPE_XMODEL, model, worldKnifeModel);
-
-		WEAPON_READ_ANIM_ARR(szXAnimsRightHanded, NUM_WEAP_ANIMS);
-		WEAPON_READ_ANIM_ARR(szXAnimsLeftHanded, NUM_WEAP_ANIMS);
-		WEAPON_READ_ANIM_ARR(szXAnims, NUM_WEAP_ANIMS);
+		parse_anims(weapon->szXAnimsRightHanded, json_fields::get(data, "szXAnimsRightHanded"), mem);
+		parse_anims(weapon->szXAnimsLeftHanded, json_fields::get(data, "szXAnimsLeftHanded"), mem);
+		parse_anims(weapon->szXAnims, json_fields::get(data, "szXAnims"), mem);
 
+		const auto& hide_tags = json_fields::get(data, "hideTags");
 		weapon->hideTags = mem->allocate<scr_string_t>(32);
 		for (auto i = 0; i < 32; i++)
 		{
-			this->add_script_string(&weapon->hideTags[i], mem->duplicate_string(data["hideTags"][i].get<std::string>()));
+			this->add_script_string(&weapon->hideTags[i], mem->duplicate_string(hide_tags.at(i).get<std::string>()));
 		}
 
-		weapon->numWeaponAttachments = static_cast<unsigned char>(data["attachments"].size());
+		const auto& attachments = json_fields::get(data, "attachments");
+		weapon->numWeaponAttachments = static_cast<unsigned char>(attachments.size());
 		if (weapon->numWeaponAttachments)
 		{
 			weapon->attachments = mem->allocate<WeaponAttachment*>(weapon->numWeaponAttachments);
 			for (auto i = 0; i < weapon->numWeaponAttachments; i++)
 			{
-				if (!data["attachments"][i].is_null())
+				if (!attachments[i].is_null())
 				{
 					weapon->attachments[i] = mem->allocate<WeaponAttachment>();
-					weapon->attachments[i]->name = mem->duplicate_string(data["attachments"][i].get<std::string>());
+					weapon->attachments[i]->name = mem->duplicate_string(attachments[i].get<std::string>());
 				}
 			}
 		}
 
-		weapon->numAnimOverrides = static_cast<unsigned char>(data["animOverrides"].size());
+		const auto& anim_overrides = json_fields::get(data, "animOverrides");
+		weapon->numAnimOverrides = static_cast<unsigned char>(anim_overrides.size());
 		if (weapon->numAnimOverrides)
 		{
 			weapon->animOverrides = mem->allocate<AnimOverrideEntry>(weapon->numAnimOverrides);
 			for (auto i = 0u; i < weapon->numAnimOverrides; i++)
 			{
-				auto altmodeAnim = data["animOverrides"][i]["altmodeAnim"].get<std::string>();
-				if (!altmodeAnim.empty())
-				{
-					weapon->animOverrides[i].altmodeAnim = db_find_x_asset_header(ASSET_TYPE_XANIM, altmodeAnim.data(), 1).parts;
-				}
-				auto overrideAnim = data["animOverrides"][i]["overrideAnim"].get<std::string>();
-				if (!overrideAnim.empty())
-				{
-					weapon->animOverrides[i].overrideAnim = db_find_x_asset_header(ASSET_TYPE_XANIM, overrideAnim.data(), 1).parts;
-				}
-				weapon->animOverrides[i].attachment1 = data["animOverrides"][i]["attachment1"].get<unsigned short>();
-				weapon->animOverrides[i].attachment2 = data["animOverrides"][i]["attachment2"].get<unsigned short>();
-				weapon->animOverrides[i].altTime = data["animOverrides"][i]["altTime"].get<int>();
-				weapon->animOverrides[i].animTime = data["animOverrides"][i]["animTime"].get<int>();
-				//weapon->animOverrides[i].animTreeType = data["animOverrides"][i]["animTreeType"].get<unsigned int>();
+				const auto& entry = anim_overrides[i];
+				weapon->animOverrides[i].altmodeAnim = parse_asset_header<XAnimParts>(ASSET_TYPE_XANIM, json_fields::get(entry, "altmodeAnim"));
+				weapon->animOverrides[i].overrideAnim = parse_asset_header<XAnimParts>(ASSET_TYPE_XANIM, json_fields::get(entry, "overrideAnim"));
+				weapon->animOverrides[i].attachment1 = entry.value("attachment1", static_cast<unsigned short>(0));
+				weapon->animOverrides[i].attachment2 = entry.value("attachment2", static_cast<unsigned short>(0));
+				weapon->animOverrides[i].altTime = entry.value("altTime", 0);
+				weapon->animOverrides[i].animTime = entry.value("animTime", 0);
+				//weapon->animOverrides[i].animTreeType = entry.value("animTreeType", 0u);
 			}
 		}
 
-		weapon->numSoundOverrides = static_cast<unsigned char>(data["soundOverrides"].size());
+		const auto& sound_overrides = json_fields::get(data, "soundOverrides");
+		weapon->numSoundOverrides = static_cast<unsigned char>(sound_overrides.size());
 		if (weapon->numSoundOverrides)
 		{
 			weapon->soundOverrides = mem->allocate<SoundOverrideEntry>(weapon->numSoundOverrides);
 			for (auto i = 0u; i < weapon->numSoundOverrides; i++)
 			{
-				auto altmodeSound = data["soundOverrides"][i]["altmodeSound"].get<std::string>();
-				if (!altmodeSound.empty())
-				{
-					weapon->soundOverrides[i].altmodeSound = db_find_x_asset_header(ASSET_TYPE_SOUND, altmodeSound.data(), 1).sound;
-				}
-				auto overrideSound = data["soundOverrides"][i]["overrideSound"].get<std::string>();
-				if (!overrideSound.empty())
-				{
-					weapon->soundOverrides[i].overrideSound = db_find_x_asset_header(ASSET_TYPE_SOUND, overrideSound.data(), 1).sound;
-				}
-				weapon->soundOverrides[i].attachment1 = data["soundOverrides"][i]["attachment1"].get<unsigned short>();
-				weapon->soundOverrides[i].attachment2 = data["soundOverrides"][i]["attachment2"].get<unsigned short>();
-				//weapon->soundOverrides[i].soundType = data["soundOverrides"][i]["soundType"].get<unsigned int>();
+				const auto& entry = sound_overrides[i];
+				weapon->soundOverrides[i].altmodeSound = parse_asset_header<snd_alias_list_t>(ASSET_TYPE_SOUND, json_fields::get(entry, "altmodeSound"));
+				weapon->soundOverrides[i].overrideSound = parse_asset_header<snd_alias_list_t>(ASSET_TYPE_SOUND, json_fields::get(entry, "overrideSound"));
+				weapon->soundOverrides[i].attachment1 = entry.value("attachment1", static_cast<unsigned short>(0));
+				weapon->soundOverrides[i].attachment2 = entry.value("attachment2", static_cast<unsigned short>(0));
+				//weapon->soundOverrides[i].soundType = entry.value("soundType", 0u);
 			}
 		}
 
-		weapon->numFXOverrides = static_cast<unsigned char>(data["fxOverrides"].size());
+		const auto& fx_overrides = json_fields::get(data, "fxOverrides");
+		weapon->numFXOverrides = static_cast<unsigned char>(fx_overrides.size());
 		if (weapon->numFXOverrides)
 		{
 			weapon->fxOverrides = mem->allocate<FXOverrideEntry>(weapon->numFXOverrides);
 			for (auto i = 0u; i < weapon->numFXOverrides; i++)
 			{
-				auto altmodeFX = data["fxOverrides"][i]["altmodeFX"].get<std::string>();
-				if (!altmodeFX.empty())
-				{
-					weapon->fxOverrides[i].altmodeFX = db_find_x_asset_header(ASSET_TYPE_FX, altmodeFX.data(), 1).fx;
-				}
-				auto overrideFX = data["fxOverrides"][i]["overrideFX"].get<std::string>();
-				if (!overrideFX.empty())
-				{
-					weapon->fxOverrides[i].overrideFX = db_find_x_asset_header(ASSET_TYPE_SOUND, overrideFX.data(), 1).fx;
-				}
-				weapon->fxOverrides[i].attachment1 = data["fxOverrides"][i]["attachment1"].get<unsigned short>();
-				weapon->fxOverrides[i].attachment2 = data["fxOverrides"][i]["attachment2"].get<unsigned short>();
-				//weapon->fxOverrides[i].fxType = data["fxOverrides"][i]["fxType"].get<unsigned int>();
+				const auto& entry = fx_overrides[i];
+				weapon->fxOverrides[i].altmodeFX = parse_asset_header<FxEffectDef>(ASSET_TYPE_FX, json_fields::get(entry, "altmodeFX"));
+				weapon->fxOverrides[i].overrideFX = parse_asset_header<FxEffectDef>(ASSET_TYPE_SOUND, json_fields::get(entry, "overrideFX"));
+				weapon->fxOverrides[i].attachment1 = entry.value("attachment1", static_cast<unsigned short>(0));
+				weapon->fxOverrides[i].attachment2 = entry.value("attachment2", static_cast<unsigned short>(0));
+				//weapon->fxOverrides[i].fxType = entry.value("fxType", 0u);
 			}
 		}
 
-		weapon->numReloadStateTimerOverrides = static_cast<unsigned char>(data["reloadOverrides"].size());
+		const auto& reload_overrides = json_fields::get(data, "reloadOverrides");
+		weapon->numReloadStateTimerOverrides = static_cast<unsigned char>(reload_overrides.size());
 		if (weapon->numReloadStateTimerOverrides)
 		{
 			weapon->reloadOverrides = mem->allocate<ReloadStateTimerEntry>(weapon->numReloadStateTimerOverrides);
 			for (auto i = 0u; i < weapon->numReloadStateTimerOverrides; i++)
 			{
-				weapon->reloadOverrides[i].attachment = data["reloadOverrides"][i]["attachment"].get<int>();
-				weapon->reloadOverrides[i].reloadAddTime = data["reloadOverrides"][i]["reloadAddTime"].get<int>();
-				weapon->reloadOverrides[i].reloadEmptyAddTime = data["reloadOverrides"][i]["reloadEmptyAddTime"].get<int>();
-				weapon->reloadOverrides[i].reloadStartAddTime = data["reloadOverrides"][i]["reloadStartAddTime"].get<int>();
+				const auto& entry = reload_overrides[i];
+				weapon->reloadOverrides[i].attachment = entry.value("attachment", 0);
+				weapon->reloadOverrides[i].reloadAddTime = entry.value("reloadAddTime", 0);
+				weapon->reloadOverrides[i].reloadEmptyAddTime = entry.value("reloadEmptyAddTime", 0);
+				weapon->reloadOverrides[i].reloadStartAddTime = entry.value("reloadStartAddTime", 0);
 			}
 		}
 
-		weapon->numNotetrackOverrides = static_cast<unsigned char>(data["notetrackOverrides"].size());
+		const auto& notetrack_overrides = json_fields::get(data, "notetrackOverrides");
+		weapon->numNotetrackOverrides = static_cast<unsigned char>(notetrack_overrides.size());
 		if (weapon->numNotetrackOverrides)
 		{
 			weapon->notetrackOverrides = mem->allocate<NoteTrackToSoundEntry>(weapon->numNotetrackOverrides);
 			for (auto i = 0u; i < weapon->numNotetrackOverrides; i++)
 			{
-				weapon->notetrackOverrides[i].attachment = data["notetrackOverrides"][i]["attachment"].get<int>();
+				const auto& entry = notetrack_overrides[i];
+				const auto& keys = json_fields::get(entry, "notetrackSoundMapKeys");
+				const auto& values = json_fields::get(entry, "notetrackSoundMapValues");
+
+				weapon->notetrackOverrides[i].attachment = entry.value("attachment", 0);
+				weapon->notetrackOverrides[i].notetrackSoundMapKeys = mem->allocate<scr_string_t>(36);
+				weapon->notetrackOverrides[i].notetrackSoundMapValues = mem->allocate<scr_string_t>(36);
 				for (auto j = 0u; j < 36; j++)
 				{
-					auto notetrackSoundMapKey = data["notetrackOverrides"][i]["notetrackSoundMapKeys"][j].get<std::string>();
-					if (!notetrackSoundMapKey.empty())
+					const auto key = keys.at(j).get<std::string>();
+					if (!key.empty())
 					{
-						this->add_script_string(&weapon->notetrackOverrides[i].notetrackSoundMapKeys[j], mem->duplicate_string(notetrackSoundMapKey));
+						this->add_script_string(&weapon->notetrackOverrides[i].notetrackSoundMapKeys[j], mem->duplicate_string(key));
 					}
-					auto notetrackSoundMapValue = data["notetrackOverrides"][i]["notetrackSoundMapValues"][j].get<std::string>();
-					if (!notetrackSoundMapValue.empty())
+
+					const auto value = values.at(j).get<std::string>();
+					if (!value.empty())
 					{
-						this->add_script_string(&weapon->notetrackOverrides[i].notetrackSoundMapValues[j], mem->duplicate_string(notetrackSoundMapValue));
+						this->add_script_string(&weapon->notetrackOverrides[i].notetrackSoundMapValues[j], mem->duplicate_string(value));
 					}
 				}
 			}
 		}
 
+		const auto& sound_map_keys = json_fields::get(data, "notetrackSoundMapKeys");
+		const auto& sound_map_values = json_fields::get(data, "notetrackSoundMapValues");
 		weapon->notetrackSoundMapKeys = mem->allocate<scr_string_t>(36);
 		weapon->notetrackSoundMapValues = mem->allocate<scr_string_t>(36);
 		for (auto i = 0; i < 36; i++)
 		{
-			auto notetrack = data["notetrackSoundMapKeys"][i].get<std::string>();
-			this->add_script_string(&weapon->notetrackSoundMapKeys[i], mem->duplicate_string(notetrack));
-		}
-		for (auto i = 0; i < 36; i++)
-		{
-			auto notetrack = data["notetrackSoundMapValues"][i].get<std::string>();
-			this->add_script_string(&weapon->notetrackSoundMapValues[i], mem->duplicate_string(notetrack));
+			this->add_script_string(&weapon->notetrackSoundMapKeys[i], 
+				mem->duplicate_string(sound_map_keys.at(i).get<std::string>()));
+
+			this->add_script_string(&weapon->notetrackSoundMapValues[i],
+				mem->duplicate_string(sound_map_values.at(i).get<std::string>()));
 		}
 
+		const auto& rumble_map_keys = json_fields::get(data, "notetrackRumbleMapKeys");
+		const auto& rumble_map_values = json_fields::get(data, "notetrackRumbleMapValues");
 		weapon->notetrackRumbleMapKeys = mem->allocate<scr_string_t>(16);
 		weapon->notetrackRumbleMapValues = mem->allocate<scr_string_t>(16);
 		for (auto i = 0; i < 16; i++)
 		{
-			auto notetrack = data["notetrackRumbleMapKeys"][i].get<std::string>();
-			this->add_script_string(&weapon->notetrackRumbleMapKeys[i], mem->duplicate_string(notetrack));
-		}
-		for (auto i = 0; i < 16; i++)
-		{
-			auto notetrack = data["notetrackRumbleMapValues"][i].get<std::string>();
-			this->add_script_string(&weapon->notetrackRumbleMapValues[i], mem->duplicate_string(notetrack));
+			this->add_script_string(&weapon->notetrackRumbleMapKeys[i], 
+				mem->duplicate_string(rumble_map_keys.at(i).get<std::string>()));
+
+			this->add_script_string(&weapon->notetrackRumbleMapValues[i],
+				mem->duplicate_string(rumble_map_values.at(i).get<std::string>()));
 		}
 
+		const auto& fx_map_keys = json_fields::get(data, "notetrackFXMapKeys");
+		const auto& fx_map_tags = json_fields::get(data, "notetrackFXMapTagValues");
+		const auto& fx_map_values = json_fields::get(data, "notetrackFXMapValues");
 		weapon->notetrackFXMapKeys = mem->allocate<scr_string_t>(16);
 		weapon->notetrackFXMapTagValues = mem->allocate<scr_string_t>(16);
-		for (auto i = 0; i < 16; i++)
-		{
-			auto notetrack = data["notetrackFXMapKeys"][i].get<std::string>();
-			this->add_script_string(&weapon->notetrackFXMapKeys[i], mem->duplicate_string(notetrack));
-		}
-		for (auto i = 0; i < 16; i++)
-		{
-			auto notetrack = data["notetrackFXMapTagValues"][i].get<std::string>();
-			this->add_script_string(&weapon->notetrackFXMapTagValues[i], mem->duplicate_string(notetrack));
-		}
-
 		weapon->notetrackFXMapValues = mem->allocate<FxEffectDef*>(16);
 		for (auto i = 0; i < 16; i++)
 		{
-			auto notetrack = data["notetrackFXMapValues"][i].get<std::string>();
-			weapon->notetrackFXMapValues[i] = db_find_x_asset_header(ASSET_TYPE_FX, notetrack.data(), 1).fx;
+			this->add_script_string(&weapon->notetrackFXMapKeys[i], 
+				mem->duplicate_string(fx_map_keys.at(i).get<std::string>()));
+
+			this->add_script_string(&weapon->notetrackFXMapTagValues[i], 
+				mem->duplicate_string(fx_map_tags.at(i).get<std::string>()));
+
+			weapon->notetrackFXMapValues[i] = parse_asset_header<FxEffectDef>(ASSET_TYPE_FX, fx_map_values.at(i));
 		}
 
+		const auto& unknown_keys = json_fields::get(data, "notetrackUnknownKeys");
+		const auto& unknown_values = json_fields::get(data, "notetrackUnknownValues");
 		weapon->notetrackUnknownKeys = mem->allocate<scr_string_t>(16);
 		weapon->notetrackUnknownValues = mem->allocate<scr_string_t>(16);
-
-		if (!data["notetrackUnknownKeys"].is_null())
+		if (!unknown_keys.is_null())
 		{
 			for (auto i = 0; i < 16; i++)
 			{
-				auto notetrack = data["notetrackUnknownKeys"][i].get<std::string>();
-				this->add_script_string(&weapon->notetrackUnknownKeys[i], mem->duplicate_string(notetrack));
+				this->add_script_string(&weapon->notetrackUnknownKeys[i], mem->duplicate_string(unknown_keys.at(i).get<std::string>()));
 			}
 		}
 
-		if (!data["notetrackUnknownValues"].is_null())
+		if (!unknown_values.is_null())
 		{
 			for (auto i = 0; i < 16; i++)
 			{
-				auto notetrack = data["notetrackUnknownValues"][i].get<std::string>();
-				this->add_script_string(&weapon->notetrackUnknownValues[i], mem->duplicate_string(notetrack));
+				this->add_script_string(&weapon->notetrackUnknownValues[i], mem->duplicate_string(unknown_values.at(i).get<std::string>()));
 			}
 		}
 
-		if (!data["notetrackUnknown"].is_null())
+		if (const auto& unknown = json_fields::get(data, "notetrackUnknown"); !unknown.is_null())
 		{
 			weapon->notetrackUnknown = mem->allocate<char>(16);
 			for (auto i = 0; i < 16; i++)
 			{
-				auto value = data["notetrackUnknown"][i].get<char>();
-				weapon->notetrackUnknown[i] = value;
-			}
-		}
-
-		WEAPON_READ_STRING(szModeName);
-		WEAPON_READ_STRING(szAltWeaponName);
-		WEAPON_READ_STRING(szAmmoName);
-		WEAPON_READ_STRING(szClipName);
-		WEAPON_READ_STRING(szSharedAmmoCapName);
-
-		WEAPON_READ_ASSET(ASSET_TYPE_FX, fx, viewFlashEffect);
-		WEAPON_READ_ASSET(ASSET_TYPE_FX, fx, viewBodyFlashEffect);
-		WEAPON_READ_ASSET(ASSET_TYPE_FX, fx, worldFlashEffect);
-		WEAPON_READ_ASSET(ASSET_TYPE_FX, fx, viewFlashADSEffect);
-		WEAPON_READ_ASSET(ASSET_TYPE_FX, fx, viewBodyFlashADSEffect);
-		WEAPON_READ_ASSET(ASSET_TYPE_FX, fx, effect06);
-		WEAPON_READ_ASSET(ASSET_TYPE_FX, fx, effect07);
-		WEAPON_READ_ASSET(ASSET_TYPE_FX, fx, effect08);
-		WEAPON_READ_ASSET(ASSET_TYPE_FX, fx, effect09);
-		WEAPON_READ_ASSET(ASSET_TYPE_FX, fx, effect10);
-		WEAPON_READ_ASSET(ASSET_TYPE_FX, fx, effect11);
-		WEAPON_READ_ASSET(ASSET_TYPE_FX, fx, effect12);
-
-		WEAPON_READ_SOUND(pickupSound);
-		WEAPON_READ_SOUND(pickupSoundPlayer);
-		WEAPON_READ_SOUND(ammoPickupSound);
-		WEAPON_READ_SOUND(ammoPickupSoundPlayer);
-		WEAPON_READ_SOUND(projectileSound);
-		WEAPON_READ_SOUND(pullbackSound);
-		WEAPON_READ_SOUND(pullbackSoundPlayer);
-		WEAPON_READ_SOUND(pullbackSoundQuick);
-		WEAPON_READ_SOUND(pullbackSoundQuickPlayer);
-		WEAPON_READ_SOUND(fireSound);
-		WEAPON_READ_SOUND(fireSoundPlayer);
-		WEAPON_READ_SOUND(fireSoundPlayerLeft);
-		WEAPON_READ_SOUND(fireSoundPlayerRight);
-		WEAPON_READ_SOUND(sound14);
-		WEAPON_READ_SOUND(sound15);
-		WEAPON_READ_SOUND(sound16);
-		WEAPON_READ_SOUND(sound17);
-		WEAPON_READ_SOUND(sound18);
-		WEAPON_READ_SOUND(fireLoopSound);
-		WEAPON_READ_SOUND(fireLoopSoundPlayer);
-		WEAPON_READ_SOUND(sound21);
-		WEAPON_READ_SOUND(sound22);
-		WEAPON_READ_SOUND(sound23);
-		WEAPON_READ_SOUND(sound24);
-		WEAPON_READ_SOUND(sound25);
-		WEAPON_READ_SOUND(sound26);
-		WEAPON_READ_SOUND(fireStopSound);
-		WEAPON_READ_SOUND(fireStopSoundPlayer);
-		WEAPON_READ_SOUND(sound29);
-		WEAPON_READ_SOUND(sound30);
-		WEAPON_READ_SOUND(sound31);
-		WEAPON_READ_SOUND(sound32);
-		WEAPON_READ_SOUND(sound33);
-		WEAPON_READ_SOUND(fireFirstSound);
-		WEAPON_READ_SOUND(fireFirstSoundPlayer);
-		WEAPON_READ_SOUND(fireSound2);
-		WEAPON_READ_SOUND(fireSoundPlayer2);
-		WEAPON_READ_SOUND(fireSpecialSound);
-		WEAPON_READ_SOUND(fireSpecialSoundPlayer);
-		WEAPON_READ_SOUND(emptyFireSound);
-		WEAPON_READ_SOUND(emptyFireSoundPlayer);
-		WEAPON_READ_SOUND(emptyFireSoundPlayerLeft);
-		WEAPON_READ_SOUND(emptyFireSoundPlayerRight);
-		WEAPON_READ_SOUND(emptyFireSoundReleasePlayer);
-		WEAPON_READ_SOUND(emptyFireSoundReleasePlayerLeft);
-		WEAPON_READ_SOUND(emptyFireSoundReleasePlayerRight);
-		WEAPON_READ_SOUND(sound47);
-		WEAPON_READ_SOUND(meleeSwipeSound);
-		WEAPON_READ_SOUND(meleeSwipeSoundPlayer);
-		WEAPON_READ_SOUND(meleeHitSound);
-		WEAPON_READ_SOUND(meleeHitSoundPlayer);
-		WEAPON_READ_SOUND(meleeMissSound);
-		WEAPON_READ_SOUND(meleeMissSoundPlayer);
-		WEAPON_READ_SOUND(sound54);
-		WEAPON_READ_SOUND(sound55);
-		WEAPON_READ_SOUND(sound56);
-		WEAPON_READ_SOUND(sound57);
-		WEAPON_READ_SOUND(sound58);
-		WEAPON_READ_SOUND(sound59);
-		WEAPON_READ_SOUND(sound60);
-		WEAPON_READ_SOUND(sound61);
-		WEAPON_READ_SOUND(sound62);
-		WEAPON_READ_SOUND(sound63);
-		WEAPON_READ_SOUND(sound64);
-		WEAPON_READ_SOUND(sound65);
-		WEAPON_READ_SOUND(nightVisionWearSound);
-		WEAPON_READ_SOUND(nightVisionWearSoundPlayer);
-		WEAPON_READ_SOUND(nightVisionRemoveSound);
-		WEAPON_READ_SOUND(nightVisionRemoveSoundPlayer);
-		WEAPON_READ_SOUND(raiseSound);
-		WEAPON_READ_SOUND(raiseSoundPlayer);
-		WEAPON_READ_SOUND(raiseSoundPlayerLeft);
-		WEAPON_READ_SOUND(raiseSoundPlayerRight);
-		WEAPON_READ_SOUND(sound74);
-		WEAPON_READ_SOUND(quickRaiseSoundPlayer);
-		WEAPON_READ_SOUND(quickRaiseSoundPlayerLeft);
-		WEAPON_READ_SOUND(quickRaiseSoundPlayerRight);
-		WEAPON_READ_SOUND(raiseSound2);
-		WEAPON_READ_SOUND(sound79);
-		WEAPON_READ_SOUND(sound80);
-		WEAPON_READ_SOUND(sound81);
-		WEAPON_READ_SOUND(putawaySound);
-		WEAPON_READ_SOUND(putawaySoundPlayer);
-		WEAPON_READ_SOUND(putawaySoundPlayerLeft);
-		WEAPON_READ_SOUND(putawaySoundPlayerRight);
-		WEAPON_READ_SOUND(sound86);
-		WEAPON_READ_SOUND(sound87);
-		WEAPON_READ_SOUND(adsEnterSoundPlayer);
-		WEAPON_READ_SOUND(adsLeaveSoundPlayer);
-		WEAPON_READ_SOUND(adsCrosshairEnemySound);
-
-		WEAPON_READ_ASSET_ARR(ASSET_TYPE_SOUND, sound, bounceSound, snd_alias_list_t, 53);
-		WEAPON_READ_ASSET_ARR(ASSET_TYPE_SOUND, sound, rollingSound, snd_alias_list_t, 53);
-
-		WEAPON_READ_ASSET(ASSET_TYPE_FX, fx, viewShellEjectEffect);
-		WEAPON_READ_ASSET(ASSET_TYPE_FX, fx, worldShellEjectEffect);
-		WEAPON_READ_ASSET(ASSET_TYPE_FX, fx, viewLastShotEjectEffect);
-		WEAPON_READ_ASSET(ASSET_TYPE_FX, fx, worldLastShotEjectEffect);
-		WEAPON_READ_ASSET(ASSET_TYPE_FX, fx, viewMagEjectEffect);
-
-		WEAPON_READ_ASSET(ASSET_TYPE_MATERIAL, material, reticleCenter);
-		WEAPON_READ_ASSET(ASSET_TYPE_MATERIAL, material, reticleSide);
-
-		WEAPON_READ_ASSET(ASSET_TYPE_MATERIAL, material, hudIcon);
-		WEAPON_READ_ASSET(ASSET_TYPE_MATERIAL, material, pickupIcon);
-		WEAPON_READ_ASSET(ASSET_TYPE_MATERIAL, material, unknownIcon2);
-		WEAPON_READ_ASSET(ASSET_TYPE_MATERIAL, material, unknownIcon3);
-		WEAPON_READ_ASSET(ASSET_TYPE_MATERIAL, material, unknownIcon4);
-		WEAPON_READ_ASSET(ASSET_TYPE_MATERIAL, material, ammoCounterIcon);
-
-		WEAPON_READ_ASSET(ASSET_TYPE_PHYSCOLLMAP, physCollmap, physCollmap);
-		WEAPON_READ_ASSET(ASSET_TYPE_PHYSPRESET, physPreset, physPreset);
-
-		WEAPON_READ_STRING(szUseHintString);
-		WEAPON_READ_STRING(dropHintString);
-
-		WEAPON_READ_FIELD_ARR(float, locationDamageMultipliers, 22);
-
-		WEAPON_READ_STRING(fireRumble);
-		WEAPON_READ_STRING(fireMedRumble);
-		WEAPON_READ_STRING(fireHighRumble);
-		WEAPON_READ_STRING(meleeImpactRumble);
-
-		WEAPON_READ_ASSET(ASSET_TYPE_TRACER, tracerDef, tracer1);
-		WEAPON_READ_ASSET(ASSET_TYPE_TRACER, tracerDef, tracer2);
-
-		WEAPON_READ_ASSET(ASSET_TYPE_LASER, laser, laser);
-
-		WEAPON_READ_ASSET(ASSET_TYPE_SOUND, sound, turretOverheatSound);
-		WEAPON_READ_ASSET(ASSET_TYPE_FX, fx, turretOverheatEffect);
-		WEAPON_READ_STRING(turretBarrelSpinRumble);
-		WEAPON_READ_ASSET(ASSET_TYPE_SOUND, sound, turretBarrelSpinMaxSnd);
-		for (auto i = 0; i < 4; i++)
-		{
-			auto sound = data["turretBarrelSpinUpSnd"][i].get<std::string>();
-			if (!sound.empty())
-			{
-				weapon->turretBarrelSpinUpSnd[i] = db_find_x_asset_header(ASSET_TYPE_SOUND, sound.data(), 1).sound;
+				weapon->notetrackUnknown[i] = unknown.at(i).get<char>();
 			}
 		}
+
+		const auto& spin_up_sounds = json_fields::get(data, "turretBarrelSpinUpSnd");
+		const auto& spin_down_sounds = json_fields::get(data, "turretBarrelSpinDownSnd");
 		for (auto i = 0; i < 4; i++)
 		{
-			auto sound = data["turretBarrelSpinDownSnd"][i].get<std::string>();
-			if (!sound.empty())
-			{
-				weapon->turretBarrelSpinDownSnd[i] = db_find_x_asset_header(ASSET_TYPE_SOUND, sound.data(), 1).sound;
-			}
+			weapon->turretBarrelSpinUpSnd[i] = parse_asset_header<snd_alias_list_t>(ASSET_TYPE_SOUND, json_fields::get(spin_up_sounds, i));
+			weapon->turretBarrelSpinDownSnd[i] = parse_asset_header<snd_alias_list_t>(ASSET_TYPE_SOUND, json_fields::get(spin_down_sounds, i));
 		}
-		WEAPON_READ_ASSET(ASSET_TYPE_SOUND, sound, missileConeSoundAlias);
-		WEAPON_READ_ASSET(ASSET_TYPE_SOUND, sound, missileConeSoundAliasAtBase);
-
-		WEAPON_READ_ASSET(ASSET_TYPE_XMODEL, model, stowOffsetModel);
-
-		WEAPON_READ_ASSET(ASSET_TYPE_MATERIAL, material, killIcon);
-		WEAPON_READ_ASSET(ASSET_TYPE_MATERIAL, material, dpadIcon);
-		WEAPON_READ_ASSET(ASSET_TYPE_MATERIAL, material, hudProximityWarningIcon);
 
-		WEAPON_READ_STRING(projectileName);
-		WEAPON_READ_ASSET(ASSET_TYPE_XMODEL, model, projectileModel);
-		WEAPON_READ_ASSET(ASSET_TYPE_FX, fx, projExplosionEffect);
-		WEAPON_READ_ASSET(ASSET_TYPE_FX, fx, projDudEffect);
-		WEAPON_READ_ASSET(ASSET_TYPE_SOUND, sound, projExplosionSound);
-		WEAPON_READ_ASSET(ASSET_TYPE_SOUND, sound, projDudSound);
-		WEAPON_READ_ASSET(ASSET_TYPE_FX, fx, projTrailEffect);
-		WEAPON_READ_ASSET(ASSET_TYPE_FX, fx, projBeaconEffect);
-		WEAPON_READ_ASSET(ASSET_TYPE_FX, fx, projIgnitionEffect);
-		WEAPON_READ_ASSET(ASSET_TYPE_SOUND, sound, projIgnitionSound);
-
-		WEAPON_READ_STRING(szScript);
-
-		if (!data["turretHydraulicSettings"].is_null())
+		if (const auto& hydraulic_settings = json_fields::get(data, "turretHydraulicSettings"); !hydraulic_settings.is_null())
 		{
 			weapon->turretHydraulicSettings = mem->allocate<TurretHydraulicSettings>();
-			parse_turret_hydraulic_settings(weapon->turretHydraulicSettings, data["turretHydraulicSettings"], mem);
+			parse_turret_hydraulic_settings(weapon->turretHydraulicSettings, hydraulic_settings, mem);
 		}
 
-		parse_statetimers(&weapon->stateTimers, data["stateTimers"]);
-		parse_statetimers(&weapon->akimboStateTimers, data["stateTimersAkimbo"]);
+		parse_statetimers(&weapon->stateTimers, json_fields::get(data, "stateTimers"), mem);
+		parse_statetimers(&weapon->akimboStateTimers, json_fields::get(data, "stateTimersAkimbo"), mem);
 
-		parse_overlay(&weapon->overlay, data["overlay"]);
+		parse_overlay(&weapon->overlay, json_fields::get(data, "overlay"), mem);
 
-		parse_accuracy_graph(weapon, data["accuracy_graph"], mem);
+		parse_accuracy_graph(weapon, json_fields::get(data, "accuracy_graph"), mem);
 
 		// parse stowtag
-		if (!data["stowTag"].is_null())
-		{
-			auto stowTag = data["stowTag"].get<std::string>();
-			this->add_script_string(&weapon->stowTag, mem->duplicate_string(stowTag));
-		}
-
-		WEAPON_READ_FIELD(int, altWeapon);
-		WEAPON_READ_FIELD(playerAnimType_t, playerAnimType);
-		WEAPON_READ_FIELD(weapType_t, weapType);
-		WEAPON_READ_FIELD(weapClass_t, weapClass);
-		WEAPON_READ_FIELD(PenetrateType, penetrateType);
-		WEAPON_READ_FIELD(float, penetrateDepth);
-		WEAPON_READ_FIELD(ImpactType, impactType);
-		WEAPON_READ_FIELD(weapInventoryType_t, inventoryType);
-		WEAPON_READ_FIELD(weapFireType_t, fireType);
-		WEAPON_READ_FIELD(weapFireBarrels_t, fireBarrels);
-		WEAPON_READ_FIELD(weapAdsFireMode_t, adsFireMode);
-		WEAPON_READ_FIELD(float, burstFireCooldown);
-		WEAPON_READ_FIELD(weapGreebleType_t, greebleType);
-		WEAPON_READ_FIELD(weapAutoReloadType_t, autoReloadType);
-		WEAPON_READ_FIELD(WeaponSlotRestriction, slotRestriction);
-		WEAPON_READ_FIELD(OffhandClass, offhandClass);
-		WEAPON_READ_FIELD(weapStance_t, stance);
-		WEAPON_READ_FIELD(int, reticleCenterSize);
-		WEAPON_READ_FIELD(int, reticleSideSize);
-		WEAPON_READ_FIELD(int, reticleMinOfs);
-		WEAPON_READ_FIELD(activeReticleType_t, activeReticleType);
-		WEAPON_READ_FIELD_ARR(float, standMove, 3);
-		WEAPON_READ_FIELD_ARR(float, standRot, 3);
-		WEAPON_READ_FIELD_ARR(float, strafeMove, 3);
-		WEAPON_READ_FIELD_ARR(float, strafeRot, 3);
-		WEAPON_READ_FIELD_ARR(float, duckedOfs, 3);
-		WEAPON_READ_FIELD_ARR(float, duckedMove, 3);
-		WEAPON_READ_FIELD_ARR(float, duckedRot, 3);
-		WEAPON_READ_FIELD_ARR(float, proneOfs, 3);
-		WEAPON_READ_FIELD_ARR(float, proneMove, 3);
-		WEAPON_READ_FIELD_ARR(float, proneRot, 3);
-		WEAPON_READ_FIELD_ARR(float, unkVec1, 3);
-		WEAPON_READ_FIELD_ARR(float, unkVec2, 3);
-		WEAPON_READ_FIELD(float, posMoveRate);
-		WEAPON_READ_FIELD(float, posProneMoveRate);
-		WEAPON_READ_FIELD(float, standMoveMinSpeed);
-		WEAPON_READ_FIELD(float, duckedMoveMinSpeed);
-		WEAPON_READ_FIELD(float, proneMoveMinSpeed);
-		WEAPON_READ_FIELD(float, posRotRate);
-		WEAPON_READ_FIELD(float, posProneRotRate);
-		WEAPON_READ_FIELD(weaponIconRatioType_t, hudIconRatio);
-		WEAPON_READ_FIELD(weaponIconRatioType_t, pickupIconRatio);
-		WEAPON_READ_FIELD(weaponIconRatioType_t, ammoCounterIconRatio);
-		WEAPON_READ_FIELD(int, ammoCounterClip);
-		WEAPON_READ_FIELD(int, startAmmo);
-		WEAPON_READ_FIELD(int, ammoIndex);
-		WEAPON_READ_FIELD(int, clipIndex);
-		WEAPON_READ_FIELD(int, maxAmmo);
-		WEAPON_READ_FIELD(int, minAmmoReq);
-		WEAPON_READ_FIELD(int, clipSize);
-		WEAPON_READ_FIELD(int, shotCount);
-		WEAPON_READ_FIELD(int, sharedAmmoCapIndex);
-		WEAPON_READ_FIELD(int, sharedAmmoCap);
-		WEAPON_READ_FIELD(int, damage);
-		WEAPON_READ_FIELD(int, playerDamage);
-		WEAPON_READ_FIELD(int, meleeDamage);
-		WEAPON_READ_FIELD(int, damageType);
-		WEAPON_READ_FIELD(float, autoAimRange);
-		WEAPON_READ_FIELD(float, aimAssistRange);
-		WEAPON_READ_FIELD(float, aimAssistRangeAds);
-		WEAPON_READ_FIELD(float, aimPadding);
-		WEAPON_READ_FIELD(float, enemyCrosshairRange);
-		WEAPON_READ_FIELD(float, moveSpeedScale);
-		WEAPON_READ_FIELD(float, adsMoveSpeedScale);
-		WEAPON_READ_FIELD(float, sprintDurationScale);
-		WEAPON_READ_FIELD(float, adsZoomFov);
-		WEAPON_READ_FIELD(float, adsZoomInFrac);
-		WEAPON_READ_FIELD(float, adsZoomOutFrac);
-		WEAPON_READ_FIELD(float, adsSceneBlur);
-		//WEAPON_READ_FIELD(float, fU_007);
-		//WEAPON_READ_FIELD(float, xU_008);
-		WEAPON_READ_FIELD(float, adsBobFactor);
-		WEAPON_READ_FIELD(float, adsViewBobMult);
-		WEAPON_READ_FIELD(float, hipSpreadStandMin);
-		WEAPON_READ_FIELD(float, hipSpreadDuckedMin);
-		WEAPON_READ_FIELD(float, hipSpreadProneMin);
-		WEAPON_READ_FIELD(float, hipSpreadStandMax);
-		//WEAPON_READ_FIELD(float, xU_009);
-		//WEAPON_READ_FIELD(float, xU_010);
-		WEAPON_READ_FIELD(float, hipSpreadDuckedMax);
-		WEAPON_READ_FIELD(float, hipSpreadProneMax);
-		WEAPON_READ_FIELD(float, hipSpreadDecayRate);
-		WEAPON_READ_FIELD(float, hipSpreadFireAdd);
-		WEAPON_READ_FIELD(float, hipSpreadTurnAdd);
-		WEAPON_READ_FIELD(float, hipSpreadMoveAdd);
-		WEAPON_READ_FIELD(float, hipSpreadDuckedDecay);
-		WEAPON_READ_FIELD(float, hipSpreadProneDecay);
-		WEAPON_READ_FIELD(float, hipReticleSidePos);
-		WEAPON_READ_FIELD(float, adsIdleAmount);
-		WEAPON_READ_FIELD(float, hipIdleAmount);
-		WEAPON_READ_FIELD(float, adsIdleSpeed);
-		WEAPON_READ_FIELD(float, hipIdleSpeed);
-		WEAPON_READ_FIELD(float, idleCrouchFactor);
-		WEAPON_READ_FIELD(float, idleProneFactor);
-		WEAPON_READ_FIELD(float, gunMaxPitch);
-		WEAPON_READ_FIELD(float, gunMaxYaw);
-		WEAPON_READ_FIELD(float, adsIdleLerpStartTime);
-		WEAPON_READ_FIELD(float, adsIdleLerpTime);
-		WEAPON_READ_FIELD(int, adsTransInTime);
-		//WEAPON_READ_FIELD(int, xU_011);
-		WEAPON_READ_FIELD(int, adsTransOutTime);
-		//WEAPON_READ_FIELD(int, xU_012);
-		WEAPON_READ_FIELD(float, swayMaxAngle);
-		WEAPON_READ_FIELD(float, swayLerpSpeed);
-		WEAPON_READ_FIELD(float, swayPitchScale);
-		WEAPON_READ_FIELD(float, swayYawScale);
-		WEAPON_READ_FIELD(float, swayVertScale);
-		WEAPON_READ_FIELD(float, swayHorizScale);
-		WEAPON_READ_FIELD(float, swayShellShockScale);
-		WEAPON_READ_FIELD(float, adsSwayMaxAngle);
-		WEAPON_READ_FIELD(float, adsSwayLerpSpeed);
-		WEAPON_READ_FIELD(float, adsSwayPitchScale);
-		WEAPON_READ_FIELD(float, adsSwayYawScale);
-		WEAPON_READ_FIELD(float, adsSwayHorizScale);
-		WEAPON_READ_FIELD(float, adsSwayVertScale);
-		WEAPON_READ_FIELD(float, adsViewErrorMin);
-		WEAPON_READ_FIELD(float, adsViewErrorMax);
-		WEAPON_READ_FIELD(float, adsFireAnimFrac);
-		WEAPON_READ_FIELD(float, dualWieldViewModelOffset);
-		WEAPON_READ_FIELD(float, scopeDriftDelay);
-		WEAPON_READ_FIELD(float, scopeDriftLerpInTime);
-		WEAPON_READ_FIELD(float, scopeDriftSteadyTime);
-		WEAPON_READ_FIELD(float, scopeDriftLerpOutTime);
-		WEAPON_READ_FIELD(float, scopeDriftSteadyFactor);
-		WEAPON_READ_FIELD(float, scopeDriftUnsteadyFactor);
-		WEAPON_READ_FIELD(float, bobVerticalFactor);
-		WEAPON_READ_FIELD(float, bobHorizontalFactor);
-		WEAPON_READ_FIELD(float, bobViewVerticalFactor);
-		WEAPON_READ_FIELD(float, bobViewHorizontalFactor);
-		WEAPON_READ_FIELD(float, stationaryZoomFov);
-		WEAPON_READ_FIELD(float, stationaryZoomDelay);
-		WEAPON_READ_FIELD(float, stationaryZoomLerpInTime);
-		WEAPON_READ_FIELD(float, stationaryZoomLerpOutTime);
-		WEAPON_READ_FIELD(float, adsDofStart);
-		WEAPON_READ_FIELD(float, adsDofEnd);
-		//WEAPON_READ_FIELD(float, xU_020);
-		WEAPON_READ_FIELD(weaponIconRatioType_t, killIconRatio);
-		WEAPON_READ_FIELD(weaponIconRatioType_t, dpadIconRatio);
-		WEAPON_READ_FIELD(int, fireAnimLength);
-		WEAPON_READ_FIELD(int, fireAnimLengthAkimbo);
-		WEAPON_READ_FIELD(int, inspectAnimTime);
-		WEAPON_READ_FIELD(int, reloadAmmoAdd);
-		WEAPON_READ_FIELD(int, reloadStartAdd);
-		WEAPON_READ_FIELD(int, ammoDropStockMin);
-		WEAPON_READ_FIELD(int, ammoDropStockMax);
-		WEAPON_READ_FIELD(int, ammoDropClipPercentMin);
-		WEAPON_READ_FIELD(int, ammoDropClipPercentMax);
-		WEAPON_READ_FIELD(int, explosionRadius);
-		WEAPON_READ_FIELD(int, explosionRadiusMin);
-		WEAPON_READ_FIELD(int, explosionInnerDamage);
-		WEAPON_READ_FIELD(int, explosionOuterDamage);
-		WEAPON_READ_FIELD(float, damageConeAngle);
-		WEAPON_READ_FIELD(float, bulletExplDmgMult);
-		WEAPON_READ_FIELD(float, bulletExplRadiusMult);
-		WEAPON_READ_FIELD(int, projectileSpeed);
-		WEAPON_READ_FIELD(int, projectileSpeedUp);
-		WEAPON_READ_FIELD(int, projectileSpeedForward);
-		WEAPON_READ_FIELD(int, projectileActivateDist);
-		WEAPON_READ_FIELD(float, projLifetime);
-		WEAPON_READ_FIELD(float, timeToAccelerate);
-		WEAPON_READ_FIELD(float, projectileCurvature);
-		//WEAPON_READ_FIELD(float, xU_021);
-		WEAPON_READ_FIELD(weapProjExposion_t, projExplosion);
-		WEAPON_READ_FIELD(WeapStickinessType, stickiness);
-		WEAPON_READ_FIELD(float, lowAmmoWarningThreshold);
-		WEAPON_READ_FIELD(float, ricochetChance);
-		WEAPON_READ_FIELD(int, riotShieldHealth);
-		WEAPON_READ_FIELD(float, riotShieldDamageMult);
-		WEAPON_READ_FIELD_ARR(float, parallelBounce, 53);
-		WEAPON_READ_FIELD_ARR(float, perpendicularBounce, 53);
-		WEAPON_READ_FIELD_ARR(float, projectileColor, 3);
-		WEAPON_READ_FIELD(guidedMissileType_t, guidedMissileType);
-		WEAPON_READ_FIELD(float, maxSteeringAccel);
-		WEAPON_READ_FIELD(int, projIgnitionDelay);
-		WEAPON_READ_FIELD(float, adsAimPitch);
-		WEAPON_READ_FIELD(float, adsCrosshairInFrac);
-		WEAPON_READ_FIELD(float, adsCrosshairOutFrac);
-		WEAPON_READ_FIELD(int, adsGunKickReducedKickBullets);
-		WEAPON_READ_FIELD(float, adsGunKickReducedKickPercent);
-		WEAPON_READ_FIELD(float, adsGunKickPitchMin);
-		WEAPON_READ_FIELD(float, adsGunKickPitchMax);
-		WEAPON_READ_FIELD(float, adsGunKickYawMin);
-		WEAPON_READ_FIELD(float, adsGunKickYawMax);
-		WEAPON_READ_FIELD(float, adsGunKickMagMin);
-		WEAPON_READ_FIELD(float, adsGunKickAccel);
-		WEAPON_READ_FIELD(float, adsGunKickSpeedMax);
-		WEAPON_READ_FIELD(float, adsGunKickSpeedDecay);
-		WEAPON_READ_FIELD(float, adsGunKickStaticDecay);
-		WEAPON_READ_FIELD(float, adsViewKickPitchMin);
-		WEAPON_READ_FIELD(float, adsViewKickPitchMax);
-		WEAPON_READ_FIELD(float, adsViewKickYawMin);
-		WEAPON_READ_FIELD(float, adsViewKickYawMax);
-		WEAPON_READ_FIELD(float, adsViewKickMagMin);
-		WEAPON_READ_FIELD(float, adsViewKickCenterSpeed);
-		WEAPON_READ_FIELD(float, adsViewScatterMin);
-		WEAPON_READ_FIELD(float, adsViewScatterMax);
-		WEAPON_READ_FIELD(float, adsSpread);
-		WEAPON_READ_FIELD(int, hipGunKickReducedKickBullets);
-		WEAPON_READ_FIELD(float, hipGunKickReducedKickPercent);
-		WEAPON_READ_FIELD(float, hipGunKickPitchMin);
-		WEAPON_READ_FIELD(float, hipGunKickPitchMax);
-		WEAPON_READ_FIELD(float, hipGunKickYawMin);
-		WEAPON_READ_FIELD(float, hipGunKickYawMax);
-		WEAPON_READ_FIELD(float, hipGunKickMagMin);
-		WEAPON_READ_FIELD(float, hipGunKickAccel);
-		WEAPON_READ_FIELD(float, hipGunKickSpeedMax);
-		WEAPON_READ_FIELD(float, hipGunKickSpeedDecay);
-		WEAPON_READ_FIELD(float, hipGunKickStaticDecay);
-		WEAPON_READ_FIELD(float, hipViewKickPitchMin);
-		WEAPON_READ_FIELD(float, hipViewKickPitchMax);
-		WEAPON_READ_FIELD(float, hipViewKickYawMin);
-		WEAPON_READ_FIELD(float, hipViewKickYawMax);
-		WEAPON_READ_FIELD(float, hipViewKickMagMin);
-		WEAPON_READ_FIELD(float, hipViewKickCenterSpeed);
-		WEAPON_READ_FIELD(float, hipViewScatterMin);
-		WEAPON_READ_FIELD(float, hipViewScatterMax);
-		//WEAPON_READ_FIELD(float, xU_043);
-		WEAPON_READ_FIELD(int, adsReloadTransTime);
-		WEAPON_READ_FIELD(float, fightDist);
-		WEAPON_READ_FIELD(float, maxDist);
-		WEAPON_READ_FIELD(int, positionReloadTransTime);
-		WEAPON_READ_FIELD(float, leftArc);
-		WEAPON_READ_FIELD(float, rightArc);
-		WEAPON_READ_FIELD(float, topArc);
-		WEAPON_READ_FIELD(float, bottomArc);
-		WEAPON_READ_FIELD(float, accuracy);
-		WEAPON_READ_FIELD(float, aiSpread);
-		WEAPON_READ_FIELD(float, playerSpread);
-		WEAPON_READ_FIELD_ARR(float, minTurnSpeed, 2);
-		WEAPON_READ_FIELD_ARR(float, maxTurnSpeed, 2);
-		WEAPON_READ_FIELD(float, pitchConvergenceTime);
-		WEAPON_READ_FIELD(float, yawConvergenceTime);
-		WEAPON_READ_FIELD(float, suppressTime);
-		WEAPON_READ_FIELD(float, maxRange);
-		WEAPON_READ_FIELD(float, animHorRotateInc);
-		WEAPON_READ_FIELD(float, playerPositionDist);
-		//WEAPON_READ_FIELD(unsigned int, iUseHintStringIndex);
-		//WEAPON_READ_FIELD(unsigned int, dropHintStringIndex);
-		WEAPON_READ_FIELD(float, horizViewJitter);
-		WEAPON_READ_FIELD(float, vertViewJitter);
-		WEAPON_READ_FIELD(float, scanSpeed);
-		WEAPON_READ_FIELD(float, scanAccel);
-		WEAPON_READ_FIELD(int, scanPauseTime);
-		WEAPON_READ_FIELD(int, minDamage);
-		WEAPON_READ_FIELD(int, midDamage);
-		WEAPON_READ_FIELD(int, minPlayerDamage);
-		WEAPON_READ_FIELD(int, midPlayerDamage);
-		WEAPON_READ_FIELD(float, maxDamageRange);
-		WEAPON_READ_FIELD(float, minDamageRange);
-		WEAPON_READ_FIELD_ARR(char, __pad, 12);
-		//WEAPON_READ_FIELD(int, iU_045);
-		//WEAPON_READ_FIELD(int, iU_046);
-		//WEAPON_READ_FIELD(int, iU_047);
-		//WEAPON_READ_FIELD(int, iU_048);
-		//WEAPON_READ_FIELD(float, fU_049);
-		//WEAPON_READ_FIELD(float, fU_050);
-		WEAPON_READ_FIELD(float, destabilizationRateTime);
-		WEAPON_READ_FIELD(float, destabilizationCurvatureMax);
-		WEAPON_READ_FIELD(int, destabilizeDistance);
-		WEAPON_READ_FIELD(float, turretADSTime);
-		WEAPON_READ_FIELD(float, turretFov);
-		WEAPON_READ_FIELD(float, turretFovADS);
-		WEAPON_READ_FIELD(float, turretScopeZoomRate);
-		WEAPON_READ_FIELD(float, turretScopeZoomMin);
-		WEAPON_READ_FIELD(float, turretScopeZoomMax);
-		//WEAPON_READ_FIELD(float, xU_056);
-		//WEAPON_READ_FIELD(float, xU_057);
-		//WEAPON_READ_FIELD(float, xU_058);
-		//WEAPON_READ_FIELD(float, xU_059);
-		WEAPON_READ_FIELD(float, turretBarrelSpinSpeed);
-		WEAPON_READ_FIELD(float, turretBarrelSpinUpTime);
-		WEAPON_READ_FIELD(float, turretBarrelSpinDownTime);
-		WEAPON_READ_FIELD(float, missileConeSoundRadiusAtTop);
-		WEAPON_READ_FIELD(float, missileConeSoundRadiusAtBase);
-		WEAPON_READ_FIELD(float, missileConeSoundHeight);
-		WEAPON_READ_FIELD(float, missileConeSoundOriginOffset);
-		WEAPON_READ_FIELD(float, missileConeSoundVolumescaleAtCore);
-		WEAPON_READ_FIELD(float, missileConeSoundVolumescaleAtEdge);
-		WEAPON_READ_FIELD(float, missileConeSoundVolumescaleCoreSize);
-		WEAPON_READ_FIELD(float, missileConeSoundPitchAtTop);
-		WEAPON_READ_FIELD(float, missileConeSoundPitchAtBottom);
-		WEAPON_READ_FIELD(float, missileConeSoundPitchTopSize);
-		WEAPON_READ_FIELD(float, missileConeSoundPitchBottomSize);
-		WEAPON_READ_FIELD(float, missileConeSoundCrossfadeTopSize);
-		WEAPON_READ_FIELD(float, missileConeSoundCrossfadeBottomSize);
-		WEAPON_READ_FIELD(float, aim_automelee_lerp);
-		WEAPON_READ_FIELD(float, aim_automelee_range);
-		WEAPON_READ_FIELD(float, aim_automelee_region_height);
-		WEAPON_READ_FIELD(float, aim_automelee_region_width);
-		WEAPON_READ_FIELD(float, player_meleeHeight);
-		WEAPON_READ_FIELD(float, player_meleeRange);
-		WEAPON_READ_FIELD(float, player_meleeWidth);
-		WEAPON_READ_FIELD(float ,signatureFireTime);
-		WEAPON_READ_FIELD(int, signatureNumBullets);
-		WEAPON_READ_FIELD(weapFireTimeInterpolation_t, fireTimeInterpolationType);
-		//WEAPON_READ_FIELD(int, xU_075);
-		WEAPON_READ_FIELD(int, ammoUsedPerShot);
-		//WEAPON_READ_FIELD(int, xU_076);
-		//WEAPON_READ_FIELD(int, xU_077);
-		//WEAPON_READ_FIELD(int, xU_078);
-		//WEAPON_READ_FIELD(int, iU_079);
-		//WEAPON_READ_FIELD(int, iU_080);
-		//WEAPON_READ_FIELD(bool, bU_081);
-		//WEAPON_READ_FIELD(bool, unknownReticleBooleanValue1);
-		//WEAPON_READ_FIELD(bool, unknownReticleBooleanValue2);
-		WEAPON_READ_FIELD(bool, turretADSEnabled);
-		WEAPON_READ_FIELD(bool, knifeAttachTagLeft);
-		WEAPON_READ_FIELD(bool, knifeAlwaysAttached);
-		WEAPON_READ_FIELD(bool, meleeOverrideValues);
-		//WEAPON_READ_FIELD(bool, bU_083);
-		//WEAPON_READ_FIELD(bool, bU_084);
-		WEAPON_READ_FIELD(bool, sharedAmmo);
-		WEAPON_READ_FIELD(bool, lockonSupported);
-		WEAPON_READ_FIELD(bool, requireLockonToFire);
-		WEAPON_READ_FIELD(bool, isAirburstWeapon);
-		WEAPON_READ_FIELD(bool, bigExplosion);
-		WEAPON_READ_FIELD(bool, noAdsWhenMagEmpty);
-		WEAPON_READ_FIELD(bool, avoidDropCleanup);
-		WEAPON_READ_FIELD(bool, inheritsPerks);
-		WEAPON_READ_FIELD(bool, crosshairColorChange);
-		WEAPON_READ_FIELD(bool, rifleBullet);
-		WEAPON_READ_FIELD(bool, armorPiercing);
-		WEAPON_READ_FIELD(bool, boltAction);
-		WEAPON_READ_FIELD(bool, aimDownSight);
-		WEAPON_READ_FIELD(bool, canHoldBreath);
-		WEAPON_READ_FIELD(bool, meleeOnly);
-		//WEAPON_READ_FIELD(bool, bU_085);
-		//WEAPON_READ_FIELD(bool, bU_086);
-		WEAPON_READ_FIELD(bool, canVariableZoom);
-		WEAPON_READ_FIELD(bool, rechamberWhileAds);
-		WEAPON_READ_FIELD(bool, bulletExplosiveDamage);
-		WEAPON_READ_FIELD(bool, cookOffHold);
-		WEAPON_READ_FIELD(bool, reticleSpin45);
-		WEAPON_READ_FIELD(bool, reticleSideEnabled);
-		WEAPON_READ_FIELD(bool, clipOnly);
-		WEAPON_READ_FIELD(bool, noAmmoPickup);
-		WEAPON_READ_FIELD(bool, disableSwitchToWhenEmpty);
-		//WEAPON_READ_FIELD(bool, bU_088);
-		WEAPON_READ_FIELD(bool, hasMotionTracker);
-		//WEAPON_READ_FIELD(bool, bU_089);
-		WEAPON_READ_FIELD(bool, noDualWield);
-		WEAPON_READ_FIELD(bool, flipKillIcon);
-		WEAPON_READ_FIELD(bool, actionSlotShowAmmo);
-		WEAPON_READ_FIELD(bool, noPartialReload);
-		WEAPON_READ_FIELD(bool, segmentedReload);
-		WEAPON_READ_FIELD(bool, multipleReload);
-		WEAPON_READ_FIELD(bool, blocksProne);
-		WEAPON_READ_FIELD(bool, silenced);
-		WEAPON_READ_FIELD(bool, isRollingGrenade);
-		WEAPON_READ_FIELD(bool, projExplosionEffectForceNormalUp);
-		WEAPON_READ_FIELD(bool, projExplosionEffectInheritParentDirection);
-		WEAPON_READ_FIELD(bool, projImpactExplode);
-		WEAPON_READ_FIELD(bool, projTrajectoryEvents);
-		WEAPON_READ_FIELD(bool, projWhizByEnabled);
-		WEAPON_READ_FIELD(bool, stickToPlayers);
-		WEAPON_READ_FIELD(bool, stickToVehicles);
-		WEAPON_READ_FIELD(bool, stickToTurrets);
-		WEAPON_READ_FIELD(bool, thrownSideways);
-		WEAPON_READ_FIELD(bool, hasDetonatorEmptyThrow);
-		WEAPON_READ_FIELD(bool, hasDetonatorDoubleTap);
-		WEAPON_READ_FIELD(bool, disableFiring);
-		WEAPON_READ_FIELD(bool, timedDetonation);
-		//WEAPON_READ_FIELD(bool, bU_090);
-		//WEAPON_READ_FIELD(bool, bU_091);
-		WEAPON_READ_FIELD(bool, rotate);
-		WEAPON_READ_FIELD(bool, holdButtonToThrow);
-		WEAPON_READ_FIELD(bool, freezeMovementWhenFiring);
-		WEAPON_READ_FIELD(bool, thermalScope);
-		WEAPON_READ_FIELD(bool, thermalToggle);
-		WEAPON_READ_FIELD(bool, outlineEnemies);
-		WEAPON_READ_FIELD(bool, altModeSameWeapon);
-		WEAPON_READ_FIELD(bool, turretBarrelSpinEnabled);
-		WEAPON_READ_FIELD(bool, missileConeSoundEnabled);
-		WEAPON_READ_FIELD(bool, missileConeSoundPitchshiftEnabled);
-		WEAPON_READ_FIELD(bool, missileConeSoundCrossfadeEnabled);
-		WEAPON_READ_FIELD(bool, offhandHoldIsCancelable);
-		WEAPON_READ_FIELD(bool, doNotAllowAttachmentsToOverrideSpread);
-		WEAPON_READ_FIELD(bool, useFastReloadAnims);
-		WEAPON_READ_FIELD(bool, dualMagReloadSupported);
-		WEAPON_READ_FIELD(bool, reloadStopsAlt);
-		//WEAPON_READ_FIELD(bool, bU_092);
-		WEAPON_READ_FIELD(bool, alwaysShatterGlassOnImpact);
-		WEAPON_READ_FIELD(bool, oldWeapon);
-		//WEAPON_READ_FIELD(bool, bU_093);
-		//WEAPON_READ_FIELD(bool, bU_094);
-		//WEAPON_READ_FIELD(bool, bU_095);
-		WEAPON_READ_FIELD(bool, hasCounterSilencer);
-		//WEAPON_READ_FIELD(bool, xU_097);
-		//WEAPON_READ_FIELD(bool, xU_098);
-		WEAPON_READ_FIELD(bool, disableVariableAutosimRate);
-		//WEAPON_READ_FIELD(bool, bU_100);
-		//WEAPON_READ_FIELD(bool, bU_101);
-		//WEAPON_READ_FIELD(bool, bU_102);
-		//WEAPON_READ_FIELD(bool, bU_103);
-		//WEAPON_READ_FIELD(bool, bU_104);
-		WEAPON_READ_FIELD(bool, cloakedWeapon);
-		WEAPON_READ_FIELD(bool, adsHideWeapon);
-		WEAPON_READ_FIELD(bool, adsHideHands);
-		//WEAPON_READ_FIELD(bool, bU_108);
-		WEAPON_READ_FIELD(bool, adsBlurSceneEnabled);
-		WEAPON_READ_FIELD(bool, usesSniperScope);
-		//WEAPON_READ_FIELD(bool, bU_111);
-		//WEAPON_READ_FIELD(bool, bU_112);
-		//WEAPON_READ_FIELD(bool, bU_113);
-		//WEAPON_READ_FIELD(bool, bU_114);
-		//WEAPON_READ_FIELD(bool, bU_115);
-		WEAPON_READ_FIELD(float, adsDofPhysicalFStop);
-		WEAPON_READ_FIELD(float, adsDofPhysicalFocusDistance);
-		WEAPON_READ_FIELD(float, autosimSpeedScalar);
-		WEAPON_READ_FIELD_ARR(float, explosionReactiveMotionParts, 5);
+		if (const auto& stow_tag = json_fields::get(data, "stowTag"); !stow_tag.is_null())
+		{
+			this->add_script_string(&weapon->stowTag, mem->duplicate_string(stow_tag.get<std::string>()));
+		}
 
 		return weapon;
 	}
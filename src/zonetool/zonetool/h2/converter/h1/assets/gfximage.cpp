@@ -49,7 +49,7 @@ namespace zonetool::h2
 			{
 				for (auto i = 0u; i < 4; i++)
 				{
-					const auto stream_file = &stream_files[*stream_file_index + i];
+					const auto stream_file = &stream_files[dump_stream_file_index + i];
 					const auto db_fs = ::h2::game::DB_FSInitialize();
 					const auto imagefile_path = utils::string::va("imagefile%d.pak", stream_file->fileIndex);
 					const auto imagefile = db_fs->vftbl->OpenFile(db_fs, ::h2::game::Sys_Folder::SF_PAKFILE, imagefile_path);
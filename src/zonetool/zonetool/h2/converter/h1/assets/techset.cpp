@@ -12,6 +12,8 @@
 
 #include <shader-tool/shader.hpp>
 
+#include "zonetool/utils/shader_patch_cache.hpp"
+
 #include <utils/io.hpp>
 #include <utils/cryptography.hpp>
 
@@ -553,7 +555,11 @@ namespace zonetool::h2
 				}
 				
 				const auto data = std::string{reinterpret_cast<const char*>(*program), *program_size};
-				const auto shader = alys::shader::patch_shader(data, patch_cb_index);
+				const auto shader = shader_patch_cache::get("h2_h1_cb_index", data, {}, [&]
+				{
+					const auto buffer = alys::shader::patch_shader(data, patch_cb_index);
+					return std::string{buffer.begin(), buffer.end()};
+				});
 				const auto new_program = allocator.allocate_array<unsigned char>(shader.size());
 				std::memcpy(new_program, shader.data(), shader.size());
 
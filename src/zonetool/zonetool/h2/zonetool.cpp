@@ -8,6 +8,9 @@
 #include "../utils/mapents.hpp"
 #include "../utils/gsc.hpp"
 #include "../utils/csv_generator.hpp"
+#include "../utils/dump_queue.hpp"
+#include "../utils/io/dump_store.hpp"
+#include "../utils/shader_patch_cache.hpp"
 
 #include <utils/io.hpp>
 
@@ -22,6 +25,7 @@ namespace zonetool::h2
 	};
 
 	zonetool_globals_t globals{};
+	dump_queue dump_worker;
 	std::vector<std::pair<XAssetType, std::string>> referenced_assets;
 	std::unordered_set<XAssetType> asset_type_filter;
 
@@ -330,7 +334,39 @@ namespace zonetool::h2
 			return;
 		}
 
-		dump_func->second(asset);
+		// serialization and disk writes run on the dump worker, the asset stays valid until
+		// db_finish_load_x_file waits for it in stop_dumping. an image's pixel data and stream file
+		// index are only valid while it is being linked though, so the task gets copies of those
+		auto stream_index = 0u;
+		std::shared_ptr<std::vector<std::uint8_t>> pixels;
+		if (asset->type == ASSET_TYPE_IMAGE)
+		{
+			const auto* image = asset->header.image;
+			if (image->streamed)
+			{
+				stream_index = *stream_file_index;
+			}
+
+			if (image->pixelData)
+			{
+				pixels = std::make_shared<std::vector<std::uint8_t>>(image->pixelData, image->pixelData + image->dataLen1);
+			}
+		}
+
+		dump_worker.push([dump = dump_func->second, copy = *asset, stream_index, pixels]() mutable
+		{
+			dump_stream_file_index = stream_index;
+
+			GfxImage image{};
+			if (pixels)
+			{
+				image = *copy.header.image;
+				image.pixelData = pixels->data();
+				copy.header.image = &image;
+			}
+
+			dump(&copy);
+		});
 	}
 
 	void stop_dumping()
@@ -340,6 +376,8 @@ namespace zonetool::h2
 			return;
 		}
 
+		dump_worker.wait();
+
 		// remove duplicates
 		std::sort(referenced_assets.begin(), referenced_assets.end());
 		referenced_assets.erase(std::unique(referenced_assets.begin(),
@@ -379,6 +417,11 @@ namespace zonetool::h2
 			dump_asset(&referenced_asset);
 		}
 
+		dump_worker.wait();
+		gsc::wait_for_decompiler();
+
+		filesystem::dump_store::report(filesystem::get_fastfile());
+
 		ZONETOOL_INFO("Zone \"%s\" dumped.", filesystem::get_fastfile().data());
 
 		referenced_assets.clear();
@@ -991,6 +1034,8 @@ namespace zonetool::h2
 			asset_type_filter.clear();
 			globals.target_game = dump_params.target;
 			dump_asset(&asset);
+			dump_worker.wait();
+			gsc::wait_for_decompiler();
 
 			ZONETOOL_INFO("Dumped to dump/assets");
 		});
@@ -1095,6 +1140,22 @@ namespace zonetool::h2
 		auto args = get_command_line_arguments();
 		if (args.size() > 1)
 		{
+			// options for the commands below, regardless of where they appear
+			if (std::find(args.begin(), args.end(), "-dumpstore") != args.end())
+			{
+				filesystem::dump_store::set_shared(true);
+			}
+
+			if (std::find(args.begin(), args.end(), "-dumppack") != args.end())
+			{
+				filesystem::dump_store::set_packed(true);
+			}
+
+			if (std::find(args.begin(), args.end(), "-shadercache") != args.end())
+			{
+				shader_patch_cache::set_persistent(true);
+			}
+
 			for (std::size_t i = 0; i < args.size(); i++)
 			{
 				if (i < args.size() - 1 && i + 1 < args.size())
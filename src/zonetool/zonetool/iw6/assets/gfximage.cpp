@@ -487,7 +487,7 @@ namespace zonetool::iw6
 	{
 		for (auto i = 0u; i < 4; i++)
 		{
-			const auto stream_file = &stream_files[*stream_file_index + i];
+			const auto stream_file = &stream_files[dump_stream_file_index + i];
 
 			std::string filename = utils::string::va("imagefile%d.pak", stream_file->fileIndex);
 			if (is_self)
@@ -594,7 +594,7 @@ namespace zonetool::iw6
 	{
 		if (image->streamed)
 		{
-			dump_streamed_image(image, stream_files[*stream_file_index].fileIndex == 69, true);
+			dump_streamed_image(image, stream_files[dump_stream_file_index].fileIndex == 69, true);
 			return;
 		}
 
@@ -680,7 +680,7 @@ namespace zonetool::iw6
 
 		if (asset->streamed)
 		{
-			if (stream_files[*stream_file_index].fileIndex == 69)
+			if (stream_files[dump_stream_file_index].fileIndex == 69)
 			{
 				dump_streamed_image(asset, true);
 				return;
@@ -719,7 +719,7 @@ namespace zonetool::iw6
 		{
 			for (auto i = 0u; i < 4; i++)
 			{
-				const auto stream_file = &stream_files[*stream_file_index + i];
+				const auto stream_file = &stream_files[dump_stream_file_index + i];
 				write.dump_single(stream_file);
 			}
 		}
@@ -1,305 +1,285 @@
 #include <std_include.hpp>
 #include "weaponattachment.hpp"
 
+#include "zonetool/utils/json_fields.hpp"
+
 namespace zonetool::iw6
 {
-#define PARSE_STRING(__field__) \
-	static_assert(std::is_same_v<decltype(asset->__field__), const char*>, "Field is not of type const char*"); \
-	!data[#__field__].is_null() && !data[#__field__].get<std::string>().empty() ? asset->__field__ = mem->duplicate_string(data[#__field__].get<std::string>()) : asset->__field__ = nullptr;
-
-#define PARSE_FIELD(__field__) \
-	if (!data[#__field__].is_null()) asset->__field__ = data[#__field__].get<decltype(asset->__field__)>();
-
-#define PARSE_FIELD_ARR(__field__, __size__) \
-	if(!data[#__field__].is_null()) \
-	{ \
-		for (auto idx##__field__ = 0u; idx##__field__ < (unsigned int)__size__; idx##__field__++) \
-		{ \
-			asset->__field__[idx##__field__] = data[#__field__][idx##__field__].get<typename std::remove_reference<decltype(asset->__field__[idx##__field__])>::type>(); \
-		} \
-	}
+#define ATTACHMENT_FIELD(__struct__, __field__) JSON_FIELD(__struct__, decltype(__struct__::__field__), __field__)
 
-#define PARSE_FIELD_RENAME(__field__, __name__) \
-	if (!data[__name__].is_null()) asset->__field__ = data[__name__].get<decltype(asset->__field__)>();
-
-#define PARSE_ASSET_ARR(__field__, __size__) \
-	if (!data[#__field__].is_null()) \
-	{ \
-		asset->__field__ = mem->allocate<typename std::remove_reference<decltype(*asset->__field__)>::type>(__size__); \
-		for (auto idx##__field__ = 0u; idx##__field__ < (unsigned int)__size__; idx##__field__++) \
-		{ \
-			if (!data[#__field__][idx##__field__].is_null() && !data[#__field__][idx##__field__].get<std::string>().empty()) \
-			{ \
-				asset->__field__[idx##__field__] = mem->manual_allocate<typename std::remove_reference<decltype(*asset->__field__[idx##__field__])>::type>(sizeof(const char*)); \
-				asset->__field__[idx##__field__]->name = mem->duplicate_string(data[#__field__][idx##__field__].get<std::string>()); \
-			} \
-			else \
-			{ \
-				asset->__field__[idx##__field__] = nullptr; \
-			} \
-		} \
-	} \
-	else \
-	{ \
-		asset->__field__ = nullptr; \
-	}
-
-#define PARSE_ASSET(__field__) \
-	if (!data[#__field__].is_null() && !data[#__field__].get<std::string>().empty()) \
-	{ \
-		asset->__field__ = mem->manual_allocate<typename std::remove_reference<decltype(*asset->__field__)>::type>(sizeof(const char*)); \
-		asset->__field__->name = mem->duplicate_string(data[#__field__].get<std::string>()); \
-	} \
-	else \
-	{ \
-		asset->__field__ = nullptr; \
-	}
-
-	void parse_att(AttAmmoGeneral* asset, ordered_json& data, zone_memory* mem)
+	constexpr auto ammo_general_fields = json_fields::make_field_table<AttAmmoGeneral>(
 	{
-		PARSE_FIELD(penetrateType);
-		PARSE_FIELD(penetrateMultiplier);
-		PARSE_FIELD(impactType);
-		PARSE_FIELD(fireType);
-		PARSE_ASSET(tracerType);
-		PARSE_FIELD(rifleBullet);
-		PARSE_FIELD(armorPiercing);
-	}
-
-	void parse_att(AttSight* asset, ordered_json& data, zone_memory* mem)
+		ATTACHMENT_FIELD(AttAmmoGeneral, penetrateType),
+		ATTACHMENT_FIELD(AttAmmoGeneral, penetrateMultiplier),
+		ATTACHMENT_FIELD(AttAmmoGeneral, impactType),
+		ATTACHMENT_FIELD(AttAmmoGeneral, fireType),
+		JSON_FIELD_ASSET(AttAmmoGeneral, tracerType),
+		ATTACHMENT_FIELD(AttAmmoGeneral, rifleBullet),
+		ATTACHMENT_FIELD(AttAmmoGeneral, armorPiercing)
+	});
+
+	constexpr auto sight_fields = json_fields::make_field_table<AttSight>(
 	{
-		PARSE_FIELD(aimDownSight);
-		PARSE_FIELD(adsFire);
-		PARSE_FIELD(rechamberWhileAds);
-		PARSE_FIELD(noAdsWhenMagEmpty);
-		PARSE_FIELD(canHoldBreath);
-		PARSE_FIELD(canVariableZoom);
-		PARSE_FIELD(hideRailWithThisScope);
-		PARSE_FIELD(useScopeDrift);
-		PARSE_FIELD(useDualFOV);
-	}
-
-	void parse_att(AttReload* asset, ordered_json& data, zone_memory* mem)
+		ATTACHMENT_FIELD(AttSight, aimDownSight),
+		ATTACHMENT_FIELD(AttSight, adsFire),
+		ATTACHMENT_FIELD(AttSight, rechamberWhileAds),
+		ATTACHMENT_FIELD(AttSight, noAdsWhenMagEmpty),
+		ATTACHMENT_FIELD(AttSight, canHoldBreath),
+		ATTACHMENT_FIELD(AttSight, canVariableZoom),
+		ATTACHMENT_FIELD(AttSight, hideRailWithThisScope),
+		ATTACHMENT_FIELD(AttSight, useScopeDrift),
+		ATTACHMENT_FIELD(AttSight, useDualFOV)
+	});
+
+	constexpr auto reload_fields = json_fields::make_field_table<AttReload>(
 	{
-		PARSE_FIELD(noPartialReload);
-		PARSE_FIELD(segmentedReload);
-	}
+		ATTACHMENT_FIELD(AttReload, noPartialReload),
+		ATTACHMENT_FIELD(AttReload, segmentedReload)
+	});
 
-	void parse_att(AttAddOns* asset, ordered_json& data, zone_memory* mem)
+	constexpr auto add_ons_fields = json_fields::make_field_table<AttAddOns>(
 	{
-		PARSE_FIELD(motionTracker);
-		PARSE_FIELD(silenced);
-		PARSE_FIELD(riotShield);
-	}
+		ATTACHMENT_FIELD(AttAddOns, motionTracker),
+		ATTACHMENT_FIELD(AttAddOns, silenced),
+		ATTACHMENT_FIELD(AttAddOns, riotShield)
+	});
 
-	void parse_att(AttGeneral* asset, ordered_json& data, zone_memory* mem)
+	constexpr auto general_fields = json_fields::make_field_table<AttGeneral>(
 	{
-		PARSE_FIELD(boltAction);
-		PARSE_FIELD(inheritsPerks);
-		PARSE_FIELD(reticleSpin45);
-		PARSE_FIELD(enemyCrosshairRange);
-		PARSE_ASSET(reticleCenter);
-		PARSE_ASSET(reticleSide);
-		PARSE_FIELD(reticleCenterSize);
-		PARSE_FIELD(reticleSideSize);
-		PARSE_FIELD(moveSpeedScale);
-		PARSE_FIELD(adsMoveSpeedScale);
-	}
-
-	void parse_att(AttAimAssist* asset, ordered_json& data, zone_memory* mem)
+		ATTACHMENT_FIELD(AttGeneral, boltAction),
+		ATTACHMENT_FIELD(AttGeneral, inheritsPerks),
+		ATTACHMENT_FIELD(AttGeneral, reticleSpin45),
+		ATTACHMENT_FIELD(AttGeneral, enemyCrosshairRange),
+		JSON_FIELD_ASSET(AttGeneral, reticleCenter),
+		JSON_FIELD_ASSET(AttGeneral, reticleSide),
+		ATTACHMENT_FIELD(AttGeneral, reticleCenterSize),
+		ATTACHMENT_FIELD(AttGeneral, reticleSideSize),
+		ATTACHMENT_FIELD(AttGeneral, moveSpeedScale),
+		ATTACHMENT_FIELD(AttGeneral, adsMoveSpeedScale)
+	});
+
+	constexpr auto aim_assist_fields = json_fields::make_field_table<AttAimAssist>(
 	{
-		PARSE_FIELD(autoAimRange);
-		PARSE_FIELD(aimAssistRange);
-		PARSE_FIELD(aimAssistRangeAds);
-	}
+		ATTACHMENT_FIELD(AttAimAssist, autoAimRange),
+		ATTACHMENT_FIELD(AttAimAssist, aimAssistRange),
+		ATTACHMENT_FIELD(AttAimAssist, aimAssistRangeAds)
+	});
 
-	void parse_att(AttAmmunition* asset, ordered_json& data, zone_memory* mem)
+	constexpr auto ammunition_fields = json_fields::make_field_table<AttAmmunition>(
 	{
-		PARSE_FIELD(maxAmmo);
-		PARSE_FIELD(startAmmo);
-		PARSE_FIELD(clipSize);
-		PARSE_FIELD(shotCount);
-		PARSE_FIELD(reloadAmmoAdd);
-		PARSE_FIELD(reloadStartAdd);
-	}
-
-	void parse_att(AttDamage* asset, ordered_json& data, zone_memory* mem)
+		ATTACHMENT_FIELD(AttAmmunition, maxAmmo),
+		ATTACHMENT_FIELD(AttAmmunition, startAmmo),
+		ATTACHMENT_FIELD(AttAmmunition, clipSize),
+		ATTACHMENT_FIELD(AttAmmunition, shotCount),
+		ATTACHMENT_FIELD(AttAmmunition, reloadAmmoAdd),
+		ATTACHMENT_FIELD(AttAmmunition, reloadStartAdd)
+	});
+
+	constexpr auto damage_fields = json_fields::make_field_table<AttDamage>(
 	{
-		PARSE_FIELD(damage);
-		PARSE_FIELD(minDamage);
-		PARSE_FIELD(meleeDamage);
-		PARSE_FIELD(maxDamageRange);
-		PARSE_FIELD(minDamageRange);
-		PARSE_FIELD(playerDamage);
-		PARSE_FIELD(minPlayerDamage);
-	}
-
-	void parse_att(AttIdleSettings* asset, ordered_json& data, zone_memory* mem)
+		ATTACHMENT_FIELD(AttDamage, damage),
+		ATTACHMENT_FIELD(AttDamage, minDamage),
+		ATTACHMENT_FIELD(AttDamage, meleeDamage),
+		ATTACHMENT_FIELD(AttDamage, maxDamageRange),
+		ATTACHMENT_FIELD(AttDamage, minDamageRange),
+		ATTACHMENT_FIELD(AttDamage, playerDamage),
+		ATTACHMENT_FIELD(AttDamage, minPlayerDamage)
+	});
+
+	constexpr auto idle_settings_fields = json_fields::make_field_table<AttIdleSettings>(
 	{
-		PARSE_FIELD(hipIdleAmount);
-		PARSE_FIELD(hipIdleSpeed);
-		PARSE_FIELD(idleCrouchFactor);
-		PARSE_FIELD(idleProneFactor);
-		PARSE_FIELD(adsIdleLerpStartTime);
-		PARSE_FIELD(adsIdleLerpTime);
-	}
-
-	void parse_att(AttADSSettings* asset, ordered_json& data, zone_memory* mem)
+		ATTACHMENT_FIELD(AttIdleSettings, hipIdleAmount),
+		ATTACHMENT_FIELD(AttIdleSettings, hipIdleSpeed),
+		ATTACHMENT_FIELD(AttIdleSettings, idleCrouchFactor),
+		ATTACHMENT_FIELD(AttIdleSettings, idleProneFactor),
+		ATTACHMENT_FIELD(AttIdleSettings, adsIdleLerpStartTime),
+		ATTACHMENT_FIELD(AttIdleSettings, adsIdleLerpTime)
+	});
+
+	constexpr auto ads_settings_fields = json_fields::make_field_table<AttADSSettings>(
 	{
-		PARSE_FIELD(adsSpread);
-		PARSE_FIELD(adsAimPitch);
-		PARSE_FIELD(adsTransInTime);
-		PARSE_FIELD(adsTransOutTime);
-		PARSE_FIELD(adsReloadTransTime);
-		PARSE_FIELD(adsCrosshairInFrac);
-		PARSE_FIELD(adsCrosshairOutFrac);
-		PARSE_FIELD(adsZoomFov);
-		PARSE_FIELD(adsZoomInFrac);
-		PARSE_FIELD(adsZoomOutFrac);
-		PARSE_FIELD(adsFovLerpTime);
-		PARSE_FIELD(adsBobFactor);
-		PARSE_FIELD(adsViewBobMult);
-		PARSE_FIELD(adsFireRateScale);
-		PARSE_FIELD(adsDamageRangeScale);
-		PARSE_FIELD(adsFireAnimFrac);
-	}
-
-	void parse_att(AttScopeDriftSettings* asset, ordered_json& data, zone_memory* mem)
+		ATTACHMENT_FIELD(AttADSSettings, adsSpread),
+		ATTACHMENT_FIELD(AttADSSettings, adsAimPitch),
+		ATTACHMENT_FIELD(AttADSSettings, adsTransInTime),
+		ATTACHMENT_FIELD(AttADSSettings, adsTransOutTime),
+		ATTACHMENT_FIELD(AttADSSettings, adsReloadTransTime),
+		ATTACHMENT_FIELD(AttADSSettings, adsCrosshairInFrac),
+		ATTACHMENT_FIELD(AttADSSettings, adsCrosshairOutFrac),
+		ATTACHMENT_FIELD(AttADSSettings, adsZoomFov),
+		ATTACHMENT_FIELD(AttADSSettings, adsZoomInFrac),
+		ATTACHMENT_FIELD(AttADSSettings, adsZoomOutFrac),
+		ATTACHMENT_FIELD(AttADSSettings, adsFovLerpTime),
+		ATTACHMENT_FIELD(AttADSSettings, adsBobFactor),
+		ATTACHMENT_FIELD(AttADSSettings, adsViewBobMult),
+		ATTACHMENT_FIELD(AttADSSettings, adsFireRateScale),
+		ATTACHMENT_FIELD(AttADSSettings, adsDamageRangeScale),
+		ATTACHMENT_FIELD(AttADSSettings, adsFireAnimFrac)
+	});
+
+	constexpr auto scope_drift_settings_fields = json_fields::make_field_table<AttScopeDriftSettings>(
 	{
-		PARSE_FIELD(fScopeDriftDelay);
-		PARSE_FIELD(fScopeDriftLerpInTime);
-		PARSE_FIELD(fScopeDriftSteadyTime);
-		PARSE_FIELD(fScopeDriftLerpOutTime);
-		PARSE_FIELD(fScopeDriftSteadyFactor);
-		PARSE_FIELD(fScopeDriftUnsteadyFactor);
-	}
-
-	void parse_att(AttHipSpread* asset, ordered_json& data, zone_memory* mem)
+		ATTACHMENT_FIELD(AttScopeDriftSettings, fScopeDriftDelay),
+		ATTACHMENT_FIELD(AttScopeDriftSettings, fScopeDriftLerpInTime),
+		ATTACHMENT_FIELD(AttScopeDriftSettings, fScopeDriftSteadyTime),
+		ATTACHMENT_FIELD(AttScopeDriftSettings, fScopeDriftLerpOutTime),
+		ATTACHMENT_FIELD(AttScopeDriftSettings, fScopeDriftSteadyFactor),
+		ATTACHMENT_FIELD(AttScopeDriftSettings, fScopeDriftUnsteadyFactor)
+	});
+
+	constexpr auto hip_spread_fields = json_fields::make_field_table<AttHipSpread>(
 	{
-		PARSE_FIELD(hipSpreadStandMin);
-		PARSE_FIELD(hipSpreadDuckedMin);
-		PARSE_FIELD(hipSpreadProneMin);
-		PARSE_FIELD(hipSpreadMax);
-		PARSE_FIELD(hipSpreadDuckedMax);
-		PARSE_FIELD(hipSpreadProneMax);
-		PARSE_FIELD(hipSpreadFireAdd);
-		PARSE_FIELD(hipSpreadTurnAdd);
-		PARSE_FIELD(hipSpreadMoveAdd);
-		PARSE_FIELD(hipSpreadDecayRate);
-		PARSE_FIELD(hipSpreadDuckedDecay);
-		PARSE_FIELD(hipSpreadProneDecay);
-	}
-
-	void parse_att(AttGunKick* asset, ordered_json& data, zone_memory* mem)
+		ATTACHMENT_FIELD(AttHipSpread, hipSpreadStandMin),
+		ATTACHMENT_FIELD(AttHipSpread, hipSpreadDuckedMin),
+		ATTACHMENT_FIELD(AttHipSpread, hipSpreadProneMin),
+		ATTACHMENT_FIELD(AttHipSpread, hipSpreadMax),
+		ATTACHMENT_FIELD(AttHipSpread, hipSpreadDuckedMax),
+		ATTACHMENT_FIELD(AttHipSpread, hipSpreadProneMax),
+		ATTACHMENT_FIELD(AttHipSpread, hipSpreadFireAdd),
+		ATTACHMENT_FIELD(AttHipSpread, hipSpreadTurnAdd),
+		ATTACHMENT_FIELD(AttHipSpread, hipSpreadMoveAdd),
+		ATTACHMENT_FIELD(AttHipSpread, hipSpreadDecayRate),
+		ATTACHMENT_FIELD(AttHipSpread, hipSpreadDuckedDecay),
+		ATTACHMENT_FIELD(AttHipSpread, hipSpreadProneDecay)
+	});
+
+	constexpr auto gun_kick_fields = json_fields::make_field_table<AttGunKick>(
 	{
-		PARSE_FIELD(hipGunKickReducedKickBullets);
-		PARSE_FIELD(hipGunKickReducedKickPercent);
-		PARSE_FIELD(hipGunKickPitchMin);
-		PARSE_FIELD(hipGunKickPitchMax);
-		PARSE_FIELD(hipGunKickYawMin);
-		PARSE_FIELD(hipGunKickYawMax);
-		PARSE_FIELD(hipGunKickMagMin);
-		PARSE_FIELD(hipGunKickAccel);
-		PARSE_FIELD(hipGunKickSpeedMax);
-		PARSE_FIELD(hipGunKickSpeedDecay);
-		PARSE_FIELD(hipGunKickStaticDecay);
-		PARSE_FIELD(adsGunKickReducedKickBullets);
-		PARSE_FIELD(adsGunKickReducedKickPercent);
-		PARSE_FIELD(adsGunKickPitchMin);
-		PARSE_FIELD(adsGunKickPitchMax);
-		PARSE_FIELD(adsGunKickYawMin);
-		PARSE_FIELD(adsGunKickYawMax);
-		PARSE_FIELD(adsGunKickMagMin);
-		PARSE_FIELD(adsGunKickAccel);
-		PARSE_FIELD(adsGunKickSpeedMax);
-		PARSE_FIELD(adsGunKickSpeedDecay);
-		PARSE_FIELD(adsGunKickStaticDecay);
-	}
-
-	void parse_att(AttViewKick* asset, ordered_json& data, zone_memory* mem)
+		ATTACHMENT_FIELD(AttGunKick, hipGunKickReducedKickBullets),
+		ATTACHMENT_FIELD(AttGunKick, hipGunKickReducedKickPercent),
+		ATTACHMENT_FIELD(AttGunKick, hipGunKickPitchMin),
+		ATTACHMENT_FIELD(AttGunKick, hipGunKickPitchMax),
+		ATTACHMENT_FIELD(AttGunKick, hipGunKickYawMin),
+		ATTACHMENT_FIELD(AttGunKick, hipGunKickYawMax),
+		ATTACHMENT_FIELD(AttGunKick, hipGunKickMagMin),
+		ATTACHMENT_FIELD(AttGunKick, hipGunKickAccel),
+		ATTACHMENT_FIELD(AttGunKick, hipGunKickSpeedMax),
+		ATTACHMENT_FIELD(AttGunKick, hipGunKickSpeedDecay),
+		ATTACHMENT_FIELD(AttGunKick, hipGunKickStaticDecay),
+		ATTACHMENT_FIELD(AttGunKick, adsGunKickReducedKickBullets),
+		ATTACHMENT_FIELD(AttGunKick, adsGunKickReducedKickPercent),
+		ATTACHMENT_FIELD(AttGunKick, adsGunKickPitchMin),
+		ATTACHMENT_FIELD(AttGunKick, adsGunKickPitchMax),
+		ATTACHMENT_FIELD(AttGunKick, adsGunKickYawMin),
+		ATTACHMENT_FIELD(AttGunKick, adsGunKickYawMax),
+		ATTACHMENT_FIELD(AttGunKick, adsGunKickMagMin),
+		ATTACHMENT_FIELD(AttGunKick, adsGunKickAccel),
+		ATTACHMENT_FIELD(AttGunKick, adsGunKickSpeedMax),
+		ATTACHMENT_FIELD(AttGunKick, adsGunKickSpeedDecay),
+		ATTACHMENT_FIELD(AttGunKick, adsGunKickStaticDecay)
+	});
+
+	constexpr auto view_kick_fields = json_fields::make_field_table<AttViewKick>(
 	{
-		PARSE_FIELD(hipViewKickPitchMin);
-		PARSE_FIELD(hipViewKickPitchMax);
-		PARSE_FIELD(hipViewKickYawMin);
-		PARSE_FIELD(hipViewKickYawMax);
-		PARSE_FIELD(hipViewKickMagMin);
-		PARSE_FIELD(hipViewKickCenterSpeed);
-		PARSE_FIELD(adsViewKickPitchMin);
-		PARSE_FIELD(adsViewKickPitchMax);
-		PARSE_FIELD(adsViewKickYawMin);
-		PARSE_FIELD(adsViewKickYawMax);
-		PARSE_FIELD(adsViewKickMagMin);
-		PARSE_FIELD(adsViewKickCenterSpeed);
-	}
-
-	void parse_att(AttADSOverlay* asset, ordered_json& data, zone_memory* mem)
+		ATTACHMENT_FIELD(AttViewKick, hipViewKickPitchMin),
+		ATTACHMENT_FIELD(AttViewKick, hipViewKickPitchMax),
+		ATTACHMENT_FIELD(AttViewKick, hipViewKickYawMin),
+		ATTACHMENT_FIELD(AttViewKick, hipViewKickYawMax),
+		ATTACHMENT_FIELD(AttViewKick, hipViewKickMagMin),
+		ATTACHMENT_FIELD(AttViewKick, hipViewKickCenterSpeed),
+		ATTACHMENT_FIELD(AttViewKick, adsViewKickPitchMin),
+		ATTACHMENT_FIELD(AttViewKick, adsViewKickPitchMax),
+		ATTACHMENT_FIELD(AttViewKick, adsViewKickYawMin),
+		ATTACHMENT_FIELD(AttViewKick, adsViewKickYawMax),
+		ATTACHMENT_FIELD(AttViewKick, adsViewKickMagMin),
+		ATTACHMENT_FIELD(AttViewKick, adsViewKickCenterSpeed)
+	});
+
+	constexpr auto ads_overlay_fields = json_fields::make_field_table<AttADSOverlay>(
 	{
-		PARSE_ASSET(overlay.shader);
-		PARSE_ASSET(overlay.shaderLowRes);
-		PARSE_ASSET(overlay.shaderEMP);
-		PARSE_ASSET(overlay.shaderEMPLowRes);
-		PARSE_FIELD(overlay.reticle);
-		PARSE_FIELD(overlay.width);
-		PARSE_FIELD(overlay.height);
-		PARSE_FIELD(overlay.widthSplitscreen);
-		PARSE_FIELD(overlay.heightSplitscreen);
-		PARSE_FIELD(hybridToggle);
-		PARSE_FIELD(thermalScope);
-		PARSE_FIELD(thermalToggle);
-		PARSE_FIELD(outlineEnemies);
-	}
-
-	void parse_att(AttUI* asset, ordered_json& data, zone_memory* mem)
+		JSON_FIELD_ASSET(AttADSOverlay, overlay.shader),
+		JSON_FIELD_ASSET(AttADSOverlay, overlay.shaderLowRes),
+		JSON_FIELD_ASSET(AttADSOverlay, overlay.shaderEMP),
+		JSON_FIELD_ASSET(AttADSOverlay, overlay.shaderEMPLowRes),
+		ATTACHMENT_FIELD(AttADSOverlay, overlay.reticle),
+		ATTACHMENT_FIELD(AttADSOverlay, overlay.width),
+		ATTACHMENT_FIELD(AttADSOverlay, overlay.height),
+		ATTACHMENT_FIELD(AttADSOverlay, overlay.widthSplitscreen),
+		ATTACHMENT_FIELD(AttADSOverlay, overlay.heightSplitscreen),
+		ATTACHMENT_FIELD(AttADSOverlay, hybridToggle),
+		ATTACHMENT_FIELD(AttADSOverlay, thermalScope),
+		ATTACHMENT_FIELD(AttADSOverlay, thermalToggle),
+		ATTACHMENT_FIELD(AttADSOverlay, outlineEnemies)
+	});
+
+	constexpr auto ui_fields = json_fields::make_field_table<AttUI>(
 	{
-		PARSE_ASSET(dpadIcon);
-		PARSE_ASSET(ammoCounterIcon);
-		PARSE_FIELD(dpadIconRatio);
-		PARSE_FIELD(ammoCounterIconRatio);
-		PARSE_FIELD(ammoCounterClip);
-	}
-
-	void parse_att(AttRumbles* asset, ordered_json& data, zone_memory* mem)
+		JSON_FIELD_ASSET(AttUI, dpadIcon),
+		JSON_FIELD_ASSET(AttUI, ammoCounterIcon),
+		ATTACHMENT_FIELD(AttUI, dpadIconRatio),
+		ATTACHMENT_FIELD(AttUI, ammoCounterIconRatio),
+		ATTACHMENT_FIELD(AttUI, ammoCounterClip)
+	});
+
+	constexpr auto rumbles_fields = json_fields::make_field_table<AttRumbles>(
 	{
-		PARSE_STRING(fireRumble);
-		PARSE_STRING(meleeImpactRumble);
-	}
+		JSON_FIELD_STRING_OR_NULL(AttRumbles, fireRumble),
+		JSON_FIELD_STRING_OR_NULL(AttRumbles, meleeImpactRumble)
+	});
 
-	void parse_att(AttProjectile* asset, ordered_json& data, zone_memory* mem)
+	constexpr auto projectile_fields = json_fields::make_field_table<AttProjectile>(
 	{
-		PARSE_FIELD(explosionRadius);
-		PARSE_FIELD(explosionInnerDamage);
-		PARSE_FIELD(explosionOuterDamage);
-		PARSE_FIELD(damageConeAngle);
-		PARSE_FIELD(projectileSpeed);
-		PARSE_FIELD(projectileSpeedUp);
-		PARSE_FIELD(projectileActivateDist);
-		PARSE_FIELD(projectileLifetime);
-		PARSE_ASSET(projectileModel);
-		PARSE_FIELD(projExplosionType);
-		PARSE_ASSET(projExplosionEffect);
-		PARSE_FIELD(projExplosionEffectForceNormalUp);
-		PARSE_ASSET(projExplosionSound);
-		PARSE_ASSET(projDudEffect);
-		PARSE_ASSET(projDudSound);
-		PARSE_FIELD(projImpactExplode);
-		PARSE_FIELD(destabilizationRateTime);
-		PARSE_FIELD(destabilizationCurvatureMax);
-		PARSE_FIELD(destabilizeDistance);
-		PARSE_ASSET(projTrailEffect);
-		PARSE_FIELD(projIgnitionDelay);
-		PARSE_ASSET(projIgnitionEffect);
-		PARSE_ASSET(projIgnitionSound);
-	}
+		ATTACHMENT_FIELD(AttProjectile, explosionRadius),
+		ATTACHMENT_FIELD(AttProjectile, explosionInnerDamage),
+		ATTACHMENT_FIELD(AttProjectile, explosionOuterDamage),
+		ATTACHMENT_FIELD(AttProjectile, damageConeAngle),
+		ATTACHMENT_FIELD(AttProjectile, projectileSpeed),
+		ATTACHMENT_FIELD(AttProjectile, projectileSpeedUp),
+		ATTACHMENT_FIELD(AttProjectile, projectileActivateDist),
+		ATTACHMENT_FIELD(AttProjectile, projectileLifetime),
+		JSON_FIELD_ASSET(AttProjectile, projectileModel),
+		ATTACHMENT_FIELD(AttProjectile, projExplosionType),
+		JSON_FIELD_ASSET(AttProjectile, projExplosionEffect),
+		ATTACHMENT_FIELD(AttProjectile, projExplosionEffectForceNormalUp),
+		JSON_FIELD_ASSET(AttProjectile, projExplosionSound),
+		JSON_FIELD_ASSET(AttProjectile, projDudEffect),
+		JSON_FIELD_ASSET(AttProjectile, projDudSound),
+		ATTACHMENT_FIELD(AttProjectile, projImpactExplode),
+		ATTACHMENT_FIELD(AttProjectile, destabilizationRateTime),
+		ATTACHMENT_FIELD(AttProjectile, destabilizationCurvatureMax),
+		ATTACHMENT_FIELD(AttProjectile, destabilizeDistance),
+		JSON_FIELD_ASSET(AttProjectile, projTrailEffect),
+		ATTACHMENT_FIELD(AttProjectile, projIgnitionDelay),
+		JSON_FIELD_ASSET(AttProjectile, projIgnitionEffect),
+		JSON_FIELD_ASSET(AttProjectile, projIgnitionSound)
+	});
+
+	constexpr auto attachment_fields = json_fields::make_field_table<WeaponAttachment>(
+	{
+		JSON_FIELD_STRING_OR_NULL(WeaponAttachment, szInternalName),
+		JSON_FIELD_STRING_OR_NULL(WeaponAttachment, szDisplayName),
+		ATTACHMENT_FIELD(WeaponAttachment, type),
+		ATTACHMENT_FIELD(WeaponAttachment, weaponType),
+		JSON_FIELD_NAMED(WeaponAttachment, weapClass_t, weapClass, "weaponClass"),
+		JSON_FIELD_ASSET_ARR(WeaponAttachment, worldModels, 64),
+		JSON_FIELD_ASSET_ARR(WeaponAttachment, viewModels, 64),
+		JSON_FIELD_ASSET_ARR(WeaponAttachment, reticleViewModels, 16),
+		ATTACHMENT_FIELD(WeaponAttachment, ammunitionScale),
+		ATTACHMENT_FIELD(WeaponAttachment, damageScale),
+		ATTACHMENT_FIELD(WeaponAttachment, damageScaleMin),
+		ATTACHMENT_FIELD(WeaponAttachment, stateTimersScale),
+		ATTACHMENT_FIELD(WeaponAttachment, fireTimersScale),
+		ATTACHMENT_FIELD(WeaponAttachment, adsSettingsScale),
+		ATTACHMENT_FIELD(WeaponAttachment, adsSettingsScaleMain),
+		ATTACHMENT_FIELD(WeaponAttachment, hipSpreadScale),
+		ATTACHMENT_FIELD(WeaponAttachment, gunKickScale),
+		ATTACHMENT_FIELD(WeaponAttachment, viewKickScale),
+		ATTACHMENT_FIELD(WeaponAttachment, viewCenterScale),
+		ATTACHMENT_FIELD(WeaponAttachment, loadIndex), // probably runtime data
+		ATTACHMENT_FIELD(WeaponAttachment, hideIronSightsWithThisAttachment),
+		ATTACHMENT_FIELD(WeaponAttachment, shareAmmoWithAlt)
+	});
+
+	template <typename T, typename Table>
+	void parse_att(T*& att, const json& data, const Table& fields, zone_memory* mem)
+	{
+		if (data.is_null())
+		{
+			att = nullptr;
+			return;
+		}
 
-#define PARSE_ATT(__att__) \
-	if (!data[#__att__].is_null()) \
-	{ \
-		asset->__att__ = mem->allocate<typename std::remove_reference<decltype(*asset->__att__)>::type>(); \
-		parse_att(asset->__att__, data[#__att__], mem);  \
-	} \
-	else \
-	{ \
-		 asset->__att__ = nullptr; \
+		att = mem->allocate<T>();
+		fields.read(att, data, mem);
 	}
 
 	WeaponAttachment* weapon_attachment::parse(const std::string& name, zone_memory* mem)
@@ -319,52 +299,32 @@ namespace zonetool::iw6
 		auto size = file.size();
 		auto bytes = file.read_bytes(size);
 		file.close();
-		ordered_json data = json::parse(bytes);
+		const json data = json::parse(bytes);
 
 		auto* asset = mem->allocate<WeaponAttachment>();
 
-		PARSE_STRING(szInternalName);
-		PARSE_STRING(szDisplayName);
-		PARSE_FIELD(type);
-		PARSE_FIELD(weaponType);
-		PARSE_FIELD_RENAME(weapClass, "weaponClass");
-		PARSE_ASSET_ARR(worldModels, 64);
-		PARSE_ASSET_ARR(viewModels, 64);
-		PARSE_ASSET_ARR(reticleViewModels, 16);
-		PARSE_ATT(ammogeneral);
-		PARSE_ATT(sight);
-		PARSE_ATT(reload);
-		PARSE_ATT(addOns);
-		PARSE_ATT(general);
-		PARSE_ATT(aimAssist);
-		PARSE_ATT(ammunition);
-		PARSE_ATT(damage);
-		PARSE_ATT(idleSettings);
-		PARSE_ATT(adsSettings);
-		PARSE_ATT(adsSettingsMain);
-		PARSE_ATT(scopeDriftSettings);
-		PARSE_ATT(scopeDriftSettingsMain);
-		PARSE_ATT(hipSpread);
-		PARSE_ATT(gunKick);
-		PARSE_ATT(viewKick);
-		PARSE_ATT(adsOverlay);
-		PARSE_ATT(ui);
-		PARSE_ATT(rumbles);
-		PARSE_ATT(projectile);
-		PARSE_FIELD(ammunitionScale);
-		PARSE_FIELD(damageScale);
-		PARSE_FIELD(damageScaleMin);
-		PARSE_FIELD(stateTimersScale);
-		PARSE_FIELD(fireTimersScale);
-		PARSE_FIELD(adsSettingsScale);
-		PARSE_FIELD(adsSettingsScaleMain);
-		PARSE_FIELD(hipSpreadScale);
-		PARSE_FIELD(gunKickScale);
-		PARSE_FIELD(viewKickScale);
-		PARSE_FIELD(viewCenterScale);
-		PARSE_FIELD(loadIndex); // probably runtime data
-		PARSE_FIELD(hideIronSightsWithThisAttachment);
-		PARSE_FIELD(shareAmmoWithAlt);
+		attachment_fields.read(asset, data, mem);
+
+		parse_att(asset->ammogeneral, json_fields::get(data, "ammogeneral"), ammo_general_fields, mem);
+		parse_att(asset->sight, json_fields::get(data, "sight"), sight_fields, mem);
+		parse_att(asset->reload, json_fields::get(data, "reload"), reload_fields, mem);
+		parse_att(asset->addOns, json_fields::get(data, "addOns"), add_ons_fields, mem);
+		parse_att(asset->general, json_fields::get(data, "general"), general_fields, mem);
+		parse_att(asset->aimAssist, json_fields::get(data, "aimAssist"), aim_assist_fields, mem);
+		parse_att(asset->ammunition, json_fields::get(data, "ammunition"), ammunition_fields, mem);
+		parse_att(asset->damage, json_fields::get(data, "damage"), damage_fields, mem);
+		parse_att(asset->idleSettings, json_fields::get(data, "idleSettings"), idle_settings_fields, mem);
+		parse_att(asset->adsSettings, json_fields::get(data, "adsSettings"), ads_settings_fields, mem);
+		parse_att(asset->adsSettingsMain, json_fields::get(data, "adsSettingsMain"), ads_settings_fields, mem);
+		parse_att(asset->scopeDriftSettings, json_fields::get(data, "scopeDriftSettings"), scope_drift_settings_fields, mem);
+		parse_att(asset->scopeDriftSettingsMain, json_fields::get(data, "scopeDriftSettingsMain"), scope_drift_settings_fields, mem);
+		parse_att(asset->hipSpread, json_fields::get(data, "hipSpread"), hip_spread_fields, mem);
+		parse_att(asset->gunKick, json_fields::get(data, "gunKick"), gun_kick_fields, mem);
+		parse_att(asset->viewKick, json_fields::get(data, "viewKick"), view_kick_fields, mem);
+		parse_att(asset->adsOverlay, json_fields::get(data, "adsOverlay"), ads_overlay_fields, mem);
+		parse_att(asset->ui, json_fields::get(data, "ui"), ui_fields, mem);
+		parse_att(asset->rumbles, json_fields::get(data, "rumbles"), rumbles_fields, mem);
+		parse_att(asset->projectile, json_fields::get(data, "projectile"), projectile_fields, mem);
 
 		return asset;
 	}
@@ -1,6 +1,8 @@
 #include "std_include.hpp"
 #include "weapondef.hpp"
 
+#include "zonetool/utils/json_fields.hpp"
+
 namespace zonetool::iw6
 {
 	constexpr const char* anim_names[NUM_WEAP_ANIMS] =
@@ -180,178 +182,598 @@ namespace zonetool::iw6
 		return nullptr;
 	}
 
-#define WEAPON_READ_FIELD(__type__, __field__) \
-	if (!data[#__field__].is_null()) *(__type__*)(&weapon->__field__) = (__type__)data[#__field__].get<__type__>()
-
-#define WEAPON_READ_FIELD_ARR(__type__, __field__, __size__) \
-	if (!data[#__field__].is_null()) \
-	{ \
-		if constexpr (std::is_pointer<decltype(weapon->__field__)>::value) \
-		{ \
-			*reinterpret_cast<__type__**>(reinterpret_cast<size_t>(&weapon->__field__)) = mem->allocate<__type__>(__size__); \
-		} \
-		for (auto idx##__field__ = 0; idx##__field__ < __size__; idx##__field__++) \
-		{ \
-			*(__type__*)(&weapon->__field__[idx##__field__]) = (__type__)data[#__field__][idx##__field__].get<__type__>(); \
-		} \
-	}
-
-#define WEAPON_READ_STRING(__field__) \
-	if (!data[#__field__].is_null()) weapon->__field__ = mem->duplicate_string(data[#__field__].get<std::string>())
-
-#define WEAPON_READ_ASSET(__type__, __datafield__, __field__) \
-	if (!data[#__field__].is_null() && data[#__field__].is_string()) \
-	{ \
-		auto asset##__field__ = data[#__field__].get<std::string>(); \
-		if (asset##__field__.empty()) \
-		{ \
-			weapon->__field__ = nullptr; \
-		} \
-		else \
-		{ \
-			weapon->__field__ = db_find_x_asset_header(XAssetType::__type__, asset##__field__.data(), 1).__datafield__; \
-		} \
-	} \
-	else \
-	{ \
-		weapon->__field__ = nullptr; \
-	}
-
-#define WEAPON_READ_ASSET_ARR(__type__, __datafield__, __field__, __struct__, __size__) \
-	if (!data[#__field__].is_null()) \
-	{ \
-		weapon->__field__ = mem->allocate<__struct__*>(__size__); \
-		for (auto idx##__field__ = 0; idx##__field__ < __size__; idx##__field__++) \
-		{ \
-			auto asset##__field__ = data[#__field__][idx##__field__].get<std::string>(); \
-			if (asset##__field__.empty()) \
-			{ \
-				weapon->__field__[idx##__field__] = nullptr; \
-			} \
-			else \
-			{ \
-				weapon->__field__[idx##__field__] = db_find_x_asset_header(XAssetType::__type__, asset##__field__.data(), 1).__datafield__; \
-			} \
-		} \
-	} \
-	else \
-	{ \
-		weapon->__field__ = nullptr; \
-	}
+#define WEAPON_FIELD(__type__, __field__) JSON_FIELD(WeaponDef, __type__, __field__)
+#define WEAPON_FIELD_ARR(__type__, __field__, __size__) JSON_FIELD_ARR(WeaponDef, __type__, __field__, __size__)
+#define WEAPON_FIELD_STRING(__field__) JSON_FIELD_STRING(WeaponDef, __field__)
+#define WEAPON_FIELD_ASSET(__type__, __field__) \
+	JSON_FIELD_ASSET_HEADER(WeaponDef, __field__, db_find_x_asset_data<__type__>)
+#define WEAPON_FIELD_ASSET_ARR(__type__, __field__, __size__) \
+	JSON_FIELD_ASSET_HEADER_ARR(WeaponDef, __field__, __size__, db_find_x_asset_data<__type__>)
 
-#define WEAPON_READ_ANIM_ARR(__field__, __size__) \
-	if (!data[#__field__].is_null()) \
-	{ \
-		weapon->__field__ = mem->allocate<XAnimParts*>(__size__); \
-		for (auto idx##__field__ = 0; idx##__field__ < __size__; idx##__field__++) \
-		{ \
-			auto asset##__field__ = data[#__field__][get_anim_name_from_index(idx##__field__)].get<std::string>(); \
-			if (asset##__field__.empty()) \
-			{ \
-				weapon->__field__[idx##__field__] = nullptr; \
-			} \
-			else \
-			{ \
-				weapon->__field__[idx##__field__] = db_find_x_asset_header(XAssetType::ASSET_TYPE_XANIMPARTS, asset##__field__.data(), 1).parts; \
-			} \
-		} \
-	} \
-	else \
-	{ \
-		weapon->__field__ = nullptr; \
-	}
+	constexpr auto overlay_fields = json_fields::make_field_table<ADSOverlay>(
+	{
+		JSON_FIELD_ASSET_HEADER(ADSOverlay, shader, db_find_x_asset_data<ASSET_TYPE_MATERIAL>),
+		JSON_FIELD_ASSET_HEADER(ADSOverlay, shaderLowRes, db_find_x_asset_data<ASSET_TYPE_MATERIAL>),
+		JSON_FIELD_ASSET_HEADER(ADSOverlay, shaderEMP, db_find_x_asset_data<ASSET_TYPE_MATERIAL>),
+		JSON_FIELD_ASSET_HEADER(ADSOverlay, shaderEMPLowRes, db_find_x_asset_data<ASSET_TYPE_MATERIAL>),
+		JSON_FIELD(ADSOverlay, int, reticle),
+		JSON_FIELD(ADSOverlay, float, width),
+		JSON_FIELD(ADSOverlay, float, height),
+		JSON_FIELD(ADSOverlay, float, widthSplitscreen),
+		JSON_FIELD(ADSOverlay, float, heightSplitscreen)
+	});
+
+	constexpr auto state_timer_fields = json_fields::make_field_table<StateTimers>(
+	{
+		JSON_FIELD(StateTimers, int, iFireDelay),
+		JSON_FIELD(StateTimers, int, iMeleeDelay),
+		JSON_FIELD(StateTimers, int, meleeChargeDelay),
+		JSON_FIELD(StateTimers, int, iDetonateDelay),
+		JSON_FIELD(StateTimers, int, iRechamberTime),
+		JSON_FIELD(StateTimers, int, rechamberTimeOneHanded),
+		JSON_FIELD(StateTimers, int, iRechamberBoltTime),
+		JSON_FIELD(StateTimers, int, iHoldFireTime),
+		JSON_FIELD(StateTimers, int, iHoldPrimeTime),
+		JSON_FIELD(StateTimers, int, iDetonateTime),
+		JSON_FIELD(StateTimers, int, iMeleeTime),
+		JSON_FIELD(StateTimers, int, meleeChargeTime),
+		JSON_FIELD(StateTimers, int, iReloadTime),
+		JSON_FIELD(StateTimers, int, reloadShowRocketTime),
+		JSON_FIELD(StateTimers, int, iReloadEmptyTime),
+		JSON_FIELD(StateTimers, int, iReloadAddTime),
+		JSON_FIELD(StateTimers, int, iReloadEmptyAddTime),
+		JSON_FIELD(StateTimers, int, iReloadStartTime),
+		JSON_FIELD(StateTimers, int, iReloadStartAddTime),
+		JSON_FIELD(StateTimers, int, iReloadEndTime),
+		JSON_FIELD(StateTimers, int, iDropTime),
+		JSON_FIELD(StateTimers, int, iRaiseTime),
+		JSON_FIELD(StateTimers, int, iAltDropTime),
+		JSON_FIELD(StateTimers, int, quickDropTime),
+		JSON_FIELD(StateTimers, int, quickRaiseTime),
+		JSON_FIELD(StateTimers, int, iBreachRaiseTime),
+		JSON_FIELD(StateTimers, int, iEmptyRaiseTime),
+		JSON_FIELD(StateTimers, int, iEmptyDropTime),
+		JSON_FIELD(StateTimers, int, sprintInTime),
+		JSON_FIELD(StateTimers, int, sprintLoopTime),
+		JSON_FIELD(StateTimers, int, sprintOutTime),
+		JSON_FIELD(StateTimers, int, stunnedTimeBegin),
+		JSON_FIELD(StateTimers, int, stunnedTimeLoop),
+		JSON_FIELD(StateTimers, int, stunnedTimeEnd),
+		JSON_FIELD(StateTimers, int, nightVisionWearTime),
+		JSON_FIELD(StateTimers, int, nightVisionWearTimeFadeOutEnd),
+		JSON_FIELD(StateTimers, int, nightVisionWearTimePowerUp),
+		JSON_FIELD(StateTimers, int, nightVisionRemoveTime),
+		JSON_FIELD(StateTimers, int, nightVisionRemoveTimePowerDown),
+		JSON_FIELD(StateTimers, int, nightVisionRemoveTimeFadeInStart),
+		JSON_FIELD(StateTimers, int, fuseTime),
+		JSON_FIELD(StateTimers, int, aiFuseTime),
+		JSON_FIELD(StateTimers, bool, bHoldFullPrime),
+		JSON_FIELD(StateTimers, int, blastFrontTime),
+		JSON_FIELD(StateTimers, int, blastRightTime),
+		JSON_FIELD(StateTimers, int, blastBackTime),
+		JSON_FIELD(StateTimers, int, blastLeftTime),
+		JSON_FIELD(StateTimers, int, slideInTime),
+		JSON_FIELD(StateTimers, int, slideLoopTime),
+		JSON_FIELD(StateTimers, int, slideOutTime)
+	});
+
+	// the "weapDef" object of a weapon
+	constexpr auto weapon_fields = json_fields::make_field_table<WeaponDef>(
+	{
+		WEAPON_FIELD_STRING(szOverlayName),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_XMODEL, handXModel),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_XMODEL, camoWorldModel),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_XMODEL, camoViewModel),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_MATERIAL, camoWorldModelMaterialOverride),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_MATERIAL, camoViewModelMaterialOverride),
+		WEAPON_FIELD_STRING(szModeName),
+		WEAPON_FIELD(int, playerAnimType),
+		WEAPON_FIELD(int, weapType),
+		WEAPON_FIELD(int, weapClass),
+		WEAPON_FIELD(int, penetrateType),
+		WEAPON_FIELD(int, inventoryType),
+		WEAPON_FIELD(int, fireType),
+		WEAPON_FIELD(float, burstFireCooldown),
+		WEAPON_FIELD(int, offhandClass),
+		WEAPON_FIELD(int, stance),
+		WEAPON_FIELD(short, rattleSoundType),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_FX, viewFlashEffect),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_FX, worldFlashEffect),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_FX, viewFlashADSEffect),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_FX, viewShellEjectEffect),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_FX, worldShellEjectEffect),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_FX, viewLastShotEjectEffect),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_FX, worldLastShotEjectEffect),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_MATERIAL, reticleCenter),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_MATERIAL, reticleSide),
+		WEAPON_FIELD(int, iReticleCenterSize),
+		WEAPON_FIELD(int, iReticleSideSize),
+		WEAPON_FIELD(int, iReticleMinOfs),
+		WEAPON_FIELD(int, activeReticleType),
+		WEAPON_FIELD_ARR(float, vStandMove, 3),
+		WEAPON_FIELD_ARR(float, vStandRot, 3),
+		WEAPON_FIELD_ARR(float, strafeMove, 3),
+		WEAPON_FIELD_ARR(float, strafeRot, 3),
+		WEAPON_FIELD_ARR(float, vDuckedOfs, 3),
+		WEAPON_FIELD_ARR(float, vDuckedMove, 3),
+		WEAPON_FIELD_ARR(float, vDuckedRot, 3),
+		WEAPON_FIELD_ARR(float, vProneOfs, 3),
+		WEAPON_FIELD_ARR(float, vProneMove, 3),
+		WEAPON_FIELD_ARR(float, vProneRot, 3),
+		WEAPON_FIELD(float, fPosMoveRate),
+		WEAPON_FIELD(float, fPosProneMoveRate),
+		WEAPON_FIELD(float, fStandMoveMinSpeed),
+		WEAPON_FIELD(float, fDuckedMoveMinSpeed),
+		WEAPON_FIELD(float, fProneMoveMinSpeed),
+		WEAPON_FIELD(float, fPosRotRate),
+		WEAPON_FIELD(float, fPosProneRotRate),
+		WEAPON_FIELD(float, fStandRotMinSpeed),
+		WEAPON_FIELD(float, fDuckedRotMinSpeed),
+		WEAPON_FIELD(float, fProneRotMinSpeed),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_XMODEL, worldClipModel),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_XMODEL, rocketModel),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_XMODEL, knifeModel),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_XMODEL, worldKnifeModel),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_MATERIAL, hudIcon),
+		WEAPON_FIELD(int, hudIconRatio),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_MATERIAL, pickupIcon),
+		WEAPON_FIELD(int, pickupIconRatio),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_MATERIAL, ammoCounterIcon),
+		WEAPON_FIELD(int, ammoCounterIconRatio),
+		WEAPON_FIELD(int, ammoCounterClip),
+		WEAPON_FIELD(int, iStartAmmo),
+		WEAPON_FIELD_STRING(szAmmoName),
+		WEAPON_FIELD(int, iAmmoIndex),
+		WEAPON_FIELD_STRING(szClipName),
+		WEAPON_FIELD(int, iClipIndex),
+		WEAPON_FIELD(int, iMaxAmmo),
+		WEAPON_FIELD(int, shotCount),
+		WEAPON_FIELD_STRING(szSharedAmmoCapName),
+		WEAPON_FIELD(int, iSharedAmmoCapIndex),
+		WEAPON_FIELD(int, iSharedAmmoCap),
+		WEAPON_FIELD(int, damage),
+		WEAPON_FIELD(int, playerDamage),
+		WEAPON_FIELD(int, iMeleeDamage),
+		WEAPON_FIELD(int, iDamageType),
+		WEAPON_FIELD(float, autoAimRange),
+		WEAPON_FIELD(float, aimAssistRange),
+		WEAPON_FIELD(float, aimAssistRangeAds),
+		WEAPON_FIELD(float, aimPadding),
+		WEAPON_FIELD(float, enemyCrosshairRange),
+		WEAPON_FIELD(float, moveSpeedScale),
+		WEAPON_FIELD(float, adsMoveSpeedScale),
+		WEAPON_FIELD(float, sprintDurationScale),
+		WEAPON_FIELD(float, fAdsZoomInFrac),
+		WEAPON_FIELD(float, fAdsZoomOutFrac),
+		WEAPON_FIELD(int, overlayInterface),
+		WEAPON_FIELD(float, fAdsBobFactor),
+		WEAPON_FIELD(float, fAdsViewBobMult),
+		WEAPON_FIELD(float, fHipSpreadStandMin),
+		WEAPON_FIELD(float, fHipSpreadDuckedMin),
+		WEAPON_FIELD(float, fHipSpreadProneMin),
+		WEAPON_FIELD(float, hipSpreadStandMax),
+		WEAPON_FIELD(float, hipSpreadDuckedMax),
+		WEAPON_FIELD(float, hipSpreadProneMax),
+		WEAPON_FIELD(float, fHipSpreadDecayRate),
+		WEAPON_FIELD(float, fHipSpreadFireAdd),
+		WEAPON_FIELD(float, fHipSpreadTurnAdd),
+		WEAPON_FIELD(float, fHipSpreadMoveAdd),
+		WEAPON_FIELD(float, fHipSpreadDuckedDecay),
+		WEAPON_FIELD(float, fHipSpreadProneDecay),
+		WEAPON_FIELD(float, fHipReticleSidePos),
+		WEAPON_FIELD(float, fAdsIdleAmount),
+		WEAPON_FIELD(float, fHipIdleAmount),
+		WEAPON_FIELD(float, adsIdleSpeed),
+		WEAPON_FIELD(float, hipIdleSpeed),
+		WEAPON_FIELD(float, fIdleCrouchFactor),
+		WEAPON_FIELD(float, fIdleProneFactor),
+		WEAPON_FIELD(float, fGunMaxPitch),
+		WEAPON_FIELD(float, fGunMaxYaw),
+		WEAPON_FIELD(float, adsIdleLerpStartTime),
+		WEAPON_FIELD(float, adsIdleLerpTime),
+		WEAPON_FIELD(float, swayMaxAngleSteadyAim),
+		WEAPON_FIELD(float, swayMaxAngle),
+		WEAPON_FIELD(float, swayLerpSpeed),
+		WEAPON_FIELD(float, swayPitchScale),
+		WEAPON_FIELD(float, swayYawScale),
+		WEAPON_FIELD(float, swayHorizScale),
+		WEAPON_FIELD(float, swayVertScale),
+		WEAPON_FIELD(float, swayShellShockScale),
+		WEAPON_FIELD(float, adsSwayMaxAngle),
+		WEAPON_FIELD(float, adsSwayLerpSpeed),
+		WEAPON_FIELD(float, adsSwayPitchScale),
+		WEAPON_FIELD(float, adsSwayYawScale),
+		WEAPON_FIELD(float, adsSwayHorizScale),
+		WEAPON_FIELD(float, adsSwayVertScale),
+		WEAPON_FIELD(float, adsFireRateScale),
+		WEAPON_FIELD(float, adsDamageRangeScale),
+		WEAPON_FIELD(float, adsFireAnimFrac),
+		WEAPON_FIELD(float, dualWieldViewModelOffset),
+		WEAPON_FIELD(float, fScopeDriftDelay),
+		WEAPON_FIELD(float, fScopeDriftLerpInTime),
+		WEAPON_FIELD(float, fScopeDriftSteadyTime),
+		WEAPON_FIELD(float, fScopeDriftLerpOutTime),
+		WEAPON_FIELD(float, fScopeDriftSteadyFactor),
+		WEAPON_FIELD(float, fScopeDriftUnsteadyFactor),
+		WEAPON_FIELD(int, killIconRatio),
+		WEAPON_FIELD(int, iReloadAmmoAdd),
+		WEAPON_FIELD(int, iReloadStartAdd),
+		WEAPON_FIELD(int, ammoDropStockMin),
+		WEAPON_FIELD(int, ammoDropClipPercentMin),
+		WEAPON_FIELD(int, ammoDropClipPercentMax),
+		WEAPON_FIELD(int, iExplosionRadius),
+		WEAPON_FIELD(int, iExplosionRadiusMin),
+		WEAPON_FIELD(int, iExplosionInnerDamage),
+		WEAPON_FIELD(int, iExplosionOuterDamage),
+		WEAPON_FIELD(float, damageConeAngle),
+		WEAPON_FIELD(float, bulletExplDmgMult),
+		WEAPON_FIELD(float, bulletExplRadiusMult),
+		WEAPON_FIELD(int, iProjectileSpeed),
+		WEAPON_FIELD(int, iProjectileSpeedUp),
+		WEAPON_FIELD(int, iProjectileSpeedForward),
+		WEAPON_FIELD(int, iProjectileActivateDist),
+		WEAPON_FIELD(float, projLifetime),
+		WEAPON_FIELD(float, timeToAccelerate),
+		WEAPON_FIELD(float, projectileCurvature),
+		WEAPON_FIELD_STRING(projectileName),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_XMODEL, projectileModel),
+		WEAPON_FIELD(int, projExplosion),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_FX, projExplosionEffect),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_FX, projDudEffect),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, projExplosionSound),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, projDudSound),
+		WEAPON_FIELD(int, stickiness),
+		WEAPON_FIELD(float, lowAmmoWarningThreshold),
+		WEAPON_FIELD(float, ricochetChance),
+		WEAPON_FIELD(bool, riotShieldEnableDamage),
+		WEAPON_FIELD(int, riotShieldHealth),
+		WEAPON_FIELD(float, riotShieldDamageMult),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_FX, projTrailEffect),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_FX, projBeaconEffect),
+		WEAPON_FIELD(float, vProjectileColor[3]),
+		WEAPON_FIELD(int, guidedMissileType),
+		WEAPON_FIELD(float, maxSteeringAccel),
+		WEAPON_FIELD(int, projIgnitionDelay),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_FX, projIgnitionEffect),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, projIgnitionSound),
+		WEAPON_FIELD(float, fAdsAimPitch),
+		WEAPON_FIELD(float, fAdsCrosshairInFrac),
+		WEAPON_FIELD(float, fAdsCrosshairOutFrac),
+		WEAPON_FIELD(bool, adsShouldShowCrosshair),
+		WEAPON_FIELD(int, adsGunKickReducedKickBullets),
+		WEAPON_FIELD(float, adsGunKickReducedKickPercent),
+		WEAPON_FIELD(float, fAdsGunKickPitchMin),
+		WEAPON_FIELD(float, fAdsGunKickPitchMax),
+		WEAPON_FIELD(float, fAdsGunKickYawMin),
+		WEAPON_FIELD(float, fAdsGunKickYawMax),
+		WEAPON_FIELD(float, fAdsGunKickMagMin),
+		WEAPON_FIELD(float, fAdsGunKickAccel),
+		WEAPON_FIELD(float, fAdsGunKickSpeedMax),
+		WEAPON_FIELD(float, fAdsGunKickSpeedDecay),
+		WEAPON_FIELD(float, fAdsGunKickStaticDecay),
+		WEAPON_FIELD(float, fAdsViewKickPitchMin),
+		WEAPON_FIELD(float, fAdsViewKickPitchMax),
+		WEAPON_FIELD(float, fAdsViewKickYawMin),
+		WEAPON_FIELD(float, fAdsViewKickYawMax),
+		WEAPON_FIELD(float, fAdsViewScatterMin),
+		WEAPON_FIELD(float, fAdsViewScatterMax),
+		WEAPON_FIELD(float, fAdsSpread),
+		WEAPON_FIELD(int, hipGunKickReducedKickBullets),
+		WEAPON_FIELD(float, hipGunKickReducedKickPercent),
+		WEAPON_FIELD(float, fHipGunKickPitchMin),
+		WEAPON_FIELD(float, fHipGunKickPitchMax),
+		WEAPON_FIELD(float, fHipGunKickYawMin),
+		WEAPON_FIELD(float, fHipGunKickYawMax),
+		WEAPON_FIELD(float, fHipGunKickMagMin),
+		WEAPON_FIELD(float, fHipGunKickAccel),
+		WEAPON_FIELD(float, fHipGunKickSpeedMax),
+		WEAPON_FIELD(float, fHipGunKickSpeedDecay),
+		WEAPON_FIELD(float, fHipGunKickStaticDecay),
+		WEAPON_FIELD(float, fHipViewKickPitchMin),
+		WEAPON_FIELD(float, fHipViewKickPitchMax),
+		WEAPON_FIELD(float, fHipViewKickYawMin),
+		WEAPON_FIELD(float, fHipViewKickYawMax),
+		WEAPON_FIELD(float, fHipViewKickMagMin),
+		WEAPON_FIELD(float, fHipViewScatterMin),
+		WEAPON_FIELD(float, fHipViewScatterMax),
+		WEAPON_FIELD(float, fightDist),
+		WEAPON_FIELD(float, maxDist),
+		WEAPON_FIELD(int, iPositionReloadTransTime),
+		WEAPON_FIELD(float, leftArc),
+		WEAPON_FIELD(float, rightArc),
+		WEAPON_FIELD(float, topArc),
+		WEAPON_FIELD(float, bottomArc),
+		WEAPON_FIELD(float, accuracy),
+		WEAPON_FIELD(float, aiSpread),
+		WEAPON_FIELD(float, playerSpread),
+		WEAPON_FIELD(float, minTurnSpeed[2]),
+		WEAPON_FIELD(float, maxTurnSpeed[2]),
+		WEAPON_FIELD(float, pitchConvergenceTime),
+		WEAPON_FIELD(float, yawConvergenceTime),
+		WEAPON_FIELD(float, suppressTime),
+		WEAPON_FIELD(float, maxRange),
+		WEAPON_FIELD(float, fAnimHorRotateInc),
+		WEAPON_FIELD(float, fPlayerPositionDist),
+		WEAPON_FIELD_STRING(szUseHintString),
+		WEAPON_FIELD_STRING(dropHintString),
+		WEAPON_FIELD(int, iUseHintStringIndex),
+		WEAPON_FIELD(int, dropHintStringIndex),
+		WEAPON_FIELD(float, horizViewJitter),
+		WEAPON_FIELD(float, vertViewJitter),
+		WEAPON_FIELD(float, scanSpeed),
+		WEAPON_FIELD(float, scanAccel),
+		WEAPON_FIELD(int, scanPauseTime),
+		WEAPON_FIELD_STRING(szScript),
+		WEAPON_FIELD_ARR(float, fOOPosAnimLength, 2),
+		WEAPON_FIELD(int, minDamage),
+		WEAPON_FIELD(int, minPlayerDamage),
+		WEAPON_FIELD(float, fMaxDamageRange),
+		WEAPON_FIELD(float, fMinDamageRange),
+		WEAPON_FIELD(float, destabilizationRateTime),
+		WEAPON_FIELD(float, destabilizationCurvatureMax),
+		WEAPON_FIELD(int, destabilizeDistance),
+		WEAPON_FIELD_ARR(float, locationDamageMultipliers, 22),
+		WEAPON_FIELD_STRING(fireRumble),
+		WEAPON_FIELD_STRING(meleeImpactRumble),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_TRACER, tracerType),
+		WEAPON_FIELD(bool, turretADSEnabled),
+		WEAPON_FIELD(float, turretADSTime),
+		WEAPON_FIELD(float, turretFov),
+		WEAPON_FIELD(float, turretFovADS),
+		WEAPON_FIELD(float, turretScopeZoomRate),
+		WEAPON_FIELD(float, turretScopeZoomMin),
+		WEAPON_FIELD(float, turretScopeZoomMax),
+		WEAPON_FIELD(float, turretOverheatUpRate),
+		WEAPON_FIELD(float, turretOverheatDownRate),
+		WEAPON_FIELD(float, turretOverheatPenalty),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, turretOverheatSound),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_FX, turretOverheatEffect),
+		WEAPON_FIELD_STRING(turretBarrelSpinRumble),
+		WEAPON_FIELD(float, turretBarrelSpinSpeed),
+		WEAPON_FIELD(float, turretBarrelSpinUpTime),
+		WEAPON_FIELD(float, turretBarrelSpinDownTime),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, turretBarrelSpinMaxSnd),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, missileConeSoundAlias),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, missileConeSoundAliasAtBase),
+		WEAPON_FIELD(float, missileConeSoundRadiusAtTop),
+		WEAPON_FIELD(float, missileConeSoundRadiusAtBase),
+		WEAPON_FIELD(float, missileConeSoundHeight),
+		WEAPON_FIELD(float, missileConeSoundOriginOffset),
+		WEAPON_FIELD(float, missileConeSoundVolumescaleAtCore),
+		WEAPON_FIELD(float, missileConeSoundVolumescaleAtEdge),
+		WEAPON_FIELD(float, missileConeSoundVolumescaleCoreSize),
+		WEAPON_FIELD(float, missileConeSoundPitchAtTop),
+		WEAPON_FIELD(float, missileConeSoundPitchAtBottom),
+		WEAPON_FIELD(float, missileConeSoundPitchTopSize),
+		WEAPON_FIELD(float, missileConeSoundPitchBottomSize),
+		WEAPON_FIELD(float, missileConeSoundCrossfadeTopSize),
+		WEAPON_FIELD(float, missileConeSoundCrossfadeBottomSize),
+
+		WEAPON_FIELD(bool, knifeAlwaysAttached),
+		WEAPON_FIELD(bool, meleeOverrideValues),
+		WEAPON_FIELD(float, aim_automelee_lerp),
+		WEAPON_FIELD(float, aim_automelee_range),
+		WEAPON_FIELD(float, aim_automelee_region_height),
+		WEAPON_FIELD(float, aim_automelee_region_width),
+		WEAPON_FIELD(float, player_meleeHeight),
+		WEAPON_FIELD(float, player_meleeRange),
+		WEAPON_FIELD(float, player_meleeWidth),
+		WEAPON_FIELD(bool, sharedAmmo),
+		WEAPON_FIELD(bool, lockonSupported),
+		WEAPON_FIELD(bool, requireLockonToFire),
+		WEAPON_FIELD(bool, isAirburstWeapon),
+		WEAPON_FIELD(bool, bigExplosion),
+		WEAPON_FIELD(bool, noAdsWhenMagEmpty),
+		WEAPON_FIELD(bool, avoidDropCleanup),
+		WEAPON_FIELD(bool, inheritsPerks),
+		WEAPON_FIELD(bool, crosshairColorChange),
+		WEAPON_FIELD(bool, bRifleBullet),
+		WEAPON_FIELD(bool, armorPiercing),
+		WEAPON_FIELD(bool, bBoltAction),
+		WEAPON_FIELD(bool, aimDownSight),
+		WEAPON_FIELD(bool, canHoldBreath),
+		WEAPON_FIELD(bool, canVariableZoom),
+		WEAPON_FIELD(bool, bRechamberWhileAds),
+		WEAPON_FIELD(bool, bBulletExplosiveDamage),
+		WEAPON_FIELD(bool, bCookOffHold),
+		WEAPON_FIELD(bool, reticleSpin45),
+		WEAPON_FIELD(bool, bClipOnly),
+		WEAPON_FIELD(bool, noAmmoPickup),
+		WEAPON_FIELD(bool, adsFireOnly),
+		WEAPON_FIELD(bool, cancelAutoHolsterWhenEmpty),
+		WEAPON_FIELD(bool, disableSwitchToWhenEmpty),
+		WEAPON_FIELD(bool, suppressAmmoReserveDisplay),
+		WEAPON_FIELD(bool, laserSightDuringNightvision),
+		WEAPON_FIELD(bool, markableViewmodel),
+		WEAPON_FIELD(bool, noDualWield),
+		WEAPON_FIELD(bool, flipKillIcon),
+		WEAPON_FIELD(bool, bNoPartialReload),
+		WEAPON_FIELD(bool, bSegmentedReload),
+		WEAPON_FIELD(bool, bMultipleReload),
+		WEAPON_FIELD(bool, blocksProne),
+		WEAPON_FIELD(bool, silenced),
+		WEAPON_FIELD(bool, isRollingGrenade),
+		WEAPON_FIELD(bool, projExplosionEffectForceNormalUp),
+		WEAPON_FIELD(bool, projExplosionEffectInheritParentDirection),
+		WEAPON_FIELD(bool, bProjImpactExplode),
+		WEAPON_FIELD(bool, bProjTrajectoryEvents),
+		WEAPON_FIELD(bool, bProjWhizByEnabled),
+		WEAPON_FIELD(bool, stickToPlayers),
+		WEAPON_FIELD(bool, stickToVehicles),
+		WEAPON_FIELD(bool, stickToTurrets),
+		WEAPON_FIELD(bool, thrownSideways),
+		WEAPON_FIELD(bool, hasDetonator),
+		WEAPON_FIELD(bool, disableFiring),
+		WEAPON_FIELD(bool, timedDetonation),
+		WEAPON_FIELD(bool, rotate),
+		WEAPON_FIELD(bool, holdButtonToThrow),
+		WEAPON_FIELD(bool, freezeMovementWhenFiring),
+		WEAPON_FIELD(bool, thermalScope),
+		WEAPON_FIELD(bool, thermalToggle),
+		WEAPON_FIELD(bool, outlineEnemies),
+		WEAPON_FIELD(bool, altModeSameWeapon),
+		WEAPON_FIELD(bool, turretBarrelSpinEnabled),
+		WEAPON_FIELD(bool, missileConeSoundEnabled),
+		WEAPON_FIELD(bool, missileConeSoundPitchshiftEnabled),
+		WEAPON_FIELD(bool, missileConeSoundCrossfadeEnabled),
+		WEAPON_FIELD(bool, offhandHoldIsCancelable),
+		WEAPON_FIELD(bool, doNotAllowAttachmentsToOverrideSpread),
+		WEAPON_FIELD(bool, useFastReloadAnims),
+		WEAPON_FIELD(bool, useScopeDrift),
+		WEAPON_FIELD(bool, alwaysShatterGlassOnImpact),
+		WEAPON_FIELD(bool, oldWeapon),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_XMODEL, stowOffsetModel),
+
+		WEAPON_FIELD_ASSET_ARR(ASSET_TYPE_XMODEL, gunXModel, 64),
+		WEAPON_FIELD_ASSET_ARR(ASSET_TYPE_XMODEL, worldModel, 64),
+		WEAPON_FIELD_ASSET_ARR(ASSET_TYPE_MATERIAL, camoMaterialTarget, 63),
+
+		WEAPON_FIELD_ASSET_ARR(ASSET_TYPE_SOUND, bounceSound, 31),
+		WEAPON_FIELD_ASSET_ARR(ASSET_TYPE_SOUND, rollingSound, 31),
+
+		//WEAPON_FIELD_ASSET(ASSET_TYPE_PHYSCOLLMAP, physCollmap),
+		//WEAPON_FIELD_ARR(float, parallelBounce, 0),
+		//WEAPON_FIELD_ARR(float, perpendicularBounce, 0),
+		//WEAPON_FIELD_STRING(accuracyGraphName[2]),
+		//WEAPON_FIELD(float, originalAccuracyGraphKnots),
+		//WEAPON_FIELD(short, originalAccuracyGraphKnotCount),
+	});
+
+	// the "sounds" object of "weapDef"
+	constexpr auto weapon_sound_fields = json_fields::make_field_table<WeaponDef>(
+	{
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, pickupSound),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, pickupSoundPlayer),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, ammoPickupSound),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, ammoPickupSoundPlayer),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, projectileSound),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, pullbackSound),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, pullbackSoundPlayer),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, fireSound),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, fireSoundPlayer),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, fireSoundPlayerAkimbo),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, fireLoopSound),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, fireLoopSoundPlayer),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, fireStopSound),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, fireStopSoundPlayer),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, fireLastSound),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, fireLastSoundPlayer),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, emptyFireSound),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, emptyFireSoundPlayer),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, meleeSwipeSound),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, meleeSwipeSoundPlayer),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, meleeHitSound),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, meleeMissSound),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, rechamberSound),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, rechamberSoundPlayer),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, reloadSound),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, reloadSoundPlayer),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, reloadEmptySound),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, reloadEmptySoundPlayer),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, reloadStartSound),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, reloadStartSoundPlayer),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, reloadEndSound),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, reloadEndSoundPlayer),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, detonateSound),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, detonateSoundPlayer),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, nightVisionWearSound),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, nightVisionWearSoundPlayer),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, nightVisionRemoveSound),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, nightVisionRemoveSoundPlayer),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, altSwitchSound),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, altSwitchSoundPlayer),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, raiseSound),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, raiseSoundPlayer),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, firstRaiseSound),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, firstRaiseSoundPlayer),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, putawaySound),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, putawaySoundPlayer),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, scanSound),
+		WEAPON_FIELD_ASSET(ASSET_TYPE_SOUND, changeVariableZoomSound)
+	});
+
+	constexpr auto complete_fields = json_fields::make_field_table<WeaponCompleteDef>(
+	{
+		JSON_FIELD_STRING(WeaponCompleteDef, szInternalName),
+		JSON_FIELD_STRING(WeaponCompleteDef, szDisplayName),
+		JSON_FIELD(WeaponCompleteDef, unsigned int, numAnimOverrides),
+		JSON_FIELD(WeaponCompleteDef, unsigned int, numSoundOverrides),
+		JSON_FIELD(WeaponCompleteDef, unsigned int, numFXOverrides),
+		JSON_FIELD(WeaponCompleteDef, unsigned int, numReloadStateTimerOverrides),
+		JSON_FIELD(WeaponCompleteDef, unsigned int, numNotetrackOverrides),
+		JSON_FIELD(WeaponCompleteDef, float, fAdsZoomFov),
+		JSON_FIELD(WeaponCompleteDef, int, iAdsTransInTime),
+		JSON_FIELD(WeaponCompleteDef, int, iAdsTransOutTime),
+		JSON_FIELD(WeaponCompleteDef, int, iClipSize),
+		JSON_FIELD(WeaponCompleteDef, int, impactType),
+		JSON_FIELD(WeaponCompleteDef, int, iFireTime),
+		JSON_FIELD(WeaponCompleteDef, int, iFireTimeAkimbo),
+		JSON_FIELD(WeaponCompleteDef, int, dpadIconRatio),
+		JSON_FIELD(WeaponCompleteDef, float, penetrateMultiplier),
+		JSON_FIELD(WeaponCompleteDef, float, fAdsViewKickCenterSpeed),
+		JSON_FIELD(WeaponCompleteDef, float, fHipViewKickCenterSpeed),
+		JSON_FIELD_STRING(WeaponCompleteDef, szAltWeaponName),
+		JSON_FIELD(WeaponCompleteDef, int, altWeapon),
+		JSON_FIELD(WeaponCompleteDef, int, iAltRaiseTime),
+		JSON_FIELD(WeaponCompleteDef, int, iAltRaiseTimeAkimbo),
+		JSON_FIELD_ASSET_HEADER(WeaponCompleteDef, killIcon, db_find_x_asset_data<ASSET_TYPE_MATERIAL>),
+		JSON_FIELD_ASSET_HEADER(WeaponCompleteDef, dpadIcon, db_find_x_asset_data<ASSET_TYPE_MATERIAL>),
+		JSON_FIELD(WeaponCompleteDef, int, fireAnimLength),
+		JSON_FIELD(WeaponCompleteDef, int, fireAnimLengthAkimbo),
+		JSON_FIELD(WeaponCompleteDef, int, iFirstRaiseTime),
+		JSON_FIELD(WeaponCompleteDef, int, iFirstRaiseTimeAkimbo),
+		JSON_FIELD(WeaponCompleteDef, int, ammoDropStockMax),
+		JSON_FIELD(WeaponCompleteDef, float, adsDofStart),
+		JSON_FIELD(WeaponCompleteDef, float, adsDofEnd),
+		JSON_FIELD_ARR(WeaponCompleteDef, unsigned __int16, accuracyGraphKnotCount, 2),
+		JSON_FIELD(WeaponCompleteDef, bool, motionTracker),
+		JSON_FIELD(WeaponCompleteDef, bool, enhanced),
+		JSON_FIELD(WeaponCompleteDef, bool, dpadIconShowsAmmo),
+		JSON_FIELD_STRING(WeaponCompleteDef, szAdsrBaseSetting),
+
+		JSON_FIELD_ASSET_HEADER_ARR(WeaponCompleteDef, scopes, 6, db_find_x_asset_data<ASSET_TYPE_ATTACHMENT>),
+		JSON_FIELD_ASSET_HEADER_ARR(WeaponCompleteDef, underBarrels, 3, db_find_x_asset_data<ASSET_TYPE_ATTACHMENT>),
+		JSON_FIELD_ASSET_HEADER_ARR(WeaponCompleteDef, others, 8, db_find_x_asset_data<ASSET_TYPE_ATTACHMENT>)
+	});
+
+	template <typename T>
+	T* parse_asset_header(const XAssetType type, const json& value)
+	{
+		const auto name = value.is_string() ? value.get<std::string>() : ""s;
+		if (name.empty())
+		{
+			return nullptr;
+		}
 
-#define WEAPON_READ_SOUND(__field__) \
-	if (!data["sounds"][#__field__].is_null() && data["sounds"][#__field__].is_string()) \
-	{ \
-		auto asset##__field__ = data["sounds"][#__field__].get<std::string>(); \
-		if (asset##__field__.empty()) \
-		{ \
-			weapon->__field__ = nullptr; \
-		} \
-		else \
-		{ \
-			weapon->__field__ = db_find_x_asset_header(XAssetType::ASSET_TYPE_SOUND, asset##__field__.data(), 1).sound; \
-		} \
-	} \
-	else \
-	{ \
-		weapon->__field__ = nullptr; \
+		return reinterpret_cast<T*>(db_find_x_asset_header(type, name.data(), 1).data);
 	}
 
-	void parse_overlay(ADSOverlay* weapon, json& data)
+	void parse_anims(XAnimParts**& anims, const json& data, zone_memory* mem)
 	{
-		WEAPON_READ_ASSET(ASSET_TYPE_MATERIAL, material, shader);
-		WEAPON_READ_ASSET(ASSET_TYPE_MATERIAL, material, shaderLowRes);
-		WEAPON_READ_ASSET(ASSET_TYPE_MATERIAL, material, shaderEMP);
-		WEAPON_READ_ASSET(ASSET_TYPE_MATERIAL, material, shaderEMPLowRes);
-		WEAPON_READ_FIELD(int, reticle);
-		WEAPON_READ_FIELD(float, width);
-		WEAPON_READ_FIELD(float, height);
-		WEAPON_READ_FIELD(float, widthSplitscreen);
-		WEAPON_READ_FIELD(float, heightSplitscreen);
+		if (data.is_null())
+		{
+			anims = nullptr;
+			return;
+		}
+
+		anims = mem->allocate<XAnimParts*>(NUM_WEAP_ANIMS);
+		for (auto i = 0; i < NUM_WEAP_ANIMS; i++)
+		{
+			anims[i] = parse_asset_header<XAnimParts>(ASSET_TYPE_XANIMPARTS, json_fields::get(data, get_anim_name_from_index(i)));
+		}
 	}
 
-	void parse_accuracy_graph(WeaponDef* def, json& data, zone_memory* mem)
+	void parse_overlay(ADSOverlay* weapon, const json& data, zone_memory* mem)
 	{
-		
+		overlay_fields.read(weapon, data, mem);
 	}
 
-	void parse_statetimers(StateTimers* weapon, json& data)
+	void parse_statetimers(StateTimers* weapon, const json& data, zone_memory* mem)
 	{
-		WEAPON_READ_FIELD(int, iFireDelay);
-		WEAPON_READ_FIELD(int, iMeleeDelay);
-		WEAPON_READ_FIELD(int, meleeChargeDelay);
-		WEAPON_READ_FIELD(int, iDetonateDelay);
-		WEAPON_READ_FIELD(int, iRechamberTime);
-		WEAPON_READ_FIELD(int, rechamberTimeOneHanded);
-		WEAPON_READ_FIELD(int, iRechamberBoltTime);
-		WEAPON_READ_FIELD(int, iHoldFireTime);
-		WEAPON_READ_FIELD(int, iHoldPrimeTime);
-		WEAPON_READ_FIELD(int, iDetonateTime);
-		WEAPON_READ_FIELD(int, iMeleeTime);
-		WEAPON_READ_FIELD(int, meleeChargeTime);
-		WEAPON_READ_FIELD(int, iReloadTime);
-		WEAPON_READ_FIELD(int, reloadShowRocketTime);
-		WEAPON_READ_FIELD(int, iReloadEmptyTime);
-		WEAPON_READ_FIELD(int, iReloadAddTime);
-		WEAPON_READ_FIELD(int, iReloadEmptyAddTime);
-		WEAPON_READ_FIELD(int, iReloadStartTime);
-		WEAPON_READ_FIELD(int, iReloadStartAddTime);
-		WEAPON_READ_FIELD(int, iReloadEndTime);
-		WEAPON_READ_FIELD(int, iDropTime);
-		WEAPON_READ_FIELD(int, iRaiseTime);
-		WEAPON_READ_FIELD(int, iAltDropTime);
-		WEAPON_READ_FIELD(int, quickDropTime);
-		WEAPON_READ_FIELD(int, quickRaiseTime);
-		WEAPON_READ_FIELD(int, iBreachRaiseTime);
-		WEAPON_READ_FIELD(int, iEmptyRaiseTime);
-		WEAPON_READ_FIELD(int, iEmptyDropTime);
-		WEAPON_READ_FIELD(int, sprintInTime);
-		WEAPON_READ_FIELD(int, sprintLoopTime);
-		WEAPON_READ_FIELD(int, sprintOutTime);
-		WEAPON_READ_FIELD(int, stunnedTimeBegin);
-		WEAPON_READ_FIELD(int, stunnedTimeLoop);
-		WEAPON_READ_FIELD(int, stunnedTimeEnd);
-		WEAPON_READ_FIELD(int, nightVisionWearTime);
-		WEAPON_READ_FIELD(int, nightVisionWearTimeFadeOutEnd);
-		WEAPON_READ_FIELD(int, nightVisionWearTimePowerUp);
-		WEAPON_READ_FIELD(int, nightVisionRemoveTime);
-		WEAPON_READ_FIELD(int, nightVisionRemoveTimePowerDown);
-		WEAPON_READ_FIELD(int, nightVisionRemoveTimeFadeInStart);
-		WEAPON_READ_FIELD(int, fuseTime);
-		WEAPON_READ_FIELD(int, aiFuseTime);
-		WEAPON_READ_FIELD(bool, bHoldFullPrime);
-		WEAPON_READ_FIELD(int, blastFrontTime);
-		WEAPON_READ_FIELD(int, blastRightTime);
-		WEAPON_READ_FIELD(int, blastBackTime);
-		WEAPON_READ_FIELD(int, blastLeftTime);
-		WEAPON_READ_FIELD(int, slideInTime);
-		WEAPON_READ_FIELD(int, slideLoopTime);
-		WEAPON_READ_FIELD(int, slideOutTime);
+		state_timer_fields.read(weapon, data, mem);
 	}
 
-	WeaponDef* weapon_def::parse_weapondef(json& data, WeaponCompleteDef* baseAsset, zone_memory* mem)
+	WeaponDef* weapon_def::parse_weapondef(const json& data, WeaponCompleteDef* baseAsset, zone_memory* mem)
 	{
 		auto weapon = mem->allocate<WeaponDef>();
 
@@ -360,391 +782,23 @@ namespace zonetool::iw6
 			memcpy(weapon, baseAsset->weapDef, sizeof WeaponDef);
 		}
 
-		WEAPON_READ_STRING(szOverlayName);
-		WEAPON_READ_ASSET(ASSET_TYPE_XMODEL, model, handXModel);
-		WEAPON_READ_ASSET(ASSET_TYPE_XMODEL, model, camoWorldModel);
-		WEAPON_READ_ASSET(ASSET_TYPE_XMODEL, model, camoViewModel);
-		WEAPON_READ_ASSET(ASSET_TYPE_MATERIAL, material, camoWorldModelMaterialOverride);
-		WEAPON_READ_ASSET(ASSET_TYPE_MATERIAL, material, camoViewModelMaterialOverride);
-		WEAPON_READ_STRING(szModeName);
-		WEAPON_READ_FIELD(int, playerAnimType);
-		WEAPON_READ_FIELD(int, weapType);
-		WEAPON_READ_FIELD(int, weapClass);
-		WEAPON_READ_FIELD(int, penetrateType);
-		WEAPON_READ_FIELD(int, inventoryType);
-		WEAPON_READ_FIELD(int, fireType);
-		WEAPON_READ_FIELD(float, burstFireCooldown);
-		WEAPON_READ_FIELD(int, offhandClass);
-		WEAPON_READ_FIELD(int, stance);
-		WEAPON_READ_FIELD(short, rattleSoundType);
-		WEAPON_READ_ASSET(ASSET_TYPE_FX, fx, viewFlashEffect);
-		WEAPON_READ_ASSET(ASSET_TYPE_FX, fx, worldFlashEffect);
-		WEAPON_READ_ASSET(ASSET_TYPE_FX, fx, viewFlashADSEffect);
-		WEAPON_READ_ASSET(ASSET_TYPE_FX, fx, viewShellEjectEffect);
-		WEAPON_READ_ASSET(ASSET_TYPE_FX, fx, worldShellEjectEffect);
-		WEAPON_READ_ASSET(ASSET_TYPE_FX, fx, viewLastShotEjectEffect);
-		WEAPON_READ_ASSET(ASSET_TYPE_FX, fx, worldLastShotEjectEffect);
-		WEAPON_READ_ASSET(ASSET_TYPE_MATERIAL, material, reticleCenter);
-		WEAPON_READ_ASSET(ASSET_TYPE_MATERIAL, material, reticleSide);
-		WEAPON_READ_FIELD(int, iReticleCenterSize);
-		WEAPON_READ_FIELD(int, iReticleSideSize);
-		WEAPON_READ_FIELD(int, iReticleMinOfs);
-		WEAPON_READ_FIELD(int, activeReticleType);
-		WEAPON_READ_FIELD_ARR(float, vStandMove, 3);
-		WEAPON_READ_FIELD_ARR(float, vStandRot, 3);
-		WEAPON_READ_FIELD_ARR(float, strafeMove, 3);
-		WEAPON_READ_FIELD_ARR(float, strafeRot, 3);
-		WEAPON_READ_FIELD_ARR(float, vDuckedOfs, 3);
-		WEAPON_READ_FIELD_ARR(float, vDuckedMove, 3);
-		WEAPON_READ_FIELD_ARR(float, vDuckedRot, 3);
-		WEAPON_READ_FIELD_ARR(float, vProneOfs, 3);
-		WEAPON_READ_FIELD_ARR(float, vProneMove, 3);
-		WEAPON_READ_FIELD_ARR(float, vProneRot, 3);
-		WEAPON_READ_FIELD(float, fPosMoveRate);
-		WEAPON_READ_FIELD(float, fPosProneMoveRate);
-		WEAPON_READ_FIELD(float, fStandMoveMinSpeed);
-		WEAPON_READ_FIELD(float, fDuckedMoveMinSpeed);
-		WEAPON_READ_FIELD(float, fProneMoveMinSpeed);
-		WEAPON_READ_FIELD(float, fPosRotRate);
-		WEAPON_READ_FIELD(float, fPosProneRotRate);
-		WEAPON_READ_FIELD(float, fStandRotMinSpeed);
-		WEAPON_READ_FIELD(float, fDuckedRotMinSpeed);
-		WEAPON_READ_FIELD(float, fProneRotMinSpeed);
-		WEAPON_READ_ASSET(ASSET_TYPE_XMODEL, model, worldClipModel);
-		WEAPON_READ_ASSET(ASSET_TYPE_XMODEL, model, rocketModel);
-		WEAPON_READ_ASSET(ASSET_TYPE_XMODEL, model, knifeModel);
-		WEAPON_READ_ASSET(ASSET_TYPE_XMODEL, model, worldKnifeModel);
-		WEAPON_READ_ASSET(ASSET_TYPE_MATERIAL, material, hudIcon);
-		WEAPON_READ_FIELD(int, hudIconRatio);
-		WEAPON_READ_ASSET(ASSET_TYPE_MATERIAL, material, pickupIcon);
-		WEAPON_READ_FIELD(int, pickupIconRatio);
-		WEAPON_READ_ASSET(ASSET_TYPE_MATERIAL, material, ammoCounterIcon);
-		WEAPON_READ_FIELD(int, ammoCounterIconRatio);
-		WEAPON_READ_FIELD(int, ammoCounterClip);
-		WEAPON_READ_FIELD(int, iStartAmmo);
-		WEAPON_READ_STRING(szAmmoName);
-		WEAPON_READ_FIELD(int, iAmmoIndex);
-		WEAPON_READ_STRING(szClipName);
-		WEAPON_READ_FIELD(int, iClipIndex);
-		WEAPON_READ_FIELD(int, iMaxAmmo);
-		WEAPON_READ_FIELD(int, shotCount);
-		WEAPON_READ_STRING(szSharedAmmoCapName);
-		WEAPON_READ_FIELD(int, iSharedAmmoCapIndex);
-		WEAPON_READ_FIELD(int, iSharedAmmoCap);
-		WEAPON_READ_FIELD(int, damage);
-		WEAPON_READ_FIELD(int, playerDamage);
-		WEAPON_READ_FIELD(int, iMeleeDamage);
-		WEAPON_READ_FIELD(int, iDamageType);
-		parse_statetimers(&weapon->stateTimers, data["stateTimers"]);
-		parse_statetimers(&weapon->akimboStateTimers, data["akimboStateTimers"]);
-		WEAPON_READ_FIELD(float, autoAimRange);
-		WEAPON_READ_FIELD(float, aimAssistRange);
-		WEAPON_READ_FIELD(float, aimAssistRangeAds);
-		WEAPON_READ_FIELD(float, aimPadding);
-		WEAPON_READ_FIELD(float, enemyCrosshairRange);
-		WEAPON_READ_FIELD(float, moveSpeedScale);
-		WEAPON_READ_FIELD(float, adsMoveSpeedScale);
-		WEAPON_READ_FIELD(float, sprintDurationScale);
-		WEAPON_READ_FIELD(float, fAdsZoomInFrac);
-		WEAPON_READ_FIELD(float, fAdsZoomOutFrac);
-		parse_overlay(&weapon->overlay, data["overlay"]);
-		WEAPON_READ_FIELD(int, overlayInterface);
-		WEAPON_READ_FIELD(float, fAdsBobFactor);
-		WEAPON_READ_FIELD(float, fAdsViewBobMult);
-		WEAPON_READ_FIELD(float, fHipSpreadStandMin);
-		WEAPON_READ_FIELD(float, fHipSpreadDuckedMin);
-		WEAPON_READ_FIELD(float, fHipSpreadProneMin);
-		WEAPON_READ_FIELD(float, hipSpreadStandMax);
-		WEAPON_READ_FIELD(float, hipSpreadDuckedMax);
-		WEAPON_READ_FIELD(float, hipSpreadProneMax);
-		WEAPON_READ_FIELD(float, fHipSpreadDecayRate);
-		WEAPON_READ_FIELD(float, fHipSpreadFireAdd);
-		WEAPON_READ_FIELD(float, fHipSpreadTurnAdd);
-		WEAPON_READ_FIELD(float, fHipSpreadMoveAdd);
-		WEAPON_READ_FIELD(float, fHipSpreadDuckedDecay);
-		WEAPON_READ_FIELD(float, fHipSpreadProneDecay);
-		WEAPON_READ_FIELD(float, fHipReticleSidePos);
-		WEAPON_READ_FIELD(float, fAdsIdleAmount);
-		WEAPON_READ_FIELD(float, fHipIdleAmount);
-		WEAPON_READ_FIELD(float, adsIdleSpeed);
-		WEAPON_READ_FIELD(float, hipIdleSpeed);
-		WEAPON_READ_FIELD(float, fIdleCrouchFactor);
-		WEAPON_READ_FIELD(float, fIdleProneFactor);
-		WEAPON_READ_FIELD(float, fGunMaxPitch);
-		WEAPON_READ_FIELD(float, fGunMaxYaw);
-		WEAPON_READ_FIELD(float, adsIdleLerpStartTime);
-		WEAPON_READ_FIELD(float, adsIdleLerpTime);
-		WEAPON_READ_FIELD(float, swayMaxAngleSteadyAim);
-		WEAPON_READ_FIELD(float, swayMaxAngle);
-		WEAPON_READ_FIELD(float, swayLerpSpeed);
-		WEAPON_READ_FIELD(float, swayPitchScale);
-		WEAPON_READ_FIELD(float, swayYawScale);
-		WEAPON_READ_FIELD(float, swayHorizScale);
-		WEAPON_READ_FIELD(float, swayVertScale);
-		WEAPON_READ_FIELD(float, swayShellShockScale);
-		WEAPON_READ_FIELD(float, adsSwayMaxAngle);
-		WEAPON_READ_FIELD(float, adsSwayLerpSpeed);
-		WEAPON_READ_FIELD(float, adsSwayPitchScale);
-		WEAPON_READ_FIELD(float, adsSwayYawScale);
-		WEAPON_READ_FIELD(float, adsSwayHorizScale);
-		WEAPON_READ_FIELD(float, adsSwayVertScale);
-		WEAPON_READ_FIELD(float, adsFireRateScale);
-		WEAPON_READ_FIELD(float, adsDamageRangeScale);
-		WEAPON_READ_FIELD(float, adsFireAnimFrac);
-		//WEAPON_READ_ASSET(ASSET_TYPE_PHYSCOLLMAP, phys_collmap, physCollmap);
-		WEAPON_READ_FIELD(float, dualWieldViewModelOffset);
-		WEAPON_READ_FIELD(float, fScopeDriftDelay);
-		WEAPON_READ_FIELD(float, fScopeDriftLerpInTime);
-		WEAPON_READ_FIELD(float, fScopeDriftSteadyTime);
-		WEAPON_READ_FIELD(float, fScopeDriftLerpOutTime);
-		WEAPON_READ_FIELD(float, fScopeDriftSteadyFactor);
-		WEAPON_READ_FIELD(float, fScopeDriftUnsteadyFactor);
-		WEAPON_READ_FIELD(int, killIconRatio);
-		WEAPON_READ_FIELD(int, iReloadAmmoAdd);
-		WEAPON_READ_FIELD(int, iReloadStartAdd);
-		WEAPON_READ_FIELD(int, ammoDropStockMin);
-		WEAPON_READ_FIELD(int, ammoDropClipPercentMin);
-		WEAPON_READ_FIELD(int, ammoDropClipPercentMax);
-		WEAPON_READ_FIELD(int, iExplosionRadius);
-		WEAPON_READ_FIELD(int, iExplosionRadiusMin);
-		WEAPON_READ_FIELD(int, iExplosionInnerDamage);
-		WEAPON_READ_FIELD(int, iExplosionOuterDamage);
-		WEAPON_READ_FIELD(float, damageConeAngle);
-		WEAPON_READ_FIELD(float, bulletExplDmgMult);
-		WEAPON_READ_FIELD(float, bulletExplRadiusMult);
-		WEAPON_READ_FIELD(int, iProjectileSpeed);
-		WEAPON_READ_FIELD(int, iProjectileSpeedUp);
-		WEAPON_READ_FIELD(int, iProjectileSpeedForward);
-		WEAPON_READ_FIELD(int, iProjectileActivateDist);
-		WEAPON_READ_FIELD(float, projLifetime);
-		WEAPON_READ_FIELD(float, timeToAccelerate);
-		WEAPON_READ_FIELD(float, projectileCurvature);
-		WEAPON_READ_STRING(projectileName);
-		WEAPON_READ_ASSET(ASSET_TYPE_XMODEL, model, projectileModel);
-		WEAPON_READ_FIELD(int, projExplosion);
-		WEAPON_READ_ASSET(ASSET_TYPE_FX, fx, projExplosionEffect);
-		WEAPON_READ_ASSET(ASSET_TYPE_FX, fx, projDudEffect);
-		WEAPON_READ_ASSET(ASSET_TYPE_SOUND, sound, projExplosionSound);
-		WEAPON_READ_ASSET(ASSET_TYPE_SOUND, sound, projDudSound);
-		WEAPON_READ_FIELD(int, stickiness);
-		WEAPON_READ_FIELD(float, lowAmmoWarningThreshold);
-		WEAPON_READ_FIELD(float, ricochetChance);
-		WEAPON_READ_FIELD(bool, riotShieldEnableDamage);
-		WEAPON_READ_FIELD(int, riotShieldHealth);
-		WEAPON_READ_FIELD(float, riotShieldDamageMult);
-		//WEAPON_READ_FIELD_ARR(float, parallelBounce, 0);
-		//WEAPON_READ_FIELD_ARR(float, perpendicularBounce, 0);
-		WEAPON_READ_ASSET(ASSET_TYPE_FX, fx, projTrailEffect);
-		WEAPON_READ_ASSET(ASSET_TYPE_FX, fx, projBeaconEffect);
-		WEAPON_READ_FIELD(float, vProjectileColor[3]);
-		WEAPON_READ_FIELD(int, guidedMissileType);
-		WEAPON_READ_FIELD(float, maxSteeringAccel);
-		WEAPON_READ_FIELD(int, projIgnitionDelay);
-		WEAPON_READ_ASSET(ASSET_TYPE_FX, fx, projIgnitionEffect);
-		WEAPON_READ_ASSET(ASSET_TYPE_SOUND, sound, projIgnitionSound);
-		WEAPON_READ_FIELD(float, fAdsAimPitch);
-		WEAPON_READ_FIELD(float, fAdsCrosshairInFrac);
-		WEAPON_READ_FIELD(float, fAdsCrosshairOutFrac);
-		WEAPON_READ_FIELD(bool, adsShouldShowCrosshair);
-		WEAPON_READ_FIELD(int, adsGunKickReducedKickBullets);
-		WEAPON_READ_FIELD(float, adsGunKickReducedKickPercent);
-		WEAPON_READ_FIELD(float, fAdsGunKickPitchMin);
-		WEAPON_READ_FIELD(float, fAdsGunKickPitchMax);
-		WEAPON_READ_FIELD(float, fAdsGunKickYawMin);
-		WEAPON_READ_FIELD(float, fAdsGunKickYawMax);
-		WEAPON_READ_FIELD(float, fAdsGunKickMagMin);
-		WEAPON_READ_FIELD(float, fAdsGunKickAccel);
-		WEAPON_READ_FIELD(float, fAdsGunKickSpeedMax);
-		WEAPON_READ_FIELD(float, fAdsGunKickSpeedDecay);
-		WEAPON_READ_FIELD(float, fAdsGunKickStaticDecay);
-		WEAPON_READ_FIELD(float, fAdsViewKickPitchMin);
-		WEAPON_READ_FIELD(float, fAdsViewKickPitchMax);
-		WEAPON_READ_FIELD(float, fAdsViewKickYawMin);
-		WEAPON_READ_FIELD(float, fAdsViewKickYawMax);
-		WEAPON_READ_FIELD(float, fAdsViewScatterMin);
-		WEAPON_READ_FIELD(float, fAdsViewScatterMax);
-		WEAPON_READ_FIELD(float, fAdsSpread);
-		WEAPON_READ_FIELD(int, hipGunKickReducedKickBullets);
-		WEAPON_READ_FIELD(float, hipGunKickReducedKickPercent);
-		WEAPON_READ_FIELD(float, fHipGunKickPitchMin);
-		WEAPON_READ_FIELD(float, fHipGunKickPitchMax);
-		WEAPON_READ_FIELD(float, fHipGunKickYawMin);
-		WEAPON_READ_FIELD(float, fHipGunKickYawMax);
-		WEAPON_READ_FIELD(float, fHipGunKickMagMin);
-		WEAPON_READ_FIELD(float, fHipGunKickAccel);
-		WEAPON_READ_FIELD(float, fHipGunKickSpeedMax);
-		WEAPON_READ_FIELD(float, fHipGunKickSpeedDecay);
-		WEAPON_READ_FIELD(float, fHipGunKickStaticDecay);
-		WEAPON_READ_FIELD(float, fHipViewKickPitchMin);
-		WEAPON_READ_FIELD(float, fHipViewKickPitchMax);
-		WEAPON_READ_FIELD(float, fHipViewKickYawMin);
-		WEAPON_READ_FIELD(float, fHipViewKickYawMax);
-		WEAPON_READ_FIELD(float, fHipViewKickMagMin);
-		WEAPON_READ_FIELD(float, fHipViewScatterMin);
-		WEAPON_READ_FIELD(float, fHipViewScatterMax);
-		WEAPON_READ_FIELD(float, fightDist);
-		WEAPON_READ_FIELD(float, maxDist);
-		//WEAPON_READ_STRING(accuracyGraphName[2]);
-		//WEAPON_READ_FIELD(float, originalAccuracyGraphKnots);
-		//WEAPON_READ_FIELD(short, originalAccuracyGraphKnotCount);
-		WEAPON_READ_FIELD(int, iPositionReloadTransTime);
-		WEAPON_READ_FIELD(float, leftArc);
-		WEAPON_READ_FIELD(float, rightArc);
-		WEAPON_READ_FIELD(float, topArc);
-		WEAPON_READ_FIELD(float, bottomArc);
-		WEAPON_READ_FIELD(float, accuracy);
-		WEAPON_READ_FIELD(float, aiSpread);
-		WEAPON_READ_FIELD(float, playerSpread);
-		WEAPON_READ_FIELD(float, minTurnSpeed[2]);
-		WEAPON_READ_FIELD(float, maxTurnSpeed[2]);
-		WEAPON_READ_FIELD(float, pitchConvergenceTime);
-		WEAPON_READ_FIELD(float, yawConvergenceTime);
-		WEAPON_READ_FIELD(float, suppressTime);
-		WEAPON_READ_FIELD(float, maxRange);
-		WEAPON_READ_FIELD(float, fAnimHorRotateInc);
-		WEAPON_READ_FIELD(float, fPlayerPositionDist);
-		WEAPON_READ_STRING(szUseHintString);
-		WEAPON_READ_STRING(dropHintString);
-		WEAPON_READ_FIELD(int, iUseHintStringIndex);
-		WEAPON_READ_FIELD(int, dropHintStringIndex);
-		WEAPON_READ_FIELD(float, horizViewJitter);
-		WEAPON_READ_FIELD(float, vertViewJitter);
-		WEAPON_READ_FIELD(float, scanSpeed);
-		WEAPON_READ_FIELD(float, scanAccel);
-		WEAPON_READ_FIELD(int, scanPauseTime);
-		WEAPON_READ_STRING(szScript);
-		WEAPON_READ_FIELD_ARR(float, fOOPosAnimLength, 2);
-		WEAPON_READ_FIELD(int, minDamage);
-		WEAPON_READ_FIELD(int, minPlayerDamage);
-		WEAPON_READ_FIELD(float, fMaxDamageRange);
-		WEAPON_READ_FIELD(float, fMinDamageRange);
-		WEAPON_READ_FIELD(float, destabilizationRateTime);
-		WEAPON_READ_FIELD(float, destabilizationCurvatureMax);
-		WEAPON_READ_FIELD(int, destabilizeDistance);
-		WEAPON_READ_FIELD_ARR(float, locationDamageMultipliers, 22);
-		WEAPON_READ_STRING(fireRumble);
-		WEAPON_READ_STRING(meleeImpactRumble);
-		WEAPON_READ_ASSET(ASSET_TYPE_TRACER, tracerDef, tracerType);
-		WEAPON_READ_FIELD(bool, turretADSEnabled);
-		WEAPON_READ_FIELD(float, turretADSTime);
-		WEAPON_READ_FIELD(float, turretFov);
-		WEAPON_READ_FIELD(float, turretFovADS);
-		WEAPON_READ_FIELD(float, turretScopeZoomRate);
-		WEAPON_READ_FIELD(float, turretScopeZoomMin);
-		WEAPON_READ_FIELD(float, turretScopeZoomMax);
-		WEAPON_READ_FIELD(float, turretOverheatUpRate);
-		WEAPON_READ_FIELD(float, turretOverheatDownRate);
-		WEAPON_READ_FIELD(float, turretOverheatPenalty);
-		WEAPON_READ_ASSET(ASSET_TYPE_SOUND, sound, turretOverheatSound);
-		WEAPON_READ_ASSET(ASSET_TYPE_FX, fx, turretOverheatEffect);
-		WEAPON_READ_STRING(turretBarrelSpinRumble);
-		WEAPON_READ_FIELD(float, turretBarrelSpinSpeed);
-		WEAPON_READ_FIELD(float, turretBarrelSpinUpTime);
-		WEAPON_READ_FIELD(float, turretBarrelSpinDownTime);
-		WEAPON_READ_ASSET(ASSET_TYPE_SOUND, sound, turretBarrelSpinMaxSnd);
-		WEAPON_READ_ASSET(ASSET_TYPE_SOUND, sound, missileConeSoundAlias);
-		WEAPON_READ_ASSET(ASSET_TYPE_SOUND, sound, missileConeSoundAliasAtBase);
-		WEAPON_READ_FIELD(float, missileConeSoundRadiusAtTop);
-		WEAPON_READ_FIELD(float, missileConeSoundRadiusAtBase);
-		WEAPON_READ_FIELD(float, missileConeSoundHeight);
-		WEAPON_READ_FIELD(float, missileConeSoundOriginOffset);
-		WEAPON_READ_FIELD(float, missileConeSoundVolumescaleAtCore);
-		WEAPON_READ_FIELD(float, missileConeSoundVolumescaleAtEdge);
-		WEAPON_READ_FIELD(float, missileConeSoundVolumescaleCoreSize);
-		WEAPON_READ_FIELD(float, missileConeSoundPitchAtTop);
-		WEAPON_READ_FIELD(float, missileConeSoundPitchAtBottom);
-		WEAPON_READ_FIELD(float, missileConeSoundPitchTopSize);
-		WEAPON_READ_FIELD(float, missileConeSoundPitchBottomSize);
-		WEAPON_READ_FIELD(float, missileConeSoundCrossfadeTopSize);
-		WEAPON_READ_FIELD(float, missileConeSoundCrossfadeBottomSize);
+		weapon_fields.read(weapon, data, mem);
+		weapon_sound_fields.read(weapon, json_fields::get(data, "sounds"), mem);
+
+		parse_statetimers(&weapon->stateTimers, json_fields::get(data, "stateTimers"), mem);
+		parse_statetimers(&weapon->akimboStateTimers, json_fields::get(data, "akimboStateTimers"), mem);
+		parse_overlay(&weapon->overlay, json_fields::get(data, "overlay"), mem);
 
 		// parse knifeAttachTagOverride
-		if (!data["knifeAttachTagOverride"].is_null())
-		{
-			auto knifeAttachTagOverride = data["knifeAttachTagOverride"].get<std::string>();
-			this->add_script_string(&weapon->knifeAttachTagOverride, mem->duplicate_string(knifeAttachTagOverride));
-		}
-
-		WEAPON_READ_FIELD(bool, knifeAlwaysAttached);
-		WEAPON_READ_FIELD(bool, meleeOverrideValues);
-		WEAPON_READ_FIELD(float, aim_automelee_lerp);
-		WEAPON_READ_FIELD(float, aim_automelee_range);
-		WEAPON_READ_FIELD(float, aim_automelee_region_height);
-		WEAPON_READ_FIELD(float, aim_automelee_region_width);
-		WEAPON_READ_FIELD(float, player_meleeHeight);
-		WEAPON_READ_FIELD(float, player_meleeRange);
-		WEAPON_READ_FIELD(float, player_meleeWidth);
-		WEAPON_READ_FIELD(bool, sharedAmmo);
-		WEAPON_READ_FIELD(bool, lockonSupported);
-		WEAPON_READ_FIELD(bool, requireLockonToFire);
-		WEAPON_READ_FIELD(bool, isAirburstWeapon);
-		WEAPON_READ_FIELD(bool, bigExplosion);
-		WEAPON_READ_FIELD(bool, noAdsWhenMagEmpty);
-		WEAPON_READ_FIELD(bool, avoidDropCleanup);
-		WEAPON_READ_FIELD(bool, inheritsPerks);
-		WEAPON_READ_FIELD(bool, crosshairColorChange);
-		WEAPON_READ_FIELD(bool, bRifleBullet);
-		WEAPON_READ_FIELD(bool, armorPiercing);
-		WEAPON_READ_FIELD(bool, bBoltAction);
-		WEAPON_READ_FIELD(bool, aimDownSight);
-		WEAPON_READ_FIELD(bool, canHoldBreath);
-		WEAPON_READ_FIELD(bool, canVariableZoom);
-		WEAPON_READ_FIELD(bool, bRechamberWhileAds);
-		WEAPON_READ_FIELD(bool, bBulletExplosiveDamage);
-		WEAPON_READ_FIELD(bool, bCookOffHold);
-		WEAPON_READ_FIELD(bool, reticleSpin45);
-		WEAPON_READ_FIELD(bool, bClipOnly);
-		WEAPON_READ_FIELD(bool, noAmmoPickup);
-		WEAPON_READ_FIELD(bool, adsFireOnly);
-		WEAPON_READ_FIELD(bool, cancelAutoHolsterWhenEmpty);
-		WEAPON_READ_FIELD(bool, disableSwitchToWhenEmpty);
-		WEAPON_READ_FIELD(bool, suppressAmmoReserveDisplay);
-		WEAPON_READ_FIELD(bool, laserSightDuringNightvision);
-		WEAPON_READ_FIELD(bool, markableViewmodel);
-		WEAPON_READ_FIELD(bool, noDualWield);
-		WEAPON_READ_FIELD(bool, flipKillIcon);
-		WEAPON_READ_FIELD(bool, bNoPartialReload);
-		WEAPON_READ_FIELD(bool, bSegmentedReload);
-		WEAPON_READ_FIELD(bool, bMultipleReload);
-		WEAPON_READ_FIELD(bool, blocksProne);
-		WEAPON_READ_FIELD(bool, silenced);
-		WEAPON_READ_FIELD(bool, isRollingGrenade);
-		WEAPON_READ_FIELD(bool, projExplosionEffectForceNormalUp);
-		WEAPON_READ_FIELD(bool, projExplosionEffectInheritParentDirection);
-		WEAPON_READ_FIELD(bool, bProjImpactExplode);
-		WEAPON_READ_FIELD(bool, bProjTrajectoryEvents);
-		WEAPON_READ_FIELD(bool, bProjWhizByEnabled);
-		WEAPON_READ_FIELD(bool, stickToPlayers);
-		WEAPON_READ_FIELD(bool, stickToVehicles);
-		WEAPON_READ_FIELD(bool, stickToTurrets);
-		WEAPON_READ_FIELD(bool, thrownSideways);
-		WEAPON_READ_FIELD(bool, hasDetonator);
-		WEAPON_READ_FIELD(bool, disableFiring);
-		WEAPON_READ_FIELD(bool, timedDetonation);
-		WEAPON_READ_FIELD(bool, rotate);
-		WEAPON_READ_FIELD(bool, holdButtonToThrow);
-		WEAPON_READ_FIELD(bool, freezeMovementWhenFiring);
-		WEAPON_READ_FIELD(bool, thermalScope);
-		WEAPON_READ_FIELD(bool, thermalToggle);
-		WEAPON_READ_FIELD(bool, outlineEnemies);
-		WEAPON_READ_FIELD(bool, altModeSameWeapon);
-		WEAPON_READ_FIELD(bool, turretBarrelSpinEnabled);
-		WEAPON_READ_FIELD(bool, missileConeSoundEnabled);
-		WEAPON_READ_FIELD(bool, missileConeSoundPitchshiftEnabled);
-		WEAPON_READ_FIELD(bool, missileConeSoundCrossfadeEnabled);
-		WEAPON_READ_FIELD(bool, offhandHoldIsCancelable);
-		WEAPON_READ_FIELD(bool, doNotAllowAttachmentsToOverrideSpread);
-		WEAPON_READ_FIELD(bool, useFastReloadAnims);
-		WEAPON_READ_FIELD(bool, useScopeDrift);
-		WEAPON_READ_FIELD(bool, alwaysShatterGlassOnImpact);
-		WEAPON_READ_FIELD(bool, oldWeapon);
-		WEAPON_READ_ASSET(ASSET_TYPE_XMODEL, model, stowOffsetModel);
+		if (const auto& knife_tag = json_fields::get(data, "knifeAttachTagOverride"); !knife_tag.is_null())
+		{
+			this->add_script_string(&weapon->knifeAttachTagOverride, mem->duplicate_string(knife_tag.get<std::string>()));
+		}
 
 		// parse stowtag
-		if (!data["stowTag"].is_null())
+		if (const auto& stow_tag = json_fields::get(data, "stowTag"); !stow_tag.is_null())
 		{
-			auto stowTag = data["stowTag"].get<std::string>();
-			this->add_script_string(&weapon->stowTag, mem->duplicate_string(stowTag));
+			this->add_script_string(&weapon->stowTag, mem->duplicate_string(stow_tag.get<std::string>()));
 		}
 
 		weapon->accuracyGraphName[0] = nullptr;
@@ -756,124 +810,55 @@ namespace zonetool::iw6
 		weapon->parallelBounce = nullptr;
 		weapon->perpendicularBounce = nullptr;
 
-		WEAPON_READ_ASSET_ARR(ASSET_TYPE_XMODEL, model, gunXModel, XModel, 64);
-		WEAPON_READ_ASSET_ARR(ASSET_TYPE_XMODEL, model, worldModel, XModel, 64);
-		WEAPON_READ_ASSET_ARR(ASSET_TYPE_MATERIAL, material, camoMaterialTarget, Material, 63);
-		WEAPON_READ_ANIM_ARR(szXAnimsRightHanded, 124);
-		WEAPON_READ_ANIM_ARR(szXAnimsLeftHanded, 124);
+		parse_anims(weapon->szXAnimsRightHanded, json_fields::get(data, "szXAnimsRightHanded"), mem);
+		parse_anims(weapon->szXAnimsLeftHanded, json_fields::get(data, "szXAnimsLeftHanded"), mem);
 
+		const auto& sound_map_keys = json_fields::get(data, "notetrackSoundMapKeys");
+		const auto& sound_map_values = json_fields::get(data, "notetrackSoundMapValues");
 		weapon->notetrackSoundMapKeys = mem->allocate<scr_string_t>(24);
 		weapon->notetrackSoundMapValues = mem->allocate<scr_string_t>(24);
 		for (auto i = 0u; i < 24; i++)
 		{
-			auto notetrack = data["notetrackSoundMapKeys"][i].get<std::string>();
-			this->add_script_string(&weapon->notetrackSoundMapKeys[i], mem->duplicate_string(notetrack));
-		}
-		for (auto i = 0u; i < 24; i++)
-		{
-			auto notetrack = data["notetrackSoundMapValues"][i].get<std::string>();
-			this->add_script_string(&weapon->notetrackSoundMapValues[i], mem->duplicate_string(notetrack));
+			this->add_script_string(&weapon->notetrackSoundMapKeys[i],
+				mem->duplicate_string(sound_map_keys.at(i).get<std::string>()));
+
+			this->add_script_string(&weapon->notetrackSoundMapValues[i],
+				mem->duplicate_string(sound_map_values.at(i).get<std::string>()));
 		}
 
+		const auto& rumble_map_keys = json_fields::get(data, "notetrackRumbleMapKeys");
+		const auto& rumble_map_values = json_fields::get(data, "notetrackRumbleMapValues");
+		const auto& fx_map_keys = json_fields::get(data, "notetrackFXMapKeys");
+		const auto& fx_map_tags = json_fields::get(data, "notetrackFXMapTagValues");
+		const auto& fx_map_values = json_fields::get(data, "notetrackFXMapValues");
 		weapon->notetrackRumbleMapKeys = mem->allocate<scr_string_t>(16);
 		weapon->notetrackRumbleMapValues = mem->allocate<scr_string_t>(16);
 		weapon->notetrackFXMapKeys = mem->allocate<scr_string_t>(16);
 		weapon->notetrackFXMapTagValues = mem->allocate<scr_string_t>(16);
-		for (auto i = 0u; i < 16; i++)
-		{
-			auto notetrack = data["notetrackRumbleMapKeys"][i].get<std::string>();
-			this->add_script_string(&weapon->notetrackRumbleMapKeys[i], mem->duplicate_string(notetrack));
-		}
-		for (auto i = 0u; i < 16; i++)
-		{
-			auto notetrack = data["notetrackRumbleMapValues"][i].get<std::string>();
-			this->add_script_string(&weapon->notetrackRumbleMapValues[i], mem->duplicate_string(notetrack));
-		}
-		for (auto i = 0u; i < 16; i++)
-		{
-			auto notetrack = data["notetrackFXMapKeys"][i].get<std::string>();
-			this->add_script_string(&weapon->notetrackFXMapKeys[i], mem->duplicate_string(notetrack));
-		}
-		for (auto i = 0u; i < 16; i++)
-		{
-			auto notetrack = data["notetrackFXMapTagValues"][i].get<std::string>();
-			this->add_script_string(&weapon->notetrackFXMapTagValues[i], mem->duplicate_string(notetrack));
-		}
-
 		weapon->notetrackFXMapValues = mem->allocate<FxEffectDef*>(16);
 		for (auto i = 0u; i < 16; i++)
 		{
-			auto notetrack = data["notetrackFXMapValues"][i].get<std::string>();
-			weapon->notetrackFXMapValues[i] = db_find_x_asset_header(ASSET_TYPE_FX, notetrack.data(), 1).fx;
-		}
-
-		WEAPON_READ_SOUND(pickupSound);
-		WEAPON_READ_SOUND(pickupSoundPlayer);
-		WEAPON_READ_SOUND(ammoPickupSound);
-		WEAPON_READ_SOUND(ammoPickupSoundPlayer);
-		WEAPON_READ_SOUND(projectileSound);
-		WEAPON_READ_SOUND(pullbackSound);
-		WEAPON_READ_SOUND(pullbackSoundPlayer);
-		WEAPON_READ_SOUND(fireSound);
-		WEAPON_READ_SOUND(fireSoundPlayer);
-		WEAPON_READ_SOUND(fireSoundPlayerAkimbo);
-		WEAPON_READ_SOUND(fireLoopSound);
-		WEAPON_READ_SOUND(fireLoopSoundPlayer);
-		WEAPON_READ_SOUND(fireStopSound);
-		WEAPON_READ_SOUND(fireStopSoundPlayer);
-		WEAPON_READ_SOUND(fireLastSound);
-		WEAPON_READ_SOUND(fireLastSoundPlayer);
-		WEAPON_READ_SOUND(emptyFireSound);
-		WEAPON_READ_SOUND(emptyFireSoundPlayer);
-		WEAPON_READ_SOUND(meleeSwipeSound);
-		WEAPON_READ_SOUND(meleeSwipeSoundPlayer);
-		WEAPON_READ_SOUND(meleeHitSound);
-		WEAPON_READ_SOUND(meleeMissSound);
-		WEAPON_READ_SOUND(rechamberSound);
-		WEAPON_READ_SOUND(rechamberSoundPlayer);
-		WEAPON_READ_SOUND(reloadSound);
-		WEAPON_READ_SOUND(reloadSoundPlayer);
-		WEAPON_READ_SOUND(reloadEmptySound);
-		WEAPON_READ_SOUND(reloadEmptySoundPlayer);
-		WEAPON_READ_SOUND(reloadStartSound);
-		WEAPON_READ_SOUND(reloadStartSoundPlayer);
-		WEAPON_READ_SOUND(reloadEndSound);
-		WEAPON_READ_SOUND(reloadEndSoundPlayer);
-		WEAPON_READ_SOUND(detonateSound);
-		WEAPON_READ_SOUND(detonateSoundPlayer);
-		WEAPON_READ_SOUND(nightVisionWearSound);
-		WEAPON_READ_SOUND(nightVisionWearSoundPlayer);
-		WEAPON_READ_SOUND(nightVisionRemoveSound);
-		WEAPON_READ_SOUND(nightVisionRemoveSoundPlayer);
-		WEAPON_READ_SOUND(altSwitchSound);
-		WEAPON_READ_SOUND(altSwitchSoundPlayer);
-		WEAPON_READ_SOUND(raiseSound);
-		WEAPON_READ_SOUND(raiseSoundPlayer);
-		WEAPON_READ_SOUND(firstRaiseSound);
-		WEAPON_READ_SOUND(firstRaiseSoundPlayer);
-		WEAPON_READ_SOUND(putawaySound);
-		WEAPON_READ_SOUND(putawaySoundPlayer);
-		WEAPON_READ_SOUND(scanSound);
-		WEAPON_READ_SOUND(changeVariableZoomSound);
-
-		WEAPON_READ_ASSET_ARR(ASSET_TYPE_SOUND, sound, bounceSound, snd_alias_list_t, 31);
-		WEAPON_READ_ASSET_ARR(ASSET_TYPE_SOUND, sound, rollingSound, snd_alias_list_t, 31);
+			this->add_script_string(&weapon->notetrackRumbleMapKeys[i],
+				mem->duplicate_string(rumble_map_keys.at(i).get<std::string>()));
 
-		for (auto i = 0u; i < 4; i++)
-		{
-			auto sound = data["turretBarrelSpinUpSnd"][i].get<std::string>();
-			if (!sound.empty())
-			{
-				weapon->turretBarrelSpinUpSnd[i] = db_find_x_asset_header(ASSET_TYPE_SOUND, sound.data(), 1).sound;
-			}
+			this->add_script_string(&weapon->notetrackRumbleMapValues[i],
+				mem->duplicate_string(rumble_map_values.at(i).get<std::string>()));
+
+			this->add_script_string(&weapon->notetrackFXMapKeys[i],
+				mem->duplicate_string(fx_map_keys.at(i).get<std::string>()));
+
+			this->add_script_string(&weapon->notetrackFXMapTagValues[i],
+				mem->duplicate_string(fx_map_tags.at(i).get<std::string>()));
+
+			weapon->notetrackFXMapValues[i] = parse_asset_header<FxEffectDef>(ASSET_TYPE_FX, fx_map_values.at(i));
 		}
+
+		const auto& spin_up_sounds = json_fields::get(data, "turretBarrelSpinUpSnd");
+		const auto& spin_down_sounds = json_fields::get(data, "turretBarrelSpinDownSnd");
 		for (auto i = 0u; i < 4; i++)
 		{
-			auto sound = data["turretBarrelSpinDownSnd"][i].get<std::string>();
-			if (!sound.empty())
-			{
-				weapon->turretBarrelSpinDownSnd[i] = db_find_x_asset_header(ASSET_TYPE_SOUND, sound.data(), 1).sound;
-			}
+			weapon->turretBarrelSpinUpSnd[i] = parse_asset_header<snd_alias_list_t>(ASSET_TYPE_SOUND, json_fields::get(spin_up_sounds, i));
+			weapon->turretBarrelSpinDownSnd[i] = parse_asset_header<snd_alias_list_t>(ASSET_TYPE_SOUND, json_fields::get(spin_down_sounds, i));
 		}
 
 		return weapon;
@@ -898,10 +883,11 @@ namespace zonetool::iw6
 		auto size = file.size();
 		auto bytes = file.read_bytes(size);
 		file.close();
-		json data = json::parse(bytes);
+		const json data = json::parse(bytes);
 
 		// base asset
-		auto base = data["baseAsset"].get<std::string>();
+		const auto& base_asset = json_fields::get(data, "baseAsset");
+		const auto base = base_asset.is_string() ? base_asset.get<std::string>() : ""s;
 		WeaponCompleteDef* baseAsset = nullptr;
 
 		if (!base.empty())
@@ -914,153 +900,106 @@ namespace zonetool::iw6
 			ZONETOOL_WARNING("No base asset is defined for weapon %s, stuff might go wrong!", name.data());
 		}
 
-		WEAPON_READ_STRING(szInternalName);
-		WEAPON_READ_STRING(szDisplayName);
-		WEAPON_READ_FIELD(unsigned int, numAnimOverrides);
-		WEAPON_READ_FIELD(unsigned int, numSoundOverrides);
-		WEAPON_READ_FIELD(unsigned int, numFXOverrides);
-		WEAPON_READ_FIELD(unsigned int, numReloadStateTimerOverrides);
-		WEAPON_READ_FIELD(unsigned int, numNotetrackOverrides);
-		WEAPON_READ_FIELD(float, fAdsZoomFov);
-		WEAPON_READ_FIELD(int, iAdsTransInTime);
-		WEAPON_READ_FIELD(int, iAdsTransOutTime);
-		WEAPON_READ_FIELD(int, iClipSize);
-		WEAPON_READ_FIELD(int, impactType);
-		WEAPON_READ_FIELD(int, iFireTime);
-		WEAPON_READ_FIELD(int, iFireTimeAkimbo);
-		WEAPON_READ_FIELD(int, dpadIconRatio);
-		WEAPON_READ_FIELD(float, penetrateMultiplier);
-		WEAPON_READ_FIELD(float, fAdsViewKickCenterSpeed);
-		WEAPON_READ_FIELD(float, fHipViewKickCenterSpeed);
-		WEAPON_READ_STRING(szAltWeaponName);
-		WEAPON_READ_FIELD(int, altWeapon);
-		WEAPON_READ_FIELD(int, iAltRaiseTime);
-		WEAPON_READ_FIELD(int, iAltRaiseTimeAkimbo);
-		WEAPON_READ_ASSET(ASSET_TYPE_MATERIAL, material, killIcon);
-		WEAPON_READ_ASSET(ASSET_TYPE_MATERIAL, material, dpadIcon);
-		WEAPON_READ_FIELD(int, fireAnimLength);
-		WEAPON_READ_FIELD(int, fireAnimLengthAkimbo);
-		WEAPON_READ_FIELD(int, iFirstRaiseTime);
-		WEAPON_READ_FIELD(int, iFirstRaiseTimeAkimbo);
-		WEAPON_READ_FIELD(int, ammoDropStockMax);
-		WEAPON_READ_FIELD(float, adsDofStart);
-		WEAPON_READ_FIELD(float, adsDofEnd);
-		WEAPON_READ_FIELD_ARR(unsigned __int16, accuracyGraphKnotCount, 2);
-		WEAPON_READ_FIELD(bool, motionTracker);
-		WEAPON_READ_FIELD(bool, enhanced);
-		WEAPON_READ_FIELD(bool, dpadIconShowsAmmo);
-		WEAPON_READ_STRING(szAdsrBaseSetting);
-
 		// parse weapondef
-		weapon->weapDef = parse_weapondef(data["weapDef"], baseAsset, mem);
+		weapon->weapDef = parse_weapondef(json_fields::get(data, "weapDef"), baseAsset, mem);
+
+		complete_fields.read(weapon, data, mem);
 
+		const auto& hide_tags = json_fields::get(data, "hideTags");
 		weapon->hideTags = mem->allocate<scr_string_t>(32);
 		for (auto i = 0u; i < 32; i++)
 		{
-			auto script_str = data["hideTags"][i].get<std::string>();
-			this->add_script_string(&weapon->hideTags[i], mem->duplicate_string(script_str));
+			this->add_script_string(&weapon->hideTags[i], mem->duplicate_string(hide_tags.at(i).get<std::string>()));
 		}
 
-		WEAPON_READ_ASSET_ARR(ASSET_TYPE_ATTACHMENT, attachment, scopes, WeaponAttachment, 6);
-		WEAPON_READ_ASSET_ARR(ASSET_TYPE_ATTACHMENT, attachment, underBarrels, WeaponAttachment, 3);
-		WEAPON_READ_ASSET_ARR(ASSET_TYPE_ATTACHMENT, attachment, others, WeaponAttachment, 8);
-
-		WEAPON_READ_ANIM_ARR(szXAnims, 124);
+		parse_anims(weapon->szXAnims, json_fields::get(data, "szXAnims"), mem);
 
 		if (weapon->numAnimOverrides)
 		{
+			const auto& anim_overrides = json_fields::get(data, "animOverrides");
 			weapon->animOverrides = mem->allocate<AnimOverrideEntry>(weapon->numAnimOverrides);
 			for (auto i = 0u; i < weapon->numAnimOverrides; i++)
 			{
-				auto altmodeAnim = data["animOverrides"][i]["altmodeAnim"].get<std::string>();
-				if (!altmodeAnim.empty())
-				{
-					weapon->animOverrides[i].altmodeAnim = db_find_x_asset_header(ASSET_TYPE_XANIMPARTS, altmodeAnim.data(), 1).parts;
-				}
-				auto overrideAnim = data["animOverrides"][i]["overrideAnim"].get<std::string>();
-				if (!overrideAnim.empty())
-				{
-					weapon->animOverrides[i].overrideAnim = db_find_x_asset_header(ASSET_TYPE_XANIMPARTS, overrideAnim.data(), 1).parts;
-				}
-				weapon->animOverrides[i].attachment1 = data["animOverrides"][i]["attachment1"].get<unsigned short>();
-				weapon->animOverrides[i].attachment2 = data["animOverrides"][i]["attachment2"].get<unsigned short>();
-				weapon->animOverrides[i].altTime = data["animOverrides"][i]["altTime"].get<int>();
-				weapon->animOverrides[i].animTime = data["animOverrides"][i]["animTime"].get<int>();
-				weapon->animOverrides[i].animTreeType = data["animOverrides"][i]["animTreeType"].get<unsigned int>();
+				const auto& entry = anim_overrides.at(i);
+				weapon->animOverrides[i].altmodeAnim = parse_asset_header<XAnimParts>(ASSET_TYPE_XANIMPARTS, json_fields::get(entry, "altmodeAnim"));
+				weapon->animOverrides[i].overrideAnim = parse_asset_header<XAnimParts>(ASSET_TYPE_XANIMPARTS, json_fields::get(entry, "overrideAnim"));
+				weapon->animOverrides[i].attachment1 = entry.value("attachment1", static_cast<unsigned short>(0));
+				weapon->animOverrides[i].attachment2 = entry.value("attachment2", static_cast<unsigned short>(0));
+				weapon->animOverrides[i].altTime = entry.value("altTime", 0);
+				weapon->animOverrides[i].animTime = entry.value("animTime", 0);
+				weapon->animOverrides[i].animTreeType = entry.value("animTreeType", 0u);
 			}
 		}
 
 		if (weapon->numSoundOverrides)
 		{
+			const auto& sound_overrides = json_fields::get(data, "soundOverrides");
 			weapon->soundOverrides = mem->allocate<SoundOverrideEntry>(weapon->numSoundOverrides);
 			for (auto i = 0u; i < weapon->numSoundOverrides; i++)
 			{
-				auto altmodeSound = data["soundOverrides"][i]["altmodeSound"].get<std::string>();
-				if (!altmodeSound.empty())
-				{
-					weapon->soundOverrides[i].altmodeSound = db_find_x_asset_header(ASSET_TYPE_SOUND, altmodeSound.data(), 1).sound;
-				}
-				auto overrideSound = data["soundOverrides"][i]["overrideSound"].get<std::string>();
-				if (!overrideSound.empty())
-				{
-					weapon->soundOverrides[i].overrideSound = db_find_x_asset_header(ASSET_TYPE_SOUND, overrideSound.data(), 1).sound;
-				}
-				weapon->soundOverrides[i].attachment1 = data["soundOverrides"][i]["attachment1"].get<unsigned short>();
-				weapon->soundOverrides[i].attachment2 = data["soundOverrides"][i]["attachment2"].get<unsigned short>();
-				weapon->soundOverrides[i].soundType = data["soundOverrides"][i]["soundType"].get<unsigned int>();
+				const auto& entry = sound_overrides.at(i);
+				weapon->soundOverrides[i].altmodeSound = parse_asset_header<snd_alias_list_t>(ASSET_TYPE_SOUND, json_fields::get(entry, "altmodeSound"));
+				weapon->soundOverrides[i].overrideSound = parse_asset_header<snd_alias_list_t>(ASSET_TYPE_SOUND, json_fields::get(entry, "overrideSound"));
+				weapon->soundOverrides[i].attachment1 = entry.value("attachment1", static_cast<unsigned short>(0));
+				weapon->soundOverrides[i].attachment2 = entry.value("attachment2", static_cast<unsigned short>(0));
+				weapon->soundOverrides[i].soundType = entry.value("soundType", 0u);
 			}
 		}
 
 		if (weapon->numFXOverrides)
 		{
+			const auto& fx_overrides = json_fields::get(data, "fxOverrides");
 			weapon->fxOverrides = mem->allocate<FXOverrideEntry>(weapon->numFXOverrides);
 			for (auto i = 0u; i < weapon->numFXOverrides; i++)
 			{
-				auto altmodeFX = data["fxOverrides"][i]["altmodeFX"].get<std::string>();
-				if (!altmodeFX.empty())
-				{
-					weapon->fxOverrides[i].altmodeFX = db_find_x_asset_header(ASSET_TYPE_FX, altmodeFX.data(), 1).fx;
-				}
-				auto overrideFX = data["fxOverrides"][i]["overrideFX"].get<std::string>();
-				if (!overrideFX.empty())
-				{
-					weapon->fxOverrides[i].overrideFX = db_find_x_asset_header(ASSET_TYPE_SOUND, overrideFX.data(), 1).fx;
-				}
-				weapon->fxOverrides[i].attachment1 = data["fxOverrides"][i]["attachment1"].get<unsigned short>();
-				weapon->fxOverrides[i].attachment2 = data["fxOverrides"][i]["attachment2"].get<unsigned short>();
-				weapon->fxOverrides[i].fxType = data["fxOverrides"][i]["fxType"].get<unsigned int>();
+				const auto& entry = fx_overrides.at(i);
+				weapon->fxOverrides[i].altmodeFX = parse_asset_header<FxEffectDef>(ASSET_TYPE_FX, json_fields::get(entry, "altmodeFX"));
+				weapon->fxOverrides[i].overrideFX = parse_asset_header<FxEffectDef>(ASSET_TYPE_SOUND, json_fields::get(entry, "overrideFX"));
+				weapon->fxOverrides[i].attachment1 = entry.value("attachment1", static_cast<unsigned short>(0));
+				weapon->fxOverrides[i].attachment2 = entry.value("attachment2", static_cast<unsigned short>(0));
+				weapon->fxOverrides[i].fxType = entry.value("fxType", 0u);
 			}
 		}
 
 		if (weapon->numReloadStateTimerOverrides)
 		{
+			const auto& reload_overrides = json_fields::get(data, "reloadOverrides");
 			weapon->reloadOverrides = mem->allocate<ReloadStateTimerEntry>(weapon->numReloadStateTimerOverrides);
 			for (auto i = 0u; i < weapon->numReloadStateTimerOverrides; i++)
 			{
-				weapon->reloadOverrides[i].attachment = data["reloadOverrides"][i]["attachment"].get<int>();
-				weapon->reloadOverrides[i].reloadAddTime = data["reloadOverrides"][i]["reloadAddTime"].get<int>();
-				weapon->reloadOverrides[i].reloadEmptyAddTime = data["reloadOverrides"][i]["reloadEmptyAddTime"].get<int>();
-				weapon->reloadOverrides[i].reloadStartAddTime = data["reloadOverrides"][i]["reloadStartAddTime"].get<int>();
+				const auto& entry = reload_overrides.at(i);
+				weapon->reloadOverrides[i].attachment = entry.value("attachment", 0);
+				weapon->reloadOverrides[i].reloadAddTime = entry.value("reloadAddTime", 0);
+				weapon->reloadOverrides[i].reloadEmptyAddTime = entry.value("reloadEmptyAddTime", 0);
+				weapon->reloadOverrides[i].reloadStartAddTime = entry.value("reloadStartAddTime", 0);
 			}
 		}
 
 		if (weapon->numNotetrackOverrides)
 		{
+			const auto& notetrack_overrides = json_fields::get(data, "notetrackOverrides");
 			weapon->notetrackOverrides = mem->allocate<NoteTrackToSoundEntry>(weapon->numNotetrackOverrides);
 			for (auto i = 0u; i < weapon->numNotetrackOverrides; i++)
 			{
-				weapon->notetrackOverrides[i].attachment = data["notetrackOverrides"][i]["attachment"].get<int>();
+				const auto& entry = notetrack_overrides.at(i);
+				const auto& keys = json_fields::get(entry, "notetrackSoundMapKeys");
+				const auto& values = json_fields::get(entry, "notetrackSoundMapValues");
+
+				weapon->notetrackOverrides[i].attachment = entry.value("attachment", 0);
+				weapon->notetrackOverrides[i].notetrackSoundMapKeys = mem->allocate<scr_string_t>(24);
+				weapon->notetrackOverrides[i].notetrackSoundMapValues = mem->allocate<scr_string_t>(24);
 				for (auto j = 0u; j < 24; j++)
 				{
-					auto notetrackSoundMapKey = data["notetrackOverrides"][i]["notetrackSoundMapKeys"][j].get<std::string>();
-					if (!notetrackSoundMapKey.empty())
+					const auto key = keys.at(j).get<std::string>();
+					if (!key.empty())
 					{
-						this->add_script_string(&weapon->notetrackOverrides[i].notetrackSoundMapKeys[j], mem->duplicate_string(notetrackSoundMapKey));
+						this->add_script_string(&weapon->notetrackOverrides[i].notetrackSoundMapKeys[j], mem->duplicate_string(key));
 					}
-					auto notetrackSoundMapValue = data["notetrackOverrides"][i]["notetrackSoundMapValues"][j].get<std::string>();
-					if (!notetrackSoundMapValue.empty())
+
+					const auto value = values.at(j).get<std::string>();
+					if (!value.empty())
 					{
-						this->add_script_string(&weapon->notetrackOverrides[i].notetrackSoundMapValues[j], mem->duplicate_string(notetrackSoundMapValue));
+						this->add_script_string(&weapon->notetrackOverrides[i].notetrackSoundMapValues[j], mem->duplicate_string(value));
 					}
 				}
 			}
@@ -15,7 +15,7 @@ namespace zonetool::iw6
 
 	public:
 		WeaponCompleteDef* parse(const std::string& name, zone_memory* mem);
-		WeaponDef* parse_weapondef(json& data, WeaponCompleteDef* baseAsset, zone_memory* mem);
+		WeaponDef* parse_weapondef(const json& data, WeaponCompleteDef* baseAsset, zone_memory* mem);
 
 		void init(const std::string& name, zone_memory* mem) override;
 		void prepare(zone_buffer* buf, zone_memory* mem) override;
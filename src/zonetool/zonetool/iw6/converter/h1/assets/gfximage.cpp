@@ -43,7 +43,7 @@ namespace zonetool::iw6
 			{
 				for (auto i = 0u; i < 4; i++)
 				{
-					const auto stream_file = &stream_files[*stream_file_index + i];
+					const auto stream_file = &stream_files[dump_stream_file_index + i];
 
 					const std::string filename = utils::string::va("imagefile%d.pak", stream_file->fileIndex);
 					const auto folder = filesystem::get_zone_path(filename);
@@ -2,11 +2,6 @@
 #include "zonetool/iw6/converter/h1/include.hpp"
 #include "physworld.hpp"
 
-#pragma warning(push)
-#pragma warning(disable: 4459)
-#include "zonetool/utils/earcut.hpp"
-#pragma warning(pop)
-
 #include <utils/string.hpp>
 #include <utils/cryptography.hpp>
 
@@ -18,14 +13,6 @@ namespace zonetool::iw6
 		{
 			namespace
 			{
-				struct mesh_node
-				{
-					float lower[3];
-					float upper[3];
-					bool is_max;
-					zonetool::h1::dmMeshNode node;
-				};
-
 				struct bounding_box
 				{
 					float lower[3];
@@ -258,319 +245,275 @@ namespace zonetool::iw6
 					}
 				}
 
-				int max_nodes = 0;
-				mesh_node* alloc_node(mesh_node* nodes, int& node_index)
-				{
-					if (node_index + 1 >= max_nodes)
-					{
-						ZONETOOL_FATAL("out of nodes for physworld generation");
-					}
-
-					return &nodes[node_index++];
-				}
-
-				bounding_box compute_bounding_box(zonetool::h1::dmMeshData* mesh, const std::vector<triangle_t>& triangles)
-				{
-					bounding_box box{};
-
-					const auto verts = &mesh->m_aVertices[0];
-
-					if (triangles.size() > 0)
-					{
-						box.lower[0] = verts[triangles[0].verts[0]].x;
-						box.lower[1] = verts[triangles[0].verts[0]].y;
-						box.lower[2] = verts[triangles[0].verts[0]].z;
-						box.upper[0] = verts[triangles[0].verts[0]].x;
-						box.upper[1] = verts[triangles[0].verts[0]].y;
-						box.upper[2] = verts[triangles[0].verts[0]].z;
-					}
-
-					for (const auto& tri : triangles)
-					{
-						for (auto i = 0; i < 3; i++)
-						{
-							for (auto o = 0; o < 3; o++)
-							{
-								const auto value = reinterpret_cast<float*>(&verts[tri.verts[i]].x)[o];
-								if (value > box.upper[o])
-								{
-									box.upper[o] = value;
-								}
-
-								if (value < box.lower[o])
-								{
-									box.lower[o] = value;
-								}
-							}
-						}
-					}
-
-					return box;
-				}
-
-				void cross_product(const float* a, const float* b, float* out)
-				{
-					out[0] = a[1] * b[2] - a[2] * b[1];
-					out[1] = a[2] * b[0] - a[0] * b[2];
-					out[2] = a[0] * b[1] - a[1] * b[0];
-				}
-
-				float dot_product(const float* a, const float* b)
-				{
-					return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
-				}
-
-				void vector_sub(const float* a, const float* b, float* out)
-				{
-					out[0] = a[0] - b[0];
-					out[1] = a[1] - b[1];
-					out[2] = a[2] - b[2];
-				}
-
-				void vector_add(const float* a, const float* b, float* out)
-				{
-					out[0] = a[0] + b[0];
-					out[1] = a[1] + b[1];
-					out[2] = a[2] + b[2];
-				}
-
-				void vector_mul(const float* a, const float mul, float* out)
-				{
-					out[0] = a[0] * mul;
-					out[1] = a[1] * mul;
-					out[2] = a[2] * mul;
-				}
-
-				int hash_triangle(const triangle_t& tri, const std::vector<zonetool::h1::dmFloat4>& phys_verticies)
-				{
-					float verts[3][3]{};
-					std::memcpy(&verts[0], &phys_verticies[tri.verts[0]], sizeof(float[3]));
-					std::memcpy(&verts[1], &phys_verticies[tri.verts[1]], sizeof(float[3]));
-					std::memcpy(&verts[2], &phys_verticies[tri.verts[2]], sizeof(float[3]));
-
-					std::string data;
-					data.append(reinterpret_cast<char*>(&verts[0]), sizeof(float[3][3]));
-
-					return utils::cryptography::jenkins_one_at_a_time::compute(data);
-				}
-
-				bool is_script_brushmodel_brush_r(zonetool::h1::clipMap_t* asset, zonetool::h1::cLeafBrushNode_s* node, zonetool::h1::cbrush_t* brush)
+				void collect_script_brushmodel_brushes_r(zonetool::h1::clipMap_t* asset, zonetool::h1::cLeafBrushNode_s* node,
+					std::vector<bool>& script_brushes)
 				{
 					if (node->leafBrushCount > 0)
 					{
 						for (auto o = 0; o < node->leafBrushCount; o++)
 						{
-							const auto brush_idx = node->data.leaf.brushes[o];
-							if (brush == &asset->info.bCollisionData.brushes[brush_idx])
-							{
-								return true;
-							}
+							script_brushes[node->data.leaf.brushes[o]] = true;
 						}
 
-						return false;
+						return;
 					}
 
 					if (node->leafBrushCount)
 					{
-						if (is_script_brushmodel_brush_r(asset, &node[1], brush))
-						{
-							return true;
-						}
+						collect_script_brushmodel_brushes_r(asset, &node[1], script_brushes);
 					}
 
-					if (node->data.children.childOffset[0] &&
-						is_script_brushmodel_brush_r(asset, &node[node->data.children.childOffset[0]], brush))
+					if (node->data.children.childOffset[0])
 					{
-						return true;
+						collect_script_brushmodel_brushes_r(asset, &node[node->data.children.childOffset[0]], script_brushes);
 					}
 
-					if (node->data.children.childOffset[1] &&
-						is_script_brushmodel_brush_r(asset, &node[node->data.children.childOffset[1]], brush))
+					if (node->data.children.childOffset[1])
 					{
-						return true;
+						collect_script_brushmodel_brushes_r(asset, &node[node->data.children.childOffset[1]], script_brushes);
 					}
-
-					return false;
 				}
 
-				bool is_script_brushmodel_brush(zonetool::h1::clipMap_t* asset, zonetool::h1::cbrush_t* brush)
+				std::vector<bool> get_script_brushmodel_brushes(zonetool::h1::clipMap_t* asset)
 				{
+					std::vector<bool> script_brushes(asset->info.bCollisionData.numBrushes);
+
 					for (auto i = 0u; i < asset->numSubModels; i++)
 					{
 						const auto cmodel = &asset->cmodels[i];
 						const auto leaf_brush_node = &asset->info.bCollisionTree.leafbrushNodes[cmodel->leaf.leafBrushNode];
-						if (is_script_brushmodel_brush_r(asset, leaf_brush_node, brush))
-						{
-							return true;
-						}
+						collect_script_brushmodel_brushes_r(asset, leaf_brush_node, script_brushes);
 					}
 
-					return false;
+					return script_brushes;
 				}
 
-				bool find_partition_in_tree(zonetool::h1::clipMap_t* asset, zonetool::h1::CollisionAabbTree* tree, zonetool::h1::CollisionPartition* partition)
+				void collect_script_brushmodel_partitions_r(zonetool::h1::clipMap_t* asset, zonetool::h1::CollisionAabbTree* tree,
+					std::vector<bool>& script_partitions)
 				{
-					if (tree->childCount != 0)
+					if (tree->childCount == 0)
 					{
-						for (auto i = 0u; i < tree->childCount; i++)
-						{
-							const auto child = &asset->info.pCollisionTree.aabbTrees[tree->u.firstChildIndex + i];
-							if (find_partition_in_tree(asset, child, partition))
-							{
-								return true;
-							}
-						}
+						script_partitions[tree->u.partitionIndex] = true;
+						return;
 					}
-					else
+
+					for (auto i = 0u; i < tree->childCount; i++)
 					{
-						return partition == &asset->info.pCollisionData.partitions[tree->u.partitionIndex];
+						const auto child = &asset->info.pCollisionTree.aabbTrees[tree->u.firstChildIndex + i];
+						collect_script_brushmodel_partitions_r(asset, child, script_partitions);
 					}
-
-					return false;
 				}
 
-				bool is_script_brushmodel_partition(zonetool::h1::clipMap_t* asset, zonetool::h1::CollisionPartition* partition)
+				std::vector<bool> get_script_brushmodel_partitions(zonetool::h1::clipMap_t* asset)
 				{
+					std::vector<bool> script_partitions(asset->info.pCollisionData.partitionCount);
+
 					for (auto i = 0u; i < asset->numSubModels; i++)
 					{
 						const auto cmodel = &asset->cmodels[i];
 						for (auto o = 0u; o < cmodel->leaf.collAabbCount; o++)
 						{
 							const auto tree = &asset->info.pCollisionTree.aabbTrees[cmodel->leaf.firstCollAabbIndex + o];
-							if (find_partition_in_tree(asset, tree, partition))
-							{
-								return true;
-							}
+							collect_script_brushmodel_partitions_r(asset, tree, script_partitions);
 						}
 					}
 
-					return false;
+					return script_partitions;
 				}
 
-				std::vector<triangle_t> generate_brush_triangles(zonetool::h1::clipMap_t* asset, std::vector<zonetool::h1::dmFloat4>& vertices, int brush_index)
+				constexpr auto max_winding_verts = 0x1000;
+				constexpr auto max_winding_polys = 0x1000;
+
+				// reused by every brush a worker thread processes
+				struct winding_scratch
 				{
-					std::vector<triangle_t> triangles;
+					float verts[max_winding_verts][3];
+					polygon_t polys[max_winding_polys];
+				};
+
+				struct brush_geometry
+				{
+					std::vector<std::array<float, 3>> verts;
+					std::vector<std::array<int, 3>> tris; // indices into verts
+				};
 
-					auto brush = &asset->info.bCollisionData.brushes[brush_index];
-					auto brush_bounds = asset->info.bCollisionData.brushBounds[brush_index];
+				void generate_brush_triangles(zonetool::h1::clipMap_t* asset, const int brush_index,
+					winding_scratch& scratch, brush_geometry& out)
+				{
+					const auto brush = &asset->info.bCollisionData.brushes[brush_index];
+					const auto brush_bounds = asset->info.bCollisionData.brushBounds[brush_index];
 
-					if (is_script_brushmodel_brush(asset, brush))
-					{
-						return {};
-					}
+					build_windings_for_brush(asset->pInfo, &brush_bounds, brush, scratch.polys, max_winding_polys,
+						scratch.verts, max_winding_verts);
 
-					const auto add_points = [&](int side_index, polygon_t* poly)
+					for (auto side_index = 0; side_index < brush->numsides + 6; side_index++)
 					{
-						const auto base_index = static_cast<int>(vertices.size());
-
-						for (auto i = 0u; i < poly->ptCount; i++)
+						const auto poly = &scratch.polys[side_index];
+						if (poly->ptCount < 3)
 						{
-							zonetool::h1::dmFloat4 vert{};
-							vert.x = poly->pts[i][0];
-							vert.y = poly->pts[i][1];
-							vert.z = poly->pts[i][2];
-							vertices.emplace_back(vert);
+							continue;
 						}
 
-						if (poly->ptCount == 3)
+						const auto base_index = static_cast<int>(out.verts.size());
+						for (auto i = 0u; i < poly->ptCount; i++)
 						{
-							triangle_t triangle{};
-							triangle.verts[0] = base_index + 0;
-							triangle.verts[1] = base_index + 1;
-							triangle.verts[2] = base_index + 2;
-							triangles.emplace_back(triangle);
+							out.verts.push_back({poly->pts[i][0], poly->pts[i][1], poly->pts[i][2]});
 						}
-						else if (poly->ptCount == 4)
+
+						// brush windings are convex, so a fan covers every face
+						for (auto i = 1; i + 1 < static_cast<int>(poly->ptCount); i++)
 						{
-							triangle_t triangle_1{};
-							triangle_1.verts[0] = base_index + 0;
-							triangle_1.verts[1] = base_index + 1;
-							triangle_1.verts[2] = base_index + 2;
-							triangles.emplace_back(triangle_1);
-
-							triangle_t triangle_2{};
-							triangle_2.verts[0] = base_index + 2;
-							triangle_2.verts[1] = base_index + 3;
-							triangle_2.verts[2] = base_index + 0;
-							triangles.emplace_back(triangle_2);
+							out.tris.push_back({base_index, base_index + i, base_index + i + 1});
 						}
-						else
-						{
-							using point = std::array<float, 2>;
-							std::vector<point> points;
-							std::vector<std::vector<point>> polygon;
+					}
+				}
 
-							for (auto i = 0u; i < poly->ptCount; i++)
-							{
-								point p{};
-								p[0] = poly->pts[i][0];
-								p[1] = poly->pts[i][1];
+				std::vector<brush_geometry> generate_brushes_geometry(zonetool::h1::clipMap_t* asset)
+				{
+					const auto brush_count = static_cast<int>(asset->info.bCollisionData.numBrushes);
+					const auto script_brushes = get_script_brushmodel_brushes(asset);
 
-								points.push_back(p);
-							}
+					std::vector<brush_geometry> geometry;
+					geometry.resize(brush_count);
 
-							polygon.push_back(points);
+					std::atomic_int next_brush = 0;
+					const auto worker = [&]
+					{
+						const auto scratch = std::make_unique<winding_scratch>();
 
-							const auto indices = mapbox::earcut<int>(polygon);
-							for (auto i = 0u; i < indices.size(); i += 3)
+						for (auto i = next_brush++; i < brush_count; i = next_brush++)
+						{
+							if (!script_brushes[i])
 							{
-								triangle_t triangle{};
-								triangle.verts[0] = base_index + indices[i + 2];
-								triangle.verts[1] = base_index + indices[i + 1];
-								triangle.verts[2] = base_index + indices[i + 0];
-								triangles.emplace_back(triangle);
+								generate_brush_triangles(asset, i, *scratch, geometry[i]);
 							}
 						}
 					};
 
-					constexpr auto max_verts = 0x1000;
-					constexpr auto max_polys = 0x1000;
-					float verts[max_verts][3]{};
-					polygon_t polys[max_verts]{};
+					const auto thread_count = std::max(1, std::min(brush_count / 64,
+						static_cast<int>(std::thread::hardware_concurrency())));
 
-					build_windings_for_brush(asset->pInfo, &brush_bounds, brush, polys, max_polys, verts, max_verts);
-					for (auto side_index = 0; side_index < brush->numsides + 6; side_index++)
+					std::vector<std::thread> threads;
+					for (auto i = 1; i < thread_count; i++)
 					{
-						const auto poly = &polys[side_index];
-						add_points(side_index, poly);
+						threads.emplace_back(worker);
 					}
 
-					return triangles;
+					worker();
+
+					for (auto& thread : threads)
+					{
+						thread.join();
+					}
+
+					return geometry;
 				}
 
+				struct vertex_key_hash
+				{
+					std::size_t operator()(const std::array<float, 3>& v) const
+					{
+						// -0.0 == 0.0 but their bits differ, hash both as 0.0 so they weld
+						const auto normalize = [](const float value)
+						{
+							return value == 0.0f ? 0.0f : value;
+						};
+
+						const std::array<float, 3> key = {normalize(v[0]), normalize(v[1]), normalize(v[2])};
+						return utils::cryptography::fnv1a::compute(key.data(), sizeof(float[3]));
+					}
+				};
+
+				struct triangle_key_hash
+				{
+					std::size_t operator()(const std::array<int, 3>& tri) const
+					{
+						return utils::cryptography::fnv1a::compute(tri.data(), sizeof(int[3]));
+					}
+				};
+
 				std::vector<triangle_t> generate_triangles(zonetool::h1::clipMap_t* asset, std::vector<zonetool::h1::dmFloat4>& vertices)
 				{
-					std::vector<triangle_t> triangles;
-					std::unordered_set<int> triangle_hashes;
+					const auto brushes = generate_brushes_geometry(asset);
+
+					// collision verts keep their indices since partitions refer to them directly,
+					// duplicates are only remapped for the purpose of triangle deduplication
+					std::unordered_map<std::array<float, 3>, int, vertex_key_hash> vertex_map;
+					std::vector<int> vertex_remap(vertices.size());
+					vertex_map.reserve(vertices.size() * 2);
+
+					for (auto i = 0u; i < vertices.size(); i++)
+					{
+						const std::array<float, 3> pos = {vertices[i].x, vertices[i].y, vertices[i].z};
+						vertex_remap[i] = vertex_map.try_emplace(pos, static_cast<int>(i)).first->second;
+					}
+
+					const auto add_vertex = [&](const std::array<float, 3>& pos)
+					{
+						const auto [itr, inserted] = vertex_map.try_emplace(pos, static_cast<int>(vertices.size()));
+						if (inserted)
+						{
+							zonetool::h1::dmFloat4 vertex{};
+							vertex.x = pos[0];
+							vertex.y = pos[1];
+							vertex.z = pos[2];
+							vertices.emplace_back(vertex);
+						}
 
-					auto triangle_index = 0;
+						return itr->second;
+					};
 
-					const auto add_triangle = [&](triangle_t& triangle)
+					std::vector<triangle_t> triangles;
+					std::unordered_set<std::array<int, 3>, triangle_key_hash> triangle_set;
+
+					// same triangle with a rotated winding is still the same triangle
+					const auto add_triangle = [&](int a, int b, int c)
 					{
-						const auto hash = hash_triangle(triangle, vertices);
-						if (triangle_hashes.contains(hash))
+						if (a == b || b == c || a == c)
+						{
+							return;
+						}
+
+						while (a > b || a > c)
+						{
+							std::swap(a, b);
+							std::swap(b, c);
+						}
+
+						if (!triangle_set.insert({a, b, c}).second)
 						{
 							return;
 						}
 
-						triangle_hashes.insert(hash);
-						triangle.index = triangle_index++;
+						triangle_t triangle{};
+						triangle.index = static_cast<int>(triangles.size());
+						triangle.verts[0] = a;
+						triangle.verts[1] = b;
+						triangle.verts[2] = c;
 						triangles.emplace_back(triangle);
 					};
 
-					for (auto i = 0u; i < asset->info.bCollisionData.numBrushes; i++)
+					std::vector<int> local_remap;
+					for (const auto& brush : brushes)
 					{
-						const auto brush_tris = generate_brush_triangles(asset, vertices, i);
-						for (auto tri : brush_tris)
+						local_remap.resize(brush.verts.size());
+						for (auto i = 0u; i < brush.verts.size(); i++)
+						{
+							local_remap[i] = add_vertex(brush.verts[i]);
+						}
+
+						for (const auto& tri : brush.tris)
 						{
-							add_triangle(tri);
+							add_triangle(local_remap[tri[0]], local_remap[tri[1]], local_remap[tri[2]]);
 						}
 					}
 
+					const auto script_partitions = get_script_brushmodel_partitions(asset);
+
 					for (auto i = 0; i < asset->info.pCollisionData.partitionCount; i++)
 					{
 						const auto partition = &asset->info.pCollisionData.partitions[i];
-						if (is_script_brushmodel_partition(asset, partition))
+						if (script_partitions[i])
 						{
 							continue;
 						}
@@ -578,11 +521,9 @@ namespace zonetool::iw6
 						auto tri_indices = &asset->info.pCollisionData.triIndices[3 * partition->firstTri];
 						for (auto o = 0u; o < partition->triCount; o++)
 						{
-							triangle_t triangle{};
-							triangle.verts[0] = tri_indices[0] + 1024 * partition->firstVertSegment;
-							triangle.verts[1] = tri_indices[1] + 1024 * partition->firstVertSegment;
-							triangle.verts[2] = tri_indices[2] + 1024 * partition->firstVertSegment;
-							add_triangle(triangle);
+							const auto base = 1024 * partition->firstVertSegment;
+							add_triangle(vertex_remap[tri_indices[0] + base], vertex_remap[tri_indices[1] + base],
+								vertex_remap[tri_indices[2] + base]);
 
 							tri_indices += 3;
 						}
@@ -591,426 +532,309 @@ namespace zonetool::iw6
 					return triangles;
 				}
 
-				// https://github.com/autonomousvision/occupancy_flow/blob/master/im2mesh/utils/libvoxelize/tribox2.h
-
-
-#define FINDMINMAX(x0, x1, x2, min, max) \
-		min = max = x0; \
-		if (x1 < min) min = x1; \
-		if (x1 > max) max = x1; \
-		if (x2 < min) min = x2; \
-		if (x2 > max) max = x2; \
-
-#define AXISTEST_X01(a, b, fa, fb) \
-		p0 = a * v0[1] - b * v0[2]; \
-		p2 = a * v2[1] - b * v2[2]; \
-		if (p0 < p2) \
-		{ \
-			min = p0; \
-			max = p2; \
-		} \
-		else \
-		{ \
-			min = p2; \
-			max = p0; \
-		} \
-		rad = fa * boxhalfsize[1] + fb * boxhalfsize[2]; \
-		if (min > rad || max < -rad) \
-		{ \
-			return false; \
-		} \
-
-#define AXISTEST_X2(a, b, fa, fb) \
-		p0 = a * v0[1] - b * v0[2]; \
-		p1 = a * v1[1] - b * v1[2]; \
-		if (p0 < p1) \
-		{ \
-			min = p0;\
-			max = p1; \
-		} \
-		else \
-		{ \
-			min = p1; \
-			max = p0; \
-		} \
-		rad = fa * boxhalfsize[1] + fb * boxhalfsize[2]; \
-		if (min > rad || max < -rad) \
-		{ \
-			return false; \
-		} \
-
-#define AXISTEST_Y02(a, b, fa, fb) \
-		p0 = -a * v0[0] + b * v0[2]; \
-		p2 = -a * v2[0] + b * v2[2]; \
-		if (p0 < p2) \
-		{ \
-			min = p0; \
-			max = p2; \
-		}\
-		else \
-		{ \
-			min = p2; \
-			max = p0; \
-		} \
-		rad = fa * boxhalfsize[0] + fb * boxhalfsize[2]; \
-		if (min > rad || max < -rad) \
-		{ \
-			return false; \
-		} \
-
-#define AXISTEST_Y1(a, b, fa, fb) \
-		p0 = -a * v0[0] + b * v0[2]; \
-		p1 = -a * v1[0] + b * v1[2]; \
-		if (p0 < p1) \
-		{ \
-			min = p0; \
-			max = p1; \
-		} \
-		else \
-		{ \
-			min = p1;  \
-			max = p0; \
-		} \
-		rad = fa * boxhalfsize[0] + fb * boxhalfsize[2]; \
-		if (min > rad || max < -rad) \
-		{ \
-			return false; \
-		} \
-
-#define AXISTEST_Z12(a, b, fa, fb) \
-		p1 = a * v1[0] - b * v1[1]; \
-		p2 = a * v2[0] - b * v2[1]; \
-		if (p2 < p1) \
-		{ \
-			min = p2; \
-			max = p1; \
-		} \
-		else \
-		{ \
-			min = p1; \
-			max = p2; \
-		} \
-		rad = fa * boxhalfsize[0] + fb * boxhalfsize[1]; \
-		if (min > rad || max < -rad) \
-		{ \
-			return false; \
-		} \
-
-#define AXISTEST_Z0(a, b, fa, fb) \
-		p0 = a * v0[0] - b * v0[1]; \
-		p1 = a * v1[0] - b * v1[1]; \
-		if (p0 < p1) \
-		{ \
-			min = p0; \
-			max = p1; \
-		} \
-		else \
-		{ \
-			min = p1; \
-			max = p0; \
-		} \
-		rad = fa * boxhalfsize[0] + fb * boxhalfsize[1]; \
-		if (min > rad || max < -rad) \
-		{ \
-			return false; \
-		} \
-
-				bool plane_box_overlap(float normal[3], float vert[3], float maxbox[3])
+				constexpr auto max_tris_per_leaf = 15; // dmMeshNode::triangleCount is 4 bits
+				constexpr auto max_tree_depth = 128;
+
+				constexpr auto sah_bin_count = 32;
+				constexpr auto sah_traversal_cost = 1.f;
+				constexpr auto sah_intersection_cost = 1.f;
+
+				// ranges larger than this build their right subtree on a separate thread
+				constexpr auto parallel_build_min_tris = 0x4000;
+				constexpr auto parallel_build_max_depth = 4;
+
+				struct triangle_ref
 				{
-					float vmin[3]{};
-					float vmax[3]{};
+					bounding_box box;
+					float centroid[3];
+					triangle_t triangle;
+				};
 
-					for (auto q = 0; q < 3; q++)
-					{
-						const auto v = vert[q];
-						if (normal[q] > 0.0f)
-						{
-							vmin[q] = -maxbox[q] - v;
-							vmax[q] = maxbox[q] - v;
+				struct build_node
+				{
+					bounding_box box;
+					zonetool::h1::dmMeshNode_anon anon;
+				};
 
-						}
-						else
-						{
-							vmin[q] = maxbox[q] - v;
-							vmax[q] = -maxbox[q] - v;
-						}
-					}
+				struct sah_bin
+				{
+					bounding_box box;
+					std::size_t count;
+				};
 
-					if (dot_product(normal, vmin) > 0.0f)
+				bounding_box empty_bounding_box()
+				{
+					bounding_box box{};
+					for (auto i = 0; i < 3; i++)
 					{
-						return false;
+						box.lower[i] = std::numeric_limits<float>::max();
+						box.upper[i] = -std::numeric_limits<float>::max();
 					}
+					return box;
+				}
 
-					if (dot_product(normal, vmax) >= 0.0f)
+				void grow_bounding_box(bounding_box& box, const float* point)
+				{
+					for (auto i = 0; i < 3; i++)
 					{
-						return true;
+						box.lower[i] = std::min(box.lower[i], point[i]);
+						box.upper[i] = std::max(box.upper[i], point[i]);
 					}
-
-					return false;
 				}
 
-				bool tri_box_overlap(float boxcenter[3], float boxhalfsize[3], float triverts[3][3])
+				void grow_bounding_box(bounding_box& box, const bounding_box& other)
 				{
-					float v0[3]{};
-					float v1[3]{};
-					float v2[3]{};
-
-					float min{}, max{};
-					float p0{}, p1{}, p2{};
-					float rad{};
-					float fex{}, fey{}, fez{};
-
-					float normal[3]{}, e0[3]{}, e1[3]{}, e2[3]{};
-
-					vector_sub(triverts[0], boxcenter, v0);
-					vector_sub(triverts[1], boxcenter, v1);
-					vector_sub(triverts[2], boxcenter, v2);
-
-					vector_sub(v1, v0, e0);
-					vector_sub(v2, v1, e1);
-					vector_sub(v0, v2, e2);
-
-					fex = std::fabsf(e0[0]);
-					fey = std::fabsf(e0[1]);
-					fez = std::fabsf(e0[2]);
-
-					AXISTEST_X01(e0[2], e0[1], fez, fey);
-					AXISTEST_Y02(e0[2], e0[0], fez, fex);
-					AXISTEST_Z12(e0[1], e0[0], fey, fex);
+					grow_bounding_box(box, other.lower);
+					grow_bounding_box(box, other.upper);
+				}
 
-					fex = std::fabsf(e1[0]);
-					fey = std::fabsf(e1[1]);
-					fez = std::fabsf(e1[2]);
+				float calculate_surface_area(const bounding_box& box)
+				{
+					if (box.lower[0] > box.upper[0])
+					{
+						return 0.f;
+					}
 
-					AXISTEST_X01(e1[2], e1[1], fez, fey);
-					AXISTEST_Y02(e1[2], e1[0], fez, fex);
-					AXISTEST_Z0(e1[1], e1[0], fey, fex);
+					const auto l = box.upper[0] - box.lower[0];
+					const auto w = box.upper[1] - box.lower[1];
+					const auto h = box.upper[2] - box.lower[2];
 
-					fex = std::fabsf(e2[0]);
-					fey = std::fabsf(e2[1]);
-					fez = std::fabsf(e2[2]);
+					const auto a1 = l * w;
+					const auto a2 = l * h;
+					const auto a3 = w * h;
 
-					AXISTEST_X2(e2[2], e2[1], fez, fey);
-					AXISTEST_Y1(e2[2], e2[0], fez, fex);
-					AXISTEST_Z12(e2[1], e2[0], fey, fex);
+					return 2 * (a1 + a2 + a3);
+				}
 
-					FINDMINMAX(v0[0], v1[0], v2[0], min, max);
+				std::vector<triangle_ref> create_triangle_refs(const std::vector<zonetool::h1::dmFloat4>& vertices,
+					const std::vector<triangle_t>& triangles)
+				{
+					std::vector<triangle_ref> refs;
+					refs.resize(triangles.size());
 
-					if (min >= boxhalfsize[0] || max <= -boxhalfsize[0])
+					for (auto i = 0u; i < triangles.size(); i++)
 					{
-						return false;
-					}
+						auto& ref = refs[i];
+						ref.triangle = triangles[i];
+						ref.box = empty_bounding_box();
 
-					FINDMINMAX(v0[1], v1[1], v2[1], min, max);
+						for (auto o = 0; o < 3; o++)
+						{
+							grow_bounding_box(ref.box, &vertices[ref.triangle.verts[o]].x);
+						}
 
-					if (min >= boxhalfsize[1] || max <= -boxhalfsize[1])
-					{
-						return false;
+						for (auto o = 0; o < 3; o++)
+						{
+							ref.centroid[o] = (ref.box.lower[o] + ref.box.upper[o]) * 0.5f;
+						}
 					}
 
-					FINDMINMAX(v0[2], v1[2], v2[2], min, max);
+					return refs;
+				}
 
-					if (min >= boxhalfsize[2] || max <= -boxhalfsize[2])
+				std::size_t split_median(std::vector<triangle_ref>& refs, const std::size_t begin, const std::size_t end,
+					const bounding_box& centroid_box, int* axis)
+				{
+					*axis = 0;
+					for (auto i = 1; i < 3; i++)
 					{
-						return false;
+						if (centroid_box.upper[i] - centroid_box.lower[i] > centroid_box.upper[*axis] - centroid_box.lower[*axis])
+						{
+							*axis = i;
+						}
 					}
 
-					cross_product(e0, e1, normal);
-
-					if (!plane_box_overlap(normal, v0, boxhalfsize))
+					const auto mid = begin + (end - begin) / 2;
+					const auto split_axis = *axis;
+					std::nth_element(refs.begin() + begin, refs.begin() + mid, refs.begin() + end,
+						[split_axis](const triangle_ref& a, const triangle_ref& b)
 					{
-						return false;
-					}
+						return a.centroid[split_axis] < b.centroid[split_axis];
+					});
 
-					return true;
+					return mid;
 				}
 
-				zonetool::h1::Bounds corners_to_bounds(bounding_box box)
+				// returns the split position in [begin, end), or `end` when a leaf is cheaper than any split
+				std::size_t split_sah(std::vector<triangle_ref>& refs, const std::size_t begin, const std::size_t end,
+					const bounding_box& box, int* axis)
 				{
-					zonetool::h1::Bounds res{};
-
-					res.midPoint[0] = (box.upper[0] + box.lower[0]) * 0.5f;
-					res.midPoint[1] = (box.upper[1] + box.lower[1]) * 0.5f;
-					res.midPoint[2] = (box.upper[2] + box.lower[2]) * 0.5f;
-					res.halfSize[0] = (box.upper[0] - box.lower[0]) * 0.5f;
-					res.halfSize[1] = (box.upper[1] - box.lower[1]) * 0.5f;
-					res.halfSize[2] = (box.upper[2] - box.lower[2]) * 0.5f;
-
-					return res;
-				}
+					const auto count = end - begin;
 
-				bool tri_intersects_box(float tri[3][3], bounding_box box)
-				{
-					auto bounds = corners_to_bounds(box);
-					return tri_box_overlap(bounds.midPoint, bounds.halfSize, tri);
-				}
+					auto centroid_box = empty_bounding_box();
+					for (auto i = begin; i < end; i++)
+					{
+						grow_bounding_box(centroid_box, refs[i].centroid);
+					}
 
-				bool triangle_box_overlay(zonetool::h1::dmMeshData* mesh, const triangle_t& triangle, const bounding_box& box)
-				{
-					const auto verts = &mesh->m_aVertices[0];
+					const auto parent_area = std::max(calculate_surface_area(box), std::numeric_limits<float>::epsilon());
 
-					zonetool::h1::vec3_t p1{};
-					zonetool::h1::vec3_t p3{};
-					zonetool::h1::vec3_t p2{};
-					zonetool::h1::vec3_t points[3]{};
+					auto best_cost = std::numeric_limits<float>::max();
+					auto best_axis = -1;
+					auto best_bin = 0;
 
-					p1[0] = verts[triangle.verts[0]].x;
-					p1[1] = verts[triangle.verts[0]].y;
-					p1[2] = verts[triangle.verts[0]].z;
+					for (auto a = 0; a < 3; a++)
+					{
+						const auto extent = centroid_box.upper[a] - centroid_box.lower[a];
+						if (extent <= 0.f)
+						{
+							continue;
+						}
 
-					p2[0] = verts[triangle.verts[1]].x;
-					p2[1] = verts[triangle.verts[1]].y;
-					p2[2] = verts[triangle.verts[1]].z;
+						sah_bin bins[sah_bin_count]{};
+						for (auto& bin : bins)
+						{
+							bin.box = empty_bounding_box();
+						}
 
-					p3[0] = verts[triangle.verts[2]].x;
-					p3[1] = verts[triangle.verts[2]].y;
-					p3[2] = verts[triangle.verts[2]].z;
+						const auto scale = sah_bin_count / extent;
+						for (auto i = begin; i < end; i++)
+						{
+							const auto b = std::min(sah_bin_count - 1,
+								static_cast<int>((refs[i].centroid[a] - centroid_box.lower[a]) * scale));
+							bins[b].count++;
+							grow_bounding_box(bins[b].box, refs[i].box);
+						}
 
-					points[0][0] = p1[0];
-					points[0][1] = p1[1];
-					points[0][2] = p1[2];
+						float right_area[sah_bin_count]{};
+						std::size_t right_count[sah_bin_count]{};
 
-					points[1][0] = p2[0];
-					points[1][1] = p2[1];
-					points[1][2] = p2[2];
+						auto accum = empty_bounding_box();
+						std::size_t accum_count = 0;
+						for (auto b = sah_bin_count - 1; b > 0; b--)
+						{
+							grow_bounding_box(accum, bins[b].box);
+							accum_count += bins[b].count;
+							right_area[b] = calculate_surface_area(accum);
+							right_count[b] = accum_count;
+						}
 
-					points[2][0] = p3[0];
-					points[2][1] = p3[1];
-					points[2][2] = p3[2];
+						accum = empty_bounding_box();
+						accum_count = 0;
+						for (auto b = 1; b < sah_bin_count; b++)
+						{
+							grow_bounding_box(accum, bins[b - 1].box);
+							accum_count += bins[b - 1].count;
 
-					return tri_intersects_box(points, box);
-				}
+							if (accum_count == 0 || right_count[b] == 0)
+							{
+								continue;
+							}
 
-				std::vector<triangle_t> get_triangles_in_box(zonetool::h1::dmMeshData* mesh, const std::vector<triangle_t>& triangles,
-					const bounding_box& root)
-				{
-					std::vector<triangle_t> res;
+							const auto cost = sah_traversal_cost + sah_intersection_cost *
+								(calculate_surface_area(accum) * accum_count + right_area[b] * right_count[b]) / parent_area;
 
-					for (const auto& tri : triangles)
-					{
-						if (triangle_box_overlay(mesh, tri, root))
-						{
-							res.emplace_back(tri);
+							if (cost < best_cost)
+							{
+								best_cost = cost;
+								best_axis = a;
+								best_bin = b;
+							}
 						}
 					}
 
-					return res;
-				}
-
-				unsigned int write_triangles(std::vector<triangle_t>& dest_triangles, const std::vector<triangle_t>& triangles)
-				{
-					auto index = dest_triangles.size();
-
-					for (const auto& tri : triangles)
+					const auto leaf_cost = sah_intersection_cost * count;
+					if (count <= max_tris_per_leaf && best_cost >= leaf_cost)
 					{
-						triangle_t dest_tri{};
-						std::memcpy(&dest_tri, &tri, sizeof(triangle_t));
-						dest_tri.index = static_cast<int>(dest_triangles.size());
-						dest_triangles.emplace_back(dest_tri);
+						return end;
 					}
 
-					return static_cast<unsigned int>(index);
-				}
-
-				int find_best_axis(zonetool::h1::dmMeshData* mesh, const std::vector<triangle_t>& triangles,
-					const bounding_box& box, float* value)
-				{
-					auto length = 0.f;
-					auto axis = 0;
-
-					for (auto i = 0; i < 3; i++)
+					if (best_axis == -1)
 					{
-						const auto l = std::abs(box.upper[i] - box.lower[i]);
-						if (l > length)
-						{
-							axis = i;
-							length = l;
-						}
+						// every centroid is in the same spot, split the range in half
+						return split_median(refs, begin, end, centroid_box, axis);
 					}
 
-					*value = box.lower[axis] + length / 2;
-					return axis;
-				}
-
-				constexpr auto max_tris_per_leaf = 15;
-				constexpr auto max_tree_depth = 128;
+					*axis = best_axis;
 
-				float calculate_surface_area(const bounding_box& box)
-				{
-					const auto l = box.upper[0] - box.lower[0];
-					const auto w = box.upper[1] - box.lower[1];
-					const auto h = box.upper[2] - box.lower[2];
+					const auto lower = centroid_box.lower[best_axis];
+					const auto scale = sah_bin_count / (centroid_box.upper[best_axis] - lower);
+					const auto mid_it = std::partition(refs.begin() + begin, refs.begin() + end, [&](const triangle_ref& ref)
+					{
+						return std::min(sah_bin_count - 1, static_cast<int>((ref.centroid[best_axis] - lower) * scale)) < best_bin;
+					});
 
-					const auto a1 = l * w;
-					const auto a2 = l * h;
-					const auto a3 = w * h;
+					const auto mid = static_cast<std::size_t>(mid_it - refs.begin());
+					if (mid == begin || mid == end)
+					{
+						return split_median(refs, begin, end, centroid_box, axis);
+					}
 
-					return 2 * (a1 + a2 + a3);
+					return mid;
 				}
 
-				void compute_aabb_tree(zonetool::h1::dmMeshData* mesh, std::vector<triangle_t>& dest_triangles,
-					const std::vector<triangle_t>& parent_triangles,
-					const bounding_box& root, mesh_node* nodes, int& node_index, int& tree_depth)
+				// emits nodes depth-first: an inner node is followed by its left subtree, `index` is the offset to its right child
+				void build_bvh_r(std::vector<triangle_ref>& refs, const std::size_t begin, const std::size_t end,
+					const int depth, std::vector<build_node>& out)
 				{
-					const auto surface_area = calculate_surface_area(root);
-					const auto triangles = get_triangles_in_box(mesh, parent_triangles, root);
-
-					if (triangles.size() > max_tris_per_leaf && tree_depth < max_tree_depth && surface_area > 1.f)
+					auto box = empty_bounding_box();
+					for (auto i = begin; i < end; i++)
 					{
-						float value{};
-						const auto axis = find_best_axis(mesh, triangles, root, &value);
+						grow_bounding_box(box, refs[i].box);
+					}
 
-						bounding_box left{};
-						bounding_box right{};
+					auto axis = 0;
+					auto mid = end;
+					if (depth < max_tree_depth || end - begin > max_tris_per_leaf)
+					{
+						mid = split_sah(refs, begin, end, box, &axis);
+					}
 
-						std::memcpy(&left, &root, sizeof(bounding_box));
-						std::memcpy(&right, &root, sizeof(bounding_box));
+					if (mid == end)
+					{
+						build_node leaf{};
+						leaf.box = box;
+						leaf.anon.fields.triangleCount = static_cast<unsigned int>(end - begin);
+						leaf.anon.fields.index = static_cast<unsigned int>(begin);
+						out.emplace_back(leaf);
+						return;
+					}
 
-						left.upper[axis] = value;
-						right.lower[axis] = value;
+					const auto node_index = out.size();
 
-						const auto left_tris = get_triangles_in_box(mesh, triangles, left);
-						const auto right_tris = get_triangles_in_box(mesh, triangles, right);
+					build_node node{};
+					node.box = box;
+					node.anon.fields.axis = axis;
+					out.emplace_back(node);
 
-						if (left_tris.size() == 0 || right_tris.size() == 0)
+					if (depth < parallel_build_max_depth && end - begin >= parallel_build_min_tris)
+					{
+						std::vector<build_node> right_nodes;
+						std::thread right_thread([&]
 						{
-							if (left_tris.size() > 0)
-							{
-								return compute_aabb_tree(mesh, dest_triangles, left_tris, left, nodes, node_index, tree_depth);
-							}
-							else if (right_tris.size() > 0)
-							{
-								return compute_aabb_tree(mesh, dest_triangles, right_tris, right, nodes, node_index, tree_depth);
-							}
-						}
-
-						const auto initial_index = node_index;
-						const auto parent_node = alloc_node(nodes, node_index);
-						std::memcpy(parent_node->lower, root.lower, sizeof(float[3]));
-						std::memcpy(parent_node->upper, root.upper, sizeof(float[3]));
-						tree_depth++;
+							build_bvh_r(refs, mid, end, depth + 1, right_nodes);
+						});
 
-						compute_aabb_tree(mesh, dest_triangles, triangles, left, nodes, node_index, tree_depth);
-						parent_node->node.anon.fields.index = node_index - initial_index;
-						compute_aabb_tree(mesh, dest_triangles, triangles, right, nodes, node_index, tree_depth);
+						build_bvh_r(refs, begin, mid, depth + 1, out);
+						right_thread.join();
 
-						tree_depth--;
+						out[node_index].anon.fields.index = static_cast<unsigned int>(out.size() - node_index);
+						out.insert(out.end(), right_nodes.begin(), right_nodes.end());
 					}
-					else if (triangles.size() > 0)
+					else
 					{
-						const auto leaf = alloc_node(nodes, node_index);
-						const auto box = compute_bounding_box(mesh, triangles);
-						std::memcpy(leaf->lower, box.lower, sizeof(float[3]));
-						std::memcpy(leaf->upper, box.upper, sizeof(float[3]));
-						leaf->node.anon.fields.triangleCount = static_cast<unsigned int>(std::min((int)triangles.size(), max_tris_per_leaf));
-						leaf->node.anon.fields.index = write_triangles(dest_triangles, triangles);
+						build_bvh_r(refs, begin, mid, depth + 1, out);
+						out[node_index].anon.fields.index = static_cast<unsigned int>(out.size() - node_index);
+						build_bvh_r(refs, mid, end, depth + 1, out);
 					}
-					else
+				}
+
+				std::vector<build_node> build_bvh(std::vector<triangle_ref>& refs)
+				{
+					std::vector<build_node> nodes;
+
+					if (refs.empty())
 					{
-						const auto leaf = alloc_node(nodes, node_index);
-						leaf->node.anon.fields.triangleCount = 1;
-						leaf->node.anon.fields.index = 0;
+						build_node leaf{};
+						leaf.anon.fields.triangleCount = 1;
+						leaf.anon.fields.index = 0;
+						nodes.emplace_back(leaf);
+						return nodes;
 					}
+
+					nodes.reserve(2 * (refs.size() / 2 + 1));
+					build_bvh_r(refs, 0, refs.size(), 0, nodes);
+					return nodes;
 				}
 			}
 
@@ -1058,69 +882,40 @@ namespace zonetool::iw6
 				mesh->m_aVertices = allocator.allocate_array<zonetool::h1::dmFloat4>(mesh->m_vertexCount);
 				std::memcpy(mesh->m_aVertices, vertices.data(), vertices.size() * sizeof(zonetool::h1::dmFloat4));
 
-				max_nodes = static_cast<int>(triangles.size()) * max_tree_depth;
-				const auto nodes = allocator.allocate_array<mesh_node>(max_nodes);
-
-				auto node_index = 0;
-
-				std::vector<triangle_t> dest_triangles;
+				auto refs = create_triangle_refs(vertices, triangles);
+				const auto nodes = build_bvh(refs);
 
-				for (auto& tri : triangles)
-				{
-					dest_triangles.emplace_back(tri);
-				}
-
-				const auto root = compute_bounding_box(mesh, triangles);
-				int tree_depth = 0;
-				compute_aabb_tree(mesh, dest_triangles, triangles, root, nodes, node_index, tree_depth);
-
-				mesh->m_triangleCount = static_cast<int>(dest_triangles.size());
+				// triangles are reordered so every leaf references a contiguous range
+				mesh->m_triangleCount = static_cast<int>(refs.size());
 				mesh->m_aTriangles = allocator.allocate_array<zonetool::h1::dmMeshTriangle>(mesh->m_triangleCount);
 
-				for (const auto& tri : dest_triangles)
+				for (auto i = 0u; i < refs.size(); i++)
 				{
-					mesh->m_aTriangles[tri.index].i1 = tri.verts[2];
-					mesh->m_aTriangles[tri.index].i2 = tri.verts[1];
-					mesh->m_aTriangles[tri.index].i3 = tri.verts[0];
-					mesh->m_aTriangles[tri.index].w1 = -1;
-					mesh->m_aTriangles[tri.index].w2 = -1;
-					mesh->m_aTriangles[tri.index].w3 = -1;
-					mesh->m_aTriangles[tri.index].materialIndex = 0;
-					mesh->m_aTriangles[tri.index].collisionFlags = 1;
+					const auto& tri = refs[i].triangle;
+					mesh->m_aTriangles[i].i1 = tri.verts[2];
+					mesh->m_aTriangles[i].i2 = tri.verts[1];
+					mesh->m_aTriangles[i].i3 = tri.verts[0];
+					mesh->m_aTriangles[i].w1 = -1;
+					mesh->m_aTriangles[i].w2 = -1;
+					mesh->m_aTriangles[i].w3 = -1;
+					mesh->m_aTriangles[i].materialIndex = 0;
+					mesh->m_aTriangles[i].collisionFlags = 1;
 				}
 
-				mesh->m_nodeCount = node_index;
+				const auto node_count = static_cast<int>(nodes.size());
+				mesh->m_nodeCount = node_count;
 				mesh->m_pRoot = allocator.allocate_array<zonetool::h1::dmMeshNode>(mesh->m_nodeCount);
 
 				float maxs[3]{};
 				float mins[3]{};
 				float unquantize[3]{};
 
-				for (auto i = 0; i < node_index; i++)
+				for (const auto& node : nodes)
 				{
-					const auto node = &nodes[i];
-
 					for (auto o = 0; o < 3; o++)
 					{
-						if (node->lower[o] > maxs[o])
-						{
-							maxs[o] = node->lower[o];
-						}
-
-						if (node->lower[o] < mins[o])
-						{
-							mins[o] = node->lower[o];
-						}
-
-						if (node->upper[o] > maxs[o])
-						{
-							maxs[o] = node->upper[o];
-						}
-
-						if (node->upper[o] < mins[o])
-						{
-							mins[o] = node->upper[o];
-						}
+						maxs[o] = std::max(maxs[o], node.box.upper[o]);
+						mins[o] = std::min(mins[o], node.box.lower[o]);
 					}
 				}
 
@@ -1130,6 +925,11 @@ namespace zonetool::iw6
 						maxs[i] / static_cast<float>(std::numeric_limits<std::int16_t>().max()),
 						mins[i] / static_cast<float>(std::numeric_limits<std::int16_t>().min())
 					);
+
+					if (unquantize[i] <= 0.f)
+					{
+						unquantize[i] = 1.f;
+					}
 				}
 
 				ZONETOOL_INFO("mins: %f %f %f", mins[0], mins[1], mins[2]);
@@ -1151,25 +951,29 @@ namespace zonetool::iw6
 				mesh->m_height = 127;
 				mesh->contents = 1;
 
-				for (auto i = 0; i < node_index; i++)
+				// round outwards so quantized nodes always contain their triangles
+				const auto quantize = [](const float value, const float scale, const bool upper)
 				{
-					const auto node = &nodes[i];
-
-					mesh->m_pRoot[i].lowerX = static_cast<zonetool::h1::dm_int16>(node->lower[0] / mesh->m_unquantize.x);
-					mesh->m_pRoot[i].lowerY = static_cast<zonetool::h1::dm_int16>(node->lower[1] / mesh->m_unquantize.y);
-					mesh->m_pRoot[i].lowerZ = static_cast<zonetool::h1::dm_int16>(node->lower[2] / mesh->m_unquantize.z);
-					mesh->m_pRoot[i].upperX = static_cast<zonetool::h1::dm_int16>(node->upper[0] / mesh->m_unquantize.x);
-					mesh->m_pRoot[i].upperY = static_cast<zonetool::h1::dm_int16>(node->upper[1] / mesh->m_unquantize.y);
-					mesh->m_pRoot[i].upperZ = static_cast<zonetool::h1::dm_int16>(node->upper[2] / mesh->m_unquantize.z);
-
-					mesh->m_pRoot[i].anon.fields.axis = node->node.anon.fields.axis;
-					mesh->m_pRoot[i].anon.fields.triangleCount = node->node.anon.fields.triangleCount;
-					mesh->m_pRoot[i].anon.fields.index = node->node.anon.fields.index;
-				}
+					const auto scaled = upper ? std::ceil(value / scale) : std::floor(value / scale);
+					return static_cast<zonetool::h1::dm_int16>(std::clamp(scaled,
+						static_cast<float>(std::numeric_limits<std::int16_t>::min()),
+						static_cast<float>(std::numeric_limits<std::int16_t>::max())));
+				};
+
+				for (auto i = 0; i < node_count; i++)
+				{
+					const auto& node = nodes[i];
 
-				allocator.free(nodes);
+					mesh->m_pRoot[i].lowerX = quantize(node.box.lower[0], mesh->m_unquantize.x, false);
+					mesh->m_pRoot[i].lowerY = quantize(node.box.lower[1], mesh->m_unquantize.y, false);
+					mesh->m_pRoot[i].lowerZ = quantize(node.box.lower[2], mesh->m_unquantize.z, false);
+					mesh->m_pRoot[i].upperX = quantize(node.box.upper[0], mesh->m_unquantize.x, true);
+					mesh->m_pRoot[i].upperY = quantize(node.box.upper[1], mesh->m_unquantize.y, true);
+					mesh->m_pRoot[i].upperZ = quantize(node.box.upper[2], mesh->m_unquantize.z, true);
+					mesh->m_pRoot[i].anon.packed = node.anon.packed;
+				}
 
-				ZONETOOL_INFO("generation complete, total nodes: %i", node_index);
+				ZONETOOL_INFO("generation complete, total nodes: %i", node_count);
 
 				return new_asset;
 			}
@@ -17,6 +17,8 @@
 
 #include <shader-tool/shader.hpp>
 
+#include "zonetool/utils/shader_patch_cache.hpp"
+
 #include <utils/cryptography.hpp>
 
 namespace asm_ = alys::shader::literals;
@@ -1474,6 +1476,24 @@ namespace zonetool::iw6
 				return false;
 			}
 
+			// everything patch_shader_const reads from the patch data, temp_index is only set while patching
+			std::string get_patch_params(const pixelshader_patch_data_t& patch_data)
+			{
+				std::string params;
+				for (const auto* arg : patch_data.args)
+				{
+					shader_patch_cache::add_param(params, arg->dest);
+					shader_patch_cache::add_param(params, arg->u.codeConst.index);
+					shader_patch_cache::add_param(params, arg->u.codeConst.firstRow);
+					shader_patch_cache::add_param(params, arg->u.codeConst.rowCount);
+				}
+
+				shader_patch_cache::add_param(params, patch_data.cb_sizes);
+				shader_patch_cache::add_param(params, patch_data.db.used);
+				shader_patch_cache::add_param(params, patch_data.db.dynamic_light_types_dest);
+				return params;
+			}
+
 			zonetool::h1::MaterialPixelShader* convert_pixelshader(MaterialPixelShader* asset, utils::memory::allocator& allocator, pixelshader_patch_data_t& patch_data)
 			{
 				auto* new_asset = allocator.allocate<zonetool::h1::MaterialPixelShader>();
@@ -1484,12 +1504,17 @@ namespace zonetool::iw6
 				if (!patch_data.args.empty())
 				{
 					const auto data = std::string{ reinterpret_cast<const char*>(asset->prog.loadDef.program), asset->prog.loadDef.programSize };
-					const auto buffer = alys::shader::patch_shader(data,
-						[&](alys::shader::assembler& a, alys::shader::detail::instruction_t& instruction) -> bool
+					const auto buffer = shader_patch_cache::get("iw6_h1_pixelshader", data, get_patch_params(patch_data), [&]
 					{
-						return patch_shader_const(a, instruction, patch_data);
-					}
-					);
+						const auto patched = alys::shader::patch_shader(data,
+							[&](alys::shader::assembler& a, alys::shader::detail::instruction_t& instruction) -> bool
+						{
+							return patch_shader_const(a, instruction, patch_data);
+						}
+						);
+
+						return std::string{patched.begin(), patched.end()};
+					});
 
 					new_asset->prog.loadDef.programSize = static_cast<unsigned int>(buffer.size());
 					new_asset->prog.loadDef.program = allocator.allocate_array<unsigned char>(buffer.size());
@@ -1651,35 +1676,45 @@ namespace zonetool::iw6
 				new_asset->prog.loadDef.programSize = asset->prog.loadDef.programSize;
 
 				const auto data = std::string{ reinterpret_cast<char*>(asset->prog.loadDef.program), asset->prog.loadDef.programSize };
-				const auto buffer = alys::shader::patch_shader(data,
-					[&](alys::shader::assembler& a, alys::shader::detail::instruction_t instruction) -> bool
+				std::string params;
+				shader_patch_cache::add_param(params, stable);
+				shader_patch_cache::add_param(params, original_dest);
+				shader_patch_cache::add_param(params, new_dest);
+
+				const auto buffer = shader_patch_cache::get("iw6_h1_ocean_vertexshader", data, params, [&]
 				{
-					if (instruction.opcode.type != D3D10_SB_OPCODE_ADD || instruction.operands.size() != 3 ||
-						instruction.operands[2].type != D3D10_SB_OPERAND_TYPE_CONSTANT_BUFFER)
+					const auto patched = alys::shader::patch_shader(data,
+						[&](alys::shader::assembler& a, alys::shader::detail::instruction_t instruction) -> bool
 					{
-						return false;
-					}
+						if (instruction.opcode.type != D3D10_SB_OPCODE_ADD || instruction.operands.size() != 3 ||
+							instruction.operands[2].type != D3D10_SB_OPERAND_TYPE_CONSTANT_BUFFER)
+						{
+							return false;
+						}
 
-					auto& cb_operand = instruction.operands[2];
+						auto& cb_operand = instruction.operands[2];
 
-					if (cb_operand.indices[0].value.uint32 != stable ||
-						cb_operand.indices[1].value.uint32 != original_dest)
-					{
-						return false;
-					}
+						if (cb_operand.indices[0].value.uint32 != stable ||
+							cb_operand.indices[1].value.uint32 != original_dest)
+						{
+							return false;
+						}
 
-					if (cb_operand.components.selection_mode != D3D10_SB_OPERAND_4_COMPONENT_SWIZZLE_MODE)
-					{
-						return false;
-					}
+						if (cb_operand.components.selection_mode != D3D10_SB_OPERAND_4_COMPONENT_SWIZZLE_MODE)
+						{
+							return false;
+						}
 
-					//alys::shader::detail::disassembler::print_instruction(instruction);
+						//alys::shader::detail::disassembler::print_instruction(instruction);
 
-					cb_operand.indices[1].value.uint32 = new_dest;
-					a(instruction);
-					return true;
-				}
-				);
+						cb_operand.indices[1].value.uint32 = new_dest;
+						a(instruction);
+						return true;
+					}
+					);
+
+					return std::string{patched.begin(), patched.end()};
+				});
 
 				new_asset->prog.loadDef.programSize = static_cast<unsigned int>(buffer.size());
 				new_asset->prog.loadDef.program = allocator.allocate_array<unsigned char>(buffer.size());
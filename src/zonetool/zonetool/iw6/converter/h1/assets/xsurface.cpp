@@ -4,6 +4,8 @@
 
 #include "zonetool/h1/assets/xsurface.hpp"
 
+#include "zonetool/utils/vertex_cache.hpp"
+
 namespace zonetool::iw6
 {
 	namespace converter::h1
@@ -41,6 +43,18 @@ namespace zonetool::iw6
 				subdiv->flags |= 4;
 			}
 
+			void* copy_stream(const void* data, const std::size_t size, utils::memory::allocator& allocator)
+			{
+				if (!data || !size)
+				{
+					return nullptr;
+				}
+
+				auto* copy = allocator.allocate(size);
+				std::memcpy(copy, data, size);
+				return copy;
+			}
+
 			zonetool::h1::XModelSurfs* convert(XModelSurfs* asset, utils::memory::allocator& allocator)
 			{
 				auto* new_asset = allocator.allocate<zonetool::h1::XModelSurfs>();
@@ -49,6 +63,8 @@ namespace zonetool::iw6
 
 				COPY_VALUE(numsurfs);
 
+				const auto optimize = vertex_cache::is_enabled();
+
 				new_asset->surfs = allocator.allocate_array<zonetool::h1::XSurface>(asset->numsurfs);
 				for (unsigned short i = 0; i < asset->numsurfs; i++)
 				{
@@ -126,10 +142,29 @@ namespace zonetool::iw6
 					COPY_ARR(surfs[i].partBits);
 
 					R_FixSubdivRegularPatchFlags(new_surf);
+
+					if (optimize)
+					{
+						// the optimizer works in place, don't touch the loaded zone's buffers
+						const auto vert_size = (surf->flags & 8) != 0
+							? sizeof(zonetool::h1::GfxPackedMotionVertex)
+							: sizeof(zonetool::h1::GfxPackedVertex);
+
+						new_surf->verts0.verts0 = copy_stream(surf->verts0.verts0, vert_size * surf->vertCount, allocator);
+						new_surf->triIndices = reinterpret_cast<zonetool::h1::Face*>(
+							copy_stream(surf->triIndices, sizeof(zonetool::h1::Face) * surf->triCount, allocator));
+						new_surf->blendVertsTable = reinterpret_cast<zonetool::h1::BlendVertsUnknown*>(
+							copy_stream(surf->blendVertsTable, sizeof(zonetool::h1::BlendVertsUnknown) * surf->vertCount, allocator));
+					}
 				}
 
 				COPY_ARR(partBits);
 
+				if (optimize)
+				{
+					zonetool::h1::xsurface::optimize(new_asset);
+				}
+
 				return new_asset;
 			}
 
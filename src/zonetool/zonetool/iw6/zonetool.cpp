@@ -11,6 +11,10 @@
 
 #include "../utils/gsc.hpp"
 #include "../utils/csv_generator.hpp"
+#include "../utils/dump_queue.hpp"
+#include "../utils/io/dump_store.hpp"
+#include "../utils/shader_patch_cache.hpp"
+#include "../utils/vertex_cache.hpp"
 
 namespace zonetool::iw6
 {
@@ -23,6 +27,7 @@ namespace zonetool::iw6
 	};
 
 	zonetool_globals_t globals{};
+	dump_queue dump_worker;
 
 	std::vector<std::pair<XAssetType, std::string>> referenced_assets;
 	std::vector<std::pair<XAssetType, std::string>> common_assets;
@@ -447,7 +452,39 @@ namespace zonetool::iw6
 			return;
 		}
 
-		dump_func->second(asset);
+		// serialization and disk writes run on the dump worker, the asset stays valid until
+		// db_finish_load_x_file waits for it in stop_dumping. an image's pixel data and stream file
+		// index are only valid while it is being linked though, so the task gets copies of those
+		auto stream_index = 0u;
+		std::shared_ptr<std::vector<std::uint8_t>> pixels;
+		if (asset->type == ASSET_TYPE_IMAGE)
+		{
+			const auto* image = asset->header.image;
+			if (image->streamed)
+			{
+				stream_index = *stream_file_index;
+			}
+
+			if (image->pixelData)
+			{
+				pixels = std::make_shared<std::vector<std::uint8_t>>(image->pixelData, image->pixelData + image->dataLen1);
+			}
+		}
+
+		dump_worker.push([dump = dump_func->second, copy = *asset, stream_index, pixels]() mutable
+		{
+			dump_stream_file_index = stream_index;
+
+			GfxImage image{};
+			if (pixels)
+			{
+				image = *copy.header.image;
+				image.pixelData = pixels->data();
+				copy.header.image = &image;
+			}
+
+			dump(&copy);
+		});
 	}
 
 	void stop_dumping()
@@ -457,6 +494,8 @@ namespace zonetool::iw6
 			return;
 		}
 
+		dump_worker.wait();
+
 		// remove duplicates
 		std::sort(referenced_assets.begin(), referenced_assets.end());
 		referenced_assets.erase(std::unique(referenced_assets.begin(),
@@ -496,6 +535,11 @@ namespace zonetool::iw6
 			dump_asset(&referenced_asset);
 		}
 
+		dump_worker.wait();
+		gsc::wait_for_decompiler();
+
+		filesystem::dump_store::report(filesystem::get_fastfile());
+
 		ZONETOOL_INFO("Zone \"%s\" dumped.", filesystem::get_fastfile().data());
 
 		referenced_assets.clear();
@@ -1159,6 +1203,8 @@ namespace zonetool::iw6
 			asset.header = header;
 			globals.target_game = game::iw6;
 			dump_asset(&asset);
+			dump_worker.wait();
+			gsc::wait_for_decompiler();
 
 			ZONETOOL_INFO("Dumped to dump/assets");
 		});
@@ -1210,6 +1256,27 @@ namespace zonetool::iw6
 		{
 			bool do_exit = false;
 
+			// options for the commands below, regardless of where they appear
+			if (std::find(args.begin(), args.end(), "-optimizesurfaces") != args.end())
+			{
+				vertex_cache::set_enabled(true);
+			}
+
+			if (std::find(args.begin(), args.end(), "-dumpstore") != args.end())
+			{
+				filesystem::dump_store::set_shared(true);
+			}
+
+			if (std::find(args.begin(), args.end(), "-dumppack") != args.end())
+			{
+				filesystem::dump_store::set_packed(true);
+			}
+
+			if (std::find(args.begin(), args.end(), "-shadercache") != args.end())
+			{
+				shader_patch_cache::set_persistent(true);
+			}
+
 			for (std::size_t i = 0; i < args.size(); i++)
 			{
 				if (i < args.size() - 1 && i + 1 < args.size())
@@ -3,6 +3,9 @@
 
 namespace zonetool::iw7
 {
+	// sorts the member and enum hash tables of a def and lays its members out in table order
+	void generateHashTables(DDLDef* def, zone_memory* mem);
+
 	class ddl : public asset_interface
 	{
 	private:
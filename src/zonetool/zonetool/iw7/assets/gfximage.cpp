@@ -522,7 +522,7 @@ namespace zonetool::iw7
 
 	void dump_streamed_image(GfxImage* image, bool is_self = false, bool dump_dds = false)
 	{
-		const auto index = (*g_streamZoneMem)->streamed_image_index;
+		const auto index = dump_stream_file_index;
 		for (auto i = 0u; i < 4; i++)
 		{
 			const auto stream_file = &(*g_streamZoneMem)->streamed_images[index + i];
@@ -623,7 +623,7 @@ namespace zonetool::iw7
 	{
 		if (image->streamed)
 		{
-			dump_streamed_image(image, (*g_streamZoneMem)->streamed_images[(*g_streamZoneMem)->streamed_image_index].fileIndex == 431, true);
+			dump_streamed_image(image, (*g_streamZoneMem)->streamed_images[dump_stream_file_index].fileIndex == 431, true);
 			return;
 		}
 
@@ -709,7 +709,7 @@ namespace zonetool::iw7
 
 		if (asset->streamed)
 		{
-			if ((*g_streamZoneMem)->streamed_images[(*g_streamZoneMem)->streamed_image_index].fileIndex == 431)
+			if ((*g_streamZoneMem)->streamed_images[dump_stream_file_index].fileIndex == 431)
 			{
 				dump_streamed_image(asset, true);
 				return;
@@ -739,7 +739,7 @@ namespace zonetool::iw7
 
 		if (asset->streamed)
 		{
-			const auto index = (*g_streamZoneMem)->streamed_image_index;
+			const auto index = dump_stream_file_index;
 
 			for (auto i = 0u; i < 4; i++)
 			{
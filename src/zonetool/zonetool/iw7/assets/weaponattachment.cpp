@@ -1,6 +1,8 @@
 #include <std_include.hpp>
 #include "weaponattachment.hpp"
 
+#include "zonetool/utils/json_fields.hpp"
+
 namespace zonetool::iw7
 {
 	const char* weap_type_str[] =
@@ -105,571 +107,554 @@ namespace zonetool::iw7
 		return nullptr;
 	}
 
-#define ATTACHMENT_PARSE_STRING(__field__) \
-	static_assert(std::is_same_v<decltype(asset->__field__), const char*>, "Field is not of type const char*"); \
-	!data[#__field__].is_null() && !data[#__field__].get<std::string>().empty() ? asset->__field__ = mem->duplicate_string(data[#__field__].get<std::string>()) : asset->__field__ = nullptr;
-
-#define ATTACHMENT_PARSE_SCRIPT_STRING(__field__) \
-	if (!data[#__field__].is_null() && !data[#__field__].get<std::string>().empty()) this->add_script_string(&asset->__field__, mem->duplicate_string(data[#__field__].get<std::string>())); asset->__field__ = scr_string_t(0);
-
-#define ATTACHMENT_PARSE_FIELD(__field__) \
-	if (!data[#__field__].is_null()) asset->__field__ = data[#__field__].get<decltype(asset->__field__)>();
-
-#define ATTACHMENT_PARSE_FIELD_ARR(__field__, __size__) \
-	if(!data[#__field__].is_null()) \
-	{ \
-		for (auto idx##__field__ = 0u; idx##__field__ < (unsigned int)__size__; idx##__field__++) \
-		{ \
-			asset->__field__[idx##__field__] = data[#__field__][idx##__field__].get<typename std::remove_reference<decltype(asset->__field__[idx##__field__])>::type>(); \
-		} \
-	}
-
-#define ATTACHMENT_PARSE_FIELD_ALLOC_ARR(__field__, __size__) \
-	if(!data[#__field__].is_null()) \
-	{ \
-		asset->__field__ = mem->allocate<typename std::remove_reference<decltype(*asset->__field__)>::type>(__size__); \
-		for (auto idx##__field__ = 0u; idx##__field__ < (unsigned int)__size__; idx##__field__++) \
-		{ \
-			asset->__field__[idx##__field__] = data[#__field__][idx##__field__].get<typename std::remove_reference<decltype(asset->__field__[idx##__field__])>::type>(); \
-		} \
-	} \
-	else \
-	{ \
-		asset->__field__ = nullptr; \
-	}
-
-#define ATTACHMENT_PARSE_FIELD_RENAME(__field__, __name__) \
-	if (!data[__name__].is_null()) asset->__field__ = data[__name__].get<decltype(asset->__field__)>();
-
-#define ATTACHMENT_PARSE_ASSET_ARR(__field__, __size__) \
-	if (!data[#__field__].is_null()) \
-	{ \
-		if (__size__) assert(__size__ == static_cast<decltype(__size__)>(data[#__field__].size())); \
-		__size__ = static_cast<decltype(__size__)>(data[#__field__].size()); \
-		asset->__field__ = mem->allocate<typename std::remove_reference<decltype(*asset->__field__)>::type>(__size__); \
-		for (auto idx##__field__ = 0u; idx##__field__ < (unsigned int)__size__; idx##__field__++) \
-		{ \
-			if (!data[#__field__][idx##__field__].is_null() && !data[#__field__][idx##__field__].get<std::string>().empty()) \
-			{ \
-				asset->__field__[idx##__field__] = mem->manual_allocate<typename std::remove_reference<decltype(*asset->__field__[idx##__field__])>::type>(sizeof(const char*)); \
-				asset->__field__[idx##__field__]->name = mem->duplicate_string(data[#__field__][idx##__field__].get<std::string>()); \
-			} \
-			else \
-			{ \
-				asset->__field__[idx##__field__] = nullptr; \
-			} \
-		} \
-	} \
-	else \
-	{ \
-		asset->__field__ = nullptr; \
-	}
-
-#define ATTACHMENT_PARSE_ASSET(__field__) \
-	if (!data[#__field__].is_null() && !data[#__field__].get<std::string>().empty()) \
-	{ \
-		asset->__field__ = mem->manual_allocate<typename std::remove_reference<decltype(*asset->__field__)>::type>(sizeof(const char*)); \
-		asset->__field__->name = mem->duplicate_string(data[#__field__].get<std::string>()); \
-	} \
-	else \
-	{ \
-		asset->__field__ = nullptr; \
-	}
-
-	void parse_att(AttAmmoGeneral* asset, ordered_json& data, zone_memory* mem)
-	{
-		ATTACHMENT_PARSE_FIELD(vfxImpactType);
-		ATTACHMENT_PARSE_FIELD(sfxImpactType);
-		ATTACHMENT_PARSE_FIELD(meleeImpactType);
-		ATTACHMENT_PARSE_FIELD(fireType);
-		ATTACHMENT_PARSE_FIELD(burstCount);
-	}
-
-	void parse_att(AttAmmoTracer* asset, ordered_json& data, zone_memory* mem)
-	{
-		ATTACHMENT_PARSE_ASSET(tracerType);
-		ATTACHMENT_PARSE_FIELD(tracerStyle);
-	}
-
-	void parse_att(AttPenetration* asset, ordered_json& data, zone_memory* mem)
-	{
-		ATTACHMENT_PARSE_FIELD(penetrateType);
-		ATTACHMENT_PARSE_FIELD(penetrateMultiplier);
-		ATTACHMENT_PARSE_FIELD(rifleBullet);
-		ATTACHMENT_PARSE_FIELD(armorPiercing);
-		ATTACHMENT_PARSE_FIELD(impaling);
-	}
-
-	void parse_att(AttSight* asset, ordered_json& data, zone_memory* mem)
-	{
-		ATTACHMENT_PARSE_FIELD(blurSceneAdsInFraction);
-		ATTACHMENT_PARSE_FIELD(blurSceneAdsOutFraction);
-		ATTACHMENT_PARSE_FIELD(aimDownSight);
-		ATTACHMENT_PARSE_FIELD(adsFire);
-		ATTACHMENT_PARSE_FIELD(rechamberWhileAds);
-		ATTACHMENT_PARSE_FIELD(noAdsWhenMagEmpty);
-		ATTACHMENT_PARSE_FIELD(canVariableZoom);
-		ATTACHMENT_PARSE_FIELD(hideRailWithThisScope);
-		ATTACHMENT_PARSE_FIELD(forceIronSightDown);
-		ATTACHMENT_PARSE_FIELD(useScopeDrift);
-		ATTACHMENT_PARSE_FIELD(useDualFOV);
-	}
-
-	void parse_att(AttHoldBreath* asset, ordered_json& data, zone_memory* mem)
-	{
-		ATTACHMENT_PARSE_FIELD(canHoldBreath);
-	}
+#define ATTACHMENT_FIELD(__struct__, __field__) JSON_FIELD(__struct__, decltype(__struct__::__field__), __field__)
+#define ATTACHMENT_FIELD_ARR(__struct__, __field__, __size__) \
+	JSON_FIELD_ARR(__struct__, std::remove_reference_t<decltype(std::declval<__struct__&>().__field__[0])>, __field__, __size__)
+
+	constexpr auto ammo_general_fields = json_fields::make_field_table<AttAmmoGeneral, ordered_json>(
+	{
+		ATTACHMENT_FIELD(AttAmmoGeneral, vfxImpactType),
+		ATTACHMENT_FIELD(AttAmmoGeneral, sfxImpactType),
+		ATTACHMENT_FIELD(AttAmmoGeneral, meleeImpactType),
+		ATTACHMENT_FIELD(AttAmmoGeneral, fireType),
+		ATTACHMENT_FIELD(AttAmmoGeneral, burstCount)
+	});
+
+	constexpr auto ammo_tracer_fields = json_fields::make_field_table<AttAmmoTracer, ordered_json>(
+	{
+		JSON_FIELD_ASSET(AttAmmoTracer, tracerType),
+		ATTACHMENT_FIELD(AttAmmoTracer, tracerStyle)
+	});
+
+	constexpr auto penetration_fields = json_fields::make_field_table<AttPenetration, ordered_json>(
+	{
+		ATTACHMENT_FIELD(AttPenetration, penetrateType),
+		ATTACHMENT_FIELD(AttPenetration, penetrateMultiplier),
+		ATTACHMENT_FIELD(AttPenetration, rifleBullet),
+		ATTACHMENT_FIELD(AttPenetration, armorPiercing),
+		ATTACHMENT_FIELD(AttPenetration, impaling)
+	});
+
+	constexpr auto sight_fields = json_fields::make_field_table<AttSight, ordered_json>(
+	{
+		ATTACHMENT_FIELD(AttSight, blurSceneAdsInFraction),
+		ATTACHMENT_FIELD(AttSight, blurSceneAdsOutFraction),
+		ATTACHMENT_FIELD(AttSight, aimDownSight),
+		ATTACHMENT_FIELD(AttSight, adsFire),
+		ATTACHMENT_FIELD(AttSight, rechamberWhileAds),
+		ATTACHMENT_FIELD(AttSight, noAdsWhenMagEmpty),
+		ATTACHMENT_FIELD(AttSight, canVariableZoom),
+		ATTACHMENT_FIELD(AttSight, hideRailWithThisScope),
+		ATTACHMENT_FIELD(AttSight, forceIronSightDown),
+		ATTACHMENT_FIELD(AttSight, useScopeDrift),
+		ATTACHMENT_FIELD(AttSight, useDualFOV)
+	});
+
+	constexpr auto hold_breath_fields = json_fields::make_field_table<AttHoldBreath, ordered_json>(
+	{
+		ATTACHMENT_FIELD(AttHoldBreath, canHoldBreath)
+	});
+
+	constexpr auto reload_fields = json_fields::make_field_table<AttReload, ordered_json>(
+	{
+		ATTACHMENT_FIELD(AttReload, noPartialReload),
+		ATTACHMENT_FIELD(AttReload, segmentedReload),
+		ATTACHMENT_FIELD(AttReload, reloadDisabled)
+	});
+
+	constexpr auto add_ons_fields = json_fields::make_field_table<AttAddOns, ordered_json>(
+	{
+		ATTACHMENT_FIELD(AttAddOns, motionTracker),
+		ATTACHMENT_FIELD(AttAddOns, silenced),
+		ATTACHMENT_FIELD(AttAddOns, riotShield)
+	});
+
+	constexpr auto general_fields = json_fields::make_field_table<AttGeneral, ordered_json>(
+	{
+		ATTACHMENT_FIELD(AttGeneral, boltAction),
+		ATTACHMENT_FIELD(AttGeneral, inheritsPerks),
+		ATTACHMENT_FIELD(AttGeneral, reticleSpin45),
+		ATTACHMENT_FIELD(AttGeneral, adsShouldShowCrosshair),
+		ATTACHMENT_FIELD(AttGeneral, enemyCrosshairRange),
+		ATTACHMENT_FIELD(AttGeneral, reticleType),
+		JSON_FIELD_ASSET(AttGeneral, reticleCenter),
+		JSON_FIELD_ASSET(AttGeneral, reticleSide),
+		JSON_FIELD_ASSET(AttGeneral, reticleOnePiece),
+		ATTACHMENT_FIELD(AttGeneral, reticleCenterSize),
+		ATTACHMENT_FIELD(AttGeneral, reticleSideSize),
+		JSON_FIELD_STRING_OR_NULL(AttGeneral, szLUICrosshairWidget)
+	});
+
+	constexpr auto laser_fields = json_fields::make_field_table<AttLaser, ordered_json>(
+	{
+		JSON_FIELD_ASSET(AttLaser, laserTypeFriendly),
+		JSON_FIELD_ASSET(AttLaser, laserTypeEnemy),
+		ATTACHMENT_FIELD(AttLaser, forceLaserOn)
+	});
+
+	constexpr auto aim_assist_fields = json_fields::make_field_table<AttAimAssist, ordered_json>(
+	{
+		ATTACHMENT_FIELD(AttAimAssist, autoAimRange),
+		ATTACHMENT_FIELD(AttAimAssist, aimAssistRange),
+		ATTACHMENT_FIELD(AttAimAssist, aimAssistRangeAds),
+		ATTACHMENT_FIELD(AttAimAssist, aimAssistPitchSlowdown),
+		ATTACHMENT_FIELD(AttAimAssist, aimAssistPitchSlowdownAds),
+		ATTACHMENT_FIELD(AttAimAssist, aimAssistYawSlowdown),
+		ATTACHMENT_FIELD(AttAimAssist, aimAssistYawSlowdownAds),
+		ATTACHMENT_FIELD(AttAimAssist, aimAssistLockonStrength)
+	});
+
+	constexpr auto target_assist_fields = json_fields::make_field_table<AttTargetAssist, ordered_json>(
+	{
+		ATTACHMENT_FIELD(AttTargetAssist, targetAssistType),
+		ATTACHMENT_FIELD(AttTargetAssist, targetAssistBehavior),
+		ATTACHMENT_FIELD(AttTargetAssist, targetAssistRange),
+		ATTACHMENT_FIELD(AttTargetAssist, targetAssistAngle),
+		ATTACHMENT_FIELD(AttTargetAssist, targetAssistLosOffsetForward),
+		ATTACHMENT_FIELD(AttTargetAssist, targetAssistLosOffsetRight),
+		ATTACHMENT_FIELD(AttTargetAssist, targetAssistLosOffsetUp),
+		ATTACHMENT_FIELD(AttTargetAssist, targetAssistOnlyAvailableInAds)
+	});
+
+	constexpr auto unknown01_fields = json_fields::make_field_table<AttUnknown01, ordered_json>(
+	{
+		JSON_FIELD_ASSET(AttUnknown01, material),
+		ATTACHMENT_FIELD(AttUnknown01, unk_0),
+		ATTACHMENT_FIELD(AttUnknown01, unk_1),
+		ATTACHMENT_FIELD(AttUnknown01, unk_2),
+		ATTACHMENT_FIELD(AttUnknown01, unk_3),
+		ATTACHMENT_FIELD(AttUnknown01, unk_4),
+		ATTACHMENT_FIELD(AttUnknown01, unk_5),
+		ATTACHMENT_FIELD(AttUnknown01, unk_6),
+		ATTACHMENT_FIELD(AttUnknown01, unk_7),
+		ATTACHMENT_FIELD(AttUnknown01, unk_8),
+		ATTACHMENT_FIELD(AttUnknown01, unk_9),
+		ATTACHMENT_FIELD(AttUnknown01, unk_10),
+		ATTACHMENT_FIELD(AttUnknown01, unk_11),
+		ATTACHMENT_FIELD(AttUnknown01, unk_12),
+		ATTACHMENT_FIELD(AttUnknown01, unk_13),
+		ATTACHMENT_FIELD(AttUnknown01, unk_14),
+		ATTACHMENT_FIELD(AttUnknown01, unk_15),
+		ATTACHMENT_FIELD(AttUnknown01, unk_16),
+		ATTACHMENT_FIELD(AttUnknown01, unk_17),
+		ATTACHMENT_FIELD(AttUnknown01, unk_18),
+		ATTACHMENT_FIELD(AttUnknown01, unk_19),
+		ATTACHMENT_FIELD(AttUnknown01, unk_20),
+		ATTACHMENT_FIELD(AttUnknown01, unk_21),
+		ATTACHMENT_FIELD(AttUnknown01, unk_22),
+		ATTACHMENT_FIELD(AttUnknown01, unk_23),
+		ATTACHMENT_FIELD(AttUnknown01, unk_24),
+		ATTACHMENT_FIELD(AttUnknown01, unk_25),
+		ATTACHMENT_FIELD(AttUnknown01, unk_26),
+		ATTACHMENT_FIELD(AttUnknown01, unk_27),
+		ATTACHMENT_FIELD(AttUnknown01, unk_28),
+		ATTACHMENT_FIELD(AttUnknown01, unk_29),
+		ATTACHMENT_FIELD(AttUnknown01, unk_30),
+		ATTACHMENT_FIELD(AttUnknown01, unk_31),
+		ATTACHMENT_FIELD(AttUnknown01, unk_32),
+		ATTACHMENT_FIELD(AttUnknown01, unk_33),
+		ATTACHMENT_FIELD(AttUnknown01, unk_34),
+		ATTACHMENT_FIELD(AttUnknown01, unk_35),
+		ATTACHMENT_FIELD(AttUnknown01, unk_36),
+		ATTACHMENT_FIELD(AttUnknown01, unk_37),
+		ATTACHMENT_FIELD(AttUnknown01, unk_38),
+		ATTACHMENT_FIELD(AttUnknown01, unk_39),
+		ATTACHMENT_FIELD(AttUnknown01, unk_40),
+		ATTACHMENT_FIELD(AttUnknown01, unk_41),
+		ATTACHMENT_FIELD(AttUnknown01, unk_42),
+		ATTACHMENT_FIELD(AttUnknown01, unk_43),
+		ATTACHMENT_FIELD(AttUnknown01, unk_44),
+		ATTACHMENT_FIELD(AttUnknown01, unk_45),
+		ATTACHMENT_FIELD(AttUnknown01, unk_46),
+		ATTACHMENT_FIELD(AttUnknown01, unk_47),
+		ATTACHMENT_FIELD(AttUnknown01, unk_48)
+	});
+
+	constexpr auto ammunition_fields = json_fields::make_field_table<AttAmmunition, ordered_json>(
+	{
+		ATTACHMENT_FIELD(AttAmmunition, maxAmmo),
+		ATTACHMENT_FIELD(AttAmmunition, startAmmo),
+		ATTACHMENT_FIELD(AttAmmunition, clipSize),
+		ATTACHMENT_FIELD(AttAmmunition, shotCount),
+		ATTACHMENT_FIELD(AttAmmunition, reloadAmmoAdd),
+		ATTACHMENT_FIELD(AttAmmunition, reloadStartAdd),
+		ATTACHMENT_FIELD(AttAmmunition, requireAmmoUsedPerShot)
+	});
+
+	constexpr auto damage_fields = json_fields::make_field_table<AttDamage, ordered_json>(
+	{
+		ATTACHMENT_FIELD(AttDamage, damage),
+		ATTACHMENT_FIELD(AttDamage, mid1Damage),
+		ATTACHMENT_FIELD(AttDamage, mid2Damage),
+		ATTACHMENT_FIELD(AttDamage, mid3Damage),
+		ATTACHMENT_FIELD(AttDamage, minDamage),
+		ATTACHMENT_FIELD(AttDamage, meleeDamage),
+		ATTACHMENT_FIELD(AttDamage, maxDamageRange),
+		ATTACHMENT_FIELD(AttDamage, mid1DamageRange),
+		ATTACHMENT_FIELD(AttDamage, mid2DamageRange),
+		ATTACHMENT_FIELD(AttDamage, mid3DamageRange),
+		ATTACHMENT_FIELD(AttDamage, minDamageRange),
+		ATTACHMENT_FIELD(AttDamage, playerDamage),
+		ATTACHMENT_FIELD(AttDamage, mid1PlayerDamage),
+		ATTACHMENT_FIELD(AttDamage, mid2PlayerDamage),
+		ATTACHMENT_FIELD(AttDamage, mid3PlayerDamage),
+		ATTACHMENT_FIELD(AttDamage, minPlayerDamage)
+	});
+
+	constexpr auto idle_settings_fields = json_fields::make_field_table<AttIdleSettings, ordered_json>(
+	{
+		ATTACHMENT_FIELD(AttIdleSettings, hipIdleAmount),
+		ATTACHMENT_FIELD(AttIdleSettings, hipIdleSpeed),
+		ATTACHMENT_FIELD(AttIdleSettings, idleCrouchFactor),
+		ATTACHMENT_FIELD(AttIdleSettings, idleProneFactor),
+		ATTACHMENT_FIELD(AttIdleSettings, adsIdleLerpStartTime),
+		ATTACHMENT_FIELD(AttIdleSettings, adsIdleLerpTime)
+	});
+
+	constexpr auto ads_settings_fields = json_fields::make_field_table<AttADSSettings, ordered_json>(
+	{
+		ATTACHMENT_FIELD(AttADSSettings, adsSpread),
+		ATTACHMENT_FIELD(AttADSSettings, adsAimPitch),
+		ATTACHMENT_FIELD(AttADSSettings, adsTransInTime),
+		ATTACHMENT_FIELD(AttADSSettings, adsTransOutTime),
+		ATTACHMENT_FIELD(AttADSSettings, adsReloadTransTime),
+		ATTACHMENT_FIELD(AttADSSettings, adsCrosshairInFrac),
+		ATTACHMENT_FIELD(AttADSSettings, adsCrosshairOutFrac),
+		ATTACHMENT_FIELD(AttADSSettings, adsInCrosshairAlphaStart),
+		ATTACHMENT_FIELD(AttADSSettings, adsInCrosshairAlphaEnd),
+		ATTACHMENT_FIELD(AttADSSettings, adsOutCrosshairAlphaStart),
+		ATTACHMENT_FIELD(AttADSSettings, adsOutCrosshairAlphaEnd),
+		ATTACHMENT_FIELD(AttADSSettings, adsZoomFov),
+		ATTACHMENT_FIELD(AttADSSettings, adsZoomInFrac),
+		ATTACHMENT_FIELD(AttADSSettings, adsZoomOutFrac),
+		ATTACHMENT_FIELD(AttADSSettings, adsFovLerpTime),
+		ATTACHMENT_FIELD(AttADSSettings, adsBobFactor),
+		ATTACHMENT_FIELD(AttADSSettings, adsViewBobMult),
+		ATTACHMENT_FIELD(AttADSSettings, adsFireRateScale),
+		ATTACHMENT_FIELD(AttADSSettings, adsDamageRangeScale),
+		ATTACHMENT_FIELD(AttADSSettings, adsFireAnimFrac),
+		ATTACHMENT_FIELD(AttADSSettings, fireTimerLerpToAdsScale),
+		ATTACHMENT_FIELD(AttADSSettings, alwaysFireAtMaxRangeInAds),
+		ATTACHMENT_FIELD(AttADSSettings, adsAlignEnabled),
+		ATTACHMENT_FIELD(AttADSSettings, disableTagAlignX)
+	});
+
+	constexpr auto scope_drift_settings_fields = json_fields::make_field_table<AttScopeDriftSettings, ordered_json>(
+	{
+		ATTACHMENT_FIELD(AttScopeDriftSettings, fScopeDriftDelay),
+		ATTACHMENT_FIELD(AttScopeDriftSettings, fScopeDriftLerpInTime),
+		ATTACHMENT_FIELD(AttScopeDriftSettings, fScopeDriftSteadyTime),
+		ATTACHMENT_FIELD(AttScopeDriftSettings, fScopeDriftLerpOutTime),
+		ATTACHMENT_FIELD(AttScopeDriftSettings, fScopeDriftSteadyFactor),
+		ATTACHMENT_FIELD(AttScopeDriftSettings, fScopeDriftUnsteadyFactor)
+	});
+
+	constexpr auto hip_spread_fields = json_fields::make_field_table<AttHipSpread, ordered_json>(
+	{
+		ATTACHMENT_FIELD(AttHipSpread, hipSpreadStandMin),
+		ATTACHMENT_FIELD(AttHipSpread, hipSpreadDuckedMin),
+		ATTACHMENT_FIELD(AttHipSpread, hipSpreadProneMin),
+		ATTACHMENT_FIELD(AttHipSpread, hipSpreadSprintMin),
+		ATTACHMENT_FIELD(AttHipSpread, hipSpreadInAirMin),
+		ATTACHMENT_FIELD(AttHipSpread, hipSpreadMax),
+		ATTACHMENT_FIELD(AttHipSpread, hipSpreadDuckedMax),
+		ATTACHMENT_FIELD(AttHipSpread, hipSpreadProneMax),
+		ATTACHMENT_FIELD(AttHipSpread, hipSpreadSprintMax),
+		ATTACHMENT_FIELD(AttHipSpread, hipSpreadInAirMax),
+		ATTACHMENT_FIELD(AttHipSpread, hipSpreadFireAdd),
+		ATTACHMENT_FIELD(AttHipSpread, hipSpreadTurnAdd),
+		ATTACHMENT_FIELD(AttHipSpread, hipSpreadMoveAdd),
+		ATTACHMENT_FIELD(AttHipSpread, hipSpreadDecayRate),
+		ATTACHMENT_FIELD(AttHipSpread, hipSpreadDuckedDecay),
+		ATTACHMENT_FIELD(AttHipSpread, hipSpreadProneDecay),
+		ATTACHMENT_FIELD(AttHipSpread, hipSpreadSprintDecay),
+		ATTACHMENT_FIELD(AttHipSpread, hipSpreadInAirDecay)
+	});
+
+	constexpr auto slide_spread_fields = json_fields::make_field_table<AttSlideSpread, ordered_json>(
+	{
+		ATTACHMENT_FIELD(AttSlideSpread, slideSpreadMin),
+		ATTACHMENT_FIELD(AttSlideSpread, slideSpreadMax),
+		ATTACHMENT_FIELD(AttSlideSpread, slideSpreadDecayRate),
+		ATTACHMENT_FIELD(AttSlideSpread, slideSpreadFireAdd),
+		ATTACHMENT_FIELD(AttSlideSpread, slideSpreadTurnAdd)
+	});
+
+	constexpr auto gun_kick_fields = json_fields::make_field_table<AttGunKick, ordered_json>(
+	{
+		ATTACHMENT_FIELD(AttGunKick, hipGunKickReducedKickBullets),
+		ATTACHMENT_FIELD(AttGunKick, hipGunKickReducedKickPercent),
+		ATTACHMENT_FIELD(AttGunKick, hipGunKickPitchMin),
+		ATTACHMENT_FIELD(AttGunKick, hipGunKickPitchMax),
+		ATTACHMENT_FIELD(AttGunKick, hipGunKickYawMin),
+		ATTACHMENT_FIELD(AttGunKick, hipGunKickYawMax),
+		ATTACHMENT_FIELD(AttGunKick, hipGunKickMagMin),
+		ATTACHMENT_FIELD(AttGunKick, hipGunKickAccel),
+		ATTACHMENT_FIELD(AttGunKick, hipGunKickSpeedMax),
+		ATTACHMENT_FIELD(AttGunKick, hipGunKickSpeedDecay),
+		ATTACHMENT_FIELD(AttGunKick, hipGunKickStaticDecay),
+		ATTACHMENT_FIELD(AttGunKick, adsGunKickReducedKickBullets),
+		ATTACHMENT_FIELD(AttGunKick, adsGunKickReducedKickPercent),
+		ATTACHMENT_FIELD(AttGunKick, adsGunKickPitchMin),
+		ATTACHMENT_FIELD(AttGunKick, adsGunKickPitchMax),
+		ATTACHMENT_FIELD(AttGunKick, adsGunKickYawMin),
+		ATTACHMENT_FIELD(AttGunKick, adsGunKickYawMax),
+		ATTACHMENT_FIELD(AttGunKick, adsGunKickMagMin),
+		ATTACHMENT_FIELD(AttGunKick, adsGunKickAccel),
+		ATTACHMENT_FIELD(AttGunKick, adsGunKickSpeedMax),
+		ATTACHMENT_FIELD(AttGunKick, adsGunKickSpeedDecay),
+		ATTACHMENT_FIELD(AttGunKick, adsGunKickStaticDecay)
+	});
+
+	constexpr auto view_kick_fields = json_fields::make_field_table<AttViewKick, ordered_json>(
+	{
+		ATTACHMENT_FIELD(AttViewKick, hipViewKickPitchMin),
+		ATTACHMENT_FIELD(AttViewKick, hipViewKickPitchMax),
+		ATTACHMENT_FIELD(AttViewKick, hipViewKickYawMin),
+		ATTACHMENT_FIELD(AttViewKick, hipViewKickYawMax),
+		ATTACHMENT_FIELD(AttViewKick, hipViewKickMagMin),
+		ATTACHMENT_FIELD(AttViewKick, hipViewKickCenterSpeed),
+		ATTACHMENT_FIELD(AttViewKick, adsViewKickPitchMin),
+		ATTACHMENT_FIELD(AttViewKick, adsViewKickPitchMax),
+		ATTACHMENT_FIELD(AttViewKick, adsViewKickYawMin),
+		ATTACHMENT_FIELD(AttViewKick, adsViewKickYawMax),
+		ATTACHMENT_FIELD(AttViewKick, adsViewKickMagMin),
+		ATTACHMENT_FIELD(AttViewKick, adsViewKickCenterSpeed),
+		ATTACHMENT_FIELD(AttViewKick, kickAlignedInputScalar),
+		ATTACHMENT_FIELD(AttViewKick, kickOpposedInputScalar)
+	});
+
+	constexpr auto ads_overlay_fields = json_fields::make_field_table<AttADSOverlay, ordered_json>(
+	{
+		JSON_FIELD_ASSET(AttADSOverlay, overlay.shader),
+		JSON_FIELD_ASSET(AttADSOverlay, overlay.shaderLowRes),
+		JSON_FIELD_ASSET(AttADSOverlay, overlay.shaderEMP),
+		JSON_FIELD_ASSET(AttADSOverlay, overlay.shaderEMPLowRes),
+		ATTACHMENT_FIELD(AttADSOverlay, overlay.reticle),
+		ATTACHMENT_FIELD(AttADSOverlay, overlay.width),
+		ATTACHMENT_FIELD(AttADSOverlay, overlay.height),
+		ATTACHMENT_FIELD(AttADSOverlay, overlay.widthSplitscreen),
+		ATTACHMENT_FIELD(AttADSOverlay, overlay.heightSplitscreen),
+		ATTACHMENT_FIELD(AttADSOverlay, hybridToggle),
+		ATTACHMENT_FIELD(AttADSOverlay, thermalScope),
+		ATTACHMENT_FIELD(AttADSOverlay, thermalToggle),
+		ATTACHMENT_FIELD(AttADSOverlay, outlineEnemies)
+	});
+
+	constexpr auto outline_fields = json_fields::make_field_table<AttOutline, ordered_json>(
+	{
+		ATTACHMENT_FIELD_ARR(AttOutline, outlineColor, 4),
+		ATTACHMENT_FIELD_ARR(AttOutline, outlineAltColor, 4),
+		ATTACHMENT_FIELD_ARR(AttOutline, outlineFillColor0, 4),
+		ATTACHMENT_FIELD_ARR(AttOutline, outlineFillColor1, 4),
+		ATTACHMENT_FIELD_ARR(AttOutline, outlineOccludedOutlineColor, 4),
+		ATTACHMENT_FIELD_ARR(AttOutline, outlineOccludedInlineColor, 4),
+		ATTACHMENT_FIELD_ARR(AttOutline, outlineOccludedInteriorColor, 4),
+		ATTACHMENT_FIELD(AttOutline, outlineWidth),
+		ATTACHMENT_FIELD(AttOutline, outlineEnemies),
+		ATTACHMENT_FIELD(AttOutline, outlineDepthTest),
+		ATTACHMENT_FIELD(AttOutline, outlineFill),
+		ATTACHMENT_FIELD(AttOutline, outlineScriptControlled),
+		ATTACHMENT_FIELD(AttOutline, outlineVehicles),
+		ATTACHMENT_FIELD(AttOutline, outlineTurrets),
+		ATTACHMENT_FIELD(AttOutline, outlineCharacters),
+		ATTACHMENT_FIELD(AttOutline, outlineAgents),
+		ATTACHMENT_FIELD(AttOutline, outlineScriptMovers),
+		ATTACHMENT_FIELD(AttOutline, outlineLockOn)
+	});
+
+	constexpr auto ui_fields = json_fields::make_field_table<AttUI, ordered_json>(
+	{
+		JSON_FIELD_ASSET(AttUI, hudIcon),
+		JSON_FIELD_ASSET(AttUI, pickupIcon),
+		JSON_FIELD_ASSET(AttUI, dangerIcon),
+		JSON_FIELD_ASSET(AttUI, throwBackIcon),
+		ATTACHMENT_FIELD(AttUI, hideWarningIcons),
+		ATTACHMENT_FIELD(AttUI, warningIconsDelay),
+		JSON_FIELD_ASSET(AttUI, dpadIcon),
+		JSON_FIELD_ASSET(AttUI, ammoCounterIcon),
+		ATTACHMENT_FIELD(AttUI, ammoCounterClip),
+		ATTACHMENT_FIELD(AttUI, grenadeDangerIconDistance)
+	});
+
+	constexpr auto rumbles_fields = json_fields::make_field_table<AttRumbles, ordered_json>(
+	{
+		JSON_FIELD_ASSET(AttRumbles, fireRumble),
+		JSON_FIELD_ASSET(AttRumbles, meleeImpactRumble)
+	});
+
+	constexpr auto projectile_fields = json_fields::make_field_table<AttProjectile, ordered_json>(
+	{
+		ATTACHMENT_FIELD(AttProjectile, explosionRadius),
+		ATTACHMENT_FIELD(AttProjectile, explosionForceRadius),
+		ATTACHMENT_FIELD(AttProjectile, explosionInnerDamage),
+		ATTACHMENT_FIELD(AttProjectile, explosionOuterDamage),
+		ATTACHMENT_FIELD(AttProjectile, damageConeAngle),
+		ATTACHMENT_FIELD(AttProjectile, projectileSpeed),
+		ATTACHMENT_FIELD(AttProjectile, projectileSpeedUp),
+		ATTACHMENT_FIELD(AttProjectile, projectileActivateDist),
+		ATTACHMENT_FIELD(AttProjectile, projectileLifetime),
+		ATTACHMENT_FIELD(AttProjectile, projectileLifetimeStdDeviation),
+		JSON_FIELD_ASSET(AttProjectile, projectileModel),
+		ATTACHMENT_FIELD(AttProjectile, projExplosionType),
+		ATTACHMENT_FIELD(AttProjectile, projExplosionEffect.type),
+		JSON_FIELD_ASSET(AttProjectile, projExplosionEffect.u.fx),
+		ATTACHMENT_FIELD(AttProjectile, projExplosionEffectForceNormalUp),
+		JSON_FIELD_STRING_OR_NULL(AttProjectile, projExplosionSound),
+		ATTACHMENT_FIELD(AttProjectile, projDudEffect.type),
+		JSON_FIELD_ASSET(AttProjectile, projDudEffect.u.fx),
+		JSON_FIELD_STRING_OR_NULL(AttProjectile, projDudSound),
+		ATTACHMENT_FIELD(AttProjectile, projImpactExplode),
+		ATTACHMENT_FIELD(AttProjectile, disableProjectileCrumpleCheck),
+		ATTACHMENT_FIELD(AttProjectile, destabilizationRateTime),
+		ATTACHMENT_FIELD(AttProjectile, destabilizationCurvatureMax),
+		ATTACHMENT_FIELD(AttProjectile, destabilizeDistance),
+		ATTACHMENT_FIELD(AttProjectile, projBodyEffect.type),
+		JSON_FIELD_ASSET(AttProjectile, projBodyEffect.u.fx),
+		ATTACHMENT_FIELD(AttProjectile, projTrailEffect.type),
+		JSON_FIELD_ASSET(AttProjectile, projTrailEffect.u.fx),
+		ATTACHMENT_FIELD(AttProjectile, projBeaconEffect.type),
+		JSON_FIELD_ASSET(AttProjectile, projBeaconEffect.u.fx),
+		ATTACHMENT_FIELD(AttProjectile, projIgnitionDelay),
+		ATTACHMENT_FIELD(AttProjectile, projIgnitionEffect.type),
+		JSON_FIELD_ASSET(AttProjectile, projIgnitionEffect.u.fx),
+		JSON_FIELD_STRING_OR_NULL(AttProjectile, projIgnitionSound),
+		ATTACHMENT_FIELD(AttProjectile, stickiness),
+		ATTACHMENT_FIELD(AttProjectile, fuseTime),
+		ATTACHMENT_FIELD(AttProjectile, aiFuseTime),
+		ATTACHMENT_FIELD(AttProjectile, stickToPlayers),
+		ATTACHMENT_FIELD(AttProjectile, stickToVehicles),
+		ATTACHMENT_FIELD(AttProjectile, stickToTurrets),
+		ATTACHMENT_FIELD(AttProjectile, stickToNonStick),
+		ATTACHMENT_FIELD(AttProjectile, timedDetonation),
+		ATTACHMENT_FIELD(AttProjectile, isPredictedProjectile),
+		ATTACHMENT_FIELD(AttProjectile, useSteppedExplosionDamage),
+		ATTACHMENT_FIELD(AttProjectile, reactiveMotionRadiusScale),
+		ATTACHMENT_FIELD(AttProjectile, reactiveMotionFrequencyScale),
+		ATTACHMENT_FIELD(AttProjectile, reactiveMotionAmplitudeScale),
+		ATTACHMENT_FIELD(AttProjectile, reactiveMotionFalloff),
+		ATTACHMENT_FIELD(AttProjectile, reactiveMotionLifetime)
+	});
+
+	constexpr auto charged_fields = json_fields::make_field_table<AttCharged, ordered_json>(
+	{
+		ATTACHMENT_FIELD(AttCharged, chargeType),
+		ATTACHMENT_FIELD(AttCharged, chargeGain),
+		ATTACHMENT_FIELD(AttCharged, chargeCostPerShot),
+		ATTACHMENT_FIELD(AttCharged, chargeLossWhenIdle),
+		ATTACHMENT_FIELD(AttCharged, chargeEmptyCooldown),
+		ATTACHMENT_FIELD(AttCharged, chargeFireAtMaxDamageMultiplier),
+		ATTACHMENT_FIELD(AttCharged, chargeMeterEffectBoneCount),
+		ATTACHMENT_FIELD(AttCharged, chargeMeterEffect.type),
+		JSON_FIELD_ASSET(AttCharged, chargeMeterEffect.u.fx),
+		JSON_FIELD_STRING_OR_NULL(AttCharged, chargeUpSound),
+		JSON_FIELD_STRING_OR_NULL(AttCharged, chargeDownSound),
+		JSON_FIELD_STRING_OR_NULL(AttCharged, chargeDownToUpSound),
+		JSON_FIELD_STRING_OR_NULL(AttCharged, chargeUpToDownSound),
+		JSON_FIELD_STRING_OR_NULL(AttCharged, chargeMaxSound),
+		JSON_FIELD_STRING_OR_NULL(AttCharged, chargeUpSoundPlayer),
+		JSON_FIELD_STRING_OR_NULL(AttCharged, chargeDownSoundPlayer),
+		JSON_FIELD_STRING_OR_NULL(AttCharged, chargeDownToUpSoundPlayer),
+		JSON_FIELD_STRING_OR_NULL(AttCharged, chargeUpToDownSoundPlayer),
+		JSON_FIELD_STRING_OR_NULL(AttCharged, chargeMaxSoundPlayer),
+		ATTACHMENT_FIELD(AttCharged, chargeHudReveal),
+		JSON_FIELD_ASSET(AttCharged, chargeRumble)
+	});
+
+	constexpr auto ads_alt_switch_fields = json_fields::make_field_table<AdsAltSwitch, ordered_json>(
+	{
+		ATTACHMENT_FIELD(AdsAltSwitch, fovInterpTimeSecMainToAlt),
+		ATTACHMENT_FIELD(AdsAltSwitch, fovInterpDelaySecMainToAlt),
+		ATTACHMENT_FIELD(AdsAltSwitch, dualFovSwitchRateMainToAlt),
+		ATTACHMENT_FIELD(AdsAltSwitch, fovInterpTypeMainToAlt),
+		ATTACHMENT_FIELD(AdsAltSwitch, fovInterpTimeSecAltToMain),
+		ATTACHMENT_FIELD(AdsAltSwitch, fovInterpDelaySecAltToMain),
+		ATTACHMENT_FIELD(AdsAltSwitch, dualFovSwitchRateAltToMain),
+		ATTACHMENT_FIELD(AdsAltSwitch, fovInterpTypeAltToMain)
+	});
+
+	constexpr auto regeneration_fields = json_fields::make_field_table<AttRegeneration, ordered_json>(
+	{
+		ATTACHMENT_FIELD(AttRegeneration, regenerationEnabled),
+		ATTACHMENT_FIELD(AttRegeneration, regenerationTimeMs),
+		ATTACHMENT_FIELD(AttRegeneration, regenerationAddTimeMs),
+		ATTACHMENT_FIELD(AttRegeneration, regenerationAmount),
+		ATTACHMENT_FIELD(AttRegeneration, regenerationConsumeStock),
+		ATTACHMENT_FIELD(AttRegeneration, regenerationDisableWhileFiring)
+	});
+
+	constexpr auto movement_fields = json_fields::make_field_table<AttMovement, ordered_json>(
+	{
+		ATTACHMENT_FIELD(AttMovement, moveSpeedScale),
+		ATTACHMENT_FIELD(AttMovement, adsMoveSpeedScale),
+		ATTACHMENT_FIELD(AttMovement, fastADS3PAnims)
+	});
+
+	constexpr auto burst_fields = json_fields::make_field_table<AttBurst, ordered_json>(
+	{
+		ATTACHMENT_FIELD(AttBurst, burstFireCooldown),
+		ATTACHMENT_FIELD(AttBurst, burstFireAuto)
+	});
+
+	constexpr auto attachment_fields = json_fields::make_field_table<WeaponAttachment, ordered_json>(
+	{
+		JSON_FIELD_STRING_OR_NULL(WeaponAttachment, szInternalName),
+		JSON_FIELD_STRING_OR_NULL(WeaponAttachment, szDisplayName),
+		ATTACHMENT_FIELD(WeaponAttachment, papAttachment),
+		ATTACHMENT_FIELD(WeaponAttachment, type),
+		ATTACHMENT_FIELD(WeaponAttachment, weaponType),
+		JSON_FIELD_NAMED(WeaponAttachment, decltype(WeaponAttachment::weapClass), weapClass, "weaponClass"),
+		JSON_FIELD_ASSET(WeaponAttachment, worldModelCamo),
+		JSON_FIELD_ASSET(WeaponAttachment, viewModelCamo),
+		ATTACHMENT_FIELD_ARR(WeaponAttachment, locationDamage, 22),
+		ATTACHMENT_FIELD(WeaponAttachment, ammunitionScale),
+		ATTACHMENT_FIELD(WeaponAttachment, damageScale),
+		ATTACHMENT_FIELD(WeaponAttachment, stateTimersScale),
+		ATTACHMENT_FIELD(WeaponAttachment, reloadTimersScale),
+		ATTACHMENT_FIELD(WeaponAttachment, fireTimeOverride),
+		ATTACHMENT_FIELD(WeaponAttachment, fireTimeAkimboOverride),
+		ATTACHMENT_FIELD(WeaponAttachment, fireTimersScale),
+		ATTACHMENT_FIELD(WeaponAttachment, burstFireCooldownScale),
+		ATTACHMENT_FIELD(WeaponAttachment, idleHipMotionScale),
+		ATTACHMENT_FIELD(WeaponAttachment, idleADSMotionScale),
+		ATTACHMENT_FIELD(WeaponAttachment, idleADSMotionTimeScale),
+		ATTACHMENT_FIELD(WeaponAttachment, adsSettingsScale),
+		ATTACHMENT_FIELD(WeaponAttachment, adsSettingsScaleMain),
+		ATTACHMENT_FIELD(WeaponAttachment, hipSpreadScale),
+		ATTACHMENT_FIELD(WeaponAttachment, slideSpreadScale),
+		ATTACHMENT_FIELD(WeaponAttachment, gunKickScale),
+		ATTACHMENT_FIELD(WeaponAttachment, viewKickScale),
+		ATTACHMENT_FIELD(WeaponAttachment, viewCenterScale),
+		ATTACHMENT_FIELD(WeaponAttachment, adsSwayScale),
+		ATTACHMENT_FIELD(WeaponAttachment, adsSwayScale2),
+		ATTACHMENT_FIELD(WeaponAttachment, adsSwayScale3),
+		ATTACHMENT_FIELD(WeaponAttachment, iAmmoIndex), // probably runtime data
+		ATTACHMENT_FIELD(WeaponAttachment, loadIndex), // ^
+		ATTACHMENT_FIELD(WeaponAttachment, useAlternateViewModelLaser),
+		ATTACHMENT_FIELD(WeaponAttachment, hideIronSightsWithThisAttachment),
+		ATTACHMENT_FIELD(WeaponAttachment, shareAmmoWithAlt),
+		ATTACHMENT_FIELD(WeaponAttachment, useLeftTriggerAltFire),
+		ATTACHMENT_FIELD(WeaponAttachment, containsIKTag),
+		ATTACHMENT_FIELD(WeaponAttachment, isAkimboAttachment),
+		ATTACHMENT_FIELD(WeaponAttachment, attachLeftWeaponAkimbo),
+		ATTACHMENT_FIELD(WeaponAttachment, attachRightWeaponAkimbo),
+		ATTACHMENT_FIELD(WeaponAttachment, luiWeaponInfoWidgetUsesScopeStencil),
+		JSON_FIELD_STRING_OR_NULL(WeaponAttachment, szAltModeName),
+		JSON_FIELD_STRING_OR_NULL(WeaponAttachment, szLUIWeaponInfoWidgetName),
+		JSON_FIELD_STRING_OR_NULL(WeaponAttachment, szLUIWeaponInfoWidgetTag)
+	});
+
+	template <typename T, typename Table>
+	void parse_att(T*& att, const ordered_json& data, const Table& fields, zone_memory* mem)
+	{
+		if (data.is_null())
+		{
+			att = nullptr;
+			return;
+		}
 
-	void parse_att(AttReload* asset, ordered_json& data, zone_memory* mem)
-	{
-		ATTACHMENT_PARSE_FIELD(noPartialReload);
-		ATTACHMENT_PARSE_FIELD(segmentedReload);
-		ATTACHMENT_PARSE_FIELD(reloadDisabled);
-	}
-
-	void parse_att(AttAddOns* asset, ordered_json& data, zone_memory* mem)
-	{
-		ATTACHMENT_PARSE_FIELD(motionTracker);
-		ATTACHMENT_PARSE_FIELD(silenced);
-		ATTACHMENT_PARSE_FIELD(riotShield);
-	}
-
-	void parse_att(AttGeneral* asset, ordered_json& data, zone_memory* mem)
-	{
-		ATTACHMENT_PARSE_FIELD(boltAction);
-		ATTACHMENT_PARSE_FIELD(inheritsPerks);
-		ATTACHMENT_PARSE_FIELD(reticleSpin45);
-		ATTACHMENT_PARSE_FIELD(adsShouldShowCrosshair);
-		ATTACHMENT_PARSE_FIELD(enemyCrosshairRange);
-		ATTACHMENT_PARSE_FIELD(reticleType);
-		ATTACHMENT_PARSE_ASSET(reticleCenter);
-		ATTACHMENT_PARSE_ASSET(reticleSide);
-		ATTACHMENT_PARSE_ASSET(reticleOnePiece);
-		ATTACHMENT_PARSE_FIELD(reticleCenterSize);
-		ATTACHMENT_PARSE_FIELD(reticleSideSize);
-		ATTACHMENT_PARSE_STRING(szLUICrosshairWidget);
-	}
-
-	void parse_att(AttLaser* asset, ordered_json& data, zone_memory* mem)
-	{
-		ATTACHMENT_PARSE_ASSET(laserTypeFriendly);
-		ATTACHMENT_PARSE_ASSET(laserTypeEnemy);
-		ATTACHMENT_PARSE_FIELD(forceLaserOn);
-	}
-
-	void parse_att(AttAimAssist* asset, ordered_json& data, zone_memory* mem)
-	{
-		ATTACHMENT_PARSE_FIELD(autoAimRange);
-		ATTACHMENT_PARSE_FIELD(aimAssistRange);
-		ATTACHMENT_PARSE_FIELD(aimAssistRangeAds);
-		ATTACHMENT_PARSE_FIELD(aimAssistPitchSlowdown);
-		ATTACHMENT_PARSE_FIELD(aimAssistPitchSlowdownAds);
-		ATTACHMENT_PARSE_FIELD(aimAssistYawSlowdown);
-		ATTACHMENT_PARSE_FIELD(aimAssistYawSlowdownAds);
-		ATTACHMENT_PARSE_FIELD(aimAssistLockonStrength);
-	}
-
-	void parse_att(AttTargetAssist* asset, ordered_json& data, zone_memory* mem)
-	{
-		ATTACHMENT_PARSE_FIELD(targetAssistType);
-		ATTACHMENT_PARSE_FIELD(targetAssistBehavior);
-		ATTACHMENT_PARSE_FIELD(targetAssistRange);
-		ATTACHMENT_PARSE_FIELD(targetAssistAngle);
-		ATTACHMENT_PARSE_FIELD(targetAssistLosOffsetForward);
-		ATTACHMENT_PARSE_FIELD(targetAssistLosOffsetRight);
-		ATTACHMENT_PARSE_FIELD(targetAssistLosOffsetUp);
-		ATTACHMENT_PARSE_FIELD(targetAssistOnlyAvailableInAds);
-	}
-
-	void parse_att(AttUnknown01* asset, ordered_json& data, zone_memory* mem)
-	{
-		ATTACHMENT_PARSE_ASSET(material);
-		ATTACHMENT_PARSE_FIELD(unk_0);
-		ATTACHMENT_PARSE_FIELD(unk_1);
-		ATTACHMENT_PARSE_FIELD(unk_2);
-		ATTACHMENT_PARSE_FIELD(unk_3);
-		ATTACHMENT_PARSE_FIELD(unk_4);
-		ATTACHMENT_PARSE_FIELD(unk_5);
-		ATTACHMENT_PARSE_FIELD(unk_6);
-		ATTACHMENT_PARSE_FIELD(unk_7);
-		ATTACHMENT_PARSE_FIELD(unk_8);
-		ATTACHMENT_PARSE_FIELD(unk_9);
-		ATTACHMENT_PARSE_FIELD(unk_10);
-		ATTACHMENT_PARSE_FIELD(unk_11);
-		ATTACHMENT_PARSE_FIELD(unk_12);
-		ATTACHMENT_PARSE_FIELD(unk_13);
-		ATTACHMENT_PARSE_FIELD(unk_14);
-		ATTACHMENT_PARSE_FIELD(unk_15);
-		ATTACHMENT_PARSE_FIELD(unk_16);
-		ATTACHMENT_PARSE_FIELD(unk_17);
-		ATTACHMENT_PARSE_FIELD(unk_18);
-		ATTACHMENT_PARSE_FIELD(unk_19);
-		ATTACHMENT_PARSE_FIELD(unk_20);
-		ATTACHMENT_PARSE_FIELD(unk_21);
-		ATTACHMENT_PARSE_FIELD(unk_22);
-		ATTACHMENT_PARSE_FIELD(unk_23);
-		ATTACHMENT_PARSE_FIELD(unk_24);
-		ATTACHMENT_PARSE_FIELD(unk_25);
-		ATTACHMENT_PARSE_FIELD(unk_26);
-		ATTACHMENT_PARSE_FIELD(unk_27);
-		ATTACHMENT_PARSE_FIELD(unk_28);
-		ATTACHMENT_PARSE_FIELD(unk_29);
-		ATTACHMENT_PARSE_FIELD(unk_30);
-		ATTACHMENT_PARSE_FIELD(unk_31);
-		ATTACHMENT_PARSE_FIELD(unk_32);
-		ATTACHMENT_PARSE_FIELD(unk_33);
-		ATTACHMENT_PARSE_FIELD(unk_34);
-		ATTACHMENT_PARSE_FIELD(unk_35);
-		ATTACHMENT_PARSE_FIELD(unk_36);
-		ATTACHMENT_PARSE_FIELD(unk_37);
-		ATTACHMENT_PARSE_FIELD(unk_38);
-		ATTACHMENT_PARSE_FIELD(unk_39);
-		ATTACHMENT_PARSE_FIELD(unk_40);
-		ATTACHMENT_PARSE_FIELD(unk_41);
-		ATTACHMENT_PARSE_FIELD(unk_42);
-		ATTACHMENT_PARSE_FIELD(unk_43);
-		ATTACHMENT_PARSE_FIELD(unk_44);
-		ATTACHMENT_PARSE_FIELD(unk_45);
-		ATTACHMENT_PARSE_FIELD(unk_46);
-		ATTACHMENT_PARSE_FIELD(unk_47);
-		ATTACHMENT_PARSE_FIELD(unk_48);
-	}
-
-	void parse_att(AttAmmunition* asset, ordered_json& data, zone_memory* mem)
-	{
-		ATTACHMENT_PARSE_FIELD(maxAmmo);
-		ATTACHMENT_PARSE_FIELD(startAmmo);
-		ATTACHMENT_PARSE_FIELD(clipSize);
-		ATTACHMENT_PARSE_FIELD(shotCount);
-		ATTACHMENT_PARSE_FIELD(reloadAmmoAdd);
-		ATTACHMENT_PARSE_FIELD(reloadStartAdd);
-		ATTACHMENT_PARSE_FIELD(requireAmmoUsedPerShot);
-	}
-
-	void parse_att(AttDamage* asset, ordered_json& data, zone_memory* mem)
-	{
-		ATTACHMENT_PARSE_FIELD(damage);
-		ATTACHMENT_PARSE_FIELD(mid1Damage);
-		ATTACHMENT_PARSE_FIELD(mid2Damage);
-		ATTACHMENT_PARSE_FIELD(mid3Damage);
-		ATTACHMENT_PARSE_FIELD(minDamage);
-		ATTACHMENT_PARSE_FIELD(meleeDamage);
-		ATTACHMENT_PARSE_FIELD(maxDamageRange);
-		ATTACHMENT_PARSE_FIELD(mid1DamageRange);
-		ATTACHMENT_PARSE_FIELD(mid2DamageRange);
-		ATTACHMENT_PARSE_FIELD(mid3DamageRange);
-		ATTACHMENT_PARSE_FIELD(minDamageRange);
-		ATTACHMENT_PARSE_FIELD(playerDamage);
-		ATTACHMENT_PARSE_FIELD(mid1PlayerDamage);
-		ATTACHMENT_PARSE_FIELD(mid2PlayerDamage);
-		ATTACHMENT_PARSE_FIELD(mid3PlayerDamage);
-		ATTACHMENT_PARSE_FIELD(minPlayerDamage);
-	}
-
-	void parse_att(AttIdleSettings* asset, ordered_json& data, zone_memory* mem)
-	{
-		ATTACHMENT_PARSE_FIELD(hipIdleAmount);
-		ATTACHMENT_PARSE_FIELD(hipIdleSpeed);
-		ATTACHMENT_PARSE_FIELD(idleCrouchFactor);
-		ATTACHMENT_PARSE_FIELD(idleProneFactor);
-		ATTACHMENT_PARSE_FIELD(adsIdleLerpStartTime);
-		ATTACHMENT_PARSE_FIELD(adsIdleLerpTime);
-	}
-
-	void parse_att(AttADSSettings* asset, ordered_json& data, zone_memory* mem)
-	{
-		ATTACHMENT_PARSE_FIELD(adsSpread);
-		ATTACHMENT_PARSE_FIELD(adsAimPitch);
-		ATTACHMENT_PARSE_FIELD(adsTransInTime);
-		ATTACHMENT_PARSE_FIELD(adsTransOutTime);
-		ATTACHMENT_PARSE_FIELD(adsReloadTransTime);
-		ATTACHMENT_PARSE_FIELD(adsCrosshairInFrac);
-		ATTACHMENT_PARSE_FIELD(adsCrosshairOutFrac);
-		ATTACHMENT_PARSE_FIELD(adsInCrosshairAlphaStart);
-		ATTACHMENT_PARSE_FIELD(adsInCrosshairAlphaEnd);
-		ATTACHMENT_PARSE_FIELD(adsOutCrosshairAlphaStart);
-		ATTACHMENT_PARSE_FIELD(adsOutCrosshairAlphaEnd);
-		ATTACHMENT_PARSE_FIELD(adsZoomFov);
-		ATTACHMENT_PARSE_FIELD(adsZoomInFrac);
-		ATTACHMENT_PARSE_FIELD(adsZoomOutFrac);
-		ATTACHMENT_PARSE_FIELD(adsFovLerpTime);
-		ATTACHMENT_PARSE_FIELD(adsBobFactor);
-		ATTACHMENT_PARSE_FIELD(adsViewBobMult);
-		ATTACHMENT_PARSE_FIELD(adsFireRateScale);
-		ATTACHMENT_PARSE_FIELD(adsDamageRangeScale);
-		ATTACHMENT_PARSE_FIELD(adsFireAnimFrac);
-		ATTACHMENT_PARSE_FIELD(fireTimerLerpToAdsScale);
-		ATTACHMENT_PARSE_FIELD(alwaysFireAtMaxRangeInAds);
-		ATTACHMENT_PARSE_FIELD(adsAlignEnabled);
-		ATTACHMENT_PARSE_FIELD(disableTagAlignX);
-	}
-
-	void parse_att(AttScopeDriftSettings* asset, ordered_json& data, zone_memory* mem)
-	{
-		ATTACHMENT_PARSE_FIELD(fScopeDriftDelay);
-		ATTACHMENT_PARSE_FIELD(fScopeDriftLerpInTime);
-		ATTACHMENT_PARSE_FIELD(fScopeDriftSteadyTime);
-		ATTACHMENT_PARSE_FIELD(fScopeDriftLerpOutTime);
-		ATTACHMENT_PARSE_FIELD(fScopeDriftSteadyFactor);
-		ATTACHMENT_PARSE_FIELD(fScopeDriftUnsteadyFactor);
-	}
-
-	void parse_att(AttHipSpread* asset, ordered_json& data, zone_memory* mem)
-	{
-		ATTACHMENT_PARSE_FIELD(hipSpreadStandMin);
-		ATTACHMENT_PARSE_FIELD(hipSpreadDuckedMin);
-		ATTACHMENT_PARSE_FIELD(hipSpreadProneMin);
-		ATTACHMENT_PARSE_FIELD(hipSpreadSprintMin);
-		ATTACHMENT_PARSE_FIELD(hipSpreadInAirMin);
-		ATTACHMENT_PARSE_FIELD(hipSpreadMax);
-		ATTACHMENT_PARSE_FIELD(hipSpreadDuckedMax);
-		ATTACHMENT_PARSE_FIELD(hipSpreadProneMax);
-		ATTACHMENT_PARSE_FIELD(hipSpreadSprintMax);
-		ATTACHMENT_PARSE_FIELD(hipSpreadInAirMax);
-		ATTACHMENT_PARSE_FIELD(hipSpreadFireAdd);
-		ATTACHMENT_PARSE_FIELD(hipSpreadTurnAdd);
-		ATTACHMENT_PARSE_FIELD(hipSpreadMoveAdd);
-		ATTACHMENT_PARSE_FIELD(hipSpreadDecayRate);
-		ATTACHMENT_PARSE_FIELD(hipSpreadDuckedDecay);
-		ATTACHMENT_PARSE_FIELD(hipSpreadProneDecay);
-		ATTACHMENT_PARSE_FIELD(hipSpreadSprintDecay);
-		ATTACHMENT_PARSE_FIELD(hipSpreadInAirDecay);
-	}
-
-	void parse_att(AttSlideSpread* asset, ordered_json& data, zone_memory* mem)
-	{
-		ATTACHMENT_PARSE_FIELD(slideSpreadMin);
-		ATTACHMENT_PARSE_FIELD(slideSpreadMax);
-		ATTACHMENT_PARSE_FIELD(slideSpreadDecayRate);
-		ATTACHMENT_PARSE_FIELD(slideSpreadFireAdd);
-		ATTACHMENT_PARSE_FIELD(slideSpreadTurnAdd);
-	}
-
-	void parse_att(AttGunKick* asset, ordered_json& data, zone_memory* mem)
-	{
-		ATTACHMENT_PARSE_FIELD(hipGunKickReducedKickBullets);
-		ATTACHMENT_PARSE_FIELD(hipGunKickReducedKickPercent);
-		ATTACHMENT_PARSE_FIELD(hipGunKickPitchMin);
-		ATTACHMENT_PARSE_FIELD(hipGunKickPitchMax);
-		ATTACHMENT_PARSE_FIELD(hipGunKickYawMin);
-		ATTACHMENT_PARSE_FIELD(hipGunKickYawMax);
-		ATTACHMENT_PARSE_FIELD(hipGunKickMagMin);
-		ATTACHMENT_PARSE_FIELD(hipGunKickAccel);
-		ATTACHMENT_PARSE_FIELD(hipGunKickSpeedMax);
-		ATTACHMENT_PARSE_FIELD(hipGunKickSpeedDecay);
-		ATTACHMENT_PARSE_FIELD(hipGunKickStaticDecay);
-		ATTACHMENT_PARSE_FIELD(adsGunKickReducedKickBullets);
-		ATTACHMENT_PARSE_FIELD(adsGunKickReducedKickPercent);
-		ATTACHMENT_PARSE_FIELD(adsGunKickPitchMin);
-		ATTACHMENT_PARSE_FIELD(adsGunKickPitchMax);
-		ATTACHMENT_PARSE_FIELD(adsGunKickYawMin);
-		ATTACHMENT_PARSE_FIELD(adsGunKickYawMax);
-		ATTACHMENT_PARSE_FIELD(adsGunKickMagMin);
-		ATTACHMENT_PARSE_FIELD(adsGunKickAccel);
-		ATTACHMENT_PARSE_FIELD(adsGunKickSpeedMax);
-		ATTACHMENT_PARSE_FIELD(adsGunKickSpeedDecay);
-		ATTACHMENT_PARSE_FIELD(adsGunKickStaticDecay);
-	}
-
-	void parse_att(AttViewKick* asset, ordered_json& data, zone_memory* mem)
-	{
-		ATTACHMENT_PARSE_FIELD(hipViewKickPitchMin);
-		ATTACHMENT_PARSE_FIELD(hipViewKickPitchMax);
-		ATTACHMENT_PARSE_FIELD(hipViewKickYawMin);
-		ATTACHMENT_PARSE_FIELD(hipViewKickYawMax);
-		ATTACHMENT_PARSE_FIELD(hipViewKickMagMin);
-		ATTACHMENT_PARSE_FIELD(hipViewKickCenterSpeed);
-		ATTACHMENT_PARSE_FIELD(adsViewKickPitchMin);
-		ATTACHMENT_PARSE_FIELD(adsViewKickPitchMax);
-		ATTACHMENT_PARSE_FIELD(adsViewKickYawMin);
-		ATTACHMENT_PARSE_FIELD(adsViewKickYawMax);
-		ATTACHMENT_PARSE_FIELD(adsViewKickMagMin);
-		ATTACHMENT_PARSE_FIELD(adsViewKickCenterSpeed);
-		ATTACHMENT_PARSE_FIELD(kickAlignedInputScalar);
-		ATTACHMENT_PARSE_FIELD(kickOpposedInputScalar);
-	}
-
-	void parse_att(AttADSOverlay* asset, ordered_json& data, zone_memory* mem)
-	{
-		ATTACHMENT_PARSE_ASSET(overlay.shader);
-		ATTACHMENT_PARSE_ASSET(overlay.shaderLowRes);
-		ATTACHMENT_PARSE_ASSET(overlay.shaderEMP);
-		ATTACHMENT_PARSE_ASSET(overlay.shaderEMPLowRes);
-		ATTACHMENT_PARSE_FIELD(overlay.reticle);
-		ATTACHMENT_PARSE_FIELD(overlay.width);
-		ATTACHMENT_PARSE_FIELD(overlay.height);
-		ATTACHMENT_PARSE_FIELD(overlay.widthSplitscreen);
-		ATTACHMENT_PARSE_FIELD(overlay.heightSplitscreen);
-		ATTACHMENT_PARSE_FIELD(hybridToggle);
-		ATTACHMENT_PARSE_FIELD(thermalScope);
-		ATTACHMENT_PARSE_FIELD(thermalToggle);
-		ATTACHMENT_PARSE_FIELD(outlineEnemies);
-	}
-
-	void parse_att(AttOutline* asset, ordered_json& data, zone_memory* mem)
-	{
-		ATTACHMENT_PARSE_FIELD_ARR(outlineColor, 4);
-		ATTACHMENT_PARSE_FIELD_ARR(outlineAltColor, 4);
-		ATTACHMENT_PARSE_FIELD_ARR(outlineFillColor0, 4);
-		ATTACHMENT_PARSE_FIELD_ARR(outlineFillColor1, 4);
-		ATTACHMENT_PARSE_FIELD_ARR(outlineOccludedOutlineColor, 4);
-		ATTACHMENT_PARSE_FIELD_ARR(outlineOccludedInlineColor, 4);
-		ATTACHMENT_PARSE_FIELD_ARR(outlineOccludedInteriorColor, 4);
-		ATTACHMENT_PARSE_FIELD(outlineWidth);
-		ATTACHMENT_PARSE_FIELD(outlineEnemies);
-		ATTACHMENT_PARSE_FIELD(outlineDepthTest);
-		ATTACHMENT_PARSE_FIELD(outlineFill);
-		ATTACHMENT_PARSE_FIELD(outlineScriptControlled);
-		ATTACHMENT_PARSE_FIELD(outlineVehicles);
-		ATTACHMENT_PARSE_FIELD(outlineTurrets);
-		ATTACHMENT_PARSE_FIELD(outlineCharacters);
-		ATTACHMENT_PARSE_FIELD(outlineAgents);
-		ATTACHMENT_PARSE_FIELD(outlineScriptMovers);
-		ATTACHMENT_PARSE_FIELD(outlineLockOn);
-	}
-
-	void parse_att(AttUI* asset, ordered_json& data, zone_memory* mem)
-	{
-		ATTACHMENT_PARSE_ASSET(hudIcon);
-		ATTACHMENT_PARSE_ASSET(pickupIcon);
-		ATTACHMENT_PARSE_ASSET(dangerIcon);
-		ATTACHMENT_PARSE_ASSET(throwBackIcon);
-		ATTACHMENT_PARSE_FIELD(hideWarningIcons);
-		ATTACHMENT_PARSE_FIELD(warningIconsDelay);
-		ATTACHMENT_PARSE_ASSET(dpadIcon);
-		ATTACHMENT_PARSE_ASSET(ammoCounterIcon);
-		ATTACHMENT_PARSE_FIELD(ammoCounterClip);
-		ATTACHMENT_PARSE_FIELD(grenadeDangerIconDistance);
-	}
-
-	void parse_att(AttRumbles* asset, ordered_json& data, zone_memory* mem)
-	{
-		ATTACHMENT_PARSE_ASSET(fireRumble);
-		ATTACHMENT_PARSE_ASSET(meleeImpactRumble);
-	}
-
-	void parse_att(AttProjectile* asset, ordered_json& data, zone_memory* mem)
-	{
-		ATTACHMENT_PARSE_FIELD(explosionRadius);
-		ATTACHMENT_PARSE_FIELD(explosionForceRadius);
-		ATTACHMENT_PARSE_FIELD(explosionInnerDamage);
-		ATTACHMENT_PARSE_FIELD(explosionOuterDamage);
-		ATTACHMENT_PARSE_FIELD(damageConeAngle);
-		ATTACHMENT_PARSE_FIELD(projectileSpeed);
-		ATTACHMENT_PARSE_FIELD(projectileSpeedUp);
-		ATTACHMENT_PARSE_FIELD(projectileActivateDist);
-		ATTACHMENT_PARSE_FIELD(projectileLifetime);
-		ATTACHMENT_PARSE_FIELD(projectileLifetimeStdDeviation);
-		ATTACHMENT_PARSE_ASSET(projectileModel);
-		ATTACHMENT_PARSE_FIELD(projExplosionType);
-		ATTACHMENT_PARSE_FIELD(projExplosionEffect.type);
-		ATTACHMENT_PARSE_ASSET(projExplosionEffect.u.fx);
-		ATTACHMENT_PARSE_FIELD(projExplosionEffectForceNormalUp);
-		ATTACHMENT_PARSE_STRING(projExplosionSound);
-		ATTACHMENT_PARSE_FIELD(projDudEffect.type);
-		ATTACHMENT_PARSE_ASSET(projDudEffect.u.fx);
-		ATTACHMENT_PARSE_STRING(projDudSound);
-		ATTACHMENT_PARSE_FIELD(projImpactExplode);
-		ATTACHMENT_PARSE_FIELD(disableProjectileCrumpleCheck);
-		ATTACHMENT_PARSE_FIELD(destabilizationRateTime);
-		ATTACHMENT_PARSE_FIELD(destabilizationCurvatureMax);
-		ATTACHMENT_PARSE_FIELD(destabilizeDistance);
-		ATTACHMENT_PARSE_FIELD(projBodyEffect.type);
-		ATTACHMENT_PARSE_ASSET(projBodyEffect.u.fx);
-		ATTACHMENT_PARSE_FIELD(projTrailEffect.type);
-		ATTACHMENT_PARSE_ASSET(projTrailEffect.u.fx);
-		ATTACHMENT_PARSE_FIELD(projBeaconEffect.type);
-		ATTACHMENT_PARSE_ASSET(projBeaconEffect.u.fx);
-		ATTACHMENT_PARSE_FIELD(projIgnitionDelay);
-		ATTACHMENT_PARSE_FIELD(projIgnitionEffect.type);
-		ATTACHMENT_PARSE_ASSET(projIgnitionEffect.u.fx);
-		ATTACHMENT_PARSE_STRING(projIgnitionSound);
-		ATTACHMENT_PARSE_FIELD(stickiness);
-		ATTACHMENT_PARSE_FIELD(fuseTime);
-		ATTACHMENT_PARSE_FIELD(aiFuseTime);
-		ATTACHMENT_PARSE_FIELD(stickToPlayers);
-		ATTACHMENT_PARSE_FIELD(stickToVehicles);
-		ATTACHMENT_PARSE_FIELD(stickToTurrets);
-		ATTACHMENT_PARSE_FIELD(stickToNonStick);
-		ATTACHMENT_PARSE_FIELD(timedDetonation);
-		ATTACHMENT_PARSE_FIELD(isPredictedProjectile);
-		ATTACHMENT_PARSE_FIELD(useSteppedExplosionDamage);
-		ATTACHMENT_PARSE_FIELD(reactiveMotionRadiusScale);
-		ATTACHMENT_PARSE_FIELD(reactiveMotionFrequencyScale);
-		ATTACHMENT_PARSE_FIELD(reactiveMotionAmplitudeScale);
-		ATTACHMENT_PARSE_FIELD(reactiveMotionFalloff);
-		ATTACHMENT_PARSE_FIELD(reactiveMotionLifetime);
-	}
-
-	void parse_att(AttCharged* asset, ordered_json& data, zone_memory* mem)
-	{
-		ATTACHMENT_PARSE_FIELD(chargeType);
-		ATTACHMENT_PARSE_FIELD(chargeGain);
-		ATTACHMENT_PARSE_FIELD(chargeCostPerShot);
-		ATTACHMENT_PARSE_FIELD(chargeLossWhenIdle);
-		ATTACHMENT_PARSE_FIELD(chargeEmptyCooldown);
-		ATTACHMENT_PARSE_FIELD(chargeFireAtMaxDamageMultiplier);
-		ATTACHMENT_PARSE_FIELD(chargeMeterEffectBoneCount);
-		ATTACHMENT_PARSE_FIELD(chargeMeterEffect.type);
-		ATTACHMENT_PARSE_ASSET(chargeMeterEffect.u.fx);
-		ATTACHMENT_PARSE_STRING(chargeUpSound);
-		ATTACHMENT_PARSE_STRING(chargeDownSound);
-		ATTACHMENT_PARSE_STRING(chargeDownToUpSound);
-		ATTACHMENT_PARSE_STRING(chargeUpToDownSound);
-		ATTACHMENT_PARSE_STRING(chargeMaxSound);
-		ATTACHMENT_PARSE_STRING(chargeUpSoundPlayer);
-		ATTACHMENT_PARSE_STRING(chargeDownSoundPlayer);
-		ATTACHMENT_PARSE_STRING(chargeDownToUpSoundPlayer);
-		ATTACHMENT_PARSE_STRING(chargeUpToDownSoundPlayer);
-		ATTACHMENT_PARSE_STRING(chargeMaxSoundPlayer);
-		ATTACHMENT_PARSE_FIELD(chargeHudReveal);
-		ATTACHMENT_PARSE_ASSET(chargeRumble);
-	}
-
-	void parse_att(AdsAltSwitch* asset, ordered_json& data, zone_memory* mem)
-	{
-		ATTACHMENT_PARSE_FIELD(fovInterpTimeSecMainToAlt);
-		ATTACHMENT_PARSE_FIELD(fovInterpDelaySecMainToAlt);
-		ATTACHMENT_PARSE_FIELD(dualFovSwitchRateMainToAlt);
-		ATTACHMENT_PARSE_FIELD(fovInterpTypeMainToAlt);
-		ATTACHMENT_PARSE_FIELD(fovInterpTimeSecAltToMain);
-		ATTACHMENT_PARSE_FIELD(fovInterpDelaySecAltToMain);
-		ATTACHMENT_PARSE_FIELD(dualFovSwitchRateAltToMain);
-		ATTACHMENT_PARSE_FIELD(fovInterpTypeAltToMain);
-	}
-
-	void parse_att(AttRegeneration* asset, ordered_json& data, zone_memory* mem)
-	{
-		ATTACHMENT_PARSE_FIELD(regenerationEnabled);
-		ATTACHMENT_PARSE_FIELD(regenerationTimeMs);
-		ATTACHMENT_PARSE_FIELD(regenerationAddTimeMs);
-		ATTACHMENT_PARSE_FIELD(regenerationAmount);
-		ATTACHMENT_PARSE_FIELD(regenerationConsumeStock);
-		ATTACHMENT_PARSE_FIELD(regenerationDisableWhileFiring);
-	}
-
-	void parse_att(AttMovement* asset, ordered_json& data, zone_memory* mem)
-	{
-		ATTACHMENT_PARSE_FIELD(moveSpeedScale);
-		ATTACHMENT_PARSE_FIELD(adsMoveSpeedScale);
-		ATTACHMENT_PARSE_FIELD(fastADS3PAnims);
-	}
-
-	void parse_att(AttBurst* asset, ordered_json& data, zone_memory* mem)
-	{
-		ATTACHMENT_PARSE_FIELD(burstFireCooldown);
-		ATTACHMENT_PARSE_FIELD(burstFireAuto);
-	}
-
-#define PARSE_ATT(__att__) \
-	if (!data[#__att__].is_null()) \
-	{ \
-		asset->__att__ = mem->allocate<typename std::remove_reference<decltype(*asset->__att__)>::type>(); \
-		parse_att(asset->__att__, data[#__att__], mem);  \
-	} \
-	else \
-	{ \
-		 asset->__att__ = nullptr; \
+		att = mem->allocate<T>();
+		fields.read(att, data, mem);
 	}
 
 	WeaponAttachment* weapon_attachment::parse(const std::string& name, zone_memory* mem)
@@ -689,95 +674,60 @@ namespace zonetool::iw7
 		auto size = file.size();
 		auto bytes = file.read_bytes(size);
 		file.close();
-		ordered_json data = json::parse(bytes);
+		const ordered_json data = json::parse(bytes);
 
 		auto* asset = mem->allocate<WeaponAttachment>();
 
-		ATTACHMENT_PARSE_STRING(szInternalName);
-		ATTACHMENT_PARSE_STRING(szDisplayName);
+		attachment_fields.read(asset, data, mem);
 		this->add_script_string(&asset->internalName, asset->szInternalName);
-		ATTACHMENT_PARSE_FIELD(papAttachment);
-		ATTACHMENT_PARSE_FIELD(type);
-		ATTACHMENT_PARSE_FIELD(weaponType);
-		ATTACHMENT_PARSE_FIELD_RENAME(weapClass, "weaponClass");
-		ATTACHMENT_PARSE_ASSET(worldModelCamo);
-		ATTACHMENT_PARSE_ASSET(viewModelCamo);
-		ATTACHMENT_PARSE_ASSET_ARR(worldModelVariations, asset->numModelVariations);
-		ATTACHMENT_PARSE_ASSET_ARR(viewModelVariations, asset->numModelVariations);
-		ATTACHMENT_PARSE_ASSET_ARR(worldModelCamoMaterials, asset->numWorldModelCamoMaterials);
-		ATTACHMENT_PARSE_ASSET_ARR(viewModelCamoMaterials, asset->numViewModelCamoMaterials);
-		ATTACHMENT_PARSE_SCRIPT_STRING(attachPoint);
-		ATTACHMENT_PARSE_ASSET_ARR(reticles, asset->numReticles);
-		ATTACHMENT_PARSE_ASSET_ARR(altReticles, asset->numAltReticles);
-		PARSE_ATT(ammogeneral);
-		PARSE_ATT(tracer);
-		PARSE_ATT(penetration);
-		PARSE_ATT(sight);
-		PARSE_ATT(holdBreath);
-		PARSE_ATT(reload);
-		PARSE_ATT(addOns);
-		PARSE_ATT(laser);
-		PARSE_ATT(general);
-		PARSE_ATT(aimAssist);
-		PARSE_ATT(targetAssist);
-		PARSE_ATT(unkAtt01);
-		PARSE_ATT(ammunition);
-		PARSE_ATT(damage);
-		PARSE_ATT(idleSettings);
-		PARSE_ATT(adsSettings);
-		PARSE_ATT(adsSettingsMain);
-		PARSE_ATT(scopeDriftSettings);
-		PARSE_ATT(scopeDriftSettingsMain);
-		PARSE_ATT(hipSpread);
-		PARSE_ATT(slideSpread);
-		PARSE_ATT(gunKick);
-		PARSE_ATT(viewKick);
-		PARSE_ATT(adsOverlay);
-		PARSE_ATT(outline);
-		PARSE_ATT(ui);
-		PARSE_ATT(rumbles);
-		PARSE_ATT(projectile);
-		PARSE_ATT(charged);
-		PARSE_ATT(adsAltSwitch);
-		PARSE_ATT(regeneration);
-		PARSE_ATT(movement);
-		PARSE_ATT(burst);
-		ATTACHMENT_PARSE_FIELD_ALLOC_ARR(locationDamage, 22);
-		ATTACHMENT_PARSE_FIELD(ammunitionScale);
-		ATTACHMENT_PARSE_FIELD(damageScale);
-		ATTACHMENT_PARSE_FIELD(stateTimersScale);
-		ATTACHMENT_PARSE_FIELD(reloadTimersScale);
-		ATTACHMENT_PARSE_FIELD(fireTimeOverride);
-		ATTACHMENT_PARSE_FIELD(fireTimeAkimboOverride);
-		ATTACHMENT_PARSE_FIELD(fireTimersScale);
-		ATTACHMENT_PARSE_FIELD(burstFireCooldownScale);
-		ATTACHMENT_PARSE_FIELD(idleHipMotionScale);
-		ATTACHMENT_PARSE_FIELD(idleADSMotionScale);
-		ATTACHMENT_PARSE_FIELD(idleADSMotionTimeScale);
-		ATTACHMENT_PARSE_FIELD(adsSettingsScale);
-		ATTACHMENT_PARSE_FIELD(adsSettingsScaleMain);
-		ATTACHMENT_PARSE_FIELD(hipSpreadScale);
-		ATTACHMENT_PARSE_FIELD(slideSpreadScale);
-		ATTACHMENT_PARSE_FIELD(gunKickScale);
-		ATTACHMENT_PARSE_FIELD(viewKickScale);
-		ATTACHMENT_PARSE_FIELD(viewCenterScale);
-		ATTACHMENT_PARSE_FIELD(adsSwayScale);
-		ATTACHMENT_PARSE_FIELD(adsSwayScale2);
-		ATTACHMENT_PARSE_FIELD(adsSwayScale3);
-		ATTACHMENT_PARSE_FIELD(iAmmoIndex); // probably runtime data
-		ATTACHMENT_PARSE_FIELD(loadIndex); // ^
-		ATTACHMENT_PARSE_FIELD(useAlternateViewModelLaser);
-		ATTACHMENT_PARSE_FIELD(hideIronSightsWithThisAttachment);
-		ATTACHMENT_PARSE_FIELD(shareAmmoWithAlt);
-		ATTACHMENT_PARSE_FIELD(useLeftTriggerAltFire);
-		ATTACHMENT_PARSE_FIELD(containsIKTag);
-		ATTACHMENT_PARSE_FIELD(isAkimboAttachment);
-		ATTACHMENT_PARSE_FIELD(attachLeftWeaponAkimbo);
-		ATTACHMENT_PARSE_FIELD(attachRightWeaponAkimbo);
-		ATTACHMENT_PARSE_FIELD(luiWeaponInfoWidgetUsesScopeStencil);
-		ATTACHMENT_PARSE_STRING(szAltModeName);
-		ATTACHMENT_PARSE_STRING(szLUIWeaponInfoWidgetName);
-		ATTACHMENT_PARSE_STRING(szLUIWeaponInfoWidgetTag);
+
+		json_fields::read_asset_list(asset->worldModelVariations, json_fields::get(data, "worldModelVariations"), asset->numModelVariations, mem);
+		json_fields::read_asset_list(asset->viewModelVariations, json_fields::get(data, "viewModelVariations"), asset->numModelVariations, mem);
+		json_fields::read_asset_list(asset->worldModelCamoMaterials, json_fields::get(data, "worldModelCamoMaterials"), asset->numWorldModelCamoMaterials, mem);
+		json_fields::read_asset_list(asset->viewModelCamoMaterials, json_fields::get(data, "viewModelCamoMaterials"), asset->numViewModelCamoMaterials, mem);
+		json_fields::read_asset_list(asset->reticles, json_fields::get(data, "reticles"), asset->numReticles, mem);
+		json_fields::read_asset_list(asset->altReticles, json_fields::get(data, "altReticles"), asset->numAltReticles, mem);
+
+		const auto& attach_point = json_fields::get(data, "attachPoint");
+		if (attach_point.is_string() && !attach_point.get_ref<const std::string&>().empty())
+		{
+			this->add_script_string(&asset->attachPoint, mem->duplicate_string(attach_point.get_ref<const std::string&>()));
+		}
+		asset->attachPoint = scr_string_t(0);
+
+		parse_att(asset->ammogeneral, json_fields::get(data, "ammogeneral"), ammo_general_fields, mem);
+		parse_att(asset->tracer, json_fields::get(data, "tracer"), ammo_tracer_fields, mem);
+		parse_att(asset->penetration, json_fields::get(data, "penetration"), penetration_fields, mem);
+		parse_att(asset->sight, json_fields::get(data, "sight"), sight_fields, mem);
+		parse_att(asset->holdBreath, json_fields::get(data, "holdBreath"), hold_breath_fields, mem);
+		parse_att(asset->reload, json_fields::get(data, "reload"), reload_fields, mem);
+		parse_att(asset->addOns, json_fields::get(data, "addOns"), add_ons_fields, mem);
+		parse_att(asset->laser, json_fields::get(data, "laser"), laser_fields, mem);
+		parse_att(asset->general, json_fields::get(data, "general"), general_fields, mem);
+		parse_att(asset->aimAssist, json_fields::get(data, "aimAssist"), aim_assist_fields, mem);
+		parse_att(asset->targetAssist, json_fields::get(data, "targetAssist"), target_assist_fields, mem);
+		parse_att(asset->unkAtt01, json_fields::get(data, "unkAtt01"), unknown01_fields, mem);
+		parse_att(asset->ammunition, json_fields::get(data, "ammunition"), ammunition_fields, mem);
+		parse_att(asset->damage, json_fields::get(data, "damage"), damage_fields, mem);
+		parse_att(asset->idleSettings, json_fields::get(data, "idleSettings"), idle_settings_fields, mem);
+		parse_att(asset->adsSettings, json_fields::get(data, "adsSettings"), ads_settings_fields, mem);
+		parse_att(asset->adsSettingsMain, json_fields::get(data, "adsSettingsMain"), ads_settings_fields, mem);
+		parse_att(asset->scopeDriftSettings, json_fields::get(data, "scopeDriftSettings"), scope_drift_settings_fields, mem);
+		parse_att(asset->scopeDriftSettingsMain, json_fields::get(data, "scopeDriftSettingsMain"), scope_drift_settings_fields, mem);
+		parse_att(asset->hipSpread, json_fields::get(data, "hipSpread"), hip_spread_fields, mem);
+		parse_att(asset->slideSpread, json_fields::get(data, "slideSpread"), slide_spread_fields, mem);
+		parse_att(asset->gunKick, json_fields::get(data, "gunKick"), gun_kick_fields, mem);
+		parse_att(asset->viewKick, json_fields::get(data, "viewKick"), view_kick_fields, mem);
+		parse_att(asset->adsOverlay, json_fields::get(data, "adsOverlay"), ads_overlay_fields, mem);
+		parse_att(asset->outline, json_fields::get(data, "outline"), outline_fields, mem);
+		parse_att(asset->ui, json_fields::get(data, "ui"), ui_fields, mem);
+		parse_att(asset->rumbles, json_fields::get(data, "rumbles"), rumbles_fields, mem);
+		parse_att(asset->projectile, json_fields::get(data, "projectile"), projectile_fields, mem);
+		parse_att(asset->charged, json_fields::get(data, "charged"), charged_fields, mem);
+		parse_att(asset->adsAltSwitch, json_fields::get(data, "adsAltSwitch"), ads_alt_switch_fields, mem);
+		parse_att(asset->regeneration, json_fields::get(data, "regeneration"), regeneration_fields, mem);
+		parse_att(asset->movement, json_fields::get(data, "movement"), movement_fields, mem);
+		parse_att(asset->burst, json_fields::get(data, "burst"), burst_fields, mem);
 
 		return asset;
 	}
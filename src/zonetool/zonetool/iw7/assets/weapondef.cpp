@@ -1,6 +1,8 @@
 #include <std_include.hpp>
 #include "weapondef.hpp"
 
+#include "zonetool/utils/json_fields.hpp"
+
 namespace zonetool::iw7
 {
 	void weapon_def::add_script_string(scr_string_t* ptr, const char* str)
@@ -27,1096 +29,1065 @@ namespace zonetool::iw7
 		return nullptr;
 	}
 
-#define MODVAL(__field__, __size__) \
-	if (__size__) assert(__size__ == static_cast<decltype(__size__)>(data[#__field__].size())); \
-	__size__ = static_cast<decltype(__size__)>(data[#__field__].size()); \
+#define WEAPON_FIELD(__struct__, __field__) JSON_FIELD(__struct__, decltype(__struct__::__field__), __field__)
+#define WEAPON_FIELD_ARR(__struct__, __field__, __size__) \
+	JSON_FIELD_ARR(__struct__, std::remove_reference_t<decltype(std::declval<__struct__&>().__field__[0])>, __field__, __size__)
+#define WEAPON_FIELD_FXCOMBINED(__struct__, __field__) \
+	{#__field__, offsetof(__struct__, __field__), read_fx_combined_field}
 
-#define WEAPON_PARSE_STRING(__field__) \
-	static_assert(std::is_same_v<decltype(asset->__field__), const char*>, "Field is not of type const char*"); \
-	!data[#__field__].is_null() ? asset->__field__ = mem->duplicate_string(data[#__field__].get<std::string>()) : asset->__field__ = nullptr;
+	namespace
+	{
+		// fx or vfx name stub, dumped as {"type": ..., "fx": name}
+		void read_fx_combined(FxCombinedDef* def, const ordered_json& value, zone_memory* mem)
+		{
+			def->u.data = mem->manual_allocate<char>(sizeof(const char*));
+			def->type = value.at("type").get<FxCombinedType>();
+			def->u.fx->name = mem->duplicate_string(value.at("fx").get<std::string>());
+		}
 
-#define WEAPON_PARSE_STRING_ARR(__field__, __size__) \
-	if(!data[#__field__].is_null()) \
-	{ \
-		for (auto idx##__field__ = 0u; idx##__field__ < (unsigned int)__size__; idx##__field__++) \
-		{ \
-			!data[#__field__][idx##__field__].is_null() && !data[#__field__][idx##__field__].get<std::string>().empty() ? asset->__field__[idx##__field__] = mem->duplicate_string(data[#__field__][idx##__field__].get<std::string>()) : asset->__field__[idx##__field__] = nullptr; \
-		} \
+		void read_fx_combined_field(void* field, const ordered_json& value, zone_memory* mem)
+		{
+			read_fx_combined(static_cast<FxCombinedDef*>(field), value, mem);
+		}
 	}
-#define WEAPON_PARSE_STRING_ARR_MODVAL(__field__, __size__) \
-	MODVAL(__field__, __size__) \
-	WEAPON_PARSE_STRING_ARR(__field__, __size__)
-
-#define WEAPON_PARSE_SCRIPT_STRING(__field__) \
-	if (!data[#__field__].is_null() && !data[#__field__].get<std::string>().empty()) this->add_script_string(&asset->__field__, mem->duplicate_string(data[#__field__].get<std::string>())); asset->__field__ = scr_string_t(0);
 
-#define WEAPON_PARSE_SCRIPT_STRING_ALLOC_ARR(__field__, __size__) \
-	if (!data[#__field__].is_null()) \
-	{ \
-		asset->__field__ = mem->allocate<scr_string_t>(__size__); \
-		for (auto idx##__field__ = 0u; idx##__field__ < (unsigned int)__size__; idx##__field__++) \
-		{ \
-			if (!data[#__field__][idx##__field__].is_null() && !data[#__field__][idx##__field__].get<std::string>().empty()) this->add_script_string(&asset->__field__[idx##__field__], mem->duplicate_string(data[#__field__][idx##__field__].get<std::string>())); asset->__field__[idx##__field__] = scr_string_t(0); \
-		} \
-	}
-#define WEAPON_PARSE_SCRIPT_STRING_ALLOC_ARR_MODVAL(__field__, __size__) \
-	MODVAL(__field__, __size__) \
-	WEAPON_PARSE_SCRIPT_STRING_ALLOC_ARR(__field__, __size__)
+	constexpr auto overlay_fields = json_fields::make_field_table<ADSOverlay, ordered_json>(
+	{
+		JSON_FIELD_ASSET(ADSOverlay, shader),
+		JSON_FIELD_ASSET(ADSOverlay, shaderLowRes),
+		JSON_FIELD_ASSET(ADSOverlay, shaderEMP),
+		JSON_FIELD_ASSET(ADSOverlay, shaderEMPLowRes),
+		WEAPON_FIELD(ADSOverlay, reticle),
+		WEAPON_FIELD(ADSOverlay, width),
+		WEAPON_FIELD(ADSOverlay, height),
+		WEAPON_FIELD(ADSOverlay, widthSplitscreen),
+		WEAPON_FIELD(ADSOverlay, heightSplitscreen)
+	});
+
+	constexpr auto rotation_params_fields = json_fields::make_field_table<GrenadeRotationParams, ordered_json>(
+	{
+		WEAPON_FIELD(GrenadeRotationParams, initialPitch),
+		WEAPON_FIELD(GrenadeRotationParams, initialYaw),
+		WEAPON_FIELD(GrenadeRotationParams, initialRoll),
 
-#define WEAPON_PARSE_FIELD(__field__) \
-	if (!data[#__field__].is_null()) asset->__field__ = data[#__field__].get<decltype(asset->__field__)>();
+		WEAPON_FIELD(GrenadeRotationParams, rotationPitchDir),
+		WEAPON_FIELD(GrenadeRotationParams, rotationPitchMin),
+		WEAPON_FIELD(GrenadeRotationParams, rotationPitchMax),
 
-#define WEAPON_PARSE_FIELD_ARR(__field__, __size__) \
-	if(!data[#__field__].is_null()) \
-	{ \
-		for (auto idx##__field__ = 0u; idx##__field__ < (unsigned int)__size__; idx##__field__++) \
-		{ \
-			asset->__field__[idx##__field__] = data[#__field__][idx##__field__].get<typename std::remove_reference<decltype(asset->__field__[idx##__field__])>::type>(); \
-		} \
-	}
-#define WEAPON_PARSE_FIELD_ARR_MODVAL(__field__, __size__) \
-	MODVAL(__field__, __size__) \
-	WEAPON_PARSE_FIELD_ARR(__field__, __size__)
+		WEAPON_FIELD(GrenadeRotationParams, rotationYawDir),
+		WEAPON_FIELD(GrenadeRotationParams, rotationYawMin),
+		WEAPON_FIELD(GrenadeRotationParams, rotationYawMax),
 
-#define WEAPON_PARSE_FIELD_ALLOC_ARR(__field__, __size__) \
-	if(!data[#__field__].is_null()) \
-	{ \
-		asset->__field__ = mem->allocate<typename std::remove_reference<decltype(*asset->__field__)>::type>(__size__); \
-		for (auto idx##__field__ = 0u; idx##__field__ < (unsigned int)__size__; idx##__field__++) \
-		{ \
-			asset->__field__[idx##__field__] = data[#__field__][idx##__field__].get<typename std::remove_reference<decltype(asset->__field__[idx##__field__])>::type>(); \
-		} \
-	} \
-	else \
-	{ \
-		asset->__field__ = nullptr; \
-	}
-#define WEAPON_PARSE_FIELD_ALLOC_ARR_MODVAL(__field__, __size__) \
-	MODVAL(__field__, __size__) \
-	WEAPON_PARSE_FIELD_ALLOC_ARR(__field__, __size__)
+		WEAPON_FIELD(GrenadeRotationParams, rotationRollDir),
+		WEAPON_FIELD(GrenadeRotationParams, rotationRollMin),
+		WEAPON_FIELD(GrenadeRotationParams, rotationRollMax),
 
-#define WEAPON_PARSE_ASSET_ALLOC_ARR(__field__, __size__) \
-	if (!data[#__field__].is_null()) \
-	{ \
-		asset->__field__ = mem->allocate<typename std::remove_reference<decltype(*asset->__field__)>::type>(__size__); \
-		for (auto idx##__field__ = 0u; idx##__field__ < (unsigned int)__size__; idx##__field__++) \
-		{ \
-			if (!data[#__field__][idx##__field__].is_null() && !data[#__field__][idx##__field__].get<std::string>().empty()) \
-			{ \
-				asset->__field__[idx##__field__] = mem->manual_allocate<typename std::remove_reference<decltype(*asset->__field__[idx##__field__])>::type>(sizeof(const char*)); \
-				asset->__field__[idx##__field__]->name = mem->duplicate_string(data[#__field__][idx##__field__].get<std::string>()); \
-			} \
-			else \
-			{ \
-				asset->__field__[idx##__field__] = nullptr; \
-			} \
-		} \
-	} \
-	else \
-	{ \
-		asset->__field__ = nullptr; \
-	}
-#define WEAPON_PARSE_ASSET_ALLOC_ARR_MODVAL(__field__, __size__) \
-	MODVAL(__field__, __size__) \
-	WEAPON_PARSE_ASSET_ALLOC_ARR(__field__, __size__)
+		WEAPON_FIELD(GrenadeRotationParams, rotate)
+	});
 
-#define WEAPON_PARSE_ASSET_FIELD_ARR(__field__, __size__) \
-	if (!data[#__field__].is_null()) \
-	{ \
-		for (auto idx##__field__ = 0u; idx##__field__ < (unsigned int)__size__; idx##__field__++) \
-		{ \
-			if (!data[#__field__][idx##__field__].is_null() && !data[#__field__][idx##__field__].get<std::string>().empty()) \
-			{ \
-				asset->__field__[idx##__field__] = mem->manual_allocate<typename std::remove_reference<decltype(*asset->__field__[idx##__field__])>::type>(sizeof(const char*)); \
-				asset->__field__[idx##__field__]->name = mem->duplicate_string(data[#__field__][idx##__field__].get<std::string>()); \
-			} \
-			else \
-			{ \
-				asset->__field__[idx##__field__] = nullptr; \
-			} \
-		} \
-	}
-#define WEAPON_PARSE_ASSET_FIELD_ARR_MODVAL(__field__, __size__) \
-	MODVAL(__field__, __size__) \
-	WEAPON_PARSE_ASSET_FIELD_ARR(__field__, __size__)
+	constexpr auto anim_override_fields = json_fields::make_field_table<AnimOverride, ordered_json>(
+	{
+		JSON_FIELD_ASSET(AnimOverride, overrides),
+		JSON_FIELD_ASSET(AnimOverride, overridesAlt)
+	});
 
-#define WEAPON_PARSE_ASSET(__field__) \
-	if (!data[#__field__].is_null() && !data[#__field__].get<std::string>().empty()) \
-	{ \
-		asset->__field__ = mem->manual_allocate<typename std::remove_reference<decltype(*asset->__field__)>::type>(sizeof(const char*)); \
-		asset->__field__->name = mem->duplicate_string(data[#__field__].get<std::string>()); \
-	} \
-	else \
-	{ \
-		asset->__field__ = nullptr; \
-	}
+	constexpr auto sfx_override_fields = json_fields::make_field_table<SFXOverride, ordered_json>(
+	{
+		JSON_FIELD_ASSET(SFXOverride, overrides),
+		JSON_FIELD_ASSET(SFXOverride, overridesAlt)
+	});
 
-#define WEAPON_PARSE_FXCOMBINED(__field__) \
-	if (!data[#__field__].is_null()) \
-	{ \
-		asset->__field__.u.data = mem->manual_allocate<char>(sizeof(const char*)); \
-		asset->__field__.type = data[#__field__]["type"].get<FxCombinedType>(); \
-		asset->__field__.u.fx->name = mem->duplicate_string(data[#__field__]["fx"].get<std::string>()); \
-	} \
-	else \
-	{ \
-		asset->__field__.u.data = nullptr; \
-	}
+	constexpr auto vfx_override_fields = json_fields::make_field_table<VFXOverride, ordered_json>(
+	{
+		JSON_FIELD_ASSET(VFXOverride, overrides),
+		JSON_FIELD_ASSET(VFXOverride, overridesAlt)
+	});
 
-#define WEAPON_PARSE_FXCOMBINED_ALLOC_ARR(__field__, __size__) \
-	if (!data[#__field__].is_null()) \
-	{ \
-		asset->__field__ = mem->allocate<FxCombinedDef>(__size__); \
-		for (auto idx##__field__ = 0u; idx##__field__ < (unsigned int)__size__; idx##__field__++) \
-		{ \
-			if (!data[#__field__][idx##__field__].is_null()) \
-			{ \
-				asset->__field__[idx##__field__].u.data = mem->manual_allocate<char>(sizeof(const char*)); \
-				asset->__field__[idx##__field__].type = data[#__field__][idx##__field__]["type"].get<FxCombinedType>(); \
-				asset->__field__[idx##__field__].u.fx->name = mem->duplicate_string(data[#__field__][idx##__field__]["fx"].get<std::string>()); \
-			} \
-			else \
-			{ \
-				asset->__field__[idx##__field__].u.data = nullptr; \
-			} \
-		} \
-	} \
-	else \
-	{ \
-		asset->__field__ = nullptr; \
-	}
-#define WEAPON_PARSE_FXCOMBINED_ALLOC_ARR_MODVAL(__field__, __size__) \
-	MODVAL(__field__, __size__) \
-	WEAPON_PARSE_FXCOMBINED_ALLOC_ARR(__field__, __size__)
+	constexpr auto weapon_fields = json_fields::make_field_table<WeaponDef, ordered_json>(
+	{
+		JSON_FIELD_STRING(WeaponDef, szOverlayName),
+		JSON_FIELD_STRING(WeaponDef, szModeName),
+		JSON_FIELD_STRING(WeaponDef, szAmmoName),
+		JSON_FIELD_STRING(WeaponDef, szSharedAmmoCapName),
+		JSON_FIELD_STRING(WeaponDef, szUseHintString),
+		JSON_FIELD_STRING(WeaponDef, dropHintString),
+		JSON_FIELD_STRING(WeaponDef, szScript),
+
+		JSON_FIELD_ASSET(WeaponDef, gunXModel),
+		JSON_FIELD_ASSET(WeaponDef, gunXModelLeftHand),
+		JSON_FIELD_ASSET(WeaponDef, gunXModelRightHand),
+		JSON_FIELD_ASSET(WeaponDef, defaultViewModel),
+		JSON_FIELD_ASSET(WeaponDef, defaultWorldModelLeftHand),
+		JSON_FIELD_ASSET(WeaponDef, defaultWorldModelRightHand),
+		JSON_FIELD_ASSET(WeaponDef, worldModel),
+		JSON_FIELD_ASSET(WeaponDef, worldXModelLeftHand),
+		JSON_FIELD_ASSET(WeaponDef, worldXModelRightHand),
+		JSON_FIELD_ASSET(WeaponDef, defaultWorldModel),
+		JSON_FIELD_ASSET(WeaponDef, playerShadowModel),
+		JSON_FIELD_ASSET(WeaponDef, playerShadowModelLeftHand),
+		JSON_FIELD_ASSET(WeaponDef, playerShadowModelRightHand),
+		JSON_FIELD_ASSET(WeaponDef, handXModel),
+
+		JSON_FIELD_ASSET_ARR(WeaponDef, camoWorldModelMaterialOverride, 16),
+		JSON_FIELD_ASSET_ARR(WeaponDef, camoViewModelMaterialOverride, 16),
+
+		JSON_FIELD_ASSET(WeaponDef, szXAnims),
+		JSON_FIELD_ASSET(WeaponDef, szXAnimsRightHanded),
+		JSON_FIELD_ASSET(WeaponDef, szXAnimsLeftHanded),
+
+		WEAPON_FIELD(WeaponDef, playerAnimType),
+		WEAPON_FIELD(WeaponDef, scriptedAnimEvent),
+		WEAPON_FIELD(WeaponDef, scriptedAnimType),
+		WEAPON_FIELD(WeaponDef, weapType),
+		WEAPON_FIELD(WeaponDef, whizbyType),
+		WEAPON_FIELD(WeaponDef, weapClass),
+		WEAPON_FIELD(WeaponDef, penetrateType),
+		WEAPON_FIELD(WeaponDef, deathAnimDamageType),
+		WEAPON_FIELD(WeaponDef, inventoryType),
+		WEAPON_FIELD(WeaponDef, fireType),
+
+		WEAPON_FIELD(WeaponDef, targetAssistType),
+		WEAPON_FIELD(WeaponDef, targetAssistBehavior),
+		WEAPON_FIELD(WeaponDef, targetAssistRange),
+		WEAPON_FIELD(WeaponDef, targetAssistAngle),
+		WEAPON_FIELD(WeaponDef, targetAssistLosOffsetForward),
+		WEAPON_FIELD(WeaponDef, targetAssistLosOffsetRight),
+		WEAPON_FIELD(WeaponDef, targetAssistLosOffsetUp),
+		WEAPON_FIELD(WeaponDef, targetAssistOnlyAvailableInAds),
+
+		WEAPON_FIELD(WeaponDef, offhandClass),
+		WEAPON_FIELD(WeaponDef, stance),
+
+		WEAPON_FIELD(WeaponDef, stickiness),
+		WEAPON_FIELD(WeaponDef, dualWieldType),
+		WEAPON_FIELD(WeaponDef, slot),
+
+		WEAPON_FIELD(WeaponDef, iFireTime),
+		WEAPON_FIELD(WeaponDef, iFireDelay),
+		WEAPON_FIELD(WeaponDef, iFireTimeAkimbo),
+		WEAPON_FIELD(WeaponDef, iFireDelayAkimbo),
+		WEAPON_FIELD(WeaponDef, bSegmentedReload),
+		WEAPON_FIELD(WeaponDef, burstFireCooldown),
+		WEAPON_FIELD(WeaponDef, burstFireAuto),
+
+		JSON_FIELD_ASSET(WeaponDef, vfxPackage),
+		JSON_FIELD_ASSET(WeaponDef, sfxPackage),
+
+		WEAPON_FIELD(WeaponDef, reticleType),
+		JSON_FIELD_ASSET(WeaponDef, reticleCenter),
+		JSON_FIELD_ASSET(WeaponDef, reticleSide),
+		JSON_FIELD_ASSET(WeaponDef, reticleOnePiece),
+		WEAPON_FIELD(WeaponDef, iReticleCenterSize),
+		WEAPON_FIELD(WeaponDef, iReticleSideSize),
+		WEAPON_FIELD(WeaponDef, iReticleMinOfs),
+		WEAPON_FIELD(WeaponDef, reticleCenterPulse),
+		WEAPON_FIELD(WeaponDef, activeReticleType),
+
+		WEAPON_FIELD_ARR(WeaponDef, vStandMove, 3),
+		WEAPON_FIELD_ARR(WeaponDef, vStandRot, 3),
+		WEAPON_FIELD_ARR(WeaponDef, strafeMove, 3),
+		WEAPON_FIELD_ARR(WeaponDef, strafeRot, 3),
+		WEAPON_FIELD_ARR(WeaponDef, vDuckedOfs, 3),
+		WEAPON_FIELD_ARR(WeaponDef, vDuckedMove, 3),
+		WEAPON_FIELD_ARR(WeaponDef, vDuckedRot, 3),
+		WEAPON_FIELD_ARR(WeaponDef, vProneOfs, 3),
+		WEAPON_FIELD_ARR(WeaponDef, vProneMove, 3),
+		WEAPON_FIELD_ARR(WeaponDef, vProneRot, 3),
+		WEAPON_FIELD(WeaponDef, fPosMoveRate),
+		WEAPON_FIELD(WeaponDef, fPosProneMoveRate),
+		WEAPON_FIELD(WeaponDef, fStandMoveMinSpeed),
+		WEAPON_FIELD(WeaponDef, fDuckedMoveMinSpeed),
+		WEAPON_FIELD(WeaponDef, fProneMoveMinSpeed),
+		WEAPON_FIELD(WeaponDef, fPosRotRate),
+		WEAPON_FIELD(WeaponDef, fPosProneRotRate),
+		WEAPON_FIELD(WeaponDef, fStandRotMinSpeed),
+		WEAPON_FIELD(WeaponDef, fDuckedRotMinSpeed),
+		WEAPON_FIELD(WeaponDef, fProneRotMinSpeed),
+
+		JSON_FIELD_ASSET(WeaponDef, worldClipModel),
+		JSON_FIELD_ASSET(WeaponDef, rocketModel),
+		JSON_FIELD_ASSET(WeaponDef, knifeModel),
+		JSON_FIELD_ASSET(WeaponDef, worldKnifeModel),
+
+		JSON_FIELD_ASSET(WeaponDef, hudIcon),
+		JSON_FIELD_ASSET(WeaponDef, pickupIcon),
+		JSON_FIELD_ASSET(WeaponDef, dangerIcon),
+		JSON_FIELD_ASSET(WeaponDef, throwBackIcon),
+
+		WEAPON_FIELD(WeaponDef, hideWarningIcons),
+		WEAPON_FIELD(WeaponDef, warningIconsDelay),
+		JSON_FIELD_ASSET(WeaponDef, ammoCounterIcon),
+		WEAPON_FIELD(WeaponDef, ammoCounterClip),
+
+		WEAPON_FIELD(WeaponDef, iStartAmmo),
+		WEAPON_FIELD(WeaponDef, iPerkStartAmmo),
+		WEAPON_FIELD(WeaponDef, iPerkMaxAmmo),
+		//WEAPON_FIELD(WeaponDef, iAmmoIndex), // runtime
+		WEAPON_FIELD(WeaponDef, iMaxAmmo),
+		WEAPON_FIELD(WeaponDef, shotCount),
+		//WEAPON_FIELD(WeaponDef, iSharedAmmoCapIndex), // runtime
+		WEAPON_FIELD(WeaponDef, iSharedAmmoCap),
+		WEAPON_FIELD(WeaponDef, iAmmoUsedPerShot),
+		WEAPON_FIELD(WeaponDef, requireAmmoUsedPerShot),
+		WEAPON_FIELD(WeaponDef, lowAmmoWarningThreshold),
+		WEAPON_FIELD(WeaponDef, disableNoAmmoWarning),
+		WEAPON_FIELD(WeaponDef, damage),
+		WEAPON_FIELD(WeaponDef, playerDamage),
+		WEAPON_FIELD(WeaponDef, meleeDamage),
+		WEAPON_FIELD(WeaponDef, iDamageType),
+
+		WEAPON_FIELD(WeaponDef, autoAimRange),
+		WEAPON_FIELD(WeaponDef, aimAssistRange),
+		WEAPON_FIELD(WeaponDef, aimAssistRangeAds),
+		WEAPON_FIELD(WeaponDef, aimAssistPitchSlowdown),
+		WEAPON_FIELD(WeaponDef, aimAssistPitchSlowdownAds),
+		WEAPON_FIELD(WeaponDef, aimAssistYawSlowdown),
+		WEAPON_FIELD(WeaponDef, aimAssistYawSlowdownAds),
+		WEAPON_FIELD(WeaponDef, aimAssistLockonStrength),
+		WEAPON_FIELD(WeaponDef, aimPadding),
+		WEAPON_FIELD(WeaponDef, enemyCrosshairRange),
+		WEAPON_FIELD(WeaponDef, moveSpeedScale),
+		WEAPON_FIELD(WeaponDef, adsMoveSpeedScale),
+		WEAPON_FIELD(WeaponDef, sprintDurationScale),
+		WEAPON_FIELD(WeaponDef, sprintRestoreDelay),
+		WEAPON_FIELD(WeaponDef, fAdsZoomInFrac),
+		WEAPON_FIELD(WeaponDef, fAdsZoomOutFrac),
+
+		WEAPON_FIELD(WeaponDef, overlayInterface),
+
+		WEAPON_FIELD(WeaponDef, fAdsBobFactor),
+		WEAPON_FIELD(WeaponDef, fAdsViewBobMult),
+		WEAPON_FIELD(WeaponDef, fHipSpreadStandMin),
+		WEAPON_FIELD(WeaponDef, fHipSpreadDuckedMin),
+		WEAPON_FIELD(WeaponDef, fHipSpreadProneMin),
+		WEAPON_FIELD(WeaponDef, hipSpreadSprintMin),
+		WEAPON_FIELD(WeaponDef, hipSpreadInAirMin),
+		WEAPON_FIELD(WeaponDef, hipSpreadStandMax),
+		WEAPON_FIELD(WeaponDef, hipSpreadDuckedMax),
+		WEAPON_FIELD(WeaponDef, hipSpreadProneMax),
+		WEAPON_FIELD(WeaponDef, hipSpreadSprintMax),
+		WEAPON_FIELD(WeaponDef, hipSpreadInAirMax),
+		WEAPON_FIELD(WeaponDef, fHipSpreadDecayRate),
+		WEAPON_FIELD(WeaponDef, fHipSpreadFireAdd),
+		WEAPON_FIELD(WeaponDef, fHipSpreadTurnAdd),
+		WEAPON_FIELD(WeaponDef, fHipSpreadMoveAdd),
+		WEAPON_FIELD(WeaponDef, fHipSpreadDuckedDecay),
+		WEAPON_FIELD(WeaponDef, fHipSpreadProneDecay),
+		WEAPON_FIELD(WeaponDef, hipSpreadSprintDecay),
+		WEAPON_FIELD(WeaponDef, hipSpreadInAirDecay),
+		WEAPON_FIELD(WeaponDef, fHipReticleSidePos),
+		WEAPON_FIELD(WeaponDef, fAdsIdleAmount),
+		WEAPON_FIELD(WeaponDef, fHipIdleAmount),
+		WEAPON_FIELD(WeaponDef, adsIdleSpeed),
+		WEAPON_FIELD(WeaponDef, hipIdleSpeed),
+		WEAPON_FIELD(WeaponDef, fIdleCrouchFactor),
+		WEAPON_FIELD(WeaponDef, fIdleProneFactor),
+		WEAPON_FIELD(WeaponDef, fGunMaxPitch),
+		WEAPON_FIELD(WeaponDef, fGunMaxYaw),
+		WEAPON_FIELD(WeaponDef, adsIdleLerpStartTime),
+		WEAPON_FIELD(WeaponDef, adsIdleLerpTime),
+		WEAPON_FIELD(WeaponDef, slideSpreadMin),
+		WEAPON_FIELD(WeaponDef, slideSpreadMax),
+		WEAPON_FIELD(WeaponDef, slideSpreadDecayRate),
+		WEAPON_FIELD(WeaponDef, slideSpreadFireAdd),
+		WEAPON_FIELD(WeaponDef, slideSpreadTurnAdd),
+		WEAPON_FIELD(WeaponDef, swayMaxAngleSteadyAim),
+		WEAPON_FIELD(WeaponDef, swayMaxAngle),
+		WEAPON_FIELD(WeaponDef, swayLerpSpeed),
+		WEAPON_FIELD(WeaponDef, swayPitchScale),
+		WEAPON_FIELD(WeaponDef, swayYawScale),
+		WEAPON_FIELD(WeaponDef, swayHorizScale),
+		WEAPON_FIELD(WeaponDef, swayVertScale),
+		WEAPON_FIELD(WeaponDef, swayShellShockScale),
+		WEAPON_FIELD(WeaponDef, adsSwayMaxAngle),
+		WEAPON_FIELD(WeaponDef, adsSwayLerpSpeed),
+		WEAPON_FIELD(WeaponDef, adsSway_UNKNOWN_Scale), // fixme
+		WEAPON_FIELD(WeaponDef, adsSwayPitchScale),
+		WEAPON_FIELD(WeaponDef, adsSwayYawScale),
+		WEAPON_FIELD(WeaponDef, adsSwayHorizScale),
+		WEAPON_FIELD(WeaponDef, adsSwayVertScale),
+		WEAPON_FIELD(WeaponDef, adsFireRateScale),
+		WEAPON_FIELD(WeaponDef, adsDamageRangeScale),
+		WEAPON_FIELD(WeaponDef, adsFireAnimFrac),
+		WEAPON_FIELD(WeaponDef, fireTimerLerpToAdsScale),
+		WEAPON_FIELD(WeaponDef, alwaysFireAtMaxRangeInAds),
+
+		WEAPON_FIELD(WeaponDef, dualWieldViewModelOffset),
+
+		WEAPON_FIELD(WeaponDef, fScopeDriftDelay),
+		WEAPON_FIELD(WeaponDef, fScopeDriftLerpInTime),
+		WEAPON_FIELD(WeaponDef, fScopeDriftSteadyTime),
+		WEAPON_FIELD(WeaponDef, fScopeDriftLerpOutTime),
+		WEAPON_FIELD(WeaponDef, fScopeDriftSteadyFactor),
+		WEAPON_FIELD(WeaponDef, fScopeDriftUnsteadyFactor),
+
+		WEAPON_FIELD(WeaponDef, killIconRatio),
+
+		WEAPON_FIELD(WeaponDef, iReloadAmmoAdd),
+		WEAPON_FIELD(WeaponDef, iReloadStartAdd),
+		WEAPON_FIELD(WeaponDef, ammoDropStockMin),
+		WEAPON_FIELD(WeaponDef, ammoDropClipPercentMin),
+		WEAPON_FIELD(WeaponDef, ammoDropClipPercentMax),
+
+		WEAPON_FIELD(WeaponDef, iExplosionRadius),
+		WEAPON_FIELD(WeaponDef, iExplosionRadiusMin),
+		WEAPON_FIELD(WeaponDef, iExplosionForceRadius),
+		WEAPON_FIELD(WeaponDef, iExplosionInnerDamage),
+		WEAPON_FIELD(WeaponDef, iExplosionOuterDamage),
+		WEAPON_FIELD(WeaponDef, damageConeAngle),
+		WEAPON_FIELD(WeaponDef, bulletExplDmgMult),
+		WEAPON_FIELD(WeaponDef, bulletExplRadiusMult),
+		WEAPON_FIELD(WeaponDef, iProjectileSpeed),
+		WEAPON_FIELD(WeaponDef, iProjectileSpeedUp),
+		WEAPON_FIELD(WeaponDef, iProjectileSpeedForward),
+		WEAPON_FIELD(WeaponDef, iProjectileActivateDist),
+		WEAPON_FIELD(WeaponDef, iProjectileDetonationRadius),
+		WEAPON_FIELD(WeaponDef, projLifetime),
+		WEAPON_FIELD(WeaponDef, projLifetimeStdDeviation),
+		WEAPON_FIELD(WeaponDef, timeToAccelerate),
+		WEAPON_FIELD(WeaponDef, projectileCurvature),
+
+		JSON_FIELD_ASSET(WeaponDef, projectileModel),
+		WEAPON_FIELD_FXCOMBINED(WeaponDef, projExplosionEffect),
+		WEAPON_FIELD_FXCOMBINED(WeaponDef, projDudEffect),
+		WEAPON_FIELD_FXCOMBINED(WeaponDef, projBodyEffect),
+		WEAPON_FIELD_FXCOMBINED(WeaponDef, projTrailEffect),
+		WEAPON_FIELD_FXCOMBINED(WeaponDef, projBeaconEffect),
+		WEAPON_FIELD_FXCOMBINED(WeaponDef, projIgnitionEffect),
+
+		WEAPON_FIELD(WeaponDef, ricochetChance),
+		WEAPON_FIELD(WeaponDef, riotShieldEnableDamage),
+		WEAPON_FIELD(WeaponDef, riotShieldHealth),
+		WEAPON_FIELD(WeaponDef, riotShieldDamageMult),
+
+		WEAPON_FIELD_ARR(WeaponDef, vProjectileColor, 3),
+		WEAPON_FIELD(WeaponDef, guidedMissileType),
+		WEAPON_FIELD(WeaponDef, maxSteeringAccel),
+		WEAPON_FIELD(WeaponDef, projIgnitionDelay),
+
+		WEAPON_FIELD_ARR(WeaponDef, parallelBounce, 64),
+		WEAPON_FIELD_ARR(WeaponDef, perpendicularBounce, 64),
+
+		WEAPON_FIELD(WeaponDef, fAdsAimPitch),
+		WEAPON_FIELD(WeaponDef, fAdsCrosshairInFrac),
+		WEAPON_FIELD(WeaponDef, fAdsCrosshairOutFrac),
+		WEAPON_FIELD(WeaponDef, adsInCrosshairAlphaStart),
+		WEAPON_FIELD(WeaponDef, adsInCrosshairAlphaEnd),
+		WEAPON_FIELD(WeaponDef, adsOutCrosshairAlphaStart),
+		WEAPON_FIELD(WeaponDef, adsOutCrosshairAlphaEnd),
+		WEAPON_FIELD(WeaponDef, adsShouldShowCrosshair),
+		WEAPON_FIELD(WeaponDef, adsGunKickReducedKickBullets),
+		WEAPON_FIELD(WeaponDef, adsGunKickReducedKickPercent),
+		WEAPON_FIELD(WeaponDef, fAdsGunKickPitchMin),
+		WEAPON_FIELD(WeaponDef, fAdsGunKickPitchMax),
+		WEAPON_FIELD(WeaponDef, fAdsGunKickYawMin),
+		WEAPON_FIELD(WeaponDef, fAdsGunKickYawMax),
+		WEAPON_FIELD(WeaponDef, fAdsGunKickMagMin),
+		WEAPON_FIELD(WeaponDef, fAdsGunKickAccel),
+		WEAPON_FIELD(WeaponDef, fAdsGunKickSpeedMax),
+		WEAPON_FIELD(WeaponDef, fAdsGunKickSpeedDecay),
+		WEAPON_FIELD(WeaponDef, fAdsGunKickStaticDecay),
+		WEAPON_FIELD(WeaponDef, fAdsViewKickPitchMin),
+		WEAPON_FIELD(WeaponDef, fAdsViewKickPitchMax),
+		WEAPON_FIELD(WeaponDef, fAdsViewKickYawMin),
+		WEAPON_FIELD(WeaponDef, fAdsViewKickYawMax),
+		WEAPON_FIELD(WeaponDef, fAdsViewKickMagMin),
+		WEAPON_FIELD(WeaponDef, fAdsViewScatterMin),
+		WEAPON_FIELD(WeaponDef, fAdsViewScatterMax),
+		WEAPON_FIELD(WeaponDef, fAdsSpread),
+
+		WEAPON_FIELD(WeaponDef, iVisibilityAxis),
+		WEAPON_FIELD(WeaponDef, fVisibilityUpOffset),
+		WEAPON_FIELD(WeaponDef, hipGunKickReducedKickBullets),
+		WEAPON_FIELD(WeaponDef, hipGunKickReducedKickPercent),
+		WEAPON_FIELD(WeaponDef, fHipGunKickPitchMin),
+		WEAPON_FIELD(WeaponDef, fHipGunKickPitchMax),
+		WEAPON_FIELD(WeaponDef, fHipGunKickYawMin),
+		WEAPON_FIELD(WeaponDef, fHipGunKickYawMax),
+		WEAPON_FIELD(WeaponDef, fHipGunKickMagMin),
+		WEAPON_FIELD(WeaponDef, fHipGunKickAccel),
+		WEAPON_FIELD(WeaponDef, fHipGunKickSpeedMax),
+		WEAPON_FIELD(WeaponDef, fHipGunKickSpeedDecay),
+		WEAPON_FIELD(WeaponDef, fHipGunKickStaticDecay),
+		WEAPON_FIELD(WeaponDef, fHipViewKickPitchMin),
+		WEAPON_FIELD(WeaponDef, fHipViewKickPitchMax),
+		WEAPON_FIELD(WeaponDef, fHipViewKickYawMin),
+		WEAPON_FIELD(WeaponDef, fHipViewKickYawMax),
+		WEAPON_FIELD(WeaponDef, fHipViewKickMagMin),
+		WEAPON_FIELD(WeaponDef, fHipViewScatterMin),
+		WEAPON_FIELD(WeaponDef, fHipViewScatterMax),
+
+		WEAPON_FIELD(WeaponDef, multipleReloadClipPercentage),
+		WEAPON_FIELD(WeaponDef, kickAlignedInputScalar),
+		WEAPON_FIELD(WeaponDef, kickOpposedInputScalar),
+		WEAPON_FIELD(WeaponDef, fightDist),
+		WEAPON_FIELD(WeaponDef, maxDist),
+
+		WEAPON_FIELD(WeaponDef, iPositionReloadTransTime),
+		WEAPON_FIELD(WeaponDef, leftArc),
+		WEAPON_FIELD(WeaponDef, rightArc),
+		WEAPON_FIELD(WeaponDef, topArc),
+		WEAPON_FIELD(WeaponDef, bottomArc),
+		WEAPON_FIELD(WeaponDef, softLeftRightArc),
+		WEAPON_FIELD(WeaponDef, accuracy),
+		WEAPON_FIELD(WeaponDef, aiSpread),
+		WEAPON_FIELD(WeaponDef, playerSpread),
+		WEAPON_FIELD_ARR(WeaponDef, minTurnSpeed, 2),
+		WEAPON_FIELD_ARR(WeaponDef, maxTurnSpeed, 2),
+		WEAPON_FIELD(WeaponDef, pitchConvergenceTime),
+		WEAPON_FIELD(WeaponDef, yawConvergenceTime),
+		WEAPON_FIELD(WeaponDef, suppressTime),
+		WEAPON_FIELD(WeaponDef, maxRange),
+		WEAPON_FIELD(WeaponDef, fAnimHorRotateInc),
+		WEAPON_FIELD(WeaponDef, fPlayerPositionDist),
+		//WEAPON_FIELD(WeaponDef, iUseHintStringIndex), // runtime
+		//WEAPON_FIELD(WeaponDef, dropHintStringIndex), // runtime
+		WEAPON_FIELD(WeaponDef, horizViewJitter),
+		WEAPON_FIELD(WeaponDef, vertViewJitter),
+		WEAPON_FIELD(WeaponDef, scanSpeed),
+		WEAPON_FIELD(WeaponDef, scanAccel),
+		WEAPON_FIELD(WeaponDef, scanPauseTime),
+		WEAPON_FIELD_ARR(WeaponDef, adsSpeedMs, 2),
+
+		WEAPON_FIELD(WeaponDef, minDamage),
+		WEAPON_FIELD(WeaponDef, minPlayerDamage),
+		WEAPON_FIELD(WeaponDef, mid1Damage),
+		WEAPON_FIELD(WeaponDef, mid2Damage),
+		WEAPON_FIELD(WeaponDef, mid3Damage),
+		WEAPON_FIELD(WeaponDef, mid1PlayerDamage),
+		WEAPON_FIELD(WeaponDef, mid2PlayerDamage),
+		WEAPON_FIELD(WeaponDef, mid3PlayerDamage),
+		WEAPON_FIELD(WeaponDef, maxDamageRange),
+		WEAPON_FIELD(WeaponDef, mid1DamageRange),
+		WEAPON_FIELD(WeaponDef, mid2DamageRange),
+		WEAPON_FIELD(WeaponDef, mid3DamageRange),
+		WEAPON_FIELD(WeaponDef, minDamageRange),
+
+		WEAPON_FIELD(WeaponDef, destabilizationRateTime),
+		WEAPON_FIELD(WeaponDef, destabilizationCurvatureMax),
+		WEAPON_FIELD(WeaponDef, destabilizeDistance),
+
+		WEAPON_FIELD(WeaponDef, robotechMaxPitch),
+		WEAPON_FIELD(WeaponDef, robotechMaxYaw),
+		WEAPON_FIELD(WeaponDef, robotechFrequency),
+		WEAPON_FIELD(WeaponDef, robotechVariancePitch),
+		WEAPON_FIELD(WeaponDef, robotechVarianceYaw),
+		WEAPON_FIELD(WeaponDef, robotechVarianceFrequency),
+
+		WEAPON_FIELD_ARR(WeaponDef, locationDamageMultipliers, 22),
+		WEAPON_FIELD_ARR(WeaponDef, hitLocPriorityMap, 22),
+		WEAPON_FIELD_ARR(WeaponDef, unittypeMultipliers, 9),
+
+		JSON_FIELD_ASSET(WeaponDef, fireRumble),
+		JSON_FIELD_ASSET(WeaponDef, meleeImpactRumble),
+
+		WEAPON_FIELD(WeaponDef, tracerStyle),
+		JSON_FIELD_ASSET(WeaponDef, tracerType),
+		JSON_FIELD_ASSET(WeaponDef, overchargeTracerType),
+
+		JSON_FIELD_ASSET(WeaponDef, laserTypeFriendly),
+		JSON_FIELD_ASSET(WeaponDef, laserTypeEnemy),
+
+		WEAPON_FIELD(WeaponDef, turretADSEnabled),
+		WEAPON_FIELD(WeaponDef, turretADSTime),
+		WEAPON_FIELD(WeaponDef, turretFov),
+		WEAPON_FIELD(WeaponDef, turretFovADS),
+		WEAPON_FIELD(WeaponDef, turretScopeZoomRate),
+		WEAPON_FIELD(WeaponDef, turretScopeZoomMin),
+		WEAPON_FIELD(WeaponDef, turretScopeZoomMax),
+		WEAPON_FIELD(WeaponDef, turretOverheatUpRate),
+		WEAPON_FIELD(WeaponDef, turretOverheatDownRate),
+		WEAPON_FIELD(WeaponDef, turretOverheatPenalty),
+		JSON_FIELD_STRING(WeaponDef, turretOverheatSound),
+		WEAPON_FIELD_FXCOMBINED(WeaponDef, turretOverheatEffect),
+		JSON_FIELD_ASSET(WeaponDef, turretBarrelSpinRumble),
+		WEAPON_FIELD(WeaponDef, turretBarrelSpinSpeed),
+		WEAPON_FIELD(WeaponDef, turretBarrelSpinUpTime),
+		WEAPON_FIELD(WeaponDef, turretBarrelSpinDownTime),
+		JSON_FIELD_STRING(WeaponDef, turretBarrelSpinMaxSnd),
+		JSON_FIELD_STRING_ARR(WeaponDef, turretBarrelSpinUpSnd, 4),
+		JSON_FIELD_STRING_ARR(WeaponDef, turretBarrelSpinDownSnd, 4),
+		JSON_FIELD_STRING(WeaponDef, missileConeSoundAlias),
+		JSON_FIELD_STRING(WeaponDef, missileConeSoundAliasAtBase),
+		WEAPON_FIELD(WeaponDef, missileConeSoundRadiusAtTop),
+		WEAPON_FIELD(WeaponDef, missileConeSoundRadiusAtBase),
+		WEAPON_FIELD(WeaponDef, missileConeSoundHeight),
+		WEAPON_FIELD(WeaponDef, missileConeSoundOriginOffset),
+		WEAPON_FIELD(WeaponDef, missileConeSoundVolumescaleAtCore),
+		WEAPON_FIELD(WeaponDef, missileConeSoundVolumescaleAtEdge),
+		WEAPON_FIELD(WeaponDef, missileConeSoundVolumescaleCoreSize),
+		WEAPON_FIELD(WeaponDef, missileConeSoundPitchAtTop),
+		WEAPON_FIELD(WeaponDef, missileConeSoundPitchAtBottom),
+		WEAPON_FIELD(WeaponDef, missileConeSoundPitchTopSize),
+		WEAPON_FIELD(WeaponDef, missileConeSoundPitchBottomSize),
+		WEAPON_FIELD(WeaponDef, missileConeSoundCrossfadeTopSize),
+		WEAPON_FIELD(WeaponDef, missileConeSoundCrossfadeBottomSize),
+
+		WEAPON_FIELD(WeaponDef, knifeAlwaysAttached),
+		WEAPON_FIELD(WeaponDef, meleeOverrideValues),
+		WEAPON_FIELD(WeaponDef, aim_automelee_lerp),
+		WEAPON_FIELD(WeaponDef, aim_automelee_region_height),
+		WEAPON_FIELD(WeaponDef, aim_automelee_region_width),
+		WEAPON_FIELD(WeaponDef, aim_automelee_maxPitchMovement),
+		WEAPON_FIELD(WeaponDef, aim_automelee_maxYawMovement),
+		WEAPON_FIELD(WeaponDef, player_meleeHeight),
+		WEAPON_FIELD(WeaponDef, player_meleeWidth),
+		WEAPON_FIELD(WeaponDef, playerMeleeRangeStanding),
+		WEAPON_FIELD(WeaponDef, playerMeleeRangeCrouched),
+		WEAPON_FIELD(WeaponDef, playerMeleeRangeProne),
+		WEAPON_FIELD(WeaponDef, playerMeleeRangeChargeStanding),
+		WEAPON_FIELD(WeaponDef, playerMeleeRangeChargeCrouched),
+		WEAPON_FIELD(WeaponDef, playerMeleeChargeHeightTolerance),
+
+		WEAPON_FIELD(WeaponDef, shieldAllowFiring),
+		WEAPON_FIELD(WeaponDef, shieldUnkBool),
+		WEAPON_FIELD(WeaponDef, shieldMaxSpeed),
+		WEAPON_FIELD(WeaponDef, shieldAlwaysDisplay),
+		JSON_FIELD_ASSET(WeaponDef, shieldDeployGesture),
+		JSON_FIELD_ASSET(WeaponDef, shieldFireWeapGesture),
+		JSON_FIELD_ASSET(WeaponDef, shieldDeployWhileFiring),
+		JSON_FIELD_ASSET(WeaponDef, shieldRetractWhileFiring),
+		JSON_FIELD_ASSET(WeaponDef, shieldBashGesture),
+		WEAPON_FIELD_FXCOMBINED(WeaponDef, shieldMeleeFx),
+		WEAPON_FIELD(WeaponDef, shieldMeleeFxDelay),
+		WEAPON_FIELD(WeaponDef, HitEarthquakeScale),
+		WEAPON_FIELD(WeaponDef, HitEarthquakeDuration),
+		WEAPON_FIELD(WeaponDef, HitEarthquakeRadius),
+		JSON_FIELD_ASSET(WeaponDef, shieldHitRumble),
+		WEAPON_FIELD(WeaponDef, MissEarthquakeScale),
+		WEAPON_FIELD(WeaponDef, MissEarthquakeDuration),
+		WEAPON_FIELD(WeaponDef, MissEarthquakeRadius),
+		JSON_FIELD_ASSET(WeaponDef, shieldMissRumble),
+		WEAPON_FIELD(WeaponDef, shieldDeployButton),
+		WEAPON_FIELD(WeaponDef, shieldUsesEnergy),
+		WEAPON_FIELD(WeaponDef, shieldMaxEnergy),
+		WEAPON_FIELD(WeaponDef, shieldConsumptionRate),
+		WEAPON_FIELD(WeaponDef, shieldMeleeEnergyCost),
+		WEAPON_FIELD(WeaponDef, shieldMeleeHitEnergyCost),
+
+		WEAPON_FIELD(WeaponDef, reactiveMotionRadiusScale),
+		WEAPON_FIELD(WeaponDef, reactiveMotionFrequencyScale),
+		WEAPON_FIELD(WeaponDef, reactiveMotionAmplitudeScale),
+		WEAPON_FIELD(WeaponDef, reactiveMotionFalloff),
+		WEAPON_FIELD(WeaponDef, reactiveMotionLifetime),
+
+		WEAPON_FIELD(WeaponDef, hasAnyTransientModels),
+		WEAPON_FIELD(WeaponDef, sharedAmmo),
+		WEAPON_FIELD(WeaponDef, lockonSupported),
+		WEAPON_FIELD(WeaponDef, requireLockonToFire),
+		WEAPON_FIELD(WeaponDef, isAirburstWeapon),
+		WEAPON_FIELD(WeaponDef, bigExplosion),
+		WEAPON_FIELD(WeaponDef, noAdsWhenMagEmpty),
+		WEAPON_FIELD(WeaponDef, avoidDropCleanup),
+		WEAPON_FIELD(WeaponDef, allowGrenadeSwitching),
+		WEAPON_FIELD(WeaponDef, inheritsPerks),
+		WEAPON_FIELD(WeaponDef, crosshairColorChange),
+		WEAPON_FIELD(WeaponDef, bRifleBullet),
+		WEAPON_FIELD(WeaponDef, bEnergyBullet),
+		WEAPON_FIELD(WeaponDef, armorPiercing),
+		WEAPON_FIELD(WeaponDef, impaling),
+		WEAPON_FIELD(WeaponDef, bBoltAction),
+		WEAPON_FIELD(WeaponDef, aimDownSight),
+		WEAPON_FIELD(WeaponDef, canHoldBreath),
+		WEAPON_FIELD(WeaponDef, meleeOnly),
+		WEAPON_FIELD(WeaponDef, supportsAlternateMelee),
+		WEAPON_FIELD(WeaponDef, canVariableZoom),
+		WEAPON_FIELD(WeaponDef, bRechamberWhileAds),
+		WEAPON_FIELD(WeaponDef, bBulletExplosiveDamage),
+		WEAPON_FIELD(WeaponDef, bCookOffHold),
+		WEAPON_FIELD(WeaponDef, reticleSpin45),
+		WEAPON_FIELD(WeaponDef, bClipOnly),
+		WEAPON_FIELD(WeaponDef, bDoesNotConsumeAmmo),
+		WEAPON_FIELD(WeaponDef, bRemoveWeaponOnEmpty),
+		WEAPON_FIELD(WeaponDef, noAmmoPickup),
+		WEAPON_FIELD(WeaponDef, adsFireOnly),
+		WEAPON_FIELD(WeaponDef, cancelAutoHolsterWhenEmpty),
+		WEAPON_FIELD(WeaponDef, disableSwitchToWhenEmpty),
+		WEAPON_FIELD(WeaponDef, suppressAmmoPrimaryDisplay),
+		WEAPON_FIELD(WeaponDef, suppressAmmoReserveDisplay),
+		WEAPON_FIELD(WeaponDef, laserSightDuringNightvision),
+		WEAPON_FIELD(WeaponDef, markableViewmodel),
+		WEAPON_FIELD(WeaponDef, flipKillIcon),
+		WEAPON_FIELD(WeaponDef, bNoPartialReload),
+		WEAPON_FIELD(WeaponDef, reloadDisabled),
+		WEAPON_FIELD(WeaponDef, blocksProne),
+		WEAPON_FIELD(WeaponDef, silenced),
+		WEAPON_FIELD(WeaponDef, isRollingGrenade),
+		WEAPON_FIELD(WeaponDef, dropGrenadeHeldOnDeath),
+		WEAPON_FIELD(WeaponDef, projExplosionEffectForceNormalUp),
+		WEAPON_FIELD(WeaponDef, projExplosionEffectInheritParentDirection),
+		WEAPON_FIELD(WeaponDef, bProjImpactExplode),
+		WEAPON_FIELD(WeaponDef, disableProjectileCrumpleCheck),
+		WEAPON_FIELD(WeaponDef, bProjTrajectoryEvents),
+		WEAPON_FIELD(WeaponDef, bProjWhizByEnabled),
+		WEAPON_FIELD(WeaponDef, stickToPlayers),
+		WEAPON_FIELD(WeaponDef, stickToVehicles),
+		WEAPON_FIELD(WeaponDef, stickToTurrets),
+		WEAPON_FIELD(WeaponDef, stickToNonStick),
+		WEAPON_FIELD(WeaponDef, projEnableMissileStickiness),
+		WEAPON_FIELD(WeaponDef, thrownSideways),
+		WEAPON_FIELD(WeaponDef, hasDetonator),
+		WEAPON_FIELD(WeaponDef, disableFiring),
+		WEAPON_FIELD(WeaponDef, firesOnWeaponSwitch),
+		WEAPON_FIELD(WeaponDef, disableHolding),
+		WEAPON_FIELD(WeaponDef, timedDetonation),
+
+		WEAPON_FIELD(WeaponDef, explosiveDamageDelay),
+		WEAPON_FIELD(WeaponDef, fuseTime),
+		WEAPON_FIELD(WeaponDef, aiFuseTime),
+		WEAPON_FIELD(WeaponDef, maxHoldTime),
+
+		WEAPON_FIELD(WeaponDef, holdButtonToThrow),
+		WEAPON_FIELD(WeaponDef, infiniteHold),
+		WEAPON_FIELD(WeaponDef, freezeMovementWhenFiring),
+		WEAPON_FIELD(WeaponDef, offhandAllowsSprint),
+		WEAPON_FIELD(WeaponDef, thermalScope),
+		WEAPON_FIELD(WeaponDef, thermalToggle),
+		WEAPON_FIELD(WeaponDef, outlineEnemies),
+		WEAPON_FIELD(WeaponDef, outlineDepthTest),
+		WEAPON_FIELD(WeaponDef, outlineFill),
+
+		WEAPON_FIELD(WeaponDef, enemyOutlineR),
+		WEAPON_FIELD(WeaponDef, enemyOutlineG),
+		WEAPON_FIELD(WeaponDef, enemyOutlineB),
+		WEAPON_FIELD(WeaponDef, enemyOutlineA),
+		WEAPON_FIELD(WeaponDef, allyOutlineR),
+		WEAPON_FIELD(WeaponDef, allyOutlineG),
+		WEAPON_FIELD(WeaponDef, allyOutlineB),
+		WEAPON_FIELD(WeaponDef, allyOutlineA),
+		WEAPON_FIELD(WeaponDef, depthScan),
+		WEAPON_FIELD(WeaponDef, depthScanThickness),
+		WEAPON_FIELD(WeaponDef, depthScanR),
+		WEAPON_FIELD(WeaponDef, depthScanG),
+		WEAPON_FIELD(WeaponDef, depthScanB),
+		WEAPON_FIELD(WeaponDef, depthScanA),
+		WEAPON_FIELD(WeaponDef, depthScanOutlineThickness),
+		WEAPON_FIELD(WeaponDef, depthScanOutlineR),
+		WEAPON_FIELD(WeaponDef, depthScanOutlineG),
+		WEAPON_FIELD(WeaponDef, depthScanOutlineB),
+		WEAPON_FIELD(WeaponDef, depthScanOutlineA),
+		WEAPON_FIELD(WeaponDef, depthScanOverlay),
+		WEAPON_FIELD(WeaponDef, depthScanOverlayStrength),
+		WEAPON_FIELD(WeaponDef, depthScanOverlayXTiles),
+		WEAPON_FIELD(WeaponDef, depthScanOverlayYTiles),
+		WEAPON_FIELD(WeaponDef, depthScanOverlayXScroll),
+		WEAPON_FIELD(WeaponDef, depthScanOverlayYScroll),
+
+		WEAPON_FIELD(WeaponDef, blurSceneAdsInFraction),
+		WEAPON_FIELD(WeaponDef, blurSceneAdsOutFraction),
+
+		WEAPON_FIELD(WeaponDef, altModeSameWeapon),
+		WEAPON_FIELD(WeaponDef, turretBarrelSpinEnabled),
+		WEAPON_FIELD(WeaponDef, missileConeSoundEnabled),
+		WEAPON_FIELD(WeaponDef, missileConeSoundPitchshiftEnabled),
+		WEAPON_FIELD(WeaponDef, missileConeSoundCrossfadeEnabled),
+		WEAPON_FIELD(WeaponDef, offhandHoldIsCancelable),
+		WEAPON_FIELD(WeaponDef, doNotAllowAttachmentsToOverrideSpread),
+		WEAPON_FIELD(WeaponDef, useScopeDrift),
+		WEAPON_FIELD(WeaponDef, alwaysShatterGlassOnImpact),
+		WEAPON_FIELD(WeaponDef, oldWeapon),
+		WEAPON_FIELD(WeaponDef, jumpSpread),
+		WEAPON_FIELD(WeaponDef, noFullViewmodelAnimations),
+
+		WEAPON_FIELD(WeaponDef, killcamOffset),
+
+		WEAPON_FIELD(WeaponDef, useDualFOV),
+		WEAPON_FIELD(WeaponDef, disableDrop),
+		WEAPON_FIELD(WeaponDef, preferredDrop),
+
+		JSON_FIELD_ASSET(WeaponDef, gestureAnimation),
+		WEAPON_FIELD(WeaponDef, gestureFireStateTime),
+		JSON_FIELD_ASSET(WeaponDef, gesturePullback),
+		WEAPON_FIELD(WeaponDef, minPullbackTime),
+		JSON_FIELD_ASSET(WeaponDef, gestureThrow),
+		WEAPON_FIELD(WeaponDef, gestureFireTime),
+		JSON_FIELD_ASSET(WeaponDef, gestureDetonate),
+		WEAPON_FIELD(WeaponDef, gestureDetonationTime),
+		WEAPON_FIELD(WeaponDef, unk_433),
+		JSON_FIELD_STRING(WeaponDef, unknownString1),
+		WEAPON_FIELD(WeaponDef, unk_434),
+		JSON_FIELD_STRING(WeaponDef, unknownString2),
+		WEAPON_FIELD(WeaponDef, gesturesDisablePrimary),
+		WEAPON_FIELD_FXCOMBINED(WeaponDef, cameraFireEffect),
+		WEAPON_FIELD(WeaponDef, cameraFireEffectDurationSec),
+		WEAPON_FIELD(WeaponDef, changedFireTime),
+		WEAPON_FIELD(WeaponDef, changedFireTimeAkimbo),
+		WEAPON_FIELD(WeaponDef, changedFireTimeNumBullets),
+
+		WEAPON_FIELD(WeaponDef, chargeType),
+		WEAPON_FIELD(WeaponDef, chargeGain),
+		WEAPON_FIELD(WeaponDef, chargeCostPerShot),
+		WEAPON_FIELD(WeaponDef, chargeLossWhenIdle),
+		WEAPON_FIELD(WeaponDef, chargeEmptyCooldown),
+		WEAPON_FIELD(WeaponDef, chargeFireAtMaxDamageMultiplier),
+		WEAPON_FIELD(WeaponDef, chargeMeterEffectBoneCount),
+		WEAPON_FIELD_FXCOMBINED(WeaponDef, chargeMeterEffect),
+		JSON_FIELD_STRING(WeaponDef, chargeUpSound),
+		JSON_FIELD_STRING(WeaponDef, chargeDownSound),
+		JSON_FIELD_STRING(WeaponDef, chargeUpSoundPlayer),
+		JSON_FIELD_STRING(WeaponDef, chargeDownSoundPlayer),
+		JSON_FIELD_STRING(WeaponDef, chargeDownToUpSound),
+		JSON_FIELD_STRING(WeaponDef, chargeDownToUpSoundPlayer),
+		JSON_FIELD_STRING(WeaponDef, chargeUpToDownSound),
+		JSON_FIELD_STRING(WeaponDef, chargeUpToDownSoundPlayer),
+		JSON_FIELD_STRING(WeaponDef, chargeMaxSound),
+		JSON_FIELD_STRING(WeaponDef, chargeMaxSoundPlayer),
+		WEAPON_FIELD(WeaponDef, chargeHudReveal),
+		JSON_FIELD_ASSET(WeaponDef, chargeRumble),
+
+		JSON_FIELD_ASSET(WeaponDef, stowOffsetModel),
+
+		WEAPON_FIELD(WeaponDef, maxTargetAngle),
+		WEAPON_FIELD(WeaponDef, spaceshipSecondaryWeapon),
+		WEAPON_FIELD(WeaponDef, impulseFieldRadius),
+		WEAPON_FIELD(WeaponDef, impulseFieldInitialSpeed),
+		WEAPON_FIELD(WeaponDef, impulseFieldMaxSpeed),
+		WEAPON_FIELD(WeaponDef, impulseFieldAcceleration),
+		WEAPON_FIELD(WeaponDef, impulseFieldInAirImpulseMultiplier),
+		WEAPON_FIELD(WeaponDef, impulseFieldInAirImpulseMultiplierInterpTime),
+		WEAPON_FIELD(WeaponDef, impulseFieldSlideMultiplier),
+		WEAPON_FIELD(WeaponDef, impulseFieldSlideMultiplierInterpTime),
+		WEAPON_FIELD(WeaponDef, impulseFieldIsPush),
+		WEAPON_FIELD(WeaponDef, impulseFieldAffectsFriendlies),
+		WEAPON_FIELD(WeaponDef, impulseFieldAffectsSelf),
+		WEAPON_FIELD(WeaponDef, impulseFieldAffectsProne),
+
+		WEAPON_FIELD(WeaponDef, regenerationEnabled),
+		WEAPON_FIELD(WeaponDef, regenerationTimeMs),
+		WEAPON_FIELD(WeaponDef, regenerationAddTimeMs),
+		WEAPON_FIELD(WeaponDef, regenerationAmount),
+		WEAPON_FIELD(WeaponDef, regenerationConsumeStock),
+		WEAPON_FIELD(WeaponDef, regenerationDisableWhileFiring),
+
+		WEAPON_FIELD(WeaponDef, deployRequireOnWalkableSurface),
+		WEAPON_FIELD(WeaponDef, deployRequireOnNavmesh),
+		WEAPON_FIELD(WeaponDef, deployRequireSkyAbove),
+		WEAPON_FIELD(WeaponDef, deployRequireNoOverhang),
+		WEAPON_FIELD(WeaponDef, deployAlwaysUpright),
+		WEAPON_FIELD(WeaponDef, deployEdgeSnap),
+		WEAPON_FIELD(WeaponDef, deployCylinderRadius),
+		WEAPON_FIELD(WeaponDef, deployCylinderHeight),
+		WEAPON_FIELD(WeaponDef, deployMaxDistance),
+		WEAPON_FIELD_FXCOMBINED(WeaponDef, deployEffect),
+		WEAPON_FIELD(WeaponDef, deployValidGroupId),
+		WEAPON_FIELD(WeaponDef, deployIndoorGroupId),
+		WEAPON_FIELD(WeaponDef, deployInvalidGroupId),
+		WEAPON_FIELD(WeaponDef, deployOutOfRangeGroupId),
+
+		WEAPON_FIELD(WeaponDef, reactiveEmitterDelay),
+		WEAPON_FIELD(WeaponDef, grenadeDangerIconDistance),
+		WEAPON_FIELD(WeaponDef, unk_466_0),
 
-	void weapon_def::parse(AnimOverride* asset, ordered_json& data, zone_memory* mem)
+		// unk stuff
+		WEAPON_FIELD(WeaponDef, unk_0),
+		WEAPON_FIELD(WeaponDef, unk_1),
+		WEAPON_FIELD(WeaponDef, unk_2),
+		WEAPON_FIELD(WeaponDef, unk_3),
+		WEAPON_FIELD(WeaponDef, unk_4_0),
+		WEAPON_FIELD(WeaponDef, unk_4_1)
+	});
+
+	// the "unk0" object of a weapon
+	constexpr auto unk0_fields = json_fields::make_field_table<WeaponDef, ordered_json>(
+	{
+		WEAPON_FIELD(WeaponDef, unk_18),
+		WEAPON_FIELD(WeaponDef, unk_19),
+		WEAPON_FIELD(WeaponDef, unk_20),
+		WEAPON_FIELD(WeaponDef, unk_21),
+		WEAPON_FIELD(WeaponDef, unk_22),
+		WEAPON_FIELD(WeaponDef, unk_23),
+		WEAPON_FIELD(WeaponDef, unk_24),
+		WEAPON_FIELD(WeaponDef, unk_25),
+		WEAPON_FIELD(WeaponDef, unk_26),
+		WEAPON_FIELD(WeaponDef, unk_27),
+		WEAPON_FIELD(WeaponDef, unk_28),
+		WEAPON_FIELD(WeaponDef, unk_29),
+		WEAPON_FIELD(WeaponDef, unk_30),
+		WEAPON_FIELD(WeaponDef, unk_31),
+		WEAPON_FIELD(WeaponDef, unk_32),
+		WEAPON_FIELD(WeaponDef, unk_33),
+		WEAPON_FIELD(WeaponDef, unk_34),
+		WEAPON_FIELD(WeaponDef, unk_35),
+		WEAPON_FIELD(WeaponDef, unk_36),
+		WEAPON_FIELD(WeaponDef, unk_37),
+		WEAPON_FIELD(WeaponDef, unk_38),
+		WEAPON_FIELD(WeaponDef, unk_39),
+		WEAPON_FIELD(WeaponDef, unk_40),
+		WEAPON_FIELD(WeaponDef, unk_41),
+		WEAPON_FIELD(WeaponDef, unk_42),
+		WEAPON_FIELD(WeaponDef, unk_43),
+		WEAPON_FIELD(WeaponDef, unk_44),
+		WEAPON_FIELD(WeaponDef, unk_45),
+		WEAPON_FIELD(WeaponDef, unk_46),
+		WEAPON_FIELD(WeaponDef, unk_47),
+		WEAPON_FIELD(WeaponDef, unk_48),
+		WEAPON_FIELD(WeaponDef, unk_49),
+		WEAPON_FIELD(WeaponDef, unk_50),
+		WEAPON_FIELD(WeaponDef, unk_51),
+		WEAPON_FIELD(WeaponDef, unk_52),
+		WEAPON_FIELD(WeaponDef, unk_53),
+		WEAPON_FIELD(WeaponDef, unk_54),
+		WEAPON_FIELD(WeaponDef, unk_55),
+		WEAPON_FIELD(WeaponDef, unk_56),
+		WEAPON_FIELD(WeaponDef, unk_57),
+		WEAPON_FIELD(WeaponDef, unk_58),
+		WEAPON_FIELD(WeaponDef, unk_59),
+		WEAPON_FIELD(WeaponDef, unk_60),
+		WEAPON_FIELD(WeaponDef, unk_61),
+		WEAPON_FIELD(WeaponDef, unk_62),
+		WEAPON_FIELD(WeaponDef, unk_63),
+		WEAPON_FIELD(WeaponDef, unk_64),
+		WEAPON_FIELD(WeaponDef, unk_65_0),
+		WEAPON_FIELD(WeaponDef, unk_65_1),
+		WEAPON_FIELD(WeaponDef, unk_65_2),
+		WEAPON_FIELD(WeaponDef, unk_65_3)
+	});
+
+	constexpr auto complete_fields = json_fields::make_field_table<WeaponCompleteDef, ordered_json>(
 	{
-		WEAPON_PARSE_SCRIPT_STRING(attachment1);
-		WEAPON_PARSE_SCRIPT_STRING(attachment2);
-		WEAPON_PARSE_ASSET(overrides);
-		WEAPON_PARSE_ASSET(overridesAlt);
+		JSON_FIELD_STRING(WeaponCompleteDef, szInternalName),
+		JSON_FIELD_STRING(WeaponCompleteDef, szDisplayName),
+		JSON_FIELD_STRING(WeaponCompleteDef, szLootTable),
+
+		WEAPON_FIELD(WeaponCompleteDef, fAdsZoomFov),
+		WEAPON_FIELD(WeaponCompleteDef, iAdsTransInTime),
+		WEAPON_FIELD(WeaponCompleteDef, iAdsTransOutTime),
+		WEAPON_FIELD(WeaponCompleteDef, iClipSize),
+		WEAPON_FIELD(WeaponCompleteDef, vfxImpactType),
+		WEAPON_FIELD(WeaponCompleteDef, sfxImpactType),
+		WEAPON_FIELD(WeaponCompleteDef, meleeImpactType),
+		WEAPON_FIELD(WeaponCompleteDef, penetrateMultiplier),
+		WEAPON_FIELD(WeaponCompleteDef, fAdsViewKickCenterSpeed),
+		WEAPON_FIELD(WeaponCompleteDef, fHipViewKickCenterSpeed),
+		JSON_FIELD_STRING(WeaponCompleteDef, szAltWeaponName),
+		JSON_FIELD_ASSET(WeaponCompleteDef, killIcon),
+		JSON_FIELD_ASSET(WeaponCompleteDef, dpadIcon),
+		WEAPON_FIELD(WeaponCompleteDef, ammoDropStockMax),
+		WEAPON_FIELD(WeaponCompleteDef, adsDofStart),
+		WEAPON_FIELD(WeaponCompleteDef, adsDofEnd),
+		WEAPON_FIELD(WeaponCompleteDef, motionTracker),
+		WEAPON_FIELD(WeaponCompleteDef, enhanced),
+		WEAPON_FIELD(WeaponCompleteDef, dpadIconShowsAmmo),
+		WEAPON_FIELD(WeaponCompleteDef, luiWeaponInfoWidgetUsesScopeStencil),
+		JSON_FIELD_STRING(WeaponCompleteDef, szAdsrBaseSetting),
+		JSON_FIELD_STRING(WeaponCompleteDef, szLUIWeaponInfoWidgetName),
+		JSON_FIELD_STRING(WeaponCompleteDef, szLUIWeaponInfoWidgetTag),
+		JSON_FIELD_STRING(WeaponCompleteDef, szLUICrosshairWidget)
+	});
+
+	void weapon_def::parse_script_string(scr_string_t* ptr, const ordered_json& value, zone_memory* mem)
+	{
+		if (value.is_string() && !value.get_ref<const std::string&>().empty())
+		{
+			this->add_script_string(ptr, mem->duplicate_string(value.get_ref<const std::string&>()));
+		}
+		*ptr = scr_string_t(0);
 	}
 
-	void weapon_def::parse(SFXOverride* asset, ordered_json& data, zone_memory* mem)
+	scr_string_t* weapon_def::parse_script_strings(const ordered_json& value, const std::size_t count, zone_memory* mem)
 	{
-		WEAPON_PARSE_SCRIPT_STRING(attachment1);
-		WEAPON_PARSE_SCRIPT_STRING(attachment2);
-		WEAPON_PARSE_ASSET(overrides);
-		WEAPON_PARSE_ASSET(overridesAlt);
+		if (value.is_null())
+		{
+			return nullptr;
+		}
+
+		auto* strings = mem->allocate<scr_string_t>(count);
+		for (auto i = 0u; i < count; i++)
+		{
+			this->parse_script_string(&strings[i], json_fields::get(value, i), mem);
+		}
+		return strings;
 	}
 
-	void weapon_def::parse(VFXOverride* asset, ordered_json& data, zone_memory* mem)
+	void weapon_def::parse(AnimOverride* asset, const ordered_json& data, zone_memory* mem)
 	{
-		WEAPON_PARSE_SCRIPT_STRING(attachment1);
-		WEAPON_PARSE_SCRIPT_STRING(attachment2);
-		WEAPON_PARSE_ASSET(overrides);
-		WEAPON_PARSE_ASSET(overridesAlt);
+		this->parse_script_string(&asset->attachment1, json_fields::get(data, "attachment1"), mem);
+		this->parse_script_string(&asset->attachment2, json_fields::get(data, "attachment2"), mem);
+		anim_override_fields.read(asset, data, mem);
 	}
 
-	void weapon_def::parse(GrenadeRotationParams* asset, ordered_json& data, zone_memory* mem)
+	void weapon_def::parse(SFXOverride* asset, const ordered_json& data, zone_memory* mem)
 	{
-		WEAPON_PARSE_FIELD(initialPitch);
-		WEAPON_PARSE_FIELD(initialYaw);
-		WEAPON_PARSE_FIELD(initialRoll);
-
-		WEAPON_PARSE_FIELD(rotationPitchDir);
-		WEAPON_PARSE_FIELD(rotationPitchMin);
-		WEAPON_PARSE_FIELD(rotationPitchMax);
-
-		WEAPON_PARSE_FIELD(rotationYawDir);
-		WEAPON_PARSE_FIELD(rotationYawMin);
-		WEAPON_PARSE_FIELD(rotationYawMax);
-
-		WEAPON_PARSE_FIELD(rotationRollDir);
-		WEAPON_PARSE_FIELD(rotationRollMin);
-		WEAPON_PARSE_FIELD(rotationRollMax);
-
-		WEAPON_PARSE_FIELD(rotate);
+		this->parse_script_string(&asset->attachment1, json_fields::get(data, "attachment1"), mem);
+		this->parse_script_string(&asset->attachment2, json_fields::get(data, "attachment2"), mem);
+		sfx_override_fields.read(asset, data, mem);
 	}
 
-	void weapon_def::parse(ADSOverlay* asset, ordered_json& data, zone_memory* mem)
+	void weapon_def::parse(VFXOverride* asset, const ordered_json& data, zone_memory* mem)
 	{
-		WEAPON_PARSE_ASSET(shader);
-		WEAPON_PARSE_ASSET(shaderLowRes);
-		WEAPON_PARSE_ASSET(shaderEMP);
-		WEAPON_PARSE_ASSET(shaderEMPLowRes);
-		WEAPON_PARSE_FIELD(reticle);
-		WEAPON_PARSE_FIELD(width);
-		WEAPON_PARSE_FIELD(height);
-		WEAPON_PARSE_FIELD(widthSplitscreen);
-		WEAPON_PARSE_FIELD(heightSplitscreen);
+		this->parse_script_string(&asset->attachment1, json_fields::get(data, "attachment1"), mem);
+		this->parse_script_string(&asset->attachment2, json_fields::get(data, "attachment2"), mem);
+		vfx_override_fields.read(asset, data, mem);
 	}
 
-	void weapon_def::parse_weapondef(WeaponDef* asset, WeaponCompleteDef* parent, ordered_json& data, zone_memory* mem)
+	void weapon_def::parse_weapondef(WeaponDef* asset, WeaponCompleteDef* parent, const ordered_json& data, zone_memory* mem)
 	{
-		WEAPON_PARSE_STRING(szOverlayName);
-		WEAPON_PARSE_STRING(szModeName);
-		WEAPON_PARSE_STRING(szAmmoName);
-		WEAPON_PARSE_STRING(szSharedAmmoCapName);
-		WEAPON_PARSE_STRING(szUseHintString);
-		WEAPON_PARSE_STRING(dropHintString);
-		WEAPON_PARSE_STRING(szScript);
-
-		WEAPON_PARSE_ASSET(gunXModel);
-		WEAPON_PARSE_ASSET(gunXModelLeftHand);
-		WEAPON_PARSE_ASSET(gunXModelRightHand);
-		WEAPON_PARSE_ASSET(defaultViewModel);
-		WEAPON_PARSE_ASSET(defaultWorldModelLeftHand);
-		WEAPON_PARSE_ASSET(defaultWorldModelRightHand);
-		WEAPON_PARSE_ASSET(worldModel);
-		WEAPON_PARSE_ASSET(worldXModelLeftHand);
-		WEAPON_PARSE_ASSET(worldXModelRightHand);
-		WEAPON_PARSE_ASSET(defaultWorldModel);
-		WEAPON_PARSE_ASSET(playerShadowModel);
-		WEAPON_PARSE_ASSET(playerShadowModelLeftHand);
-		WEAPON_PARSE_ASSET(playerShadowModelRightHand);
-		WEAPON_PARSE_ASSET(handXModel);
-		WEAPON_PARSE_ASSET_ALLOC_ARR_MODVAL(complexWorldModel, asset->numComplexModels);
-		WEAPON_PARSE_ASSET_ALLOC_ARR_MODVAL(complexWorldModelLeftHand, asset->numComplexModels);
-		WEAPON_PARSE_ASSET_ALLOC_ARR_MODVAL(complexWorldModelRightHand, asset->numComplexModels);
-		WEAPON_PARSE_ASSET_ALLOC_ARR_MODVAL(complexGunXModel, asset->numComplexModels);
-		WEAPON_PARSE_ASSET_ALLOC_ARR_MODVAL(complexGunXModelLeftHand, asset->numComplexModels);
-		WEAPON_PARSE_ASSET_ALLOC_ARR_MODVAL(complexGunXModelRightHand, asset->numComplexModels);
-
-		WEAPON_PARSE_ASSET_FIELD_ARR(camoWorldModelMaterialOverride, 16);
-		WEAPON_PARSE_ASSET_FIELD_ARR(camoViewModelMaterialOverride, 16);
-
-		WEAPON_PARSE_ASSET(szXAnims);
-		WEAPON_PARSE_ASSET(szXAnimsRightHanded);
-		WEAPON_PARSE_ASSET(szXAnimsLeftHanded);
-
-		WEAPON_PARSE_SCRIPT_STRING_ALLOC_ARR(notetrackRumbleMapKeys, 16);
-		WEAPON_PARSE_SCRIPT_STRING_ALLOC_ARR(notetrackRumbleMapValues, 16);
-		WEAPON_PARSE_SCRIPT_STRING_ALLOC_ARR(notetrackFXMapKeys, 16);
-		WEAPON_PARSE_FXCOMBINED_ALLOC_ARR(notetrackFXMapValues, 16);
-		WEAPON_PARSE_SCRIPT_STRING_ALLOC_ARR(notetrackFXMapTagValues, 16);
-
-		WEAPON_PARSE_FIELD(playerAnimType);
-		WEAPON_PARSE_FIELD(scriptedAnimEvent);
-		WEAPON_PARSE_FIELD(scriptedAnimType);
-		WEAPON_PARSE_FIELD(weapType);
-		WEAPON_PARSE_FIELD(whizbyType);
-		WEAPON_PARSE_FIELD(weapClass);
-		WEAPON_PARSE_FIELD(penetrateType);
-		WEAPON_PARSE_FIELD(deathAnimDamageType);
-		WEAPON_PARSE_FIELD(inventoryType);
-		WEAPON_PARSE_FIELD(fireType);
-
-		WEAPON_PARSE_FIELD(targetAssistType);
-		WEAPON_PARSE_FIELD(targetAssistBehavior);
-		WEAPON_PARSE_FIELD(targetAssistRange);
-		WEAPON_PARSE_FIELD(targetAssistAngle);
-		WEAPON_PARSE_FIELD(targetAssistLosOffsetForward);
-		WEAPON_PARSE_FIELD(targetAssistLosOffsetRight);
-		WEAPON_PARSE_FIELD(targetAssistLosOffsetUp);
-		WEAPON_PARSE_FIELD(targetAssistOnlyAvailableInAds);
-
-		WEAPON_PARSE_FIELD(offhandClass);
-		WEAPON_PARSE_FIELD(stance);
-
-		WEAPON_PARSE_FIELD(stickiness);
-		WEAPON_PARSE_FIELD(dualWieldType);
-		WEAPON_PARSE_FIELD(slot);
-
-		WEAPON_PARSE_FIELD(iFireTime);
-		WEAPON_PARSE_FIELD(iFireDelay);
-		WEAPON_PARSE_FIELD(iFireTimeAkimbo);
-		WEAPON_PARSE_FIELD(iFireDelayAkimbo);
-		WEAPON_PARSE_FIELD(bSegmentedReload);
-		WEAPON_PARSE_FIELD(burstFireCooldown);
-		WEAPON_PARSE_FIELD(burstFireAuto);
-
-		WEAPON_PARSE_ASSET(vfxPackage);
-		WEAPON_PARSE_ASSET(sfxPackage);
-
-		WEAPON_PARSE_FIELD(reticleType);
-		WEAPON_PARSE_ASSET(reticleCenter);
-		WEAPON_PARSE_ASSET(reticleSide);
-		WEAPON_PARSE_ASSET(reticleOnePiece);
-		WEAPON_PARSE_FIELD(iReticleCenterSize);
-		WEAPON_PARSE_FIELD(iReticleSideSize);
-		WEAPON_PARSE_FIELD(iReticleMinOfs);
-		WEAPON_PARSE_FIELD(reticleCenterPulse);
-		WEAPON_PARSE_FIELD(activeReticleType);
-
-		WEAPON_PARSE_FIELD_ARR(vStandMove, 3);
-		WEAPON_PARSE_FIELD_ARR(vStandRot, 3);
-		WEAPON_PARSE_FIELD_ARR(strafeMove, 3);
-		WEAPON_PARSE_FIELD_ARR(strafeRot, 3);
-		WEAPON_PARSE_FIELD_ARR(vDuckedOfs, 3);
-		WEAPON_PARSE_FIELD_ARR(vDuckedMove, 3);
-		WEAPON_PARSE_FIELD_ARR(vDuckedRot, 3);
-		WEAPON_PARSE_FIELD_ARR(vProneOfs, 3);
-		WEAPON_PARSE_FIELD_ARR(vProneMove, 3);
-		WEAPON_PARSE_FIELD_ARR(vProneRot, 3);
-		WEAPON_PARSE_FIELD(fPosMoveRate);
-		WEAPON_PARSE_FIELD(fPosProneMoveRate);
-		WEAPON_PARSE_FIELD(fStandMoveMinSpeed);
-		WEAPON_PARSE_FIELD(fDuckedMoveMinSpeed);
-		WEAPON_PARSE_FIELD(fProneMoveMinSpeed);
-		WEAPON_PARSE_FIELD(fPosRotRate);
-		WEAPON_PARSE_FIELD(fPosProneRotRate);
-		WEAPON_PARSE_FIELD(fStandRotMinSpeed);
-		WEAPON_PARSE_FIELD(fDuckedRotMinSpeed);
-		WEAPON_PARSE_FIELD(fProneRotMinSpeed);
-
-		WEAPON_PARSE_ASSET(worldClipModel);
-		WEAPON_PARSE_ASSET(rocketModel);
-		WEAPON_PARSE_ASSET(knifeModel);
-		WEAPON_PARSE_ASSET(worldKnifeModel);
-
-		WEAPON_PARSE_ASSET(hudIcon);
-		WEAPON_PARSE_ASSET(pickupIcon);
-		WEAPON_PARSE_ASSET(dangerIcon);
-		WEAPON_PARSE_ASSET(throwBackIcon);
-
-		WEAPON_PARSE_FIELD(hideWarningIcons);
-		WEAPON_PARSE_FIELD(warningIconsDelay);
-		WEAPON_PARSE_ASSET(ammoCounterIcon);
-		WEAPON_PARSE_FIELD(ammoCounterClip);
-
-		WEAPON_PARSE_FIELD(iStartAmmo);
-		WEAPON_PARSE_FIELD(iPerkStartAmmo);
-		WEAPON_PARSE_FIELD(iPerkMaxAmmo);
-		//WEAPON_PARSE_FIELD(iAmmoIndex); // runtime
-		WEAPON_PARSE_FIELD(iMaxAmmo);
-		WEAPON_PARSE_FIELD(shotCount);
-		//WEAPON_PARSE_FIELD(iSharedAmmoCapIndex); // runtime
-		WEAPON_PARSE_FIELD(iSharedAmmoCap);
-		WEAPON_PARSE_FIELD(iAmmoUsedPerShot);
-		WEAPON_PARSE_FIELD(requireAmmoUsedPerShot);
-		WEAPON_PARSE_FIELD(lowAmmoWarningThreshold);
-		WEAPON_PARSE_FIELD(disableNoAmmoWarning);
-		WEAPON_PARSE_FIELD(damage);
-		WEAPON_PARSE_FIELD(playerDamage);
-		WEAPON_PARSE_FIELD(meleeDamage);
-		WEAPON_PARSE_FIELD(iDamageType);
-
-		WEAPON_PARSE_FIELD(autoAimRange);
-		WEAPON_PARSE_FIELD(aimAssistRange);
-		WEAPON_PARSE_FIELD(aimAssistRangeAds);
-		WEAPON_PARSE_FIELD(aimAssistPitchSlowdown);
-		WEAPON_PARSE_FIELD(aimAssistPitchSlowdownAds);
-		WEAPON_PARSE_FIELD(aimAssistYawSlowdown);
-		WEAPON_PARSE_FIELD(aimAssistYawSlowdownAds);
-		WEAPON_PARSE_FIELD(aimAssistLockonStrength);
-		WEAPON_PARSE_FIELD(aimPadding);
-		WEAPON_PARSE_FIELD(enemyCrosshairRange);
-		WEAPON_PARSE_FIELD(moveSpeedScale);
-		WEAPON_PARSE_FIELD(adsMoveSpeedScale);
-		WEAPON_PARSE_FIELD(sprintDurationScale);
-		WEAPON_PARSE_FIELD(sprintRestoreDelay);
-		WEAPON_PARSE_FIELD(fAdsZoomInFrac);
-		WEAPON_PARSE_FIELD(fAdsZoomOutFrac);
-
-		parse(&asset->overlay, data["overlay"], mem);
-		WEAPON_PARSE_FIELD(overlayInterface);
-
-		WEAPON_PARSE_FIELD(fAdsBobFactor);
-		WEAPON_PARSE_FIELD(fAdsViewBobMult);
-		WEAPON_PARSE_FIELD(fHipSpreadStandMin);
-		WEAPON_PARSE_FIELD(fHipSpreadDuckedMin);
-		WEAPON_PARSE_FIELD(fHipSpreadProneMin);
-		WEAPON_PARSE_FIELD(hipSpreadSprintMin);
-		WEAPON_PARSE_FIELD(hipSpreadInAirMin);
-		WEAPON_PARSE_FIELD(hipSpreadStandMax);
-		WEAPON_PARSE_FIELD(hipSpreadDuckedMax);
-		WEAPON_PARSE_FIELD(hipSpreadProneMax);
-		WEAPON_PARSE_FIELD(hipSpreadSprintMax);
-		WEAPON_PARSE_FIELD(hipSpreadInAirMax);
-		WEAPON_PARSE_FIELD(fHipSpreadDecayRate);
-		WEAPON_PARSE_FIELD(fHipSpreadFireAdd);
-		WEAPON_PARSE_FIELD(fHipSpreadTurnAdd);
-		WEAPON_PARSE_FIELD(fHipSpreadMoveAdd);
-		WEAPON_PARSE_FIELD(fHipSpreadDuckedDecay);
-		WEAPON_PARSE_FIELD(fHipSpreadProneDecay);
-		WEAPON_PARSE_FIELD(hipSpreadSprintDecay);
-		WEAPON_PARSE_FIELD(hipSpreadInAirDecay);
-		WEAPON_PARSE_FIELD(fHipReticleSidePos);
-		WEAPON_PARSE_FIELD(fAdsIdleAmount);
-		WEAPON_PARSE_FIELD(fHipIdleAmount);
-		WEAPON_PARSE_FIELD(adsIdleSpeed);
-		WEAPON_PARSE_FIELD(hipIdleSpeed);
-		WEAPON_PARSE_FIELD(fIdleCrouchFactor);
-		WEAPON_PARSE_FIELD(fIdleProneFactor);
-		WEAPON_PARSE_FIELD(fGunMaxPitch);
-		WEAPON_PARSE_FIELD(fGunMaxYaw);
-		WEAPON_PARSE_FIELD(adsIdleLerpStartTime);
-		WEAPON_PARSE_FIELD(adsIdleLerpTime);
-		WEAPON_PARSE_FIELD(slideSpreadMin);
-		WEAPON_PARSE_FIELD(slideSpreadMax);
-		WEAPON_PARSE_FIELD(slideSpreadDecayRate);
-		WEAPON_PARSE_FIELD(slideSpreadFireAdd);
-		WEAPON_PARSE_FIELD(slideSpreadTurnAdd);
-		WEAPON_PARSE_FIELD(swayMaxAngleSteadyAim);
-		WEAPON_PARSE_FIELD(swayMaxAngle);
-		WEAPON_PARSE_FIELD(swayLerpSpeed);
-		WEAPON_PARSE_FIELD(swayPitchScale);
-		WEAPON_PARSE_FIELD(swayYawScale);
-		WEAPON_PARSE_FIELD(swayHorizScale);
-		WEAPON_PARSE_FIELD(swayVertScale);
-		WEAPON_PARSE_FIELD(swayShellShockScale);
-		WEAPON_PARSE_FIELD(adsSwayMaxAngle);
-		WEAPON_PARSE_FIELD(adsSwayLerpSpeed);
-		WEAPON_PARSE_FIELD(adsSway_UNKNOWN_Scale); // fixme
-		WEAPON_PARSE_FIELD(adsSwayPitchScale);
-		WEAPON_PARSE_FIELD(adsSwayYawScale);
-		WEAPON_PARSE_FIELD(adsSwayHorizScale);
-		WEAPON_PARSE_FIELD(adsSwayVertScale);
-		WEAPON_PARSE_FIELD(adsFireRateScale);
-		WEAPON_PARSE_FIELD(adsDamageRangeScale);
-		WEAPON_PARSE_FIELD(adsFireAnimFrac);
-		WEAPON_PARSE_FIELD(fireTimerLerpToAdsScale);
-		WEAPON_PARSE_FIELD(alwaysFireAtMaxRangeInAds);
-
-		WEAPON_PARSE_FIELD(dualWieldViewModelOffset);
-
-		WEAPON_PARSE_FIELD(fScopeDriftDelay);
-		WEAPON_PARSE_FIELD(fScopeDriftLerpInTime);
-		WEAPON_PARSE_FIELD(fScopeDriftSteadyTime);
-		WEAPON_PARSE_FIELD(fScopeDriftLerpOutTime);
-		WEAPON_PARSE_FIELD(fScopeDriftSteadyFactor);
-		WEAPON_PARSE_FIELD(fScopeDriftUnsteadyFactor);
-
-		WEAPON_PARSE_FIELD(killIconRatio);
-
-		WEAPON_PARSE_FIELD(iReloadAmmoAdd);
-		WEAPON_PARSE_FIELD(iReloadStartAdd);
-		WEAPON_PARSE_FIELD(ammoDropStockMin);
-		WEAPON_PARSE_FIELD(ammoDropClipPercentMin);
-		WEAPON_PARSE_FIELD(ammoDropClipPercentMax);
-
-		WEAPON_PARSE_FIELD(iExplosionRadius);
-		WEAPON_PARSE_FIELD(iExplosionRadiusMin);
-		WEAPON_PARSE_FIELD(iExplosionForceRadius);
-		WEAPON_PARSE_FIELD(iExplosionInnerDamage);
-		WEAPON_PARSE_FIELD(iExplosionOuterDamage);
-		WEAPON_PARSE_FIELD(damageConeAngle);
-		WEAPON_PARSE_FIELD(bulletExplDmgMult);
-		WEAPON_PARSE_FIELD(bulletExplRadiusMult);
-		WEAPON_PARSE_FIELD(iProjectileSpeed);
-		WEAPON_PARSE_FIELD(iProjectileSpeedUp);
-		WEAPON_PARSE_FIELD(iProjectileSpeedForward);
-		WEAPON_PARSE_FIELD(iProjectileActivateDist);
-		WEAPON_PARSE_FIELD(iProjectileDetonationRadius);
-		WEAPON_PARSE_FIELD(projLifetime);
-		WEAPON_PARSE_FIELD(projLifetimeStdDeviation);
-		WEAPON_PARSE_FIELD(timeToAccelerate);
-		WEAPON_PARSE_FIELD(projectileCurvature);
-
-		WEAPON_PARSE_ASSET(projectileModel);
-		WEAPON_PARSE_FXCOMBINED(projExplosionEffect);
-		WEAPON_PARSE_FXCOMBINED(projDudEffect);
-		WEAPON_PARSE_FXCOMBINED(projBodyEffect);
-		WEAPON_PARSE_FXCOMBINED(projTrailEffect);
-		WEAPON_PARSE_FXCOMBINED(projBeaconEffect);
-		WEAPON_PARSE_FXCOMBINED(projIgnitionEffect);
-
-		WEAPON_PARSE_FIELD(ricochetChance);
-		WEAPON_PARSE_FIELD(riotShieldEnableDamage);
-		WEAPON_PARSE_FIELD(riotShieldHealth);
-		WEAPON_PARSE_FIELD(riotShieldDamageMult);
-
-		WEAPON_PARSE_FIELD_ARR(vProjectileColor, 3);
-		WEAPON_PARSE_FIELD(guidedMissileType);
-		WEAPON_PARSE_FIELD(maxSteeringAccel);
-		WEAPON_PARSE_FIELD(projIgnitionDelay);
-
-		WEAPON_PARSE_FIELD_ALLOC_ARR(parallelBounce, 64);
-		WEAPON_PARSE_FIELD_ALLOC_ARR(perpendicularBounce, 64);
-
-		WEAPON_PARSE_FIELD(fAdsAimPitch);
-		WEAPON_PARSE_FIELD(fAdsCrosshairInFrac);
-		WEAPON_PARSE_FIELD(fAdsCrosshairOutFrac);
-		WEAPON_PARSE_FIELD(adsInCrosshairAlphaStart);
-		WEAPON_PARSE_FIELD(adsInCrosshairAlphaEnd);
-		WEAPON_PARSE_FIELD(adsOutCrosshairAlphaStart);
-		WEAPON_PARSE_FIELD(adsOutCrosshairAlphaEnd);
-		WEAPON_PARSE_FIELD(adsShouldShowCrosshair);
-		WEAPON_PARSE_FIELD(adsGunKickReducedKickBullets);
-		WEAPON_PARSE_FIELD(adsGunKickReducedKickPercent);
-		WEAPON_PARSE_FIELD(fAdsGunKickPitchMin);
-		WEAPON_PARSE_FIELD(fAdsGunKickPitchMax);
-		WEAPON_PARSE_FIELD(fAdsGunKickYawMin);
-		WEAPON_PARSE_FIELD(fAdsGunKickYawMax);
-		WEAPON_PARSE_FIELD(fAdsGunKickMagMin);
-		WEAPON_PARSE_FIELD(fAdsGunKickAccel);
-		WEAPON_PARSE_FIELD(fAdsGunKickSpeedMax);
-		WEAPON_PARSE_FIELD(fAdsGunKickSpeedDecay);
-		WEAPON_PARSE_FIELD(fAdsGunKickStaticDecay);
-		WEAPON_PARSE_FIELD(fAdsViewKickPitchMin);
-		WEAPON_PARSE_FIELD(fAdsViewKickPitchMax);
-		WEAPON_PARSE_FIELD(fAdsViewKickYawMin);
-		WEAPON_PARSE_FIELD(fAdsViewKickYawMax);
-		WEAPON_PARSE_FIELD(fAdsViewKickMagMin);
-		WEAPON_PARSE_FIELD(fAdsViewScatterMin);
-		WEAPON_PARSE_FIELD(fAdsViewScatterMax);
-		WEAPON_PARSE_FIELD(fAdsSpread);
-
-		WEAPON_PARSE_FIELD(iVisibilityAxis);
-		WEAPON_PARSE_FIELD(fVisibilityUpOffset);
-		WEAPON_PARSE_FIELD(hipGunKickReducedKickBullets);
-		WEAPON_PARSE_FIELD(hipGunKickReducedKickPercent);
-		WEAPON_PARSE_FIELD(fHipGunKickPitchMin);
-		WEAPON_PARSE_FIELD(fHipGunKickPitchMax);
-		WEAPON_PARSE_FIELD(fHipGunKickYawMin);
-		WEAPON_PARSE_FIELD(fHipGunKickYawMax);
-		WEAPON_PARSE_FIELD(fHipGunKickMagMin);
-		WEAPON_PARSE_FIELD(fHipGunKickAccel);
-		WEAPON_PARSE_FIELD(fHipGunKickSpeedMax);
-		WEAPON_PARSE_FIELD(fHipGunKickSpeedDecay);
-		WEAPON_PARSE_FIELD(fHipGunKickStaticDecay);
-		WEAPON_PARSE_FIELD(fHipViewKickPitchMin);
-		WEAPON_PARSE_FIELD(fHipViewKickPitchMax);
-		WEAPON_PARSE_FIELD(fHipViewKickYawMin);
-		WEAPON_PARSE_FIELD(fHipViewKickYawMax);
-		WEAPON_PARSE_FIELD(fHipViewKickMagMin);
-		WEAPON_PARSE_FIELD(fHipViewScatterMin);
-		WEAPON_PARSE_FIELD(fHipViewScatterMax);
-
-		WEAPON_PARSE_FIELD(multipleReloadClipPercentage);
-		WEAPON_PARSE_FIELD(kickAlignedInputScalar);
-		WEAPON_PARSE_FIELD(kickOpposedInputScalar);
-		WEAPON_PARSE_FIELD(fightDist);
-		WEAPON_PARSE_FIELD(maxDist);
+		weapon_fields.read(asset, data, mem);
+		overlay_fields.read(&asset->overlay, json_fields::get(data, "overlay"), mem);
+		rotation_params_fields.read(&asset->rotationParams, json_fields::get(data, "rotationParams"), mem);
+
+		json_fields::read_asset_list(asset->complexWorldModel, json_fields::get(data, "complexWorldModel"), asset->numComplexModels, mem);
+		json_fields::read_asset_list(asset->complexWorldModelLeftHand, json_fields::get(data, "complexWorldModelLeftHand"), asset->numComplexModels, mem);
+		json_fields::read_asset_list(asset->complexWorldModelRightHand, json_fields::get(data, "complexWorldModelRightHand"), asset->numComplexModels, mem);
+		json_fields::read_asset_list(asset->complexGunXModel, json_fields::get(data, "complexGunXModel"), asset->numComplexModels, mem);
+		json_fields::read_asset_list(asset->complexGunXModelLeftHand, json_fields::get(data, "complexGunXModelLeftHand"), asset->numComplexModels, mem);
+		json_fields::read_asset_list(asset->complexGunXModelRightHand, json_fields::get(data, "complexGunXModelRightHand"), asset->numComplexModels, mem);
+
+		asset->notetrackRumbleMapKeys = this->parse_script_strings(json_fields::get(data, "notetrackRumbleMapKeys"), 16, mem);
+		asset->notetrackRumbleMapValues = this->parse_script_strings(json_fields::get(data, "notetrackRumbleMapValues"), 16, mem);
+		asset->notetrackFXMapKeys = this->parse_script_strings(json_fields::get(data, "notetrackFXMapKeys"), 16, mem);
+		asset->notetrackFXMapTagValues = this->parse_script_strings(json_fields::get(data, "notetrackFXMapTagValues"), 16, mem);
+
+		const auto& fx_map_values = json_fields::get(data, "notetrackFXMapValues");
+		if (!fx_map_values.is_null())
+		{
+			asset->notetrackFXMapValues = mem->allocate<FxCombinedDef>(16);
+			for (auto i = 0u; i < 16; i++)
+			{
+				const auto& value = json_fields::get(fx_map_values, i);
+				if (!value.is_null())
+				{
+					read_fx_combined(&asset->notetrackFXMapValues[i], value, mem);
+				}
+			}
+		}
+
+		this->parse_script_string(&asset->knifeAttachTagOverride, json_fields::get(data, "knifeAttachTagOverride"), mem);
+		this->parse_script_string(&asset->knifeAttachTagOverride2, json_fields::get(data, "knifeAttachTagOverride2"), mem);
+		this->parse_script_string(&asset->stowTag, json_fields::get(data, "stowTag"), mem);
 
+		const auto& graph_names = json_fields::get(data, "accuracyGraphName");
+		const auto& original_knots = json_fields::get(data, "originalAccuracyGraphKnots");
+		const auto& original_knot_counts = json_fields::get(data, "originalAccuracyGraphKnotCount");
 		for (auto i = 0; i < 2; i++)
 		{
-			asset->accuracyGraphName[i] = data["accuracyGraphName"][i].empty() ? nullptr : mem->duplicate_string(data["accuracyGraphName"][i].get<std::string>());
+			const auto& graph_name = json_fields::get(graph_names, i);
+			asset->accuracyGraphName[i] = graph_name.empty() ? nullptr : mem->duplicate_string(graph_name.get<std::string>());
+
+			const auto& knots = json_fields::get(original_knots, i);
 			asset->originalAccuracyGraphKnots[i] = mem->allocate<vec2_t>(parent->accuracyGraphKnotCount[i]);
 			for (auto ii = 0; ii < parent->accuracyGraphKnotCount[i]; ii++)
 			{
-				asset->originalAccuracyGraphKnots[i][ii][0] = data["originalAccuracyGraphKnots"][i][ii][0].get<float>();
-				asset->originalAccuracyGraphKnots[i][ii][1] = data["originalAccuracyGraphKnots"][i][ii][1].get<float>();
+				asset->originalAccuracyGraphKnots[i][ii][0] = knots.at(ii).at(0).get<float>();
+				asset->originalAccuracyGraphKnots[i][ii][1] = knots.at(ii).at(1).get<float>();
 			}
-			asset->originalAccuracyGraphKnotCount[i] = data["originalAccuracyGraphKnotCount"][i].get<unsigned short>();
+			asset->originalAccuracyGraphKnotCount[i] = json_fields::get(original_knot_counts, i).get<unsigned short>();
 		}
 
-		WEAPON_PARSE_FIELD(iPositionReloadTransTime);
-		WEAPON_PARSE_FIELD(leftArc);
-		WEAPON_PARSE_FIELD(rightArc);
-		WEAPON_PARSE_FIELD(topArc);
-		WEAPON_PARSE_FIELD(bottomArc);
-		WEAPON_PARSE_FIELD(softLeftRightArc);
-		WEAPON_PARSE_FIELD(accuracy);
-		WEAPON_PARSE_FIELD(aiSpread);
-		WEAPON_PARSE_FIELD(playerSpread);
-		WEAPON_PARSE_FIELD_ARR(minTurnSpeed, 2);
-		WEAPON_PARSE_FIELD_ARR(maxTurnSpeed, 2);
-		WEAPON_PARSE_FIELD(pitchConvergenceTime);
-		WEAPON_PARSE_FIELD(yawConvergenceTime);
-		WEAPON_PARSE_FIELD(suppressTime);
-		WEAPON_PARSE_FIELD(maxRange);
-		WEAPON_PARSE_FIELD(fAnimHorRotateInc);
-		WEAPON_PARSE_FIELD(fPlayerPositionDist);
-		//WEAPON_PARSE_FIELD(iUseHintStringIndex); // runtime
-		//WEAPON_PARSE_FIELD(dropHintStringIndex); // runtime
-		WEAPON_PARSE_FIELD(horizViewJitter);
-		WEAPON_PARSE_FIELD(vertViewJitter);
-		WEAPON_PARSE_FIELD(scanSpeed);
-		WEAPON_PARSE_FIELD(scanAccel);
-		WEAPON_PARSE_FIELD(scanPauseTime);
-		WEAPON_PARSE_FIELD_ARR(adsSpeedMs, 2);
-
-		WEAPON_PARSE_FIELD(minDamage);
-		WEAPON_PARSE_FIELD(minPlayerDamage);
-		WEAPON_PARSE_FIELD(mid1Damage);
-		WEAPON_PARSE_FIELD(mid2Damage);
-		WEAPON_PARSE_FIELD(mid3Damage);
-		WEAPON_PARSE_FIELD(mid1PlayerDamage);
-		WEAPON_PARSE_FIELD(mid2PlayerDamage);
-		WEAPON_PARSE_FIELD(mid3PlayerDamage);
-		WEAPON_PARSE_FIELD(maxDamageRange);
-		WEAPON_PARSE_FIELD(mid1DamageRange);
-		WEAPON_PARSE_FIELD(mid2DamageRange);
-		WEAPON_PARSE_FIELD(mid3DamageRange);
-		WEAPON_PARSE_FIELD(minDamageRange);
-
-		WEAPON_PARSE_FIELD(destabilizationRateTime);
-		WEAPON_PARSE_FIELD(destabilizationCurvatureMax);
-		WEAPON_PARSE_FIELD(destabilizeDistance);
-
-		WEAPON_PARSE_FIELD(robotechMaxPitch);
-		WEAPON_PARSE_FIELD(robotechMaxYaw);
-		WEAPON_PARSE_FIELD(robotechFrequency);
-		WEAPON_PARSE_FIELD(robotechVariancePitch);
-		WEAPON_PARSE_FIELD(robotechVarianceYaw);
-		WEAPON_PARSE_FIELD(robotechVarianceFrequency);
-
-		WEAPON_PARSE_FIELD_ALLOC_ARR(locationDamageMultipliers, 22);
-		WEAPON_PARSE_FIELD_ALLOC_ARR(hitLocPriorityMap, 22);
-		WEAPON_PARSE_FIELD_ARR(unittypeMultipliers, 9);
-
-		WEAPON_PARSE_ASSET(fireRumble);
-		WEAPON_PARSE_ASSET(meleeImpactRumble);
-
-		WEAPON_PARSE_FIELD(tracerStyle);
-		WEAPON_PARSE_ASSET(tracerType);
-		WEAPON_PARSE_ASSET(overchargeTracerType);
-
-		WEAPON_PARSE_ASSET(laserTypeFriendly);
-		WEAPON_PARSE_ASSET(laserTypeEnemy);
-
-		WEAPON_PARSE_FIELD(turretADSEnabled);
-		WEAPON_PARSE_FIELD(turretADSTime);
-		WEAPON_PARSE_FIELD(turretFov);
-		WEAPON_PARSE_FIELD(turretFovADS);
-		WEAPON_PARSE_FIELD(turretScopeZoomRate);
-		WEAPON_PARSE_FIELD(turretScopeZoomMin);
-		WEAPON_PARSE_FIELD(turretScopeZoomMax);
-		WEAPON_PARSE_FIELD(turretOverheatUpRate);
-		WEAPON_PARSE_FIELD(turretOverheatDownRate);
-		WEAPON_PARSE_FIELD(turretOverheatPenalty);
-		WEAPON_PARSE_STRING(turretOverheatSound);
-		WEAPON_PARSE_FXCOMBINED(turretOverheatEffect);
-		WEAPON_PARSE_ASSET(turretBarrelSpinRumble);
-		WEAPON_PARSE_FIELD(turretBarrelSpinSpeed);
-		WEAPON_PARSE_FIELD(turretBarrelSpinUpTime);
-		WEAPON_PARSE_FIELD(turretBarrelSpinDownTime);
-		WEAPON_PARSE_STRING(turretBarrelSpinMaxSnd);
-		WEAPON_PARSE_STRING_ARR(turretBarrelSpinUpSnd, 4);
-		WEAPON_PARSE_STRING_ARR(turretBarrelSpinDownSnd, 4);
-		WEAPON_PARSE_STRING(missileConeSoundAlias);
-		WEAPON_PARSE_STRING(missileConeSoundAliasAtBase);
-		WEAPON_PARSE_FIELD(missileConeSoundRadiusAtTop);
-		WEAPON_PARSE_FIELD(missileConeSoundRadiusAtBase);
-		WEAPON_PARSE_FIELD(missileConeSoundHeight);
-		WEAPON_PARSE_FIELD(missileConeSoundOriginOffset);
-		WEAPON_PARSE_FIELD(missileConeSoundVolumescaleAtCore);
-		WEAPON_PARSE_FIELD(missileConeSoundVolumescaleAtEdge);
-		WEAPON_PARSE_FIELD(missileConeSoundVolumescaleCoreSize);
-		WEAPON_PARSE_FIELD(missileConeSoundPitchAtTop);
-		WEAPON_PARSE_FIELD(missileConeSoundPitchAtBottom);
-		WEAPON_PARSE_FIELD(missileConeSoundPitchTopSize);
-		WEAPON_PARSE_FIELD(missileConeSoundPitchBottomSize);
-		WEAPON_PARSE_FIELD(missileConeSoundCrossfadeTopSize);
-		WEAPON_PARSE_FIELD(missileConeSoundCrossfadeBottomSize);
-
-		WEAPON_PARSE_SCRIPT_STRING(knifeAttachTagOverride);
-		WEAPON_PARSE_SCRIPT_STRING(knifeAttachTagOverride2);
-		WEAPON_PARSE_FIELD(knifeAlwaysAttached);
-		WEAPON_PARSE_FIELD(meleeOverrideValues);
-		WEAPON_PARSE_FIELD(aim_automelee_lerp);
-		WEAPON_PARSE_FIELD(aim_automelee_region_height);
-		WEAPON_PARSE_FIELD(aim_automelee_region_width);
-		WEAPON_PARSE_FIELD(aim_automelee_maxPitchMovement);
-		WEAPON_PARSE_FIELD(aim_automelee_maxYawMovement);
-		WEAPON_PARSE_FIELD(player_meleeHeight);
-		WEAPON_PARSE_FIELD(player_meleeWidth);
-		WEAPON_PARSE_FIELD(playerMeleeRangeStanding);
-		WEAPON_PARSE_FIELD(playerMeleeRangeCrouched);
-		WEAPON_PARSE_FIELD(playerMeleeRangeProne);
-		WEAPON_PARSE_FIELD(playerMeleeRangeChargeStanding);
-		WEAPON_PARSE_FIELD(playerMeleeRangeChargeCrouched);
-		WEAPON_PARSE_FIELD(playerMeleeChargeHeightTolerance);
-
-		WEAPON_PARSE_FIELD(shieldAllowFiring);
-		WEAPON_PARSE_FIELD(shieldUnkBool);
-		WEAPON_PARSE_FIELD(shieldMaxSpeed);
-		WEAPON_PARSE_FIELD(shieldAlwaysDisplay);
-		WEAPON_PARSE_ASSET(shieldDeployGesture);
-		WEAPON_PARSE_ASSET(shieldFireWeapGesture);
-		WEAPON_PARSE_ASSET(shieldDeployWhileFiring);
-		WEAPON_PARSE_ASSET(shieldRetractWhileFiring);
-		WEAPON_PARSE_ASSET(shieldBashGesture);
-		WEAPON_PARSE_FXCOMBINED(shieldMeleeFx);
-		WEAPON_PARSE_FIELD(shieldMeleeFxDelay);
-		WEAPON_PARSE_FIELD(HitEarthquakeScale);
-		WEAPON_PARSE_FIELD(HitEarthquakeDuration);
-		WEAPON_PARSE_FIELD(HitEarthquakeRadius);
-		WEAPON_PARSE_ASSET(shieldHitRumble);
-		WEAPON_PARSE_FIELD(MissEarthquakeScale);
-		WEAPON_PARSE_FIELD(MissEarthquakeDuration);
-		WEAPON_PARSE_FIELD(MissEarthquakeRadius);
-		WEAPON_PARSE_ASSET(shieldMissRumble);
-		WEAPON_PARSE_FIELD(shieldDeployButton);
-		WEAPON_PARSE_FIELD(shieldUsesEnergy);
-		WEAPON_PARSE_FIELD(shieldMaxEnergy);
-		WEAPON_PARSE_FIELD(shieldConsumptionRate);
-		WEAPON_PARSE_FIELD(shieldMeleeEnergyCost);
-		WEAPON_PARSE_FIELD(shieldMeleeHitEnergyCost);
-
-		WEAPON_PARSE_FIELD(reactiveMotionRadiusScale);
-		WEAPON_PARSE_FIELD(reactiveMotionFrequencyScale);
-		WEAPON_PARSE_FIELD(reactiveMotionAmplitudeScale);
-		WEAPON_PARSE_FIELD(reactiveMotionFalloff);
-		WEAPON_PARSE_FIELD(reactiveMotionLifetime);
-
-		WEAPON_PARSE_FIELD(hasAnyTransientModels);
-		WEAPON_PARSE_FIELD(sharedAmmo);
-		WEAPON_PARSE_FIELD(lockonSupported);
-		WEAPON_PARSE_FIELD(requireLockonToFire);
-		WEAPON_PARSE_FIELD(isAirburstWeapon);
-		WEAPON_PARSE_FIELD(bigExplosion);
-		WEAPON_PARSE_FIELD(noAdsWhenMagEmpty);
-		WEAPON_PARSE_FIELD(avoidDropCleanup);
-		WEAPON_PARSE_FIELD(allowGrenadeSwitching);
-		WEAPON_PARSE_FIELD(inheritsPerks);
-		WEAPON_PARSE_FIELD(crosshairColorChange);
-		WEAPON_PARSE_FIELD(bRifleBullet);
-		WEAPON_PARSE_FIELD(bEnergyBullet);
-		WEAPON_PARSE_FIELD(armorPiercing);
-		WEAPON_PARSE_FIELD(impaling);
-		WEAPON_PARSE_FIELD(bBoltAction);
-		WEAPON_PARSE_FIELD(aimDownSight);
-		WEAPON_PARSE_FIELD(canHoldBreath);
-		WEAPON_PARSE_FIELD(meleeOnly);
-		WEAPON_PARSE_FIELD(supportsAlternateMelee);
-		WEAPON_PARSE_FIELD(canVariableZoom);
-		WEAPON_PARSE_FIELD(bRechamberWhileAds);
-		WEAPON_PARSE_FIELD(bBulletExplosiveDamage);
-		WEAPON_PARSE_FIELD(bCookOffHold);
-		WEAPON_PARSE_FIELD(reticleSpin45);
-		WEAPON_PARSE_FIELD(bClipOnly);
-		WEAPON_PARSE_FIELD(bDoesNotConsumeAmmo);
-		WEAPON_PARSE_FIELD(bRemoveWeaponOnEmpty);
-		WEAPON_PARSE_FIELD(noAmmoPickup);
-		WEAPON_PARSE_FIELD(adsFireOnly);
-		WEAPON_PARSE_FIELD(cancelAutoHolsterWhenEmpty);
-		WEAPON_PARSE_FIELD(disableSwitchToWhenEmpty);
-		WEAPON_PARSE_FIELD(suppressAmmoPrimaryDisplay);
-		WEAPON_PARSE_FIELD(suppressAmmoReserveDisplay);
-		WEAPON_PARSE_FIELD(laserSightDuringNightvision);
-		WEAPON_PARSE_FIELD(markableViewmodel);
-		WEAPON_PARSE_FIELD(flipKillIcon);
-		WEAPON_PARSE_FIELD(bNoPartialReload);
-		WEAPON_PARSE_FIELD(reloadDisabled);
-		WEAPON_PARSE_FIELD(blocksProne);
-		WEAPON_PARSE_FIELD(silenced);
-		WEAPON_PARSE_FIELD(isRollingGrenade);
-		WEAPON_PARSE_FIELD(dropGrenadeHeldOnDeath);
-		WEAPON_PARSE_FIELD(projExplosionEffectForceNormalUp);
-		WEAPON_PARSE_FIELD(projExplosionEffectInheritParentDirection);
-		WEAPON_PARSE_FIELD(bProjImpactExplode);
-		WEAPON_PARSE_FIELD(disableProjectileCrumpleCheck);
-		WEAPON_PARSE_FIELD(bProjTrajectoryEvents);
-		WEAPON_PARSE_FIELD(bProjWhizByEnabled);
-		WEAPON_PARSE_FIELD(stickToPlayers);
-		WEAPON_PARSE_FIELD(stickToVehicles);
-		WEAPON_PARSE_FIELD(stickToTurrets);
-		WEAPON_PARSE_FIELD(stickToNonStick);
-		WEAPON_PARSE_FIELD(projEnableMissileStickiness);
-		WEAPON_PARSE_FIELD(thrownSideways);
-		WEAPON_PARSE_FIELD(hasDetonator);
-		WEAPON_PARSE_FIELD(disableFiring);
-		WEAPON_PARSE_FIELD(firesOnWeaponSwitch);
-		WEAPON_PARSE_FIELD(disableHolding);
-		WEAPON_PARSE_FIELD(timedDetonation);
-
-		WEAPON_PARSE_FIELD(explosiveDamageDelay);
-		WEAPON_PARSE_FIELD(fuseTime);
-		WEAPON_PARSE_FIELD(aiFuseTime);
-		WEAPON_PARSE_FIELD(maxHoldTime);
-
-		WEAPON_PARSE_FIELD(holdButtonToThrow);
-		WEAPON_PARSE_FIELD(infiniteHold);
-		WEAPON_PARSE_FIELD(freezeMovementWhenFiring);
-		WEAPON_PARSE_FIELD(offhandAllowsSprint);
-		WEAPON_PARSE_FIELD(thermalScope);
-		WEAPON_PARSE_FIELD(thermalToggle);
-		WEAPON_PARSE_FIELD(outlineEnemies);
-		WEAPON_PARSE_FIELD(outlineDepthTest);
-		WEAPON_PARSE_FIELD(outlineFill);
-
-		WEAPON_PARSE_FIELD(enemyOutlineR);
-		WEAPON_PARSE_FIELD(enemyOutlineG);
-		WEAPON_PARSE_FIELD(enemyOutlineB);
-		WEAPON_PARSE_FIELD(enemyOutlineA);
-		WEAPON_PARSE_FIELD(allyOutlineR);
-		WEAPON_PARSE_FIELD(allyOutlineG);
-		WEAPON_PARSE_FIELD(allyOutlineB);
-		WEAPON_PARSE_FIELD(allyOutlineA);
-		WEAPON_PARSE_FIELD(depthScan);
-		WEAPON_PARSE_FIELD(depthScanThickness);
-		WEAPON_PARSE_FIELD(depthScanR);
-		WEAPON_PARSE_FIELD(depthScanG);
-		WEAPON_PARSE_FIELD(depthScanB);
-		WEAPON_PARSE_FIELD(depthScanA);
-		WEAPON_PARSE_FIELD(depthScanOutlineThickness);
-		WEAPON_PARSE_FIELD(depthScanOutlineR);
-		WEAPON_PARSE_FIELD(depthScanOutlineG);
-		WEAPON_PARSE_FIELD(depthScanOutlineB);
-		WEAPON_PARSE_FIELD(depthScanOutlineA);
-		WEAPON_PARSE_FIELD(depthScanOverlay);
-		WEAPON_PARSE_FIELD(depthScanOverlayStrength);
-		WEAPON_PARSE_FIELD(depthScanOverlayXTiles);
-		WEAPON_PARSE_FIELD(depthScanOverlayYTiles);
-		WEAPON_PARSE_FIELD(depthScanOverlayXScroll);
-		WEAPON_PARSE_FIELD(depthScanOverlayYScroll);
-
-		WEAPON_PARSE_FIELD(blurSceneAdsInFraction);
-		WEAPON_PARSE_FIELD(blurSceneAdsOutFraction);
-
-		WEAPON_PARSE_FIELD(altModeSameWeapon);
-		WEAPON_PARSE_FIELD(turretBarrelSpinEnabled);
-		WEAPON_PARSE_FIELD(missileConeSoundEnabled);
-		WEAPON_PARSE_FIELD(missileConeSoundPitchshiftEnabled);
-		WEAPON_PARSE_FIELD(missileConeSoundCrossfadeEnabled);
-		WEAPON_PARSE_FIELD(offhandHoldIsCancelable);
-		WEAPON_PARSE_FIELD(doNotAllowAttachmentsToOverrideSpread);
-		WEAPON_PARSE_FIELD(useScopeDrift);
-		WEAPON_PARSE_FIELD(alwaysShatterGlassOnImpact);
-		WEAPON_PARSE_FIELD(oldWeapon);
-		WEAPON_PARSE_FIELD(jumpSpread);
-		WEAPON_PARSE_FIELD(noFullViewmodelAnimations);
-
-		WEAPON_PARSE_FIELD(killcamOffset);
-
-		WEAPON_PARSE_FIELD(useDualFOV);
-		WEAPON_PARSE_FIELD(disableDrop);
-		WEAPON_PARSE_FIELD(preferredDrop);
-
-		WEAPON_PARSE_ASSET(gestureAnimation);
-		WEAPON_PARSE_FIELD(gestureFireStateTime);
-		WEAPON_PARSE_ASSET(gesturePullback);
-		WEAPON_PARSE_FIELD(minPullbackTime);
-		WEAPON_PARSE_ASSET(gestureThrow);
-		WEAPON_PARSE_FIELD(gestureFireTime);
-		WEAPON_PARSE_ASSET(gestureDetonate);
-		WEAPON_PARSE_FIELD(gestureDetonationTime);
-		WEAPON_PARSE_FIELD(unk_433);
-		WEAPON_PARSE_STRING(unknownString1);
-		WEAPON_PARSE_FIELD(unk_434);
-		WEAPON_PARSE_STRING(unknownString2);
-		WEAPON_PARSE_FIELD(gesturesDisablePrimary);
-		WEAPON_PARSE_FXCOMBINED(cameraFireEffect);
-		WEAPON_PARSE_FIELD(cameraFireEffectDurationSec);
-		WEAPON_PARSE_FIELD(changedFireTime);
-		WEAPON_PARSE_FIELD(changedFireTimeAkimbo);
-		WEAPON_PARSE_FIELD(changedFireTimeNumBullets);
-
-		WEAPON_PARSE_FIELD(chargeType);
-		WEAPON_PARSE_FIELD(chargeGain);
-		WEAPON_PARSE_FIELD(chargeCostPerShot);
-		WEAPON_PARSE_FIELD(chargeLossWhenIdle);
-		WEAPON_PARSE_FIELD(chargeEmptyCooldown);
-		WEAPON_PARSE_FIELD(chargeFireAtMaxDamageMultiplier);
-		WEAPON_PARSE_FIELD(chargeMeterEffectBoneCount);
-		WEAPON_PARSE_FXCOMBINED(chargeMeterEffect);
-		WEAPON_PARSE_STRING(chargeUpSound);
-		WEAPON_PARSE_STRING(chargeDownSound);
-		WEAPON_PARSE_STRING(chargeUpSoundPlayer);
-		WEAPON_PARSE_STRING(chargeDownSoundPlayer);
-		WEAPON_PARSE_STRING(chargeDownToUpSound);
-		WEAPON_PARSE_STRING(chargeDownToUpSoundPlayer);
-		WEAPON_PARSE_STRING(chargeUpToDownSound);
-		WEAPON_PARSE_STRING(chargeUpToDownSoundPlayer);
-		WEAPON_PARSE_STRING(chargeMaxSound);
-		WEAPON_PARSE_STRING(chargeMaxSoundPlayer);
-		WEAPON_PARSE_FIELD(chargeHudReveal);
-		WEAPON_PARSE_ASSET(chargeRumble);
-
-		WEAPON_PARSE_SCRIPT_STRING(stowTag);
-		WEAPON_PARSE_ASSET(stowOffsetModel);
-
-		WEAPON_PARSE_FIELD(maxTargetAngle);
-		WEAPON_PARSE_FIELD(spaceshipSecondaryWeapon);
-		WEAPON_PARSE_FIELD(impulseFieldRadius);
-		WEAPON_PARSE_FIELD(impulseFieldInitialSpeed);
-		WEAPON_PARSE_FIELD(impulseFieldMaxSpeed);
-		WEAPON_PARSE_FIELD(impulseFieldAcceleration);
-		WEAPON_PARSE_FIELD(impulseFieldInAirImpulseMultiplier);
-		WEAPON_PARSE_FIELD(impulseFieldInAirImpulseMultiplierInterpTime);
-		WEAPON_PARSE_FIELD(impulseFieldSlideMultiplier);
-		WEAPON_PARSE_FIELD(impulseFieldSlideMultiplierInterpTime);
-		WEAPON_PARSE_FIELD(impulseFieldIsPush);
-		WEAPON_PARSE_FIELD(impulseFieldAffectsFriendlies);
-		WEAPON_PARSE_FIELD(impulseFieldAffectsSelf);
-		WEAPON_PARSE_FIELD(impulseFieldAffectsProne);
-
-		WEAPON_PARSE_FIELD(regenerationEnabled);
-		WEAPON_PARSE_FIELD(regenerationTimeMs);
-		WEAPON_PARSE_FIELD(regenerationAddTimeMs);
-		WEAPON_PARSE_FIELD(regenerationAmount);
-		WEAPON_PARSE_FIELD(regenerationConsumeStock);
-		WEAPON_PARSE_FIELD(regenerationDisableWhileFiring);
-
-		WEAPON_PARSE_FIELD(deployRequireOnWalkableSurface);
-		WEAPON_PARSE_FIELD(deployRequireOnNavmesh);
-		WEAPON_PARSE_FIELD(deployRequireSkyAbove);
-		WEAPON_PARSE_FIELD(deployRequireNoOverhang);
-		WEAPON_PARSE_FIELD(deployAlwaysUpright);
-		WEAPON_PARSE_FIELD(deployEdgeSnap);
-		WEAPON_PARSE_FIELD(deployCylinderRadius);
-		WEAPON_PARSE_FIELD(deployCylinderHeight);
-		WEAPON_PARSE_FIELD(deployMaxDistance);
-		WEAPON_PARSE_FXCOMBINED(deployEffect);
-		WEAPON_PARSE_FIELD(deployValidGroupId);
-		WEAPON_PARSE_FIELD(deployIndoorGroupId);
-		WEAPON_PARSE_FIELD(deployInvalidGroupId);
-		WEAPON_PARSE_FIELD(deployOutOfRangeGroupId);
-
-		WEAPON_PARSE_FIELD(reactiveEmitterDelay);
-		WEAPON_PARSE_FIELD(grenadeDangerIconDistance);
-		WEAPON_PARSE_FIELD(unk_466_0);
-
-		// unk stuff
-		WEAPON_PARSE_FIELD(unk_0);
-		WEAPON_PARSE_FIELD(unk_1);
-		WEAPON_PARSE_FIELD(unk_2);
-		WEAPON_PARSE_FIELD(unk_3);
-		WEAPON_PARSE_FIELD(unk_4_0);
-		WEAPON_PARSE_FIELD(unk_4_1);
-
-		parse(&asset->rotationParams, data["rotationParams"], mem);
-
+		const auto& anim_overrides = json_fields::get(data, "animOverrides");
+		const auto& sfx_overrides = json_fields::get(data, "sfxOverrides");
+		const auto& vfx_overrides = json_fields::get(data, "vfxOverrides");
 		for (auto i = 0; i < 21; i++)
 		{
-			parse(&asset->animOverrides[i], data["animOverrides"][i], mem);
-			parse(&asset->sfxOverrides[i], data["sfxOverrides"][i], mem);
-			parse(&asset->vfxOverrides[i], data["vfxOverrides"][i], mem);
+			this->parse(&asset->animOverrides[i], json_fields::get(anim_overrides, i), mem);
+			this->parse(&asset->sfxOverrides[i], json_fields::get(sfx_overrides, i), mem);
+			this->parse(&asset->vfxOverrides[i], json_fields::get(vfx_overrides, i), mem);
 		}
 
-		{ // unk
-			//AttUnknown01; WeaponDef;
-
-#define PARSE_UNK0(__field__) \
-			asset->__field__ = data["unk0"][#__field__].get<decltype(asset->__field__)>();
-
-			if (!data["unk0"]["material"].empty())
-			{
-				asset->unkMaterial = mem->allocate<Material>();
-				asset->unkMaterial->name = mem->duplicate_string(data["unk0"]["material"].get<std::string>());
-			}
-			else
-			{
-				asset->unkMaterial = nullptr;
-			}
-			PARSE_UNK0(unk_18);
-			PARSE_UNK0(unk_19);
-			PARSE_UNK0(unk_20);
-			PARSE_UNK0(unk_21);
-			PARSE_UNK0(unk_22);
-			PARSE_UNK0(unk_23);
-			PARSE_UNK0(unk_24);
-			PARSE_UNK0(unk_25);
-			PARSE_UNK0(unk_26);
-			PARSE_UNK0(unk_27);
-			PARSE_UNK0(unk_28);
-			PARSE_UNK0(unk_29);
-			PARSE_UNK0(unk_30);
-			PARSE_UNK0(unk_31);
-			PARSE_UNK0(unk_32);
-			PARSE_UNK0(unk_33);
-			PARSE_UNK0(unk_34);
-			PARSE_UNK0(unk_35);
-			PARSE_UNK0(unk_36);
-			PARSE_UNK0(unk_37);
-			PARSE_UNK0(unk_38);
-			PARSE_UNK0(unk_39);
-			PARSE_UNK0(unk_40);
-			PARSE_UNK0(unk_41);
-			PARSE_UNK0(unk_42);
-			PARSE_UNK0(unk_43);
-			PARSE_UNK0(unk_44);
-			PARSE_UNK0(unk_45);
-			PARSE_UNK0(unk_46);
-			PARSE_UNK0(unk_47);
-			PARSE_UNK0(unk_48);
-			PARSE_UNK0(unk_49);
-			PARSE_UNK0(unk_50);
-			PARSE_UNK0(unk_51);
-			PARSE_UNK0(unk_52);
-			PARSE_UNK0(unk_53);
-			PARSE_UNK0(unk_54);
-			PARSE_UNK0(unk_55);
-			PARSE_UNK0(unk_56);
-			PARSE_UNK0(unk_57);
-			PARSE_UNK0(unk_58);
-			PARSE_UNK0(unk_59);
-			PARSE_UNK0(unk_60);
-			PARSE_UNK0(unk_61);
-			PARSE_UNK0(unk_62);
-			PARSE_UNK0(unk_63);
-			PARSE_UNK0(unk_64);
-			PARSE_UNK0(unk_65_0);
-			PARSE_UNK0(unk_65_1);
-			PARSE_UNK0(unk_65_2);
-			PARSE_UNK0(unk_65_3);
+		//AttUnknown01; WeaponDef;
+		const auto& unk0 = json_fields::get(data, "unk0");
+		const auto& unk_material = json_fields::get(unk0, "material");
+		if (!unk_material.empty())
+		{
+			asset->unkMaterial = mem->allocate<Material>();
+			asset->unkMaterial->name = mem->duplicate_string(unk_material.get<std::string>());
 		}
+		else
+		{
+			asset->unkMaterial = nullptr;
+		}
+		unk0_fields.read(asset, unk0, mem);
 	}
 
-	void weapon_def::parse_NoteTrackToSoundEntry(NoteTrackToSoundEntry* asset, ordered_json& data, zone_memory* mem)
+	void weapon_def::parse_NoteTrackToSoundEntry(NoteTrackToSoundEntry* asset, const ordered_json& data, zone_memory* mem)
 	{
-		WEAPON_PARSE_SCRIPT_STRING(attachment);
-		WEAPON_PARSE_SCRIPT_STRING_ALLOC_ARR_MODVAL(notetrackSoundMapKeys, asset->numSoundMappings);
-		WEAPON_PARSE_SCRIPT_STRING_ALLOC_ARR_MODVAL(notetrackSoundMapValues, asset->numSoundMappings);
+		this->parse_script_string(&asset->attachment, json_fields::get(data, "attachment"), mem);
+
+		const auto& keys = json_fields::get(data, "notetrackSoundMapKeys");
+		const auto& values = json_fields::get(data, "notetrackSoundMapValues");
+		assert(keys.size() == values.size());
+		asset->numSoundMappings = static_cast<decltype(asset->numSoundMappings)>(keys.size());
+		asset->notetrackSoundMapKeys = this->parse_script_strings(keys, asset->numSoundMappings, mem);
+		asset->notetrackSoundMapValues = this->parse_script_strings(values, asset->numSoundMappings, mem);
 	}
 
-	void weapon_def::parse_NoteTrackToSuitSoundEntry(NoteTrackToSuitSoundEntry* asset, ordered_json& data, zone_memory* mem)
+	void weapon_def::parse_NoteTrackToSuitSoundEntry(NoteTrackToSuitSoundEntry* asset, const ordered_json& data, zone_memory* mem)
 	{
-		WEAPON_PARSE_FIELD(suitAnimState);
-		WEAPON_PARSE_SCRIPT_STRING_ALLOC_ARR_MODVAL(notetrackSoundMapKeys, asset->numSoundMappings);
-		WEAPON_PARSE_SCRIPT_STRING_ALLOC_ARR_MODVAL(notetrackSoundMapValues, asset->numSoundMappings);
+		const auto& suit_anim_state = json_fields::get(data, "suitAnimState");
+		if (!suit_anim_state.is_null())
+		{
+			asset->suitAnimState = suit_anim_state.get<decltype(asset->suitAnimState)>();
+		}
+
+		const auto& keys = json_fields::get(data, "notetrackSoundMapKeys");
+		const auto& values = json_fields::get(data, "notetrackSoundMapValues");
+		assert(keys.size() == values.size());
+		asset->numSoundMappings = static_cast<decltype(asset->numSoundMappings)>(keys.size());
+		asset->notetrackSoundMapKeys = this->parse_script_strings(keys, asset->numSoundMappings, mem);
+		asset->notetrackSoundMapValues = this->parse_script_strings(values, asset->numSoundMappings, mem);
 	}
 
-	void weapon_def::parse_complete(WeaponCompleteDef* asset, ordered_json& data, zone_memory* mem)
+	void weapon_def::parse_complete(WeaponCompleteDef* asset, const ordered_json& data, zone_memory* mem)
 	{
-		WEAPON_PARSE_STRING(szInternalName);
-		WEAPON_PARSE_STRING(szDisplayName);
-		WEAPON_PARSE_STRING(szLootTable);
-
-		WEAPON_PARSE_SCRIPT_STRING_ALLOC_ARR(hideTags, 32);
-		WEAPON_PARSE_ASSET_ALLOC_ARR_MODVAL(attachments, asset->numAttachments);
-		WEAPON_PARSE_ASSET_ALLOC_ARR_MODVAL(attachments2, asset->numAttachments2);
-		WEAPON_PARSE_ASSET_ALLOC_ARR_MODVAL(attachments3, asset->numAttachments3);
-		WEAPON_PARSE_ASSET_ALLOC_ARR_MODVAL(attachments4, asset->numAttachments4);
-		WEAPON_PARSE_ASSET_ALLOC_ARR_MODVAL(attachments5, asset->numAttachments5);
-		WEAPON_PARSE_ASSET_ALLOC_ARR_MODVAL(attachments6, asset->numAttachments6);
-		WEAPON_PARSE_SCRIPT_STRING_ALLOC_ARR_MODVAL(notetrackSoundMapKeys, asset->numNotetrackSoundMappings);
-		WEAPON_PARSE_SCRIPT_STRING_ALLOC_ARR_MODVAL(notetrackSoundMapValues, asset->numNotetrackSoundMappings);
-		if (!data["notetrackOverrides"].is_null())
+		complete_fields.read(asset, data, mem);
+
+		asset->hideTags = this->parse_script_strings(json_fields::get(data, "hideTags"), 32, mem);
+		json_fields::read_asset_list(asset->attachments, json_fields::get(data, "attachments"), asset->numAttachments, mem);
+		json_fields::read_asset_list(asset->attachments2, json_fields::get(data, "attachments2"), asset->numAttachments2, mem);
+		json_fields::read_asset_list(asset->attachments3, json_fields::get(data, "attachments3"), asset->numAttachments3, mem);
+		json_fields::read_asset_list(asset->attachments4, json_fields::get(data, "attachments4"), asset->numAttachments4, mem);
+		json_fields::read_asset_list(asset->attachments5, json_fields::get(data, "attachments5"), asset->numAttachments5, mem);
+		json_fields::read_asset_list(asset->attachments6, json_fields::get(data, "attachments6"), asset->numAttachments6, mem);
+
+		const auto& keys = json_fields::get(data, "notetrackSoundMapKeys");
+		const auto& values = json_fields::get(data, "notetrackSoundMapValues");
+		assert(keys.size() == values.size());
+		asset->numNotetrackSoundMappings = static_cast<decltype(asset->numNotetrackSoundMappings)>(keys.size());
+		asset->notetrackSoundMapKeys = this->parse_script_strings(keys, asset->numNotetrackSoundMappings, mem);
+		asset->notetrackSoundMapValues = this->parse_script_strings(values, asset->numNotetrackSoundMappings, mem);
+
+		const auto& notetrack_overrides = json_fields::get(data, "notetrackOverrides");
+		if (!notetrack_overrides.is_null())
 		{
-			asset->numNotetrackOverrides = static_cast<unsigned short>(data["notetrackOverrides"].size());
+			asset->numNotetrackOverrides = static_cast<unsigned short>(notetrack_overrides.size());
 			asset->notetrackOverrides = mem->allocate<NoteTrackToSoundEntry>(asset->numNotetrackOverrides);
 			for (auto i = 0u; i < asset->numNotetrackOverrides; i++)
 			{
-				parse_NoteTrackToSoundEntry(&asset->notetrackOverrides[i], data["notetrackOverrides"][i], mem);
+				this->parse_NoteTrackToSoundEntry(&asset->notetrackOverrides[i], notetrack_overrides[i], mem);
 			}
 		}
 		else
 		{
 			asset->notetrackOverrides = nullptr;
 		}
-		if (!data["notetrackSuitEntries"].is_null())
+
+		const auto& suit_entries = json_fields::get(data, "notetrackSuitEntries");
+		if (!suit_entries.is_null())
 		{
-			asset->numNotetrackSuitEntries = static_cast<unsigned short>(data["notetrackSuitEntries"].size());
+			asset->numNotetrackSuitEntries = static_cast<unsigned short>(suit_entries.size());
 			asset->notetrackSuitEntries = mem->allocate<NoteTrackToSuitSoundEntry>(asset->numNotetrackSuitEntries);
 			for (auto i = 0u; i < asset->numNotetrackSuitEntries; i++)
 			{
-				parse_NoteTrackToSuitSoundEntry(&asset->notetrackSuitEntries[i], data["notetrackSuitEntries"][i], mem);
+				this->parse_NoteTrackToSuitSoundEntry(&asset->notetrackSuitEntries[i], suit_entries[i], mem);
 			}
 		}
 		else
 		{
 			asset->notetrackSuitEntries = nullptr;
 		}
-		WEAPON_PARSE_FIELD(fAdsZoomFov);
-		WEAPON_PARSE_FIELD(iAdsTransInTime);
-		WEAPON_PARSE_FIELD(iAdsTransOutTime);
-		WEAPON_PARSE_FIELD(iClipSize);
-		WEAPON_PARSE_FIELD(vfxImpactType);
-		WEAPON_PARSE_FIELD(sfxImpactType);
-		WEAPON_PARSE_FIELD(meleeImpactType);
-		WEAPON_PARSE_FIELD(penetrateMultiplier);
-		WEAPON_PARSE_FIELD(fAdsViewKickCenterSpeed);
-		WEAPON_PARSE_FIELD(fHipViewKickCenterSpeed);
-		WEAPON_PARSE_STRING(szAltWeaponName);
-		WEAPON_PARSE_ASSET(killIcon);
-		WEAPON_PARSE_ASSET(dpadIcon);
-		WEAPON_PARSE_FIELD(ammoDropStockMax);
-		WEAPON_PARSE_FIELD(adsDofStart);
-		WEAPON_PARSE_FIELD(adsDofEnd);
+
+		const auto& graph_knots = json_fields::get(data, "accuracyGraphKnots");
 		for (auto i = 0; i < 2; i++)
 		{
-			if (!data["accuracyGraphKnots"][i].is_null())
+			const auto& knots = json_fields::get(graph_knots, i);
+			if (!knots.is_null())
 			{
-				asset->accuracyGraphKnotCount[i] = static_cast<unsigned short>(data["accuracyGraphKnots"][i].size());
+				asset->accuracyGraphKnotCount[i] = static_cast<unsigned short>(knots.size());
 				asset->accuracyGraphKnots[i] = mem->allocate<vec2_t>(asset->accuracyGraphKnotCount[i]);
 				for (auto ii = 0; ii < asset->accuracyGraphKnotCount[i]; ii++)
 				{
-					asset->accuracyGraphKnots[i][ii][0] = data["accuracyGraphKnots"][i][ii][0].get<float>();
-					asset->accuracyGraphKnots[i][ii][1] = data["accuracyGraphKnots"][i][ii][1].get<float>();
+					asset->accuracyGraphKnots[i][ii][0] = knots[ii].at(0).get<float>();
+					asset->accuracyGraphKnots[i][ii][1] = knots[ii].at(1).get<float>();
 				}
 			}
 			else
@@ -1124,18 +1095,10 @@ namespace zonetool::iw7
 				asset->accuracyGraphKnots[i] = nullptr;
 			}
 		}
-		WEAPON_PARSE_FIELD(motionTracker);
-		WEAPON_PARSE_FIELD(enhanced);
-		WEAPON_PARSE_FIELD(dpadIconShowsAmmo);
-		WEAPON_PARSE_FIELD(luiWeaponInfoWidgetUsesScopeStencil);
-		WEAPON_PARSE_STRING(szAdsrBaseSetting);
-		WEAPON_PARSE_STRING(szLUIWeaponInfoWidgetName);
-		WEAPON_PARSE_STRING(szLUIWeaponInfoWidgetTag);
-		WEAPON_PARSE_STRING(szLUICrosshairWidget);
 
 		// parse this last
 		asset->weapDef = mem->allocate<WeaponDef>();
-		parse_weapondef(asset->weapDef, asset, data["weapDef"], mem);
+		this->parse_weapondef(asset->weapDef, asset, json_fields::get(data, "weapDef"), mem);
 	}
 
 	WeaponCompleteDef* weapon_def::parse(const std::string& name, zone_memory* mem)
@@ -1152,7 +1115,7 @@ namespace zonetool::iw7
 
 		// parse json file
 		file.open("rb");
-		ordered_json data = json::parse(file.read_bytes(file.size()));
+		const ordered_json data = json::parse(file.read_bytes(file.size()));
 		file.close();
 
 		auto asset = mem->allocate<WeaponCompleteDef>();
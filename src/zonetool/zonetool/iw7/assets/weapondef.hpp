@@ -23,15 +23,15 @@ namespace zonetool::iw7
 		void prepare(VFXOverride* asset, zone_buffer* buf);
 		void prepare_weapondef(WeaponDef* asset, zone_buffer* buf);
 
-		void parse(AnimOverride* asset, ordered_json& data, zone_memory* mem);
-		void parse(SFXOverride* asset, ordered_json& data, zone_memory* mem);
-		void parse(VFXOverride* asset, ordered_json& data, zone_memory* mem);
-		void parse(GrenadeRotationParams* asset, ordered_json& data, zone_memory* mem);
-		void parse(ADSOverlay* asset, ordered_json& data, zone_memory* mem);
-		void parse_weapondef(WeaponDef* asset, WeaponCompleteDef* parent, ordered_json& data, zone_memory* mem);
-		void parse_NoteTrackToSoundEntry(NoteTrackToSoundEntry* asset, ordered_json& data, zone_memory* mem);
-		void parse_NoteTrackToSuitSoundEntry(NoteTrackToSuitSoundEntry* asset, ordered_json& data, zone_memory* mem);
-		void parse_complete(WeaponCompleteDef* asset, ordered_json& data, zone_memory* mem);
+		void parse_script_string(scr_string_t* ptr, const ordered_json& value, zone_memory* mem);
+		scr_string_t* parse_script_strings(const ordered_json& value, std::size_t count, zone_memory* mem);
+		void parse(AnimOverride* asset, const ordered_json& data, zone_memory* mem);
+		void parse(SFXOverride* asset, const ordered_json& data, zone_memory* mem);
+		void parse(VFXOverride* asset, const ordered_json& data, zone_memory* mem);
+		void parse_weapondef(WeaponDef* asset, WeaponCompleteDef* parent, const ordered_json& data, zone_memory* mem);
+		void parse_NoteTrackToSoundEntry(NoteTrackToSoundEntry* asset, const ordered_json& data, zone_memory* mem);
+		void parse_NoteTrackToSuitSoundEntry(NoteTrackToSuitSoundEntry* asset, const ordered_json& data, zone_memory* mem);
+		void parse_complete(WeaponCompleteDef* asset, const ordered_json& data, zone_memory* mem);
 
 		static void dump(AnimOverride* asset, ordered_json& data);
 		static void dump(SFXOverride* asset, ordered_json& data);
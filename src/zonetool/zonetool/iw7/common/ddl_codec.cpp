@@ -0,0 +1,556 @@
+#include "std_include.hpp"
+#include "zonetool/iw7/zonetool.hpp"
+#include "ddl_codec.hpp"
+
+#include "zonetool/iw7/assets/ddl.hpp"
+
+namespace zonetool::iw7
+{
+	namespace ddl_codec
+	{
+		namespace
+		{
+			// version is the first thing in every header
+			constexpr auto header_version_bits = 16u;
+
+			bool is_in_buffer(const std::size_t size, const std::size_t offset, const std::uint32_t count)
+			{
+				return count <= 64 && offset + count <= size * 8;
+			}
+
+			bool read_bits(const std::uint8_t* buffer, const std::size_t size, std::size_t offset, const std::uint32_t count, std::uint64_t* value)
+			{
+				if (!is_in_buffer(size, offset, count))
+				{
+					return false;
+				}
+
+				*value = 0;
+				for (auto done = 0u; done < count;)
+				{
+					const auto shift = static_cast<std::uint32_t>(offset & 7);
+					const auto take = std::min(8 - shift, count - done);
+					*value |= static_cast<std::uint64_t>((buffer[offset >> 3] >> shift) & ((1u << take) - 1)) << done;
+
+					done += take;
+					offset += take;
+				}
+
+				return true;
+			}
+
+			bool write_bits(std::uint8_t* buffer, const std::size_t size, std::size_t offset, const std::uint32_t count, const std::uint64_t value)
+			{
+				if (!is_in_buffer(size, offset, count))
+				{
+					return false;
+				}
+
+				for (auto done = 0u; done < count;)
+				{
+					const auto shift = static_cast<std::uint32_t>(offset & 7);
+					const auto take = std::min(8 - shift, count - done);
+					const auto mask = static_cast<std::uint8_t>(((1u << take) - 1) << shift);
+					const auto bits = static_cast<std::uint8_t>(((value >> done) << shift) & mask);
+					buffer[offset >> 3] = static_cast<std::uint8_t>((buffer[offset >> 3] & ~mask) | bits);
+
+					done += take;
+					offset += take;
+				}
+
+				return true;
+			}
+
+			std::uint64_t get_mask(const std::uint32_t bits)
+			{
+				return bits >= 64 ? std::numeric_limits<std::uint64_t>::max() : (1ull << bits) - 1;
+			}
+
+			std::int64_t sign_extend(const std::uint64_t value, const std::uint32_t bits)
+			{
+				if (!bits || bits >= 64 || !((value >> (bits - 1)) & 1))
+				{
+					return static_cast<std::int64_t>(value);
+				}
+
+				return static_cast<std::int64_t>(value | ~get_mask(bits));
+			}
+
+			std::uint32_t get_element_bits(const DDLMember& member)
+			{
+				return static_cast<std::uint32_t>(member.bitSize / std::max(1, member.arraySize));
+			}
+
+			// sorted by hash, with equal hashes next to each other
+			template <typename F>
+			const DDLHash* find_hash(const DDLHashTable& table, const int count, const std::string_view name, F&& matches)
+			{
+				if (!table.list || count <= 0 || name.empty())
+				{
+					return nullptr;
+				}
+
+				const auto hash = DDL_HashString(name.data(), static_cast<int>(name.size()));
+				const DDLHash* begin = table.list;
+				const auto* end = begin + count;
+				for (auto* entry = std::lower_bound(begin, end, hash, [](const DDLHash& a, const std::uint32_t b)
+				{
+					return a.hash < b;
+				}); entry != end && entry->hash == hash; ++entry)
+				{
+					if (matches(entry->index))
+					{
+						return entry;
+					}
+				}
+
+				return nullptr;
+			}
+		}
+
+		codec::codec(const DDLDef* def)
+			: def_(def)
+		{
+			for (auto i = 0; def && i < def->structCount; i++)
+			{
+				if (def->structList[i].name && def->structList[i].name == "root"sv)
+				{
+					this->root_ = &def->structList[i];
+					break;
+				}
+			}
+		}
+
+		const DDLMember* codec::find_member(const DDLStruct& struct_def, const std::string_view name) const
+		{
+			const auto matches = [&](const int index)
+			{
+				return index >= 0 && index < struct_def.memberCount && struct_def.members[index].name == name;
+			};
+
+			if (const auto* entry = find_hash(struct_def.hashTableUpper, struct_def.hashTableUpper.count, name, matches))
+			{
+				return &struct_def.members[entry->index];
+			}
+
+			// pads are appended to the lower table after it was sorted
+			auto lower_count = struct_def.hashTableLower.count;
+			while (lower_count > 0 && struct_def.members[struct_def.hashTableLower.list[lower_count - 1].index].type == DDL_PAD_TYPE)
+			{
+				lower_count--;
+			}
+
+			if (const auto* entry = find_hash(struct_def.hashTableLower, lower_count, name, matches))
+			{
+				return &struct_def.members[entry->index];
+			}
+
+			return nullptr;
+		}
+
+		std::optional<int> codec::find_array_index(const DDLMember& member, const std::string_view index) const
+		{
+			if (index.empty())
+			{
+				return {};
+			}
+
+			if (std::all_of(index.begin(), index.end(), [](const char c) { return std::isdigit(static_cast<unsigned char>(c)); }))
+			{
+				const auto value = std::atoi(std::string(index).data());
+				return value < member.arraySize ? std::optional(value) : std::nullopt;
+			}
+
+			// arrays sized by an enum are indexed by its member names as well
+			if (member.enumIndex < 0 || member.enumIndex >= this->def_->enumCount)
+			{
+				return {};
+			}
+
+			const auto& enum_def = this->def_->enumList[member.enumIndex];
+			const auto* entry = find_hash(enum_def.hashTable, enum_def.hashTable.count, index, [&](const int i)
+			{
+				return i >= 0 && i < enum_def.memberCount && enum_def.members[i] == index;
+			});
+
+			if (!entry || entry->index >= member.arraySize)
+			{
+				return {};
+			}
+
+			return entry->index;
+		}
+
+		std::optional<codec::location> codec::resolve(const std::string& path) const
+		{
+			if (!this->root_)
+			{
+				return {};
+			}
+
+			const auto* struct_def = this->root_;
+			location location{nullptr, static_cast<std::size_t>(this->def_->headerBitSize), false};
+
+			std::string_view remaining = path;
+			while (true)
+			{
+				const auto end = remaining.find('.');
+				auto token = remaining.substr(0, end);
+
+				std::optional<std::string_view> index;
+				if (const auto bracket = token.find('['); bracket != std::string_view::npos)
+				{
+					if (!token.ends_with(']'))
+					{
+						return {};
+					}
+
+					index = token.substr(bracket + 1, token.size() - bracket - 2);
+					token = token.substr(0, bracket);
+				}
+
+				const auto* member = find_member(*struct_def, token);
+				if (!member)
+				{
+					return {};
+				}
+
+				location.member = member;
+				location.bit_offset += member->offset;
+				location.element = member->arraySize <= 1;
+
+				if (index)
+				{
+					const auto array_index = this->find_array_index(*member, *index);
+					if (!array_index)
+					{
+						return {};
+					}
+
+					location.bit_offset += static_cast<std::size_t>(*array_index) * get_element_bits(*member);
+					location.element = true;
+				}
+
+				if (end == std::string_view::npos)
+				{
+					return location;
+				}
+
+				if (member->type != DDL_STRUCT_TYPE || !location.element || member->externalIndex < 0 || member->externalIndex >= this->def_->structCount)
+				{
+					return {};
+				}
+
+				struct_def = &this->def_->structList[member->externalIndex];
+				remaining = remaining.substr(end + 1);
+			}
+		}
+
+		ordered_json codec::read(const std::uint8_t* buffer, const std::size_t size, const location& location) const
+		{
+			const auto& member = *location.member;
+			const auto bits = get_element_bits(member);
+
+			if (!location.element)
+			{
+				auto array = ordered_json::array();
+				for (auto i = 0; i < member.arraySize; i++)
+				{
+					array.push_back(this->read(buffer, size, {location.member, location.bit_offset + i * bits, true}));
+				}
+
+				return array;
+			}
+
+			if (member.type == DDL_STRUCT_TYPE)
+			{
+				if (member.externalIndex < 0 || member.externalIndex >= this->def_->structCount)
+				{
+					return nullptr;
+				}
+
+				return this->read_struct(buffer, size, this->def_->structList[member.externalIndex], location.bit_offset);
+			}
+
+			if (member.type == DDL_STRING_TYPE)
+			{
+				std::string value;
+				for (auto i = 0u; i < bits / 8; i++)
+				{
+					std::uint64_t c{};
+					if (!read_bits(buffer, size, location.bit_offset + i * 8, 8, &c))
+					{
+						return nullptr;
+					}
+
+					if (!c)
+					{
+						break;
+					}
+
+					value.push_back(static_cast<char>(c));
+				}
+
+				return value;
+			}
+
+			std::uint64_t value{};
+			if (!read_bits(buffer, size, location.bit_offset, bits, &value))
+			{
+				return nullptr;
+			}
+
+			switch (member.type)
+			{
+			case DDL_SHORT_TYPE:
+			case DDL_INT_TYPE:
+				return sign_extend(value, bits);
+			case DDL_FLOAT_TYPE:
+				return std::bit_cast<float>(static_cast<std::uint32_t>(value));
+			case DDL_ENUM_TYPE:
+				if (member.externalIndex >= 0 && member.externalIndex < this->def_->enumCount)
+				{
+					const auto& enum_def = this->def_->enumList[member.externalIndex];
+					if (value < static_cast<std::uint64_t>(enum_def.memberCount))
+					{
+						return enum_def.members[value];
+					}
+				}
+
+				return value;
+			default:
+				return value;
+			}
+		}
+
+		ordered_json codec::read_struct(const std::uint8_t* buffer, const std::size_t size, const DDLStruct& struct_def, const std::size_t bit_offset) const
+		{
+			auto object = ordered_json::object();
+			for (auto i = 0; i < struct_def.memberCount; i++)
+			{
+				const auto& member = struct_def.members[i];
+				if (member.type != DDL_PAD_TYPE)
+				{
+					object[member.name] = this->read(buffer, size, {&member, bit_offset + member.offset, member.arraySize <= 1});
+				}
+			}
+
+			return object;
+		}
+
+		bool codec::write(std::uint8_t* buffer, const std::size_t size, const location& location, const ordered_json& value, const bool apply) const
+		{
+			const auto& member = *location.member;
+			const auto bits = get_element_bits(member);
+
+			// without `apply` every check still runs, only the buffer is left alone
+			const auto put_bits = [&](const std::size_t offset, const std::uint32_t count, const std::uint64_t raw)
+			{
+				return apply ? write_bits(buffer, size, offset, count, raw) : is_in_buffer(size, offset, count);
+			};
+
+			if (!location.element)
+			{
+				if (!value.is_array() || value.size() > static_cast<std::size_t>(member.arraySize))
+				{
+					return false;
+				}
+
+				for (auto i = 0u; i < value.size(); i++)
+				{
+					if (!this->write(buffer, size, {location.member, location.bit_offset + i * bits, true}, value[i], apply))
+					{
+						return false;
+					}
+				}
+
+				return true;
+			}
+
+			if (member.type == DDL_PAD_TYPE)
+			{
+				return false;
+			}
+
+			if (member.type == DDL_STRUCT_TYPE)
+			{
+				if (member.externalIndex < 0 || member.externalIndex >= this->def_->structCount)
+				{
+					return false;
+				}
+
+				return this->write_struct(buffer, size, this->def_->structList[member.externalIndex], location.bit_offset, value, apply);
+			}
+
+			if (member.type == DDL_STRING_TYPE)
+			{
+				// keeps room for the terminator
+				if (!value.is_string() || value.get_ref<const std::string&>().size() >= bits / 8)
+				{
+					return false;
+				}
+
+				const auto& string = value.get_ref<const std::string&>();
+				for (auto i = 0u; i < bits / 8; i++)
+				{
+					const auto c = i < string.size() ? static_cast<std::uint8_t>(string[i]) : 0;
+					if (!put_bits(location.bit_offset + i * 8, 8, c))
+					{
+						return false;
+					}
+				}
+
+				return true;
+			}
+
+			std::uint64_t raw{};
+			if (member.type == DDL_FLOAT_TYPE)
+			{
+				if (!value.is_number())
+				{
+					return false;
+				}
+
+				raw = std::bit_cast<std::uint32_t>(value.get<float>());
+			}
+			else if (member.type == DDL_SHORT_TYPE || member.type == DDL_INT_TYPE)
+			{
+				if (!value.is_number_integer())
+				{
+					return false;
+				}
+
+				const auto signed_value = value.get<std::int64_t>();
+				const auto max = bits >= 64 ? std::numeric_limits<std::int64_t>::max() : static_cast<std::int64_t>(get_mask(bits - 1));
+				if (signed_value > max || signed_value < -max - 1)
+				{
+					return false;
+				}
+
+				raw = static_cast<std::uint64_t>(signed_value) & get_mask(bits);
+			}
+			else
+			{
+				if (member.type == DDL_ENUM_TYPE && value.is_string())
+				{
+					if (member.externalIndex < 0 || member.externalIndex >= this->def_->enumCount)
+					{
+						return false;
+					}
+
+					const auto& enum_def = this->def_->enumList[member.externalIndex];
+					const auto& name = value.get_ref<const std::string&>();
+					const auto* entry = find_hash(enum_def.hashTable, enum_def.hashTable.count, name, [&](const int i)
+					{
+						return i >= 0 && i < enum_def.memberCount && enum_def.members[i] == name;
+					});
+
+					if (!entry)
+					{
+						return false;
+					}
+
+					raw = static_cast<std::uint64_t>(entry->index);
+				}
+				else if (value.is_boolean())
+				{
+					raw = value.get<bool>();
+				}
+				else if (value.is_number_unsigned() || (value.is_number_integer() && value.get<std::int64_t>() >= 0))
+				{
+					raw = value.get<std::uint64_t>();
+				}
+				else
+				{
+					return false;
+				}
+
+				if (raw > get_mask(bits) || (member.type == DDL_UINT_TYPE && member.rangeLimit && raw > member.rangeLimit))
+				{
+					return false;
+				}
+			}
+
+			return put_bits(location.bit_offset, bits, raw);
+		}
+
+		bool codec::write_struct(std::uint8_t* buffer, const std::size_t size, const DDLStruct& struct_def, const std::size_t bit_offset,
+			const ordered_json& value, const bool apply) const
+		{
+			if (!value.is_object())
+			{
+				return false;
+			}
+
+			for (const auto& [name, member_value] : value.items())
+			{
+				const auto* member = this->find_member(struct_def, name);
+				if (!member || !this->write(buffer, size, {member, bit_offset + member->offset, member->arraySize <= 1}, member_value, apply))
+				{
+					return false;
+				}
+			}
+
+			return true;
+		}
+
+		std::optional<ordered_json> codec::get(const std::uint8_t* buffer, const std::size_t size, const std::string& path) const
+		{
+			const auto location = this->resolve(path);
+			if (!location)
+			{
+				return {};
+			}
+
+			return this->read(buffer, size, *location);
+		}
+
+		bool codec::set(std::uint8_t* buffer, const std::size_t size, const std::string& path, const ordered_json& value) const
+		{
+			// the whole value is checked before any of it is written, so a refused value leaves the buffer as it was
+			const auto location = this->resolve(path);
+			return location && this->write(buffer, size, *location, value, false) && this->write(buffer, size, *location, value, true);
+		}
+
+		ordered_json codec::to_json(const std::uint8_t* buffer, const std::size_t size) const
+		{
+			if (!this->root_)
+			{
+				return nullptr;
+			}
+
+			return this->read_struct(buffer, size, *this->root_, this->def_->headerBitSize);
+		}
+
+		bool codec::from_json(const ordered_json& object, std::uint8_t* buffer, const std::size_t size) const
+		{
+			if (!this->root_ || size < static_cast<std::size_t>(this->def_->byteSize))
+			{
+				return false;
+			}
+
+			const auto bit_offset = static_cast<std::size_t>(this->def_->headerBitSize);
+			return this->write_struct(buffer, size, *this->root_, bit_offset, object, false)
+				&& this->write_struct(buffer, size, *this->root_, bit_offset, object, true);
+		}
+
+		const DDLDef* find_def(const DDLFile* file, const std::uint8_t* buffer, const std::size_t size)
+		{
+			std::uint64_t version{};
+			if (!file || !read_bits(buffer, size, 0, header_version_bits, &version))
+			{
+				return nullptr;
+			}
+
+			for (auto* def = file->ddlDef; def; def = def->next)
+			{
+				if (def->version == version)
+				{
+					return def;
+				}
+			}
+
+			return nullptr;
+		}
+	}
+}
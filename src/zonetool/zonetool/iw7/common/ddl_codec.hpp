@@ -0,0 +1,58 @@
+#pragma once
+
+namespace zonetool::iw7
+{
+	namespace ddl_codec
+	{
+		// reads and writes buffers laid out by a DDLDef: the header, then the root struct. values are packed lsb first,
+		// members are found through the hash tables of their struct (and array indices through those of their enum)
+		class codec
+		{
+		public:
+			explicit codec(const DDLDef* def);
+
+			const DDLDef* def() const { return this->def_; }
+
+			// value at a path like "ranked.weapons[3].kills" or "ranked.weapons[iw7_ar57].kills", empty if the path doesn't
+			// resolve. whole arrays come back as arrays and structs as objects
+			std::optional<ordered_json> get(const std::uint8_t* buffer, std::size_t size, const std::string& path) const;
+
+			// writes `value` to a path, false if the path doesn't resolve or the value doesn't fit the member. nothing is
+			// written then, not even the parts of an array or struct value that would fit
+			bool set(std::uint8_t* buffer, std::size_t size, const std::string& path, const ordered_json& value) const;
+
+			// the whole root struct, pads left out
+			ordered_json to_json(const std::uint8_t* buffer, std::size_t size) const;
+
+			// writes every member `object` has over `buffer`, which has to be at least byteSize long. members it
+			// doesn't have are kept, false (with nothing written) if any member doesn't exist or doesn't fit
+			bool from_json(const ordered_json& object, std::uint8_t* buffer, std::size_t size) const;
+
+		private:
+			struct location
+			{
+				const DDLMember* member;
+				std::size_t bit_offset;
+				bool element; // a single element of the member, otherwise the whole array
+			};
+
+			const DDLDef* def_;
+			const DDLStruct* root_ = nullptr;
+
+			const DDLMember* find_member(const DDLStruct& struct_def, std::string_view name) const;
+			std::optional<int> find_array_index(const DDLMember& member, std::string_view index) const;
+			std::optional<location> resolve(const std::string& path) const;
+
+			ordered_json read(const std::uint8_t* buffer, std::size_t size, const location& location) const;
+			ordered_json read_struct(const std::uint8_t* buffer, std::size_t size, const DDLStruct& struct_def, std::size_t bit_offset) const;
+
+			// without `apply` the value is only checked, set and from_json check it all before writing any of it
+			bool write(std::uint8_t* buffer, std::size_t size, const location& location, const ordered_json& value, bool apply) const;
+			bool write_struct(std::uint8_t* buffer, std::size_t size, const DDLStruct& struct_def, std::size_t bit_offset,
+				const ordered_json& value, bool apply) const;
+		};
+
+		// def of `file` the buffer was written with, going by the version in its header
+		const DDLDef* find_def(const DDLFile* file, const std::uint8_t* buffer, std::size_t size);
+	}
+}
@@ -119,7 +119,7 @@ namespace zonetool::iw7
 
 			void dump_streamed_image(zonetool::h1::GfxImage* image, bool is_self = false, bool dump_dds = false)
 			{
-				const auto index = (*g_streamZoneMem)->streamed_image_index;
+				const auto index = dump_stream_file_index;
 				for (auto i = 0u; i < 4; i++)
 				{
 					const auto stream_file = &(*g_streamZoneMem)->streamed_images[index + i];
@@ -220,7 +220,7 @@ namespace zonetool::iw7
 			{
 				if (image->streamed)
 				{
-					dump_streamed_image(image, (*g_streamZoneMem)->streamed_images[(*g_streamZoneMem)->streamed_image_index].fileIndex == 431, true);
+					dump_streamed_image(image, (*g_streamZoneMem)->streamed_images[dump_stream_file_index].fileIndex == 431, true);
 					return;
 				}
 
@@ -380,7 +380,7 @@ namespace zonetool::iw7
 
 				if (asset->streamed)
 				{
-					dump_streamed_image(converted_asset, (*g_streamZoneMem)->streamed_images[(*g_streamZoneMem)->streamed_image_index].fileIndex == 431);
+					dump_streamed_image(converted_asset, (*g_streamZoneMem)->streamed_images[dump_stream_file_index].fileIndex == 431);
 					return;
 				}
 
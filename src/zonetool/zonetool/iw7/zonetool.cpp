@@ -2,9 +2,12 @@
 #include "zonetool.hpp"
 
 #include "converter/converter.hpp"
+#include "common/ddl_codec.hpp"
 
 #include "../utils/gsc.hpp"
 #include "../utils/csv_generator.hpp"
+#include "../utils/dump_queue.hpp"
+#include "../utils/io/dump_store.hpp"
 
 #include <utils/io.hpp>
 #include <utils/flags.hpp>
@@ -20,6 +23,7 @@ namespace zonetool::iw7
 	};
 
 	zonetool_globals_t globals{};
+	dump_queue dump_worker;
 	std::vector<std::pair<XAssetType, std::string>> referenced_assets;
 	std::unordered_set<XAssetType> asset_type_filter;
 
@@ -314,7 +318,39 @@ namespace zonetool::iw7
 			return;
 		}
 
-		dump_func->second(asset);
+		// serialization and disk writes run on the dump worker, the asset stays valid until
+		// db_finish_load_x_file waits for it in stop_dumping. an image's pixel data and stream file
+		// index are only valid while it is being linked though, so the task gets copies of those
+		auto stream_index = 0u;
+		std::shared_ptr<std::vector<std::uint8_t>> pixels;
+		if (asset->type == ASSET_TYPE_IMAGE)
+		{
+			const auto* image = asset->header.image;
+			if (image->streamed)
+			{
+				stream_index = static_cast<unsigned int>((*g_streamZoneMem)->streamed_image_index);
+			}
+
+			if (image->pixelData)
+			{
+				pixels = std::make_shared<std::vector<std::uint8_t>>(image->pixelData, image->pixelData + image->dataLen1);
+			}
+		}
+
+		dump_worker.push([dump = dump_func->second, copy = *asset, stream_index, pixels]() mutable
+		{
+			dump_stream_file_index = stream_index;
+
+			GfxImage image{};
+			if (pixels)
+			{
+				image = *copy.header.image;
+				image.pixelData = pixels->data();
+				copy.header.image = &image;
+			}
+
+			dump(&copy);
+		});
 	}
 
 	void dump_refs()
@@ -377,7 +413,11 @@ namespace zonetool::iw7
 			return;
 		}
 
+		dump_worker.wait();
 		dump_refs();
+		dump_worker.wait();
+
+		filesystem::dump_store::report(filesystem::get_fastfile());
 
 		ZONETOOL_INFO("Zone \"%s\" dumped.", filesystem::get_fastfile().data());
 
@@ -971,6 +1011,99 @@ namespace zonetool::iw7
 		iterate_zones_internal(lang_path);
 	}
 
+	void decode_ddl(const std::string& ddl_name, const std::string& buffer_file, const std::string& json_file)
+	{
+		// takes the loaded ddl over the one on disk, like the game would use
+		zone_memory mem(0x1000000);
+		const auto _0 = gsl::finally([&]
+		{
+			mem.free();
+		});
+
+		auto* file = db_find_x_asset_header(ASSET_TYPE_DDL, ddl_name.data(), false).ddlFile;
+		if (!file && !(file = ddl::parse(ddl_name, &mem)))
+		{
+			ZONETOOL_ERROR("DDL \"%s\" not found", ddl_name.data());
+			return;
+		}
+
+		std::string data{};
+		if (!utils::io::read_file(buffer_file, &data))
+		{
+			ZONETOOL_ERROR("Failed to read \"%s\"", buffer_file.data());
+			return;
+		}
+
+		const auto* buffer = reinterpret_cast<const std::uint8_t*>(data.data());
+		const auto* def = ddl_codec::find_def(file, buffer, data.size());
+		if (!def)
+		{
+			ZONETOOL_ERROR("\"%s\" wasn't written with any version of DDL \"%s\"", buffer_file.data(), ddl_name.data());
+			return;
+		}
+
+		const ddl_codec::codec codec(def);
+		utils::io::write_file(json_file, codec.to_json(buffer, data.size()).dump(4));
+
+		ZONETOOL_INFO("Decoded \"%s\" (version %d) to \"%s\"", buffer_file.data(), def->version, json_file.data());
+	}
+
+	void encode_ddl(const std::string& ddl_name, const std::string& json_file, const std::string& buffer_file)
+	{
+		zone_memory mem(0x1000000);
+		const auto _0 = gsl::finally([&]
+		{
+			mem.free();
+		});
+
+		auto* file = db_find_x_asset_header(ASSET_TYPE_DDL, ddl_name.data(), false).ddlFile;
+		if (!file && !(file = ddl::parse(ddl_name, &mem)))
+		{
+			ZONETOOL_ERROR("DDL \"%s\" not found", ddl_name.data());
+			return;
+		}
+
+		std::string data{};
+		if (!utils::io::read_file(json_file, &data))
+		{
+			ZONETOOL_ERROR("Failed to read \"%s\"", json_file.data());
+			return;
+		}
+
+		const auto object = ordered_json::parse(data, nullptr, false);
+		if (!object.is_object())
+		{
+			ZONETOOL_ERROR("\"%s\" isn't a json object", json_file.data());
+			return;
+		}
+
+		// always written with the newest version
+		const auto* def = file->ddlDef;
+		for (auto* next = def; next; next = next->next)
+		{
+			if (next->version > def->version)
+			{
+				def = next;
+			}
+		}
+
+		std::string buffer(def->byteSize, '\0');
+		buffer[0] = static_cast<char>(def->version & 0xFF);
+		buffer[1] = static_cast<char>(def->version >> 8);
+
+		const ddl_codec::codec codec(def);
+		if (!codec.from_json(object, reinterpret_cast<std::uint8_t*>(buffer.data()), buffer.size()))
+		{
+			ZONETOOL_ERROR("Some members of \"%s\" don't exist in DDL \"%s\" or don't fit their type, nothing was encoded",
+				json_file.data(), ddl_name.data());
+			return;
+		}
+
+		utils::io::write_file(buffer_file, buffer);
+
+		ZONETOOL_INFO("Encoded \"%s\" (version %d) to \"%s\"", json_file.data(), def->version, buffer_file.data());
+	}
+
 	void register_commands()
 	{
 		::iw7::command::add("quit", []()
@@ -1083,6 +1216,7 @@ namespace zonetool::iw7
 			asset.header = header;
 			globals.target_game = game::iw7;
 			dump_asset(&asset);
+			dump_worker.wait();
 
 			ZONETOOL_INFO("Dumped to dump/assets");
 		});
@@ -1119,6 +1253,28 @@ namespace zonetool::iw7
 		{
 			iterate_zones();
 		});
+
+		::iw7::command::add("decodeddl", [](const ::iw7::command::params& params)
+		{
+			if (params.size() != 4)
+			{
+				ZONETOOL_ERROR("usage: decodeddl <ddl> <buffer file> <json file>");
+				return;
+			}
+
+			decode_ddl(params.get(1), params.get(2), params.get(3));
+		});
+
+		::iw7::command::add("encodeddl", [](const ::iw7::command::params& params)
+		{
+			if (params.size() != 4)
+			{
+				ZONETOOL_ERROR("usage: encodeddl <ddl> <json file> <buffer file>");
+				return;
+			}
+
+			encode_ddl(params.get(1), params.get(2), params.get(3));
+		});
 	}
 
 	std::vector<std::string> get_command_line_arguments()
@@ -1148,6 +1304,17 @@ namespace zonetool::iw7
 		auto args = get_command_line_arguments();
 		if (args.size() > 1)
 		{
+			// options for the commands below, regardless of where they appear
+			if (std::find(args.begin(), args.end(), "-dumpstore") != args.end())
+			{
+				filesystem::dump_store::set_shared(true);
+			}
+
+			if (std::find(args.begin(), args.end(), "-dumppack") != args.end())
+			{
+				filesystem::dump_store::set_packed(true);
+			}
+
 			bool do_exit = false;
 
 			for (std::size_t i = 0; i < args.size(); i++)
@@ -490,7 +490,7 @@ namespace zonetool::s1
 	{
 		for (auto i = 0u; i < 4; i++)
 		{
-			const auto stream_file = &stream_files[*stream_file_index + i];
+			const auto stream_file = &stream_files[dump_stream_file_index + i];
 
 			std::string filename = utils::string::va("imagefile%d.pak", stream_file->fileIndex);
 			if (is_self)
@@ -582,7 +582,7 @@ namespace zonetool::s1
 	{
 		if (image->streamed)
 		{
-			dump_streamed_image(image, stream_files[*stream_file_index].fileIndex == 96, true);
+			dump_streamed_image(image, stream_files[dump_stream_file_index].fileIndex == 96, true);
 			return;
 		}
 
@@ -668,7 +668,7 @@ namespace zonetool::s1
 
 		if (asset->streamed)
 		{
-			if (stream_files[*stream_file_index].fileIndex == 96)
+			if (stream_files[dump_stream_file_index].fileIndex == 96)
 			{
 				dump_streamed_image(asset, true);
 				return;
@@ -707,7 +707,7 @@ namespace zonetool::s1
 		{
 			for (auto i = 0u; i < 4; i++)
 			{
-				const auto stream_file = &stream_files[*stream_file_index + i];
+				const auto stream_file = &stream_files[dump_stream_file_index + i];
 				write.dump_single(stream_file);
 			}
 		}
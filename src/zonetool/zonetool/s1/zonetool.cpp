@@ -11,6 +11,8 @@
 
 #include "../utils/gsc.hpp"
 #include "../utils/csv_generator.hpp"
+#include "../utils/dump_queue.hpp"
+#include "../utils/io/dump_store.hpp"
 
 namespace zonetool::s1
 {
@@ -23,6 +25,7 @@ namespace zonetool::s1
 	};
 
 	zonetool_globals_t globals{};
+	dump_queue dump_worker;
 	std::vector<std::pair<XAssetType, std::string>> referenced_assets;
 	std::unordered_set<XAssetType> asset_type_filter;
 
@@ -471,7 +474,39 @@ namespace zonetool::s1
 			return;
 		}
 
-		dump_func->second(asset);
+		// serialization and disk writes run on the dump worker, the asset stays valid until
+		// db_finish_load_x_file waits for it in stop_dumping. an image's pixel data and stream file
+		// index are only valid while it is being linked though, so the task gets copies of those
+		auto stream_index = 0u;
+		std::shared_ptr<std::vector<std::uint8_t>> pixels;
+		if (asset->type == ASSET_TYPE_IMAGE)
+		{
+			const auto* image = asset->header.image;
+			if (image->streamed)
+			{
+				stream_index = *stream_file_index;
+			}
+
+			if (image->pixelData)
+			{
+				pixels = std::make_shared<std::vector<std::uint8_t>>(image->pixelData, image->pixelData + image->dataLen1);
+			}
+		}
+
+		dump_worker.push([dump = dump_func->second, copy = *asset, stream_index, pixels]() mutable
+		{
+			dump_stream_file_index = stream_index;
+
+			GfxImage image{};
+			if (pixels)
+			{
+				image = *copy.header.image;
+				image.pixelData = pixels->data();
+				copy.header.image = &image;
+			}
+
+			dump(&copy);
+		});
 	}
 
 	void dump_refs()
@@ -534,7 +569,12 @@ namespace zonetool::s1
 			return;
 		}
 
+		dump_worker.wait();
 		dump_refs();
+		dump_worker.wait();
+		gsc::wait_for_decompiler();
+
+		filesystem::dump_store::report(filesystem::get_fastfile());
 
 		ZONETOOL_INFO("Zone \"%s\" dumped.", filesystem::get_fastfile().data());
 
@@ -1206,6 +1246,8 @@ namespace zonetool::s1
 			asset.header = header;
 			globals.target_game = game::s1;
 			dump_asset(&asset);
+			dump_worker.wait();
+			gsc::wait_for_decompiler();
 
 			ZONETOOL_INFO("Dumped to dump/assets");
 		});
@@ -1357,6 +1399,17 @@ namespace zonetool::s1
 		auto args = get_command_line_arguments();
 		if (args.size() > 1)
 		{
+			// options for the commands below, regardless of where they appear
+			if (std::find(args.begin(), args.end(), "-dumpstore") != args.end())
+			{
+				filesystem::dump_store::set_shared(true);
+			}
+
+			if (std::find(args.begin(), args.end(), "-dumppack") != args.end())
+			{
+				filesystem::dump_store::set_packed(true);
+			}
+
 			bool do_exit = false;
 
 			for (std::size_t i = 0; i < args.size(); i++)
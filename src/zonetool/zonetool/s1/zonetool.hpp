@@ -73,6 +73,14 @@
 namespace zonetool::s1
 {
 	XAssetHeader db_find_x_asset_header(XAssetType type, const char* name, int create_default);
+
+	// db_find_x_asset_header as a function of the name only, for json_fields::read_asset_header
+	template <XAssetType Type>
+	void* db_find_x_asset_data(const char* name)
+	{
+		return db_find_x_asset_header(Type, name, 1).data;
+	}
+
 	XAssetHeader db_find_x_asset_header_safe(XAssetType type, const std::string& name);
 
 	template <typename T>
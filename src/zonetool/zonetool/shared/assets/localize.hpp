@@ -10,6 +10,77 @@ namespace zonetool
 		S* asset_ = nullptr;
 
 	public:
+		using localized_strings = std::vector<std::pair<std::string, std::string>>;
+
+		// registers the strings of a whole file with the zone in one batch. like adding them one by one, a key repeated
+		// in the file keeps its first value and keys the zone already has keep the value they were added with
+		static void add_localized_strings(zone_base* zone, const std::string& path, const localized_strings& strings)
+		{
+			const auto type = zone->get_type_by_name("localize");
+			if (type == -1)
+			{
+				ZONETOOL_ERROR("Could not translate typename localize to an integer!");
+				return;
+			}
+
+			std::unordered_map<std::string_view, std::size_t> indices;
+			indices.reserve(strings.size());
+
+			std::vector<S> entries;
+			entries.reserve(strings.size());
+
+			std::size_t duplicates = 0;
+			for (const auto& [key, value] : strings)
+			{
+				const auto [index, inserted] = indices.try_emplace(key, entries.size());
+				if (!inserted)
+				{
+					duplicates++;
+					if (value != entries[index->second].value)
+					{
+						ZONETOOL_WARNING("Localized string \"%s\" is defined again with a different value in \"%s\", keeping the first one",
+							key.data(), path.data());
+					}
+
+					continue;
+				}
+
+				S loc{};
+				loc.name = key.data();
+				loc.value = value.data();
+				entries.emplace_back(loc);
+			}
+
+			std::vector<void*> pointers;
+			pointers.reserve(entries.size());
+			for (auto& entry : entries)
+			{
+				pointers.emplace_back(&entry);
+			}
+
+			std::size_t added = 0;
+			try
+			{
+				added = zone->add_assets_of_type_by_pointer(type, pointers);
+			}
+			catch (const std::exception& e)
+			{
+				ZONETOOL_FATAL("A fatal exception occured while adding localizedstrings from file: \"%s\", exception was: \n%s",
+					path.data(), e.what());
+			}
+
+			if (duplicates)
+			{
+				ZONETOOL_WARNING("\"%s\" defines %zu keys more than once", path.data(), duplicates);
+			}
+
+			if (added < entries.size())
+			{
+				ZONETOOL_WARNING("\"%s\" redefines %zu keys that were already added to the zone, their earlier values are kept",
+					path.data(), entries.size() - added);
+			}
+		}
+
 		static bool parse_localizedstrings_json(zone_base* zone, const std::string& file_name)
 		{
 			const auto path = "localizedstrings\\"s + file_name + ".json";
@@ -34,30 +105,16 @@ namespace zonetool
 				return false;
 			}
 
+			localized_strings strings;
+			strings.reserve(localize.size());
+
 			for (const auto& [key, value] : localize.items())
 			{
-				const auto value_str = value.get<std::string>();
-
-				S loc{};
-				loc.name = key.data();
-				loc.value = value_str.data();
-
-				auto type = zone->get_type_by_name("localize");
-				if (type == -1)
-				{
-					ZONETOOL_ERROR("Could not translate typename localize to an integer!");
-				}
-				try
-				{
-					zone->add_asset_of_type_by_pointer(type, &loc);
-				}
-				catch (const std::exception& e)
-				{
-					ZONETOOL_FATAL("A fatal exception occured while adding localizedstring: \"%s\" from file: \"%s\", exception was: \n%s",
-						key.data(), path.data(), e.what());
-				}
+				strings.emplace_back(key, value.get<std::string>());
 			}
 
+			add_localized_strings(zone, path, strings);
+
 			return true;
 		}
 
@@ -86,6 +143,7 @@ namespace zonetool
 				std::string value;
 				size_t line = 0;
 				size_t i = 0;
+				localized_strings strings;
 				while (getline(stringstream, string))
 				{
 					data = string.data();
@@ -184,6 +242,7 @@ namespace zonetool
 							}
 							if (!strncmp(&data[i], "ENDMARKER", 9))
 							{
+								add_localized_strings(zone, path, strings);
 								file.close();
 								return true;
 							}
@@ -192,33 +251,18 @@ namespace zonetool
 					if (failed)
 					{
 						ZONETOOL_WARNING("\"%s\" parse failed at line: %zu index: %zu", path.data(), line, i);
+						add_localized_strings(zone, path, strings);
 						file.close();
 						return false;
 					}
 					if (!name.empty() && !value.empty())
 					{
-						S loc{};
-						loc.name = name.data();
-						loc.value = value.data();
-
-						auto type = zone->get_type_by_name("localize");
-						if (type == -1)
-						{
-							ZONETOOL_ERROR("Could not translate typename localize to an integer!");
-						}
-						try
-						{
-							zone->add_asset_of_type_by_pointer(type, &loc);
-						}
-						catch (std::exception& ex)
-						{
-							ZONETOOL_FATAL("A fatal exception occured while adding localizedstring: \"%s\" from file: \"%s\", exception was: \n%s",
-								name.data(), path.data(), ex.what());
-						}
+						strings.emplace_back(name, value);
 						name.clear();
 						value.clear();
 					}
 				}
+				add_localized_strings(zone, path, strings);
 				file.close();
 				return true;
 			}
@@ -294,6 +338,8 @@ namespace zonetool
 		{
 		}
 
+		void* pointer() override { return asset_; }
+
 		std::string name()
 		{
 			return this->name_;
@@ -9,18 +9,18 @@ namespace zonetool
 		std::string name_;
 		S* asset_ = nullptr;
 
-	public:
-		S* parse(const std::string& name, zone_memory* mem)
+		// set while the script compiles from source, the asset gets its buffer and bytecode in prepare
+		std::shared_future<gsc::compiled_script> compiled_;
+
+		static S* parse_gscbin(const std::string& name, zone_memory* mem)
 		{
 			auto file = filesystem::file(utils::string::va("%s.gscbin", name.data()));
 			file.open("rb");
 			if (!file.get_fp())
 			{
-				ZONETOOL_FATAL("Could not find scriptfile \"%s\"", name.data());
+				return nullptr;
 			}
 
-			ZONETOOL_INFO("Parsing scriptfile \"%s\"...", name.data());
-
 			auto* asset = mem->allocate<S>();
 
 			std::string m_name;
@@ -39,6 +39,78 @@ namespace zonetool
 			return asset;
 		}
 
+		// an include is either a source next to the script, a precompiled script or one the game has loaded
+		std::optional<gsc::include_file> resolve_include(const std::string& name, zone_memory* mem)
+		{
+			auto source = filesystem::file(utils::string::va("%s.gsc", name.data()));
+			source.open("rb");
+			if (source.get_fp())
+			{
+				const auto data = source.read_bytes(source.size());
+				return gsc::include_file{{data.begin(), data.end()}};
+			}
+
+			for (const auto& asset_name : {name, gsc::get_script_asset_name(game::get_mode(), name)})
+			{
+				auto* script = parse_gscbin(asset_name, mem);
+				if (!script && db_find_x_asset_entry<E>(this->type(), asset_name.data()))
+				{
+					script = db_find_x_asset_header_safe<H, E>(this->type(), asset_name).scriptfile;
+				}
+
+				if (script && script->bytecode && script->buffer)
+				{
+					return gsc::include_file{{}, {script->bytecode, static_cast<std::size_t>(script->bytecodeLen)},
+						{script->buffer, static_cast<std::size_t>(script->compressedLen)}};
+				}
+			}
+
+			return {};
+		}
+
+		S* compile(const std::string& name, zone_memory* mem)
+		{
+			auto file = filesystem::file(utils::string::va("%s.gsc", name.data()));
+			file.open("rb");
+			if (!file.get_fp() || !gsc::can_compile(game::get_mode()))
+			{
+				return nullptr;
+			}
+
+			ZONETOOL_INFO("Compiling scriptfile \"%s\"...", name.data());
+
+			const auto data = file.read_bytes(file.size());
+			file.close();
+
+			// every script of the zone is queued before any of them is waited for
+			this->compiled_ = gsc::compile_async(game::get_mode(), name, {data.begin(), data.end()},
+				[&](const std::string& include)
+			{
+				return this->resolve_include(include, mem);
+			});
+
+			auto* asset = mem->allocate<S>();
+			asset->name = mem->duplicate_string(name);
+			return asset;
+		}
+
+	public:
+		S* parse(const std::string& name, zone_memory* mem)
+		{
+			if (auto* asset = parse_gscbin(name, mem))
+			{
+				ZONETOOL_INFO("Parsing scriptfile \"%s\"...", name.data());
+				return asset;
+			}
+
+			if (auto* asset = this->compile(name, mem))
+			{
+				return asset;
+			}
+
+			ZONETOOL_FATAL("Could not find scriptfile \"%s\"", name.data());
+		}
+
 		void init(const std::string& name, zone_memory* mem) override
 		{
 			this->name_ = name;
@@ -59,6 +131,32 @@ namespace zonetool
 
 		void prepare(zone_buffer* buf, zone_memory* mem) override
 		{
+			if (!this->compiled_.valid())
+			{
+				return;
+			}
+
+			const auto& script = this->compiled_.get();
+			if (!script.errors.empty())
+			{
+				for (const auto& error : script.errors)
+				{
+					ZONETOOL_ERROR("%s:%d:%d: %s", error.file.data(), error.line, error.column, error.message.data());
+				}
+
+				ZONETOOL_FATAL("Failed to compile scriptfile \"%s\"", this->name().data());
+			}
+
+			this->asset_->compressedLen = static_cast<int>(script.buffer.size());
+			this->asset_->len = static_cast<int>(script.len);
+			this->asset_->bytecodeLen = static_cast<int>(script.bytecode.size());
+
+			auto* buffer = mem->allocate<char>(script.buffer.size());
+			std::memcpy(buffer, script.buffer.data(), script.buffer.size());
+			this->asset_->buffer = buffer;
+
+			this->asset_->bytecode = mem->allocate<char>(script.bytecode.size());
+			std::memcpy(this->asset_->bytecode, script.bytecode.data(), script.bytecode.size());
 		}
 
 		void load_depending(zone_base* zone) override
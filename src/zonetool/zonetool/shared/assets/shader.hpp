@@ -99,7 +99,7 @@ namespace zonetool
 
 			filesystem::file file(path);
 			file.open("rb");
-			if (!file.get_fp())
+			if (!file.is_open())
 			{
 				return nullptr;
 			}
@@ -15,25 +15,42 @@ namespace zonetool
 	public:
 		S* parse(const std::string& name, zone_memory* mem)
 		{
-			auto table = csv::parser(filesystem::get_file_path(name) + name);
+			string_table_builder table;
+			table.parse_file(filesystem::get_file_path(name) + name);
+
 			auto stringtable = mem->allocate<S>();
 
 			stringtable->name = mem->duplicate_string(name);
-			stringtable->rowCount = static_cast<int>(table.get_num_rows());
-			stringtable->columnCount = static_cast<int>(table.get_max_columns());
+			stringtable->rowCount = table.get_num_rows();
+			stringtable->columnCount = table.get_max_columns();
 			stringtable->values = mem->allocate<StringTableCell>(stringtable->rowCount * stringtable->columnCount);
 
-			auto rows = table.get_rows();
-			for (int row = 0; row < table.get_num_rows(); row++)
+			// every distinct value is copied and hashed once, cells with the same value share it
+			const auto& strings = table.get_strings();
+			std::vector<StringTableCell> pooled(strings.size());
+			for (std::size_t i = 0; i < strings.size(); i++)
+			{
+				pooled[i].string = mem->duplicate_string(strings[i]);
+				pooled[i].hash = string_table_hash(strings[i]);
+			}
+
+			for (int row = 0; row < stringtable->rowCount; row++)
 			{
 				for (int col = 0; col < stringtable->columnCount; col++)
 				{
 					int entry = (row * stringtable->columnCount) + col;
-					stringtable->values[entry].string = mem->duplicate_string(col >= rows[row]->num_fields ? "" : rows[row]->fields[col]);
-					stringtable->values[entry].hash = string_table_hash(stringtable->values[entry].string);
+					stringtable->values[entry] = pooled[table.get_cell(row, col)];
 				}
 			}
 
+			const auto cell_bytes = table.get_cell_bytes();
+			const auto pooled_bytes = table.get_pooled_bytes();
+			if (cell_bytes > pooled_bytes)
+			{
+				ZONETOOL_INFO("Pooled stringtable \"%s\": %zu distinct strings, %zu bytes saved", name.data(),
+					strings.size(), cell_bytes - pooled_bytes);
+			}
+
 			return stringtable;
 		}
 
@@ -93,11 +110,21 @@ namespace zonetool
 
 				if (data->columnCount * data->rowCount > 0)
 				{
+					// each distinct value is written once, the cells repeating it point at the first copy
+					std::unordered_map<std::string_view, const char*> written;
 					for (int i = 0; i < data->columnCount * data->rowCount; i++)
 					{
 						if (data->values[i].string)
 						{
+							auto& pointer = written[data->values[i].string];
+							if (pointer)
+							{
+								destStrings[i].string = pointer;
+								continue;
+							}
+
 							destStrings[i].string = buf->write_str(data->values[i].string);
+							pointer = buf->find_sub_buffer(data->values[i].string);
 						}
 					}
 				}
@@ -18,10 +18,51 @@ namespace zonetool
 
 		virtual void add_asset_of_type_by_pointer(std::int32_t type, void* pointer) = 0;
 
+		// adds every asset the zone doesn't have yet, returns how many were added
+		virtual std::size_t add_assets_of_type_by_pointer(std::int32_t type, const std::vector<void*>& pointers) = 0;
+
 		virtual void add_asset_of_type(const std::string& type, const std::string& name) = 0;
 		virtual void add_asset_of_type(std::int32_t type, const std::string& name) = 0;
 		virtual std::int32_t get_type_by_name(const std::string& type) = 0;
 
 		virtual void build(zone_buffer* buf) = 0;
 	};
+
+	// add_assets_of_type_by_pointer of every game: `add(pointer, name)` is called for each pointer whose name
+	// `assets` doesn't have yet. one pass over the zone for the whole batch, adding them one by one scans it for every asset
+	template <typename Assets, typename GetName, typename Add>
+	std::size_t add_new_assets_by_pointer(Assets& assets, const std::int32_t type, const std::vector<void*>& pointers,
+		GetName&& get_name, Add&& add)
+	{
+		std::unordered_set<std::string> existing;
+		for (const auto& asset : assets)
+		{
+			if (asset->type() == type)
+			{
+				existing.emplace(asset->name());
+			}
+		}
+
+		assets.reserve(assets.size() + pointers.size());
+
+		std::size_t added = 0;
+		for (auto* pointer : pointers)
+		{
+			if (!pointer)
+			{
+				continue;
+			}
+
+			const std::string& name = get_name(pointer);
+			if (!existing.emplace(name).second)
+			{
+				continue;
+			}
+
+			add(pointer, name);
+			added++;
+		}
+
+		return added;
+	}
 }
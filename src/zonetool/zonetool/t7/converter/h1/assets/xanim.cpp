@@ -13,6 +13,160 @@ namespace zonetool::t7
 	{
 		namespace xanim
 		{
+			namespace
+			{
+				// largest angle in degrees a dropped rotation key may differ from its interpolation, 0 keeps all keys
+				std::atomic<float> reduce_tolerance = 0.0f;
+
+				using quat = std::array<float, 4>;
+
+				quat get_quat(const short* key, const int rot_size)
+				{
+					quat q{};
+					if (rot_size == 2)
+					{
+						q[2] = QuatInt16::ToFloat(key[0]);
+						q[3] = QuatInt16::ToFloat(key[1]);
+					}
+					else
+					{
+						for (auto i = 0; i < 4; i++)
+						{
+							q[i] = QuatInt16::ToFloat(key[i]);
+						}
+					}
+
+					return q;
+				}
+
+				quat normalize(const quat& q)
+				{
+					const auto length = std::sqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+					if (length <= 0.0f)
+					{
+						return q;
+					}
+
+					return {q[0] / length, q[1] / length, q[2] / length, q[3] / length};
+				}
+
+				// keys are blended like the game does, a plain lerp of the components that is normalized after
+				quat nlerp(const quat& from, const quat& to, const float frac)
+				{
+					quat q{};
+					for (auto i = 0; i < 4; i++)
+					{
+						q[i] = from[i] + (to[i] - from[i]) * frac;
+					}
+
+					return normalize(q);
+				}
+
+				float get_angle(const quat& a, const quat& b)
+				{
+					const auto dot = std::abs(a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3]);
+					return 2.0f * std::acos(std::min(dot, 1.0f)) * 180.0f / 3.14159265358979323846f;
+				}
+
+				// largest error of the keys between two kept keys when they are interpolated instead
+				float get_segment_error(const std::vector<unsigned short>& frames, const std::vector<quat>& quats, const std::size_t from, const std::size_t to)
+				{
+					auto error = 0.0f;
+					for (auto i = from + 1; i < to; i++)
+					{
+						const auto span = frames[to] - frames[from];
+						const auto frac = span ? static_cast<float>(frames[i] - frames[from]) / static_cast<float>(span) : 0.0f;
+						error = std::max(error, get_angle(nlerp(quats[from], quats[to], frac), quats[i]));
+					}
+
+					return error;
+				}
+
+				// drops the keys of a rotation track that interpolating their neighbours reproduces within the tolerance and
+				// returns the largest error of the dropped keys. the first and last key are always kept, a track that can't
+				// keep `min_key_count` keys within the tolerance is left as is
+				float reduce_track(std::vector<unsigned short>& frames, std::vector<short>& keys, const int rot_size, const std::size_t min_key_count, const float tolerance)
+				{
+					const auto key_count = frames.size();
+					if (key_count <= min_key_count || key_count < 3)
+					{
+						return 0.0f;
+					}
+
+					std::vector<quat> quats(key_count);
+					for (auto i = 0u; i < key_count; i++)
+					{
+						quats[i] = normalize(get_quat(&keys[i * rot_size], rot_size));
+					}
+
+					std::vector<bool> kept(key_count, false);
+					kept.front() = true;
+					kept.back() = true;
+
+					auto anchor = 0u;
+					for (auto end = 2u; end < key_count; end++)
+					{
+						if (get_segment_error(frames, quats, anchor, end) > tolerance)
+						{
+							anchor = end - 1;
+							kept[anchor] = true;
+						}
+					}
+
+					// tracks that store their indices separately need to stay above that threshold
+					auto kept_count = static_cast<std::size_t>(std::count(kept.begin(), kept.end(), true));
+					for (auto i = 1u; i < key_count && kept_count < min_key_count; i++)
+					{
+						if (!kept[i])
+						{
+							kept[i] = true;
+							kept_count++;
+						}
+					}
+
+					if (kept_count == key_count)
+					{
+						return 0.0f;
+					}
+
+					auto error = 0.0f;
+					for (std::size_t from = 0, to = 1; to < key_count; to++)
+					{
+						if (kept[to])
+						{
+							error = std::max(error, get_segment_error(frames, quats, from, to));
+							from = to;
+						}
+					}
+
+					if (error > tolerance)
+					{
+						return 0.0f;
+					}
+
+					std::size_t count = 0;
+					for (auto i = 0u; i < key_count; i++)
+					{
+						if (kept[i])
+						{
+							frames[count] = frames[i];
+							std::memmove(&keys[count * rot_size], &keys[i * rot_size], rot_size * sizeof(short));
+							count++;
+						}
+					}
+
+					frames.resize(count);
+					keys.resize(count * rot_size);
+
+					return error;
+				}
+			}
+
+			void set_reduce_tolerance(const float degrees)
+			{
+				reduce_tolerance = degrees;
+			}
+
 			zonetool::h1::XAnimParts* convert(XAnimParts* asset, utils::memory::allocator& allocator)
 			{
 				using u8 = unsigned char;
@@ -105,11 +259,9 @@ namespace zonetool::t7
 
 					auto readConvert = [&](u16*& dst, u16*& src, u32 count = 1)
 					{
-						for (u32 i = 0; i < count; ++i)
-						{
-							const float hf = half_float::half_to_float(*src++);
-							*dst++ = QuatInt16::ToInt16(hf);
-						}
+						QuatInt16::HalfToInt16(reinterpret_cast<short*>(dst), src, count);
+						dst += count;
+						src += count;
 					};
 
 					auto readRaw = [&](u16*& dst, u16*& src, u32 count = 1)
@@ -123,45 +275,73 @@ namespace zonetool::t7
 					const u32 frameSize = (asset->numframes > 255) ? 2u : 1u;
 					const u32 boneIdSize = (asset->boneCount[TotalBoneCount] > 255) ? 2u : 1u;
 
+					std::vector<u16> frames;
+					std::vector<short> keys;
+
+					u32 originalKeyCount = 0;
+					u32 reducedKeyCount = 0;
+					auto maxError = 0.0f;
+
 					auto processBoneData = [&](int boneCountIndex, int rotSize)
 					{
 						for (int i = 0; i < asset->boneCount[boneCountIndex]; ++i)
 						{
-							const u16 frameCount = *srcShort;
-							readRaw(dstShort, srcShort); // frame count
-							for (int f = 0; f < frameCount + 1; ++f)
+							const u32 frameCount = *srcShort++;
+							const u32 keyCount = frameCount + 1;
+
+							// frame indices of byte sized anims are part of dataByte, only short sized ones can be rebuilt
+							frames.clear();
+							if (frameSize == 2)
 							{
-								if (frameSize == 2)
-								{
-									if (frameCount < 0x40)
-									{
-										readRaw(dstShort, srcShort); // frame index
-									}
-									else
-									{
-										indices.push_back(*srcShort);
-										++srcShort;
-									}
-								}
+								frames.assign(srcShort, srcShort + keyCount);
+								srcShort += keyCount;
+							}
+
+							keys.resize(keyCount * rotSize);
+							QuatInt16::HalfToInt16(keys.data(), srcRand, keyCount * rotSize);
+							srcRand += keyCount * rotSize;
+
+							// byte sized frame indices would need dataByte rebuilt, and translation tracks (below) are quantized against
+							// ranges kept in dataInt/randomDataByte, neither is reduced
+							if (frameSize == 2 && reduce_tolerance > 0.0f)
+							{
+								// tracks keep their index storage, see the rebuild of dataShort below
+								const auto minKeyCount = frameCount < 0x40 ? 2u : 0x41u;
+								const auto error = reduce_track(frames, keys, rotSize, minKeyCount, reduce_tolerance);
+								maxError = std::max(maxError, error);
+							}
+
+							originalKeyCount += keyCount;
+							reducedKeyCount += static_cast<u32>(keys.size() / rotSize);
 
-								readConvert(dstRand, srcRand, rotSize);
+							const u16 newFrameCount = static_cast<u16>(keys.size() / rotSize - 1);
+							*dstShort++ = newFrameCount; // frame count
+
+							if (newFrameCount < 0x40)
+							{
+								dstShort = std::copy(frames.begin(), frames.end(), dstShort); // frame index
 							}
+							else
+							{
+								indices.insert(indices.end(), frames.begin(), frames.end());
+							}
+
+							std::memcpy(dstRand, keys.data(), keys.size() * sizeof(short));
+							dstRand += keys.size();
 						}
 					};
 
 					processBoneData(TwoDRotatedBoneCount, 2);
 					processBoneData(NormalRotatedBoneCount, 4);
 
-					auto processStaticBoneData = [&](int boneCountIndex, int rotSize)
-					{
-						for (int i = 0; i < asset->boneCount[boneCountIndex]; ++i)
-						{
-							readConvert(dstShort, srcShort, rotSize);
-						}
-					};
+					// static rotations follow each other, all of them are converted at once
+					readConvert(dstShort, srcShort, asset->boneCount[TwoDStaticRotatedBoneCount] * 2 + asset->boneCount[NormalStaticRotatedBoneCount] * 4);
 
-					processStaticBoneData(TwoDStaticRotatedBoneCount, 2);
-					processStaticBoneData(NormalStaticRotatedBoneCount, 4);
+					if (reducedKeyCount < originalKeyCount)
+					{
+						ZONETOOL_INFO("Reduced rotation keys of xanim \"%s\" from %u to %u (%.2fx), max error %.3f degrees",
+							asset->name, originalKeyCount, reducedKeyCount, static_cast<float>(originalKeyCount) / reducedKeyCount, maxError);
+					}
 
 					auto processTranslatedBoneData = [&](int boneCountIndex, int translationSize)
 					{
@@ -8,6 +8,10 @@ namespace zonetool::t7
 		{
 			zonetool::h1::XAnimParts* convert(XAnimParts* asset, utils::memory::allocator& allocator);
 			void dump(XAnimParts* asset);
+
+			// drops rotation keys that interpolation reproduces within `degrees` when converting, enabled with -reduceanims.
+			// only applies to animations longer than 255 frames, translation keys are never dropped
+			void set_reduce_tolerance(float degrees);
 		}
 	}
 }
@@ -5,6 +5,9 @@
 
 #include "converter/converter.hpp"
 
+#include "../utils/dump_queue.hpp"
+#include "../utils/io/dump_store.hpp"
+
 #include "common/xpak.hpp"
 
 namespace zonetool::t7
@@ -18,6 +21,7 @@ namespace zonetool::t7
 	};
 
 	zonetool_globals_t globals{};
+	dump_queue dump_worker;
 	std::vector<std::pair<XAssetType, std::string>> referenced_assets;
 	std::unordered_set<XAssetType> asset_type_filter;
 
@@ -274,7 +278,12 @@ namespace zonetool::t7
 			return;
 		}
 
-		dump_func->second(asset);
+		// serialization and disk writes run on the dump worker, the asset stays valid until
+		// db_finish_load_x_file waits for it in stop_dumping
+		dump_worker.push([dump = dump_func->second, copy = *asset]() mutable
+		{
+			dump(&copy);
+		});
 	}
 
 	void dump_refs()
@@ -337,7 +346,11 @@ namespace zonetool::t7
 			return;
 		}
 
+		dump_worker.wait();
 		dump_refs();
+		dump_worker.wait();
+
+		filesystem::dump_store::report(filesystem::get_fastfile());
 
 		ZONETOOL_INFO("Zone \"%s\" dumped.", filesystem::get_fastfile().data());
 
@@ -679,6 +692,7 @@ namespace zonetool::t7
 			asset.header = header;
 			globals.target_game = game::t7;
 			dump_asset(&asset);
+			dump_worker.wait();
 
 			ZONETOOL_INFO("Dumped to dump/assets");
 		});
@@ -738,6 +752,34 @@ namespace zonetool::t7
 		auto args = get_command_line_arguments();
 		if (args.size() > 1)
 		{
+			// options for the commands below, regardless of where they appear
+			if (std::find(args.begin(), args.end(), "-dumpstore") != args.end())
+			{
+				filesystem::dump_store::set_shared(true);
+			}
+
+			if (std::find(args.begin(), args.end(), "-dumppack") != args.end())
+			{
+				filesystem::dump_store::set_packed(true);
+			}
+
+			if (const auto reduce_anims = std::find(args.begin(), args.end(), "-reduceanims"); reduce_anims != args.end())
+			{
+				// takes an optional tolerance in degrees
+				auto tolerance = 0.5f;
+				if (reduce_anims + 1 != args.end())
+				{
+					char* end = nullptr;
+					const auto value = std::strtof((reduce_anims + 1)->data(), &end);
+					if (end && !*end && value > 0.0f)
+					{
+						tolerance = value;
+					}
+				}
+
+				converter::h1::xanim::set_reduce_tolerance(tolerance);
+			}
+
 			for (std::size_t i = 0; i < args.size(); i++)
 			{
 				if (i < args.size() - 1 && i + 1 < args.size())
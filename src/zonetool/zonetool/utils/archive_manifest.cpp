@@ -0,0 +1,409 @@
+#include <std_include.hpp>
+#include "archive_manifest.hpp"
+#include "json_writer.hpp"
+#include "utils.hpp"
+
+#include <utils/io.hpp>
+#include <utils/string.hpp>
+#include <utils/cryptography.hpp>
+
+namespace zonetool::archive_manifest
+{
+	namespace
+	{
+		namespace fs = std::filesystem;
+
+		constexpr auto index_version = 2;
+		constexpr auto index_filename = "manifest_index.json";
+		constexpr auto fragments_folder = "fragments";
+		constexpr auto chunk_prefix = "file_structure_";
+
+		struct zone_record
+		{
+			std::string key;
+			std::string name;
+			std::uint64_t size;
+			std::int64_t mtime;
+			std::uint64_t hash;
+			std::uint64_t fragment_size;
+		};
+
+		struct zone_index
+		{
+			std::unordered_map<std::string, zone_record> zones;
+			std::unordered_map<std::string, std::uint64_t> chunks; // signature of each chunk by its name
+			std::size_t chunk_budget;
+		};
+
+		std::string hex(const std::uint64_t value)
+		{
+			return utils::string::va("%016llX", value);
+		}
+
+		std::uint64_t from_hex(const std::string& value)
+		{
+			return std::strtoull(value.data(), nullptr, 16);
+		}
+
+		std::uint64_t hash_file(const fs::path& path)
+		{
+			std::ifstream stream(path, std::ios::binary);
+			if (!stream.is_open())
+			{
+				return 0;
+			}
+
+			auto hash = utils::cryptography::fnv1a::offset_basis;
+			std::vector<char> buffer(4 * 1024 * 1024);
+
+			while (stream)
+			{
+				stream.read(buffer.data(), buffer.size());
+				const auto count = static_cast<std::size_t>(stream.gcount());
+				if (count == 0)
+				{
+					break;
+				}
+
+				hash = utils::cryptography::fnv1a::compute(buffer.data(), count, hash);
+			}
+
+			return hash;
+		}
+
+		fs::path get_fragment_path(const settings& settings, const std::string& key)
+		{
+			const auto name = hex(utils::cryptography::fnv1a::compute(key)) + ".json";
+			return settings.output_folder / fragments_folder / name;
+		}
+
+		// numbered from 1 in zone order, like the chunks were before the index existed
+		std::string get_chunk_name(const std::size_t index)
+		{
+			return utils::string::va("%s%03zu", chunk_prefix, index + 1);
+		}
+
+		fs::path get_chunk_path(const settings& settings, const std::string& name)
+		{
+			return settings.output_folder / (name + ".json");
+		}
+
+		zone_index load_index(const settings& settings)
+		{
+			zone_index index{};
+
+			std::string data;
+			if (settings.force || !utils::io::read_file((settings.output_folder / index_filename).string(), &data))
+			{
+				return index;
+			}
+
+			const auto json = nlohmann::json::parse(data, nullptr, false);
+			if (json.is_discarded() || json.value("version", 0) != index_version)
+			{
+				ZONETOOL_WARNING("Archive index is missing or outdated, regenerating all zones");
+				return index;
+			}
+
+			try
+			{
+				index.chunk_budget = json.value("chunk_budget", 0ull);
+
+				for (const auto& [key, entry] : json.at("zones").items())
+				{
+					zone_record record{};
+					record.key = key;
+					record.name = entry.at("name").get<std::string>();
+					record.size = entry.at("size").get<std::uint64_t>();
+					record.mtime = entry.at("mtime").get<std::int64_t>();
+					record.hash = from_hex(entry.at("hash").get<std::string>());
+					record.fragment_size = entry.at("fragment_size").get<std::uint64_t>();
+					index.zones.emplace(key, std::move(record));
+				}
+
+				for (const auto& [name, signature] : json.at("chunks").items())
+				{
+					index.chunks.emplace(name, from_hex(signature.get<std::string>()));
+				}
+			}
+			catch (const std::exception& e)
+			{
+				ZONETOOL_WARNING("Archive index is damaged (%s), regenerating all zones", e.what());
+				return zone_index{};
+			}
+
+			return index;
+		}
+
+		void save_index(const settings& settings, const std::vector<zone_record>& zones,
+			const std::vector<std::pair<std::string, std::uint64_t>>& chunks)
+		{
+			const auto path = settings.output_folder / index_filename;
+			const auto fp = std::fopen(path.string().data(), "wb");
+			if (!fp)
+			{
+				ZONETOOL_ERROR("Failed to write archive index: %s", path.string().data());
+				return;
+			}
+
+			{
+				json_writer writer(fp);
+				writer.begin_object();
+				writer.key("version").value(static_cast<std::uint64_t>(index_version));
+				writer.key("chunk_budget").value(static_cast<std::uint64_t>(settings.chunk_budget));
+
+				writer.key("zones").begin_object();
+				for (const auto& zone : zones)
+				{
+					writer.newline();
+					writer.key(zone.key).begin_object();
+					writer.key("name").value(zone.name);
+					writer.key("size").value(zone.size);
+					writer.key("mtime").raw(std::to_string(zone.mtime));
+					writer.key("hash").value(hex(zone.hash));
+					writer.key("fragment_size").value(zone.fragment_size);
+					writer.end_object();
+				}
+				writer.end_object();
+
+				writer.key("chunks").begin_object();
+				for (const auto& [name, signature] : chunks)
+				{
+					writer.key(name).value(hex(signature));
+				}
+				writer.end_object();
+				writer.end_object();
+			}
+
+			std::fclose(fp);
+		}
+
+		std::uint64_t write_fragment(const settings& settings, const zone_record& record,
+			const std::vector<asset_entry>& assets)
+		{
+			json_writer writer;
+			writer.begin_object();
+			writer.key("name").value(record.name);
+			writer.key("children").begin_array();
+
+			std::string path;
+			for (const auto& asset : assets)
+			{
+				path.clear();
+				path.append(record.name).append("/").append(asset.type).append("/").append(asset.name);
+
+				writer.begin_object();
+				writer.key("name").value(asset.name);
+				writer.key("path").value(path);
+				writer.end_object();
+			}
+
+			writer.end_array();
+			writer.end_object();
+
+			const auto& data = writer.get_buffer();
+			utils::io::write_file(get_fragment_path(settings, record.key).string(), data);
+			return data.size();
+		}
+
+		// cut chunks once they reach the byte budget, or past half of it at zone-dependent boundaries,
+		// so inserting or removing a zone only shifts the boundaries of the chunks around it
+		std::vector<std::pair<std::size_t, std::size_t>> partition_chunks(const std::vector<zone_record>& zones,
+			const std::size_t budget)
+		{
+			std::vector<std::pair<std::size_t, std::size_t>> chunks;
+
+			std::size_t start = 0;
+			std::size_t size = 0;
+			for (auto i = 0u; i < zones.size(); i++)
+			{
+				size += zones[i].fragment_size + 1;
+
+				const auto boundary = (utils::cryptography::fnv1a::compute(zones[i].key) & 3) == 0;
+				if (size >= budget || (size >= budget / 2 && boundary))
+				{
+					chunks.emplace_back(start, i + 1);
+					start = i + 1;
+					size = 0;
+				}
+			}
+
+			if (start < zones.size())
+			{
+				chunks.emplace_back(start, zones.size());
+			}
+
+			return chunks;
+		}
+
+		bool write_chunk(const settings& settings, const std::vector<zone_record>& zones,
+			const std::size_t begin, const std::size_t end, const std::string& name)
+		{
+			const auto path = get_chunk_path(settings, name);
+			const auto fp = std::fopen(path.string().data(), "wb");
+			if (!fp)
+			{
+				return false;
+			}
+
+			{
+				json_writer writer(fp);
+				writer.begin_object();
+				writer.key("zones").begin_array();
+
+				std::string fragment;
+				for (auto i = begin; i < end; i++)
+				{
+					if (!utils::io::read_file(get_fragment_path(settings, zones[i].key).string(), &fragment))
+					{
+						ZONETOOL_ERROR("Missing fragment for zone \"%s\"", zones[i].key.data());
+						continue;
+					}
+
+					writer.newline();
+					writer.raw(fragment);
+				}
+
+				writer.newline();
+				writer.end_array();
+				writer.end_object();
+				writer.newline();
+			}
+
+			std::fclose(fp);
+			return true;
+		}
+	}
+
+	statistics generate(const std::vector<std::filesystem::path>& zones, const settings& settings,
+		const enumerate_callback& enumerate)
+	{
+		statistics stats{};
+		stats.zones_total = zones.size();
+
+		fs::create_directories(settings.output_folder / fragments_folder);
+
+		auto index = load_index(settings);
+
+		std::vector<zone_record> records;
+		records.reserve(zones.size());
+
+		for (const auto& zone : zones)
+		{
+			std::error_code ec;
+			zone_record record{};
+			record.key = zone.generic_string();
+			record.name = zone.stem().string();
+			record.size = fs::file_size(zone, ec);
+			record.mtime = fs::last_write_time(zone, ec).time_since_epoch().count();
+
+			const auto previous = index.zones.find(record.key);
+			const auto has_previous = previous != index.zones.end() &&
+				fs::exists(get_fragment_path(settings, record.key));
+
+			if (has_previous && previous->second.size == record.size && previous->second.mtime == record.mtime)
+			{
+				record.hash = previous->second.hash;
+				record.fragment_size = previous->second.fragment_size;
+				records.emplace_back(std::move(record));
+				stats.zones_reused++;
+				continue;
+			}
+
+			record.hash = hash_file(zone);
+
+			if (has_previous && previous->second.hash == record.hash)
+			{
+				record.fragment_size = previous->second.fragment_size;
+				records.emplace_back(std::move(record));
+				stats.zones_reused++;
+				continue;
+			}
+
+			ZONETOOL_INFO("Archiving zone %zu/%zu: \"%s\"", records.size() + 1, zones.size(), record.name.data());
+
+			const auto assets = enumerate(zone);
+			record.fragment_size = write_fragment(settings, record, assets);
+			records.emplace_back(std::move(record));
+			stats.zones_enumerated++;
+		}
+
+		// drop fragments of zones that no longer exist
+		std::unordered_set<std::string> current_keys;
+		for (const auto& record : records)
+		{
+			current_keys.insert(record.key);
+		}
+
+		for (const auto& [key, _] : index.zones)
+		{
+			if (!current_keys.contains(key))
+			{
+				std::error_code ec;
+				fs::remove(get_fragment_path(settings, key), ec);
+				stats.zones_removed++;
+			}
+		}
+
+		const auto chunks = partition_chunks(records, settings.chunk_budget);
+		const auto same_budget = index.chunk_budget == settings.chunk_budget;
+
+		std::vector<std::pair<std::string, std::uint64_t>> signatures;
+		signatures.reserve(chunks.size());
+
+		std::unordered_set<std::string> chunk_names;
+
+		for (auto i = 0u; i < chunks.size(); i++)
+		{
+			const auto [begin, end] = chunks[i];
+			const auto name = get_chunk_name(i);
+			chunk_names.insert(name);
+
+			auto signature = utils::cryptography::fnv1a::offset_basis;
+			for (auto o = begin; o < end; o++)
+			{
+				signature = utils::cryptography::fnv1a::compute(records[o].key, signature);
+				signature = utils::cryptography::fnv1a::compute(&records[o].hash, sizeof(std::uint64_t), signature);
+			}
+
+			signatures.emplace_back(name, signature);
+
+			const auto previous = index.chunks.find(name);
+			if (same_budget && previous != index.chunks.end() && previous->second == signature &&
+				fs::exists(get_chunk_path(settings, name)))
+			{
+				continue;
+			}
+
+			if (!write_chunk(settings, records, begin, end, name))
+			{
+				ZONETOOL_ERROR("Failed to write chunk file: %s", get_chunk_path(settings, name).string().data());
+				signatures.back().second = 0;
+				continue;
+			}
+
+			stats.chunks_written++;
+		}
+
+		// chunks past the last one, and ones named by an older index layout
+		std::error_code ec;
+		for (const auto& entry : fs::directory_iterator(settings.output_folder, ec))
+		{
+			const auto stem = entry.path().stem().string();
+			if (entry.is_regular_file() && entry.path().extension() == ".json" && stem.starts_with(chunk_prefix) &&
+				!chunk_names.contains(stem))
+			{
+				std::error_code remove_ec;
+				if (fs::remove(entry.path(), remove_ec))
+				{
+					stats.chunks_removed++;
+				}
+			}
+		}
+
+		stats.chunks_total = chunks.size();
+		save_index(settings, records, signatures);
+
+		return stats;
+	}
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace zonetool::archive_manifest
+{
+	struct asset_entry
+	{
+		std::string type;
+		std::string name;
+	};
+
+	// loads the zone and returns every asset it contains
+	using enumerate_callback = std::function<std::vector<asset_entry>(const std::filesystem::path& zone)>;
+
+	struct settings
+	{
+		std::filesystem::path output_folder;
+		std::size_t chunk_budget = 4ull * 1024 * 1024; // target size of a chunk file in bytes
+		bool force = false; // ignore the sidecar index and re-enumerate everything
+	};
+
+	struct statistics
+	{
+		std::size_t zones_total;
+		std::size_t zones_enumerated;
+		std::size_t zones_reused;
+		std::size_t zones_removed;
+		std::size_t chunks_total;
+		std::size_t chunks_written;
+		std::size_t chunks_removed;
+	};
+
+	statistics generate(const std::vector<std::filesystem::path>& zones, const settings& settings,
+		const enumerate_callback& enumerate);
+}
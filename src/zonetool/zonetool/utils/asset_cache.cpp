@@ -0,0 +1,121 @@
+#include <std_include.hpp>
+#include "asset_cache.hpp"
+
+#include "utils.hpp"
+
+#include <utils/cryptography.hpp>
+
+namespace zonetool::asset_cache
+{
+	namespace
+	{
+		constexpr auto cache_path = "dump\\_cache\\assets\\";
+
+		// bump when the key layout changes, older cache entries are ignored then
+		constexpr auto cache_version = 1u;
+
+		std::atomic_bool cache_enabled = false;
+
+		struct counter
+		{
+			std::atomic_uint64_t count;
+			std::atomic_int64_t time;
+
+			void add(const std::chrono::steady_clock::duration duration)
+			{
+				this->count++;
+				this->time += std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+			}
+
+			// total and average milliseconds
+			std::pair<double, double> get_times() const
+			{
+				const auto total = static_cast<double>(this->time.load()) / 1000.0;
+				return {total, this->count ? total / static_cast<double>(this->count) : 0.0};
+			}
+
+			void reset()
+			{
+				this->count = 0;
+				this->time = 0;
+			}
+		};
+
+		counter hits;
+		counter misses;
+	}
+
+	void set_enabled(const bool enabled)
+	{
+		cache_enabled = enabled;
+	}
+
+	bool is_enabled()
+	{
+		return cache_enabled;
+	}
+
+	std::string get_entry(const char* kind, const std::uint32_t version, const std::string& name, const std::vector<std::uint8_t>& source)
+	{
+		if (!cache_enabled)
+		{
+			return {};
+		}
+
+		std::string data;
+		data.reserve(source.size() + name.size() + 64);
+		data.append(std::to_string(cache_version)).push_back('\0');
+		data.append(std::to_string(version)).push_back('\0');
+		data.append(name).push_back('\0');
+		data.append(reinterpret_cast<const char*>(source.data()), source.size());
+
+		return cache_path + std::string(kind) + "\\" + utils::cryptography::sha1::compute(data, true) + ".bin";
+	}
+
+	void store(const std::string& entry, const std::function<bool(const std::string& path)>& write)
+	{
+		if (entry.empty())
+		{
+			return;
+		}
+
+		std::error_code ec;
+		std::filesystem::create_directories(std::filesystem::path(entry).parent_path(), ec);
+
+		// written next to the entry first, a build running in parallel never reads half an entry
+		const auto staged = entry + "." + std::to_string(GetCurrentThreadId()) + ".tmp";
+		if (!write(staged))
+		{
+			std::filesystem::remove(staged, ec);
+			ZONETOOL_WARNING("Failed to write asset cache entry \"%s\"", entry.data());
+			return;
+		}
+
+		std::filesystem::rename(staged, entry, ec);
+		if (ec)
+		{
+			std::filesystem::remove(staged, ec);
+		}
+	}
+
+	void add_result(const bool hit, const std::chrono::steady_clock::duration time)
+	{
+		(hit ? hits : misses).add(time);
+	}
+
+	void report()
+	{
+		if (!cache_enabled || (!hits.count && !misses.count))
+		{
+			return;
+		}
+
+		const auto [hit_time, hit_average] = hits.get_times();
+		const auto [miss_time, miss_average] = misses.get_times();
+		ZONETOOL_INFO("Asset cache: %llu hits in %.1f ms (%.2f ms each), %llu misses parsed and stored in %.1f ms (%.2f ms each)",
+			hits.count.load(), hit_time, hit_average, misses.count.load(), miss_time, miss_average);
+
+		hits.reset();
+		misses.reset();
+	}
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace zonetool::asset_cache
+{
+	// parsed assets are kept in their binary dump form in dump\_cache\assets\, enabled with -assetcache
+	void set_enabled(bool enabled);
+	bool is_enabled();
+
+	// returns the cache entry path for an asset parsed from `source`, empty when caching is disabled.
+	// `version` has to be bumped whenever the parser or the binary layout of that asset kind changes
+	std::string get_entry(const char* kind, std::uint32_t version, const std::string& name, const std::vector<std::uint8_t>& source);
+
+	// writes an entry through `write`, which gets the path to write to. the entry only shows up once it is complete
+	void store(const std::string& entry, const std::function<bool(const std::string& path)>& write);
+
+	// counts an asset that was read from its entry (hit) or parsed from source and stored (miss), with the time it took
+	void add_result(bool hit, std::chrono::steady_clock::duration time);
+
+	// logs the hits and misses since the last report, so a cold and a warm build of a zone can be compared
+	void report();
+}
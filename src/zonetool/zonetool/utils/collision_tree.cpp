@@ -0,0 +1,398 @@
+#include <std_include.hpp>
+#include "collision_tree.hpp"
+
+#include "utils.hpp"
+
+#include <array>
+
+namespace zonetool::collision_tree
+{
+	namespace
+	{
+		constexpr auto bin_count = 16u;
+
+		// leafs up to this size are fine when splitting them doesn't pay off
+		constexpr auto max_leaf_tri_count = 8u;
+
+		// cost of visiting a node relative to testing a triangle
+		constexpr auto traversal_cost = 1.0f;
+
+		constexpr auto max_quantized = static_cast<float>(std::numeric_limits<std::uint16_t>::max());
+
+		std::atomic_bool build_enabled = false;
+
+		struct bounds
+		{
+			std::array<float, 3> mins{
+				std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max()};
+			std::array<float, 3> maxs{
+				std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest()};
+
+			void add(const float* point)
+			{
+				for (auto i = 0; i < 3; i++)
+				{
+					this->mins[i] = std::min(this->mins[i], point[i]);
+					this->maxs[i] = std::max(this->maxs[i], point[i]);
+				}
+			}
+
+			void add(const bounds& other)
+			{
+				for (auto i = 0; i < 3; i++)
+				{
+					this->mins[i] = std::min(this->mins[i], other.mins[i]);
+					this->maxs[i] = std::max(this->maxs[i], other.maxs[i]);
+				}
+			}
+
+			bool empty() const
+			{
+				return this->mins[0] > this->maxs[0];
+			}
+
+			float area() const
+			{
+				if (this->empty())
+				{
+					return 0.0f;
+				}
+
+				const auto x = this->maxs[0] - this->mins[0];
+				const auto y = this->maxs[1] - this->mins[1];
+				const auto z = this->maxs[2] - this->mins[2];
+				return 2.0f * (x * y + y * z + z * x);
+			}
+		};
+
+		const float* get_position(const mesh& mesh, const std::size_t vertex)
+		{
+			return reinterpret_cast<const float*>(reinterpret_cast<const std::uint8_t*>(mesh.positions) + vertex * mesh.position_stride);
+		}
+
+		float quantize(const float value, const float trans, const float scale)
+		{
+			return (value + trans) * scale;
+		}
+
+		struct split
+		{
+			float cost = std::numeric_limits<float>::max();
+			std::uint32_t axis = 0;
+			float position = 0.0f;
+		};
+
+		// best of the bin boundaries on all axes, the triangles go left when their centroid is below the position
+		split find_split(const std::vector<bounds>& tri_bounds, const std::vector<std::array<float, 3>>& centroids,
+			const std::uint32_t* tris, const std::size_t count, const float parent_area)
+		{
+			bounds centroid_bounds;
+			for (auto i = 0u; i < count; i++)
+			{
+				centroid_bounds.add(centroids[tris[i]].data());
+			}
+
+			split best;
+			for (auto axis = 0u; axis < 3; axis++)
+			{
+				const auto min = centroid_bounds.mins[axis];
+				const auto extent = centroid_bounds.maxs[axis] - min;
+				if (extent <= 0.0f)
+				{
+					continue;
+				}
+
+				std::array<bounds, bin_count> bins;
+				std::array<std::size_t, bin_count> bin_tri_counts{};
+
+				const auto bin_scale = bin_count / extent;
+				for (auto i = 0u; i < count; i++)
+				{
+					const auto bin = std::min(bin_count - 1, static_cast<std::uint32_t>((centroids[tris[i]][axis] - min) * bin_scale));
+					bins[bin].add(tri_bounds[tris[i]]);
+					bin_tri_counts[bin]++;
+				}
+
+				// areas and counts right of each boundary, then sweep from the left
+				std::array<float, bin_count> right_areas{};
+				std::array<std::size_t, bin_count> right_counts{};
+				bounds right;
+				std::size_t right_count = 0;
+				for (auto b = bin_count - 1; b > 0; b--)
+				{
+					right.add(bins[b]);
+					right_count += bin_tri_counts[b];
+					right_areas[b] = right.area();
+					right_counts[b] = right_count;
+				}
+
+				bounds left;
+				std::size_t left_count = 0;
+				for (auto b = 1u; b < bin_count; b++)
+				{
+					left.add(bins[b - 1]);
+					left_count += bin_tri_counts[b - 1];
+					if (!left_count || !right_counts[b])
+					{
+						continue;
+					}
+
+					const auto cost = traversal_cost + (left.area() * left_count + right_areas[b] * right_counts[b]) / parent_area;
+					if (cost < best.cost)
+					{
+						best.cost = cost;
+						best.axis = axis;
+						best.position = min + b / bin_scale;
+					}
+				}
+			}
+
+			return best;
+		}
+	}
+
+	void set_enabled(const bool enabled)
+	{
+		build_enabled = enabled;
+	}
+
+	bool is_enabled()
+	{
+		return build_enabled;
+	}
+
+	std::optional<tree> build(const mesh& mesh)
+	{
+		if (!mesh.tri_count || mesh.tri_count > std::numeric_limits<std::uint16_t>::max())
+		{
+			return {};
+		}
+
+		std::vector<bounds> tri_bounds(mesh.tri_count);
+		std::vector<std::array<float, 3>> centroids(mesh.tri_count);
+		bounds mesh_bounds;
+
+		for (auto t = 0u; t < mesh.tri_count; t++)
+		{
+			for (auto c = 0u; c < 3; c++)
+			{
+				const auto vertex = mesh.indices[t * 3 + c];
+				if (vertex >= mesh.vertex_count)
+				{
+					return {};
+				}
+
+				tri_bounds[t].add(get_position(mesh, vertex));
+			}
+
+			for (auto i = 0; i < 3; i++)
+			{
+				centroids[t][i] = (tri_bounds[t].mins[i] + tri_bounds[t].maxs[i]) * 0.5f;
+			}
+
+			mesh_bounds.add(tri_bounds[t]);
+		}
+
+		tree tree{};
+		for (auto i = 0; i < 3; i++)
+		{
+			const auto extent = mesh_bounds.maxs[i] - mesh_bounds.mins[i];
+			tree.trans[i] = -mesh_bounds.mins[i];
+			tree.scale[i] = extent > 0.0f ? max_quantized / extent : 0.0f;
+		}
+
+		tree.triangle_order.resize(mesh.tri_count);
+		for (auto t = 0u; t < mesh.tri_count; t++)
+		{
+			tree.triangle_order[t] = t;
+		}
+
+		struct task
+		{
+			std::size_t node;
+			std::uint32_t begin;
+			std::uint32_t end;
+		};
+
+		// depth first with the left child on top, leafs come out in triangle order that way
+		std::vector<task> stack = {{0, 0, static_cast<std::uint32_t>(mesh.tri_count)}};
+		tree.nodes.emplace_back();
+
+		while (!stack.empty())
+		{
+			const auto [node_index, begin, end] = stack.back();
+			stack.pop_back();
+
+			auto* tris = tree.triangle_order.data() + begin;
+			const auto count = end - begin;
+
+			bounds node_bounds;
+			for (auto i = 0u; i < count; i++)
+			{
+				node_bounds.add(tri_bounds[tris[i]]);
+			}
+
+			auto& node = tree.nodes[node_index];
+			for (auto i = 0; i < 3; i++)
+			{
+				node.mins[i] = static_cast<std::uint16_t>(std::clamp(std::floor(quantize(node_bounds.mins[i], tree.trans[i], tree.scale[i])), 0.0f, max_quantized));
+				node.maxs[i] = static_cast<std::uint16_t>(std::clamp(std::ceil(quantize(node_bounds.maxs[i], tree.trans[i], tree.scale[i])), 0.0f, max_quantized));
+			}
+
+			auto middle = begin;
+			if (count > 2)
+			{
+				const auto split = find_split(tri_bounds, centroids, tris, count, std::max(node_bounds.area(), std::numeric_limits<float>::min()));
+				if (split.cost < static_cast<float>(count) || count > max_leaf_tri_count)
+				{
+					if (split.cost < std::numeric_limits<float>::max())
+					{
+						middle = static_cast<std::uint32_t>(std::partition(tris, tris + count, [&](const std::uint32_t t)
+						{
+							return centroids[t][split.axis] < split.position;
+						}) - tree.triangle_order.data());
+					}
+
+					// every centroid is in the same spot, halve the leaf anyway
+					if ((middle == begin || middle == end) && count > max_leaf_tri_count)
+					{
+						middle = begin + count / 2;
+					}
+				}
+			}
+
+			if (middle == begin || middle == end)
+			{
+				if (tree.leafs.size() >= std::numeric_limits<std::uint16_t>::max())
+				{
+					return {};
+				}
+
+				node.child_begin = static_cast<std::uint16_t>(tree.leafs.size());
+				node.child_count = 0;
+				tree.leafs.emplace_back(static_cast<std::uint16_t>(begin));
+				continue;
+			}
+
+			const auto child_begin = tree.nodes.size();
+			if (child_begin + 2 > std::numeric_limits<std::uint16_t>::max())
+			{
+				return {};
+			}
+
+			node.child_begin = static_cast<std::uint16_t>(child_begin);
+			node.child_count = 2;
+			tree.nodes.resize(child_begin + 2);
+
+			stack.push_back({child_begin + 1, middle, end});
+			stack.push_back({child_begin, begin, middle});
+		}
+
+		tree.leafs.emplace_back(static_cast<std::uint16_t>(mesh.tri_count));
+		return tree;
+	}
+
+	bool validate(const mesh& mesh, const float* trans, const float* scale, const node* nodes, const std::size_t node_count,
+		const std::uint16_t* leafs, const std::size_t leaf_count)
+	{
+		if (!nodes || !node_count || !leafs || leaf_count < 2 || leafs[leaf_count - 1] != mesh.tri_count)
+		{
+			return false;
+		}
+
+		const auto contains = [&](const node& outer, const node& inner)
+		{
+			for (auto i = 0; i < 3; i++)
+			{
+				if (inner.mins[i] < outer.mins[i] || inner.maxs[i] > outer.maxs[i])
+				{
+					return false;
+				}
+			}
+
+			return true;
+		};
+
+		// one quantization step of slack for the rounding of either side
+		const auto contains_point = [&](const node& node, const float* point)
+		{
+			for (auto i = 0; i < 3; i++)
+			{
+				const auto value = quantize(point[i], trans[i], scale[i]);
+				if (value < node.mins[i] - 1.0f || value > node.maxs[i] + 1.0f)
+				{
+					return false;
+				}
+			}
+
+			return true;
+		};
+
+		std::vector<bool> node_visited(node_count, false);
+		std::vector<bool> leaf_visited(leaf_count - 1, false);
+		std::vector<bool> tri_covered(mesh.tri_count, false);
+
+		// children have to lie inside their parent, so the triangles of a leaf lie inside every node above it
+		std::vector<std::size_t> stack = {0};
+		node_visited[0] = true;
+
+		while (!stack.empty())
+		{
+			const auto& node = nodes[stack.back()];
+			stack.pop_back();
+
+			if (node.child_count)
+			{
+				if (node.child_begin + node.child_count > node_count)
+				{
+					return false;
+				}
+
+				for (auto i = 0u; i < node.child_count; i++)
+				{
+					const auto child = node.child_begin + i;
+					if (node_visited[child] || !contains(node, nodes[child]))
+					{
+						return false;
+					}
+
+					node_visited[child] = true;
+					stack.emplace_back(child);
+				}
+
+				continue;
+			}
+
+			const auto leaf = node.child_begin;
+			if (leaf + 1u >= leaf_count || leaf_visited[leaf] || leafs[leaf] > leafs[leaf + 1] || leafs[leaf + 1] > mesh.tri_count)
+			{
+				return false;
+			}
+
+			leaf_visited[leaf] = true;
+
+			for (auto t = leafs[leaf]; t < leafs[leaf + 1]; t++)
+			{
+				if (tri_covered[t])
+				{
+					return false;
+				}
+
+				tri_covered[t] = true;
+
+				for (auto c = 0u; c < 3; c++)
+				{
+					const auto vertex = mesh.indices[t * 3 + c];
+					if (vertex >= mesh.vertex_count || !contains_point(node, get_position(mesh, vertex)))
+					{
+						return false;
+					}
+				}
+			}
+		}
+
+		return std::ranges::all_of(node_visited, [](const bool visited) { return visited; })
+			&& std::ranges::all_of(leaf_visited, [](const bool visited) { return visited; })
+			&& std::ranges::all_of(tri_covered, [](const bool covered) { return covered; });
+	}
+}
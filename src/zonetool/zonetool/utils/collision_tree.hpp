@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace zonetool::collision_tree
+{
+	// building trees for rigid vertex lists that have none is opt-in, enabled with -buildcolltrees
+	void set_enabled(bool enabled);
+	bool is_enabled();
+
+	struct mesh
+	{
+		const float* positions; // xyz of the first vertex
+		std::size_t position_stride; // bytes from one vertex position to the next
+		std::size_t vertex_count;
+		const std::uint16_t* indices; // first triangle of the range the tree covers
+		std::size_t tri_count;
+	};
+
+	// laid out like XSurfaceCollisionNode. nodes with children point at `child_count` consecutive nodes, nodes
+	// without point at a leaf and own the triangles up to the start of the next leaf
+	struct node
+	{
+		std::uint16_t mins[3];
+		std::uint16_t maxs[3];
+		std::uint16_t child_begin;
+		std::uint16_t child_count;
+	};
+
+	struct tree
+	{
+		// positions are quantized as (xyz + trans) * scale into 0..0xFFFF
+		float trans[3];
+		float scale[3];
+
+		std::vector<node> nodes;
+
+		// first triangle of each leaf, relative to the start of the range, followed by the end of the range
+		std::vector<std::uint16_t> leafs;
+
+		// the leafs own consecutive triangles, so the range has to be drawn in this order (indices into the range)
+		std::vector<std::uint32_t> triangle_order;
+	};
+
+	// binned SAH build over the triangle centroids, empty if the range doesn't fit the 16 bit indices
+	std::optional<tree> build(const mesh& mesh);
+
+	// checks that every node is reachable once, every triangle belongs to exactly one leaf and lies inside the
+	// bounds of each node above it. `mesh` has to be in the triangle order the tree was built for
+	bool validate(const mesh& mesh, const float* trans, const float* scale, const node* nodes, std::size_t node_count,
+		const std::uint16_t* leafs, std::size_t leaf_count);
+}
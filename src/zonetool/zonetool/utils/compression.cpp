@@ -289,6 +289,11 @@ namespace compression
 	}
 
 	std::vector<std::uint8_t> compress_zstd(const std::uint8_t* data, const std::size_t size)
+	{
+		return compress_zstd(data, size, ZSTD_COMPRESSION);
+	}
+
+	std::vector<std::uint8_t> compress_zstd(const std::uint8_t* data, const std::size_t size, const int level)
 	{
 		// calculate buffer size needed for current zone
 		auto compressed_size = ZSTD_compressBound(size);
@@ -298,15 +303,34 @@ namespace compression
 		compressed.resize(compressed_size);
 
 		// compress buffer
-		auto destsize = ZSTD_compress(compressed.data(), compressed_size, data, size, ZSTD_COMPRESSION);
-		compressed.resize(destsize);
-
+		auto destsize = ZSTD_compress(compressed.data(), compressed_size, data, size, level);
 		if (ZSTD_isError(destsize))
 		{
 			throw std::runtime_error(utils::string::va("An error occured while compressing the fastfile: %s", ZSTD_getErrorName(destsize)));
 		}
 
+		compressed.resize(destsize);
+
 		// return compressed buffer
 		return compressed;
 	}
+
+	std::vector<std::uint8_t> decompress_zstd(const std::uint8_t* data, const std::size_t size, const std::size_t uncompressed_size)
+	{
+		std::vector<std::uint8_t> decompressed;
+		decompressed.resize(uncompressed_size);
+
+		const auto result = ZSTD_decompress(decompressed.data(), uncompressed_size, data, size);
+		if (ZSTD_isError(result))
+		{
+			throw std::runtime_error(utils::string::va("An error occured while decompressing: %s", ZSTD_getErrorName(result)));
+		}
+
+		if (result != uncompressed_size)
+		{
+			throw std::runtime_error("An error occured while decompressing: size mismatch");
+		}
+
+		return decompressed;
+	}
 }
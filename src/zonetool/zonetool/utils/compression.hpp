@@ -39,6 +39,8 @@ namespace compression
 	std::vector<std::uint8_t> compress_zlib(const std::uint8_t* data, const std::size_t size, bool compress_blocks = false);
 
 	std::vector<std::uint8_t> compress_zstd(const std::uint8_t* data, const std::size_t size);
+	std::vector<std::uint8_t> compress_zstd(const std::uint8_t* data, const std::size_t size, const int level);
+	std::vector<std::uint8_t> decompress_zstd(const std::uint8_t* data, const std::size_t size, const std::size_t uncompressed_size);
 
 	
 }
@@ -0,0 +1,113 @@
+#include <std_include.hpp>
+#include "dump_queue.hpp"
+#include "utils.hpp"
+
+namespace zonetool
+{
+	dump_queue::dump_queue(const std::size_t worker_count)
+		: worker_count_(std::max<std::size_t>(1, worker_count))
+	{
+	}
+
+	dump_queue::~dump_queue()
+	{
+		{
+			std::lock_guard _(this->mutex_);
+			this->stopping_ = true;
+		}
+
+		this->task_cv_.notify_all();
+
+		for (auto& worker : this->workers_)
+		{
+			if (worker.joinable())
+			{
+				worker.join();
+			}
+		}
+	}
+
+	void dump_queue::push(task task)
+	{
+		{
+			std::lock_guard _(this->mutex_);
+			this->start_workers();
+			this->tasks_.emplace_back(std::move(task));
+		}
+
+		this->task_cv_.notify_one();
+	}
+
+	void dump_queue::wait()
+	{
+		std::unique_lock lock(this->mutex_);
+		this->idle_cv_.wait(lock, [this]
+		{
+			return this->tasks_.empty() && this->running_ == 0;
+		});
+	}
+
+	std::size_t dump_queue::pending()
+	{
+		std::lock_guard _(this->mutex_);
+		return this->tasks_.size() + this->running_;
+	}
+
+	// workers are started on first use, so queues can live in static storage
+	void dump_queue::start_workers()
+	{
+		if (!this->workers_.empty())
+		{
+			return;
+		}
+
+		for (auto i = 0u; i < this->worker_count_; i++)
+		{
+			this->workers_.emplace_back([this]
+			{
+				this->work();
+			});
+		}
+	}
+
+	void dump_queue::work()
+	{
+		std::unique_lock lock(this->mutex_);
+
+		while (true)
+		{
+			this->task_cv_.wait(lock, [this]
+			{
+				return this->stopping_ || !this->tasks_.empty();
+			});
+
+			if (this->tasks_.empty())
+			{
+				return;
+			}
+
+			auto task = std::move(this->tasks_.front());
+			this->tasks_.pop_front();
+			this->running_++;
+
+			lock.unlock();
+
+			try
+			{
+				task();
+			}
+			catch (const std::exception& ex)
+			{
+				ZONETOOL_ERROR("Dump task failed: %s", ex.what());
+			}
+
+			lock.lock();
+			this->running_--;
+
+			if (this->tasks_.empty() && this->running_ == 0)
+			{
+				this->idle_cv_.notify_all();
+			}
+		}
+	}
+}
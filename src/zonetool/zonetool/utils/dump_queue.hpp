@@ -0,0 +1,46 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace zonetool
+{
+	// runs dump work on worker threads so asset linking doesn't wait on serialization and disk writes,
+	// tasks start in push order and wait() is the barrier before the zone's memory may be freed
+	class dump_queue
+	{
+	public:
+		using task = std::function<void()>;
+
+		explicit dump_queue(std::size_t worker_count = 1);
+		~dump_queue();
+
+		dump_queue(const dump_queue&) = delete;
+		dump_queue& operator=(const dump_queue&) = delete;
+
+		void push(task task);
+
+		// blocks until every task pushed so far has finished
+		void wait();
+
+		std::size_t pending();
+
+	private:
+		void start_workers();
+		void work();
+
+		std::size_t worker_count_;
+		std::vector<std::thread> workers_;
+
+		std::mutex mutex_;
+		std::condition_variable task_cv_;
+		std::condition_variable idle_cv_;
+		std::deque<task> tasks_;
+		std::size_t running_ = 0;
+		bool stopping_ = false;
+	};
+}
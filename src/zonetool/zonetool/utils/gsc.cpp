@@ -1,6 +1,13 @@
 #include <std_include.hpp>
 #include "gsc.hpp"
 
+#include "dump_queue.hpp"
+#include "utils.hpp"
+
+#include <utils/compression.hpp>
+#include <utils/cryptography.hpp>
+#include <utils/io.hpp>
+
 namespace gsc
 {
 	namespace iw7
@@ -27,4 +34,138 @@ namespace gsc
 	{
 		std::unique_ptr<xsk::gsc::h2::context> gsc_ctx = std::make_unique<xsk::gsc::h2::context>(xsk::gsc::instance::server);
 	}
-}
\ No newline at end of file
+
+	namespace
+	{
+		constexpr auto cache_path = "dump\\_cache\\gsc\\";
+
+		// bump when a gsc-tool update changes the decompiler output, old cache entries are ignored then
+		constexpr auto cache_version = 1;
+
+		zonetool::dump_queue& get_decompiler_queue()
+		{
+			static zonetool::dump_queue queue(std::thread::hardware_concurrency());
+			return queue;
+		}
+
+		// the contexts keep per script state while disassembling and decompiling, so every thread gets its own
+		template <typename T>
+		T& get_thread_context()
+		{
+			thread_local auto ctx = std::make_unique<T>(xsk::gsc::instance::server);
+			return *ctx;
+		}
+
+		template <typename T>
+		std::string decompile(const std::vector<std::uint8_t>& bytecode, const std::string& stack_compressed)
+		{
+			auto& ctx = get_thread_context<T>();
+
+			const auto decompressed_stack = utils::compression::zlib::decompress(stack_compressed);
+			const std::vector<std::uint8_t> stack{decompressed_stack.begin(), decompressed_stack.end()};
+
+			const auto disasm = ctx.disassembler().disassemble(bytecode, stack);
+			const auto decomp = ctx.decompiler().decompile(*disasm);
+
+			const auto decomp_data = ctx.source().dump(*decomp);
+			return {decomp_data.begin(), decomp_data.end()};
+		}
+
+		std::string decompile(const engine engine, const std::vector<std::uint8_t>& bytecode, const std::string& stack)
+		{
+			switch (engine)
+			{
+			case engine::iw7:
+				return decompile<xsk::gsc::iw7::context>(bytecode, stack);
+			case engine::iw6:
+				return decompile<xsk::gsc::iw6_pc::context>(bytecode, stack);
+			case engine::s1:
+				return decompile<xsk::gsc::s1_pc::context>(bytecode, stack);
+			case engine::h1:
+				return decompile<xsk::gsc::h1::context>(bytecode, stack);
+			case engine::h2:
+				return decompile<xsk::gsc::h2::context>(bytecode, stack);
+			}
+
+			throw std::runtime_error("unknown gsc engine");
+		}
+
+		const char* get_engine_name(const engine engine)
+		{
+			switch (engine)
+			{
+			case engine::iw7:
+				return "iw7";
+			case engine::iw6:
+				return "iw6";
+			case engine::s1:
+				return "s1";
+			case engine::h1:
+				return "h1";
+			case engine::h2:
+				return "h2";
+			}
+
+			return "unknown";
+		}
+
+		std::string get_cache_file(const engine engine, const std::vector<std::uint8_t>& bytecode, const std::string& stack)
+		{
+			std::string key;
+			key.reserve(bytecode.size() + stack.size() + 16);
+			key.append(std::to_string(cache_version)).append(":");
+			key.append(std::to_string(bytecode.size())).append(":");
+			key.append(reinterpret_cast<const char*>(bytecode.data()), bytecode.size());
+			key.append(stack);
+
+			return cache_path + std::string(get_engine_name(engine)) + "\\" +
+				utils::cryptography::sha1::compute(key, true) + ".gsc";
+		}
+	}
+
+	void decompile_async(const engine engine, const std::string& name, std::vector<std::uint8_t> bytecode,
+		std::string stack, decompile_callback callback)
+	{
+		auto cache_file = get_cache_file(engine, bytecode, stack);
+
+		std::string source;
+		if (utils::io::read_file(cache_file, &source))
+		{
+			callback(source);
+			return;
+		}
+
+		get_decompiler_queue().push([=, bytecode = std::move(bytecode), stack = std::move(stack), callback = std::move(callback)]
+		{
+			std::string source;
+			try
+			{
+				source = decompile(engine, bytecode, stack);
+			}
+			catch (const std::exception& ex)
+			{
+				ZONETOOL_ERROR("Failed to decompile script %s\n%s", name.data(), ex.what());
+				return;
+			}
+
+			// written next to the entry first, a build running in parallel never reads half a script
+			std::error_code ec;
+			const auto staged = cache_file + "." + std::to_string(GetCurrentThreadId()) + ".tmp";
+			if (utils::io::write_file(staged, source, false))
+			{
+				std::filesystem::rename(staged, cache_file, ec);
+				if (ec)
+				{
+					std::filesystem::remove(staged, ec);
+				}
+			}
+
+			callback(source);
+		});
+	}
+
+	void wait_for_decompiler()
+	{
+		get_decompiler_queue().wait();
+	}
+}
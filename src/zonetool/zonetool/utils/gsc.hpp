@@ -32,4 +32,25 @@ namespace gsc
 	{
 		extern std::unique_ptr<xsk::gsc::h2::context> gsc_ctx;
 	}
-}
\ No newline at end of file
+
+	enum class engine
+	{
+		iw7,
+		iw6,
+		s1,
+		h1,
+		h2,
+	};
+
+	// receives the decompiled source, runs on a decompiler thread or right away when the script was cached
+	using decompile_callback = std::function<void(const std::string& source)>;
+
+	// decompiles a script on the decompiler threads, each of them uses its own context of the engine,
+	// `stack` is the zlib compressed buffer of the ScriptFile and `name` is only used for errors.
+	// sources are cached in dump\_cache\gsc\<engine>\ by a hash of the bytecode and stack, cached scripts aren't decompiled again
+	void decompile_async(engine engine, const std::string& name, std::vector<std::uint8_t> bytecode,
+		std::string stack, decompile_callback callback);
+
+	// blocks until every queued script is decompiled and its callback has run
+	void wait_for_decompiler();
+}
@@ -0,0 +1,370 @@
+#include <std_include.hpp>
+#include "gsc_compiler.hpp"
+
+#include "gsc.hpp"
+#include "dump_queue.hpp"
+#include "utils.hpp"
+
+#include <utils/compression.hpp>
+#include <utils/cryptography.hpp>
+#include <utils/io.hpp>
+#include <utils/string.hpp>
+
+namespace gsc
+{
+	namespace
+	{
+		constexpr auto cache_path = "dump\\_cache\\gsc\\compiled\\";
+
+		// bump when a gsc-tool update changes the compiler output, old cache entries are ignored then
+		constexpr auto compiler_version = 1;
+
+		// sorted, so the cache key doesn't depend on the order scripts are included in
+		using include_map = std::map<std::string, include_file>;
+
+		// includes of the script the current thread is compiling (stacks decompressed), the compiler asks for them by name
+		thread_local const include_map* current_includes = nullptr;
+
+		zonetool::dump_queue& get_compiler_queue()
+		{
+			static zonetool::dump_queue queue(std::thread::hardware_concurrency());
+			return queue;
+		}
+
+		std::string normalize_name(std::string name)
+		{
+			std::replace(name.begin(), name.end(), '/', '\\');
+
+			for (const auto* extension : {".gscbin", ".gsc"})
+			{
+				if (name.ends_with(extension))
+				{
+					name.resize(name.size() - std::strlen(extension));
+					break;
+				}
+			}
+
+			return utils::string::to_lower(name);
+		}
+
+		std::pair<xsk::gsc::buffer, std::vector<std::uint8_t>> read_include(const std::string& name)
+		{
+			if (current_includes)
+			{
+				const auto itr = current_includes->find(normalize_name(name));
+				if (itr != current_includes->end())
+				{
+					const auto& file = itr->second;
+					if (file.bytecode.empty())
+					{
+						return {{}, {file.source.begin(), file.source.end()}};
+					}
+
+					return {{reinterpret_cast<const std::uint8_t*>(file.bytecode.data()), file.bytecode.size()},
+						{file.stack.begin(), file.stack.end()}};
+				}
+			}
+
+			throw std::runtime_error(utils::string::va("Could not find included script \"%s\"", name.data()));
+		}
+
+		// a new context for every script, the contexts cache which functions an include declares by its name and
+		// reusing one would compile against an include read for an earlier script
+		template <typename T>
+		std::unique_ptr<T> make_context()
+		{
+			auto ctx = std::make_unique<T>(xsk::gsc::instance::server);
+			ctx->init(xsk::gsc::build::prod, []([[maybe_unused]] auto const* context, const auto& name)
+			{
+				return read_include(name);
+			});
+
+			return ctx;
+		}
+
+		template <typename T>
+		compiled_script compile(const std::string& name, const std::string& source, const include_map& includes)
+		{
+			const auto ctx = make_context<T>();
+
+			current_includes = &includes;
+			const auto _0 = gsl::finally([]
+			{
+				current_includes = nullptr;
+			});
+
+			std::vector<std::uint8_t> data{source.begin(), source.end()};
+			const auto assembly = ctx->compiler().compile(name + ".gsc", data);
+			const auto [bytecode, stack] = ctx->assembler().assemble(*assembly);
+
+			compiled_script script{};
+			script.bytecode.assign(reinterpret_cast<const char*>(bytecode.data), bytecode.size);
+			script.len = static_cast<std::uint32_t>(stack.size);
+			script.buffer = utils::compression::zlib::compress({reinterpret_cast<const char*>(stack.data), stack.size});
+
+			return script;
+		}
+
+		compiled_script compile(const game::game_mode mode, const std::string& name, const std::string& source,
+			const include_map& includes)
+		{
+			switch (mode)
+			{
+			case game::iw7:
+				return compile<xsk::gsc::iw7::context>(name, source, includes);
+			case game::iw6:
+				return compile<xsk::gsc::iw6_pc::context>(name, source, includes);
+			case game::s1:
+				return compile<xsk::gsc::s1_pc::context>(name, source, includes);
+			case game::h1:
+				return compile<xsk::gsc::h1::context>(name, source, includes);
+			case game::h2:
+				return compile<xsk::gsc::h2::context>(name, source, includes);
+			default:
+				break;
+			}
+
+			throw std::runtime_error("no gsc compiler for this game");
+		}
+
+		// gsc-tool errors read "[ERROR]:<stage>:<file>:<line>:<column>: <message>", assembler errors and the ones
+		// read_include throws have no location and are reported against the script itself
+		diagnostic get_diagnostic(const std::string& name, const std::string& error)
+		{
+			static const std::regex pattern(R"(^\[ERROR\]:\w+:(.+?):(\d+):(\d+): ([\s\S]*)$)");
+
+			std::smatch match;
+			if (std::regex_match(error, match, pattern))
+			{
+				return {match[1].str(), std::stoi(match[2].str()), std::stoi(match[3].str()), match[4].str()};
+			}
+
+			return {name + ".gsc", 0, 0, error};
+		}
+
+		// `source` without its `//`, `/* */` and `/# #/` comments and with empty string literals, so that only
+		// real directives are left for the include scan
+		std::string strip_comments(const std::string& source)
+		{
+			std::string result;
+			result.reserve(source.size());
+
+			for (std::size_t i = 0; i < source.size();)
+			{
+				const auto next = i + 1 < source.size() ? source[i + 1] : '\0';
+				if (source[i] == '"')
+				{
+					i++;
+					while (i < source.size() && source[i] != '"' && source[i] != '\n')
+					{
+						i += source[i] == '\\' ? 2 : 1;
+					}
+
+					i = i < source.size() && source[i] == '"' ? i + 1 : std::min(i, source.size());
+					result.append("\"\"");
+				}
+				else if (source[i] == '/' && next == '/')
+				{
+					i = std::min(source.find('\n', i), source.size());
+				}
+				else if (source[i] == '/' && (next == '*' || next == '#'))
+				{
+					const char end[] = {next == '*' ? '*' : '#', '/', '\0'};
+					const auto close = source.find(end, i + 2);
+					i = close == std::string::npos ? source.size() : close + 2;
+					result.push_back(' ');
+				}
+				else
+				{
+					result.push_back(source[i++]);
+				}
+			}
+
+			return result;
+		}
+
+		// follows the #include directives of `source` and of every included source, `missing` gets the ones
+		// that couldn't be resolved so the compiler reports them where they are used
+		void resolve_includes(const std::string& source, const include_resolver& resolver, include_map& includes,
+			std::set<std::string>& missing)
+		{
+			static const std::regex pattern(R"(#include\s+([\w\\/.]+)\s*;)");
+
+			const auto code = strip_comments(source);
+			for (auto itr = std::sregex_iterator(code.begin(), code.end(), pattern); itr != std::sregex_iterator(); ++itr)
+			{
+				const auto name = normalize_name((*itr)[1].str());
+				if (includes.contains(name) || missing.contains(name))
+				{
+					continue;
+				}
+
+				auto file = resolver(name);
+				if (!file)
+				{
+					missing.insert(name);
+					continue;
+				}
+
+				auto& include = includes[name] = std::move(*file);
+				if (include.bytecode.empty())
+				{
+					resolve_includes(include.source, resolver, includes, missing);
+				}
+				else
+				{
+					include.stack = utils::compression::zlib::decompress(include.stack);
+				}
+			}
+		}
+
+		void append_key(std::string& key, const std::string& value)
+		{
+			key.append(std::to_string(value.size())).append(":").append(value);
+		}
+
+		std::string get_cache_file(const game::game_mode mode, const std::string& name, const std::string& source,
+			const include_map& includes, const std::set<std::string>& missing)
+		{
+			std::string key;
+			append_key(key, std::to_string(compiler_version));
+			append_key(key, name);
+			append_key(key, source);
+
+			for (const auto& [include_name, file] : includes)
+			{
+				append_key(key, include_name);
+				append_key(key, file.source);
+				append_key(key, file.bytecode);
+				append_key(key, file.stack);
+			}
+
+			for (const auto& include_name : missing)
+			{
+				append_key(key, "!" + include_name);
+			}
+
+			return cache_path + game::get_mode_as_string(mode) + "\\" +
+				utils::cryptography::sha1::compute(key, true) + ".gscbin";
+		}
+
+		std::optional<compiled_script> read_cache(const std::string& cache_file)
+		{
+			std::string data;
+			if (!utils::io::read_file(cache_file, &data) || data.size() < sizeof(std::uint32_t) * 3)
+			{
+				return {};
+			}
+
+			std::uint32_t sizes[3]{};
+			std::memcpy(sizes, data.data(), sizeof(sizes));
+
+			const auto [len, compressed_len, bytecode_len] = sizes;
+			if (data.size() != sizeof(sizes) + static_cast<std::size_t>(compressed_len) + bytecode_len)
+			{
+				return {};
+			}
+
+			compiled_script script{};
+			script.len = len;
+			script.buffer = data.substr(sizeof(sizes), compressed_len);
+			script.bytecode = data.substr(sizeof(sizes) + compressed_len);
+
+			return script;
+		}
+
+		void write_cache(const std::string& cache_file, const compiled_script& script)
+		{
+			const std::uint32_t sizes[3]{script.len, static_cast<std::uint32_t>(script.buffer.size()),
+				static_cast<std::uint32_t>(script.bytecode.size())};
+
+			std::string data(reinterpret_cast<const char*>(sizes), sizeof(sizes));
+			data.append(script.buffer);
+			data.append(script.bytecode);
+
+			// written next to the entry first, a build running in parallel never reads half a script
+			std::error_code ec;
+			const auto staged = cache_file + "." + std::to_string(GetCurrentThreadId()) + ".tmp";
+			if (utils::io::write_file(staged, data, false))
+			{
+				std::filesystem::rename(staged, cache_file, ec);
+				if (ec)
+				{
+					std::filesystem::remove(staged, ec);
+				}
+			}
+		}
+	}
+
+	bool can_compile(const game::game_mode mode)
+	{
+		return mode == game::iw7 || mode == game::iw6 || mode == game::s1 || mode == game::h1 || mode == game::h2;
+	}
+
+	std::string get_script_asset_name(const game::game_mode mode, const std::string& name)
+	{
+		auto token = name;
+		std::replace(token.begin(), token.end(), '\\', '/');
+
+		std::uint32_t id = 0;
+		switch (mode)
+		{
+		case game::iw7:
+			id = iw7::gsc_ctx->token_id(token);
+			break;
+		case game::iw6:
+			id = iw6::gsc_ctx->token_id(token);
+			break;
+		case game::s1:
+			id = s1::gsc_ctx->token_id(token);
+			break;
+		case game::h1:
+			id = h1::gsc_ctx->token_id(token);
+			break;
+		case game::h2:
+			id = h2::gsc_ctx->token_id(token);
+			break;
+		default:
+			break;
+		}
+
+		return id ? std::to_string(id) : name;
+	}
+
+	std::shared_future<compiled_script> compile_async(const game::game_mode mode, const std::string& name,
+		const std::string& source, const include_resolver& resolver)
+	{
+		auto includes = std::make_shared<include_map>();
+		std::set<std::string> missing;
+		resolve_includes(source, resolver, *includes, missing);
+
+		const auto cache_file = get_cache_file(mode, name, source, *includes, missing);
+
+		auto promise = std::make_shared<std::promise<compiled_script>>();
+		auto future = promise->get_future().share();
+
+		if (auto script = read_cache(cache_file))
+		{
+			promise->set_value(std::move(*script));
+			return future;
+		}
+
+		get_compiler_queue().push([=]
+		{
+			compiled_script script{};
+			try
+			{
+				script = compile(mode, name, source, *includes);
+				write_cache(cache_file, script);
+			}
+			catch (const std::exception& ex)
+			{
+				script.errors.emplace_back(get_diagnostic(name, ex.what()));
+			}
+
+			promise->set_value(std::move(script));
+		});
+
+		return future;
+	}
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "game/mode.hpp"
+
+namespace gsc
+{
+	// a compile error in a script or one of its includes, line and column are 0 when the compiler didn't give one
+	struct diagnostic
+	{
+		std::string file;
+		int line;
+		int column;
+		std::string message;
+	};
+
+	struct compiled_script
+	{
+		std::string buffer; // zlib compressed stack, like ScriptFile::buffer
+		std::uint32_t len = 0; // size of the stack decompressed
+		std::string bytecode;
+
+		// empty when the script compiled
+		std::vector<diagnostic> errors;
+	};
+
+	// what an #include refers to, either the source of a script or a precompiled one
+	struct include_file
+	{
+		std::string source;
+		std::string bytecode;
+		std::string stack; // zlib compressed, like ScriptFile::buffer
+	};
+
+	// finds an included script by the name it is included as, empty when there is none
+	using include_resolver = std::function<std::optional<include_file>(const std::string& name)>;
+
+	bool can_compile(game::game_mode mode);
+
+	// name of the ScriptFile asset a script is included as, the token id for scripts the game only knows by id
+	std::string get_script_asset_name(game::game_mode mode, const std::string& name);
+
+	// compiles the source of script `name` on the compiler threads, every script gets a new context of the engine.
+	// includes are resolved up front on the calling thread with `resolver`, following the ones that are sources.
+	// results are cached in dump\_cache\gsc\compiled\<game>\ by the source, everything it includes and the compiler
+	// version, cached scripts aren't compiled again
+	std::shared_future<compiled_script> compile_async(game::game_mode mode, const std::string& name,
+		const std::string& source, const include_resolver& resolver);
+}
@@ -149,7 +149,7 @@ namespace zonetool
 
 			bool is_open()
 			{
-				return file.get_fp() != nullptr;
+				return file.is_open();
 			}
 
 			auto open()
@@ -477,7 +477,7 @@ namespace zonetool
 
 			bool is_open()
 			{
-				return file.get_fp() != nullptr;
+				return file.is_open();
 			}
 
 			auto open()
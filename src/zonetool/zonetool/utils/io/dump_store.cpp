@@ -0,0 +1,387 @@
+#include <std_include.hpp>
+#include "dump_store.hpp"
+#include "filesystem.hpp"
+#include "pack.hpp"
+
+#include "../utils.hpp"
+
+#include <utils/cryptography.hpp>
+#include <utils/io.hpp>
+
+namespace zonetool
+{
+	namespace filesystem
+	{
+		namespace dump_store
+		{
+			namespace
+			{
+				constexpr auto store_path = "dump\\_store\\";
+
+				struct counters
+				{
+					std::atomic_uint64_t files_written;
+					std::atomic_uint64_t files_skipped;
+					std::atomic_uint64_t bytes_written;
+					std::atomic_uint64_t bytes_skipped;
+
+					void add(const bool written, const std::uint64_t size)
+					{
+						if (written)
+						{
+							this->files_written++;
+							this->bytes_written += size;
+						}
+						else
+						{
+							this->files_skipped++;
+							this->bytes_skipped += size;
+						}
+					}
+
+					statistics get() const
+					{
+						return {this->files_written, this->files_skipped, this->bytes_written, this->bytes_skipped};
+					}
+
+					void reset()
+					{
+						this->files_written = 0;
+						this->files_skipped = 0;
+						this->bytes_written = 0;
+						this->bytes_skipped = 0;
+					}
+				};
+
+				std::atomic_bool shared_enabled = false;
+				std::atomic_bool packed_enabled = false;
+				std::atomic_uint64_t stage_index = 0;
+
+				counters zone_counters;
+				counters total_counters;
+
+				std::mutex links_mutex;
+				std::vector<std::pair<std::string, std::string>> zone_links;
+
+				std::mutex packs_mutex;
+				std::unordered_map<std::string, std::unique_ptr<pack::writer>> pack_writers;
+
+				void add_result(const bool written, const std::uint64_t size)
+				{
+					zone_counters.add(written, size);
+					total_counters.add(written, size);
+				}
+
+				// a file of another size can't hold the same content, so it is only read when the sizes match
+				bool file_matches(const std::string& path, const std::string_view data)
+				{
+					std::error_code ec;
+					const auto size = std::filesystem::file_size(path, ec);
+					if (ec || size != data.size())
+					{
+						return false;
+					}
+
+					std::string existing;
+					return utils::io::read_file(path, &existing) && existing == data;
+				}
+
+				bool replace_file(const std::string& source, const std::string& target)
+				{
+					std::error_code ec;
+
+					// targets linked to a store object are read only, the link is dropped so the other zones keep their copy
+					if (std::filesystem::exists(target, ec) && std::filesystem::hard_link_count(target, ec) > 1)
+					{
+						std::filesystem::remove(target, ec);
+					}
+
+					std::filesystem::rename(source, target, ec);
+					if (ec)
+					{
+						ZONETOOL_ERROR("Failed to write \"%s\": %s", target.data(), ec.message().data());
+						std::filesystem::remove(source, ec);
+						return false;
+					}
+
+					return true;
+				}
+
+				// the data is written next to the target and moved over it, so a failed write never leaves a partial file
+				bool write_file(const std::string& target, const std::string_view data)
+				{
+					const auto staged = target + "." + std::to_string(stage_index++) + ".tmp";
+					if (!utils::io::write_file(staged, std::string(data)))
+					{
+						ZONETOOL_ERROR("Failed to write \"%s\"", target.data());
+						return false;
+					}
+
+					return replace_file(staged, target);
+				}
+
+				void link_object(const std::string& object, const std::string& target)
+				{
+					std::error_code ec;
+					if (std::filesystem::exists(target, ec) && std::filesystem::equivalent(object, target, ec))
+					{
+						return;
+					}
+
+					std::filesystem::remove(target, ec);
+					std::filesystem::create_hard_link(object, target, ec);
+					if (ec)
+					{
+						// hard links don't work across volumes, keep a plain copy instead
+						std::filesystem::copy_file(object, target, std::filesystem::copy_options::overwrite_existing, ec);
+						if (ec)
+						{
+							ZONETOOL_ERROR("Failed to link \"%s\": %s", target.data(), ec.message().data());
+						}
+					}
+				}
+
+				// `staged` is the file the data was already written to, if any, it is moved into place instead of writing the data again
+				void commit_local(const std::string_view data, const std::string& target, const std::string& staged)
+				{
+					if (file_matches(target, data))
+					{
+						if (!staged.empty())
+						{
+							std::error_code ec;
+							std::filesystem::remove(staged, ec);
+						}
+
+						add_result(false, data.size());
+						return;
+					}
+
+					if (staged.empty() ? write_file(target, data) : replace_file(staged, target))
+					{
+						add_result(true, data.size());
+					}
+				}
+
+				void commit_shared(const std::string_view data, const std::string& target, const std::string& staged)
+				{
+					// objects are named by hash and size, but the hash is only 64 bits, so the bytes are compared before
+					// linking to an object. data that collides with an object gets the next free numbered name
+					const auto hash = utils::cryptography::fnv1a::compute(data.data(), data.size());
+					const std::string base_name = utils::string::va("%016llX_%llX", hash, static_cast<std::uint64_t>(data.size()));
+
+					std::error_code ec;
+					std::string object_name;
+					std::string object;
+					auto exists = false;
+					for (auto index = 0u;; index++)
+					{
+						object_name = index ? utils::string::va("%s_%u", base_name.data(), index) : base_name;
+						object = store_path + object_name;
+
+						exists = std::filesystem::exists(object, ec);
+						if (!exists || file_matches(object, data))
+						{
+							break;
+						}
+					}
+
+					if (exists)
+					{
+						if (!staged.empty())
+						{
+							std::filesystem::remove(staged, ec);
+						}
+
+						add_result(false, data.size());
+					}
+					else
+					{
+						std::filesystem::create_directories(store_path, ec);
+						if (!(staged.empty() ? write_file(object, data) : replace_file(staged, object)))
+						{
+							return;
+						}
+
+						// every zone links to the object, editing it in place would change all of them
+						std::filesystem::permissions(object, std::filesystem::perms::owner_write | std::filesystem::perms::group_write |
+							std::filesystem::perms::others_write, std::filesystem::perm_options::remove, ec);
+
+						add_result(true, data.size());
+					}
+
+					link_object(object, target);
+
+					std::lock_guard _(links_mutex);
+					zone_links.emplace_back(object_name, target);
+				}
+
+				void commit_packed(const std::string_view data, const std::string& target, const std::string& name)
+				{
+					// dump\<zone>\<name> is stored as <name> in dump\<zone>.zpk
+					auto pack_path = target.substr(0, target.size() - name.size());
+					while (!pack_path.empty() && (pack_path.back() == '\\' || pack_path.back() == '/'))
+					{
+						pack_path.pop_back();
+					}
+					pack_path += pack::extension;
+
+					std::lock_guard _(packs_mutex);
+					auto& writer = pack_writers[pack_path];
+					if (!writer)
+					{
+						writer = std::make_unique<pack::writer>(pack_path, true);
+					}
+
+					const auto written = writer->add(name, reinterpret_cast<const std::uint8_t*>(data.data()), data.size());
+					add_result(written, data.size());
+				}
+
+				void commit_data(const std::string_view data, const std::string& target, const std::string& name,
+					const std::string& staged)
+				{
+					if (packed_enabled)
+					{
+						if (!staged.empty())
+						{
+							std::error_code ec;
+							std::filesystem::remove(staged, ec);
+						}
+
+						commit_packed(data, target, name);
+					}
+					else if (shared_enabled)
+					{
+						commit_shared(data, target, staged);
+					}
+					else
+					{
+						commit_local(data, target, staged);
+					}
+				}
+
+				void close_packs()
+				{
+					std::lock_guard _(packs_mutex);
+					pack_writers.clear();
+				}
+
+				void write_manifest(const std::string& zone)
+				{
+					std::lock_guard _(links_mutex);
+					if (zone_links.empty())
+					{
+						return;
+					}
+
+					std::sort(zone_links.begin(), zone_links.end(), [](const auto& a, const auto& b)
+					{
+						return a.second < b.second;
+					});
+
+					const auto path = store_path + zone + ".links";
+					std::ofstream stream(path, std::ios::binary | std::ios::trunc);
+					if (!stream.is_open())
+					{
+						ZONETOOL_ERROR("Failed to write link manifest \"%s\"", path.data());
+					}
+					else
+					{
+						for (const auto& [object, target] : zone_links)
+						{
+							stream << object << " " << target << "\n";
+						}
+					}
+
+					zone_links.clear();
+				}
+
+				double to_megabytes(const std::uint64_t size)
+				{
+					return static_cast<double>(size) / (1024.0 * 1024.0);
+				}
+			}
+
+			void set_shared(const bool enabled)
+			{
+				shared_enabled = enabled;
+			}
+
+			bool is_shared()
+			{
+				return shared_enabled;
+			}
+
+			void set_packed(const bool enabled)
+			{
+				packed_enabled = enabled;
+			}
+
+			bool is_packed()
+			{
+				return packed_enabled;
+			}
+
+			std::string stage(const std::string& target)
+			{
+				if (packed_enabled)
+				{
+					// packed files never reach their target, so there is no need for its folder
+					const auto path = get_temp_path();
+					utils::io::create_directory(path);
+					return path + std::to_string(stage_index++) + ".tmp";
+				}
+
+				return target + "." + std::to_string(stage_index++) + ".tmp";
+			}
+
+			void commit(const std::string& staged, const std::string& target, const std::string& name)
+			{
+				std::string data;
+				if (!utils::io::read_file(staged, &data))
+				{
+					ZONETOOL_ERROR("Failed to write \"%s\"", target.data());
+
+					std::error_code ec;
+					std::filesystem::remove(staged, ec);
+					return;
+				}
+
+				commit_data(data, target, name, staged);
+			}
+
+			void commit(const std::uint8_t* data, const std::size_t size, const std::string& target, const std::string& name)
+			{
+				commit_data({reinterpret_cast<const char*>(data), size}, target, name, {});
+			}
+
+			statistics get_statistics()
+			{
+				return total_counters.get();
+			}
+
+			void report(const std::string& zone)
+			{
+				const auto stats = zone_counters.get();
+				zone_counters.reset();
+
+				close_packs();
+
+				if (shared_enabled)
+				{
+					write_manifest(zone);
+				}
+
+				if (!stats.files_written && !stats.files_skipped)
+				{
+					return;
+				}
+
+				const auto totals = total_counters.get();
+				ZONETOOL_INFO("Dump output: %llu files written (%.2f MB), %llu unchanged files skipped (%.2f MB), %.2f MB written / %.2f MB skipped in total",
+					stats.files_written, to_megabytes(stats.bytes_written),
+					stats.files_skipped, to_megabytes(stats.bytes_skipped),
+					to_megabytes(totals.bytes_written), to_megabytes(totals.bytes_skipped));
+			}
+		}
+	}
+}
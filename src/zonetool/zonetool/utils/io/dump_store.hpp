@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+namespace zonetool
+{
+	namespace filesystem
+	{
+		// files written to the dump path are kept in memory and only replace their target when the bytes
+		// differ, so re-dumping common assets (shaders, techsets, materials...) costs no writes
+		namespace dump_store
+		{
+			struct statistics
+			{
+				std::uint64_t files_written;
+				std::uint64_t files_skipped;
+				std::uint64_t bytes_written;
+				std::uint64_t bytes_skipped;
+			};
+
+			// deduplicates dumped files across zones into dump\_store\ and hard-links them into each zone's folder,
+			// every zone gets a manifest of the links it created (dump\_store\<zone>.links), enabled with -dumpstore.
+			// store objects are read only since every link shares them, re-dumping a file with other content
+			// replaces only that zone's link
+			void set_shared(bool enabled);
+			bool is_shared();
+
+			// appends dumped files to dump\<zone>.zpk instead of writing loose files (see pack), enabled with -dumppack
+			void set_packed(bool enabled);
+			bool is_packed();
+
+			// returns the path a dump file for `target` is written to when its writer needs a FILE*
+			std::string stage(const std::string& target);
+
+			// moves a staged file into place, or drops it when the target already holds the same content,
+			// `name` is the path of the file relative to the dump folder
+			void commit(const std::string& staged, const std::string& target, const std::string& name);
+
+			// same for a file that was written to memory, nothing is written when the target is unchanged
+			void commit(const std::uint8_t* data, std::size_t size, const std::string& target, const std::string& name);
+
+			statistics get_statistics();
+
+			// logs the written/skipped totals of the zone, writes its link manifest, closes its pack and resets the zone counters
+			void report(const std::string& zone);
+		}
+	}
+}
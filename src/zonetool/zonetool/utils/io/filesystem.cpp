@@ -1,5 +1,7 @@
 #include <std_include.hpp>
 #include "filesystem.hpp"
+#include "dump_store.hpp"
+#include "pack.hpp"
 
 #include <utils/io.hpp>
 
@@ -7,6 +9,90 @@ namespace zonetool
 {
 	namespace filesystem
 	{
+		namespace
+		{
+			std::vector<std::unique_ptr<pack::reader>>& get_packs()
+			{
+				static std::vector<std::unique_ptr<pack::reader>> packs;
+				return packs;
+			}
+
+			std::optional<std::vector<std::uint8_t>> read_pack_entry(const std::string& name)
+			{
+				for (const auto& pack : get_packs())
+				{
+					if (pack->contains(name))
+					{
+						return pack->read(name);
+					}
+				}
+
+				return {};
+			}
+
+			bool pack_contains(const std::string& name)
+			{
+				return std::any_of(get_packs().begin(), get_packs().end(), [&](const auto& pack)
+				{
+					return pack->contains(name);
+				});
+			}
+
+			std::mutex extract_mutex;
+			std::unordered_set<std::string> extracted_entries;
+
+			std::string get_extract_path()
+			{
+				return get_temp_path() + "packs\\";
+			}
+
+			// writes a pack entry to the extract path once, returns the folder it is in or nothing if no pack has it.
+			// `data` is the content of the entry when the caller already read it
+			std::string extract_pack_entry(const std::string& name, const std::vector<std::uint8_t>* data = nullptr)
+			{
+				if (!pack_contains(name))
+				{
+					return {};
+				}
+
+				const auto path = get_extract_path();
+				const auto key = pack::normalize_name(name);
+
+				std::lock_guard _(extract_mutex);
+				if (extracted_entries.contains(key))
+				{
+					return path;
+				}
+
+				std::optional<std::vector<std::uint8_t>> read_data;
+				if (!data)
+				{
+					read_data = read_pack_entry(name);
+					data = read_data ? &read_data.value() : nullptr;
+				}
+
+				if (!data || !utils::io::write_file(path + key, {reinterpret_cast<const char*>(data->data()), data->size()}))
+				{
+					ZONETOOL_ERROR("Failed to extract \"%s\" from its pack", name.data());
+					return {};
+				}
+
+				extracted_entries.insert(key);
+				return path;
+			}
+
+			void remove_temp_path()
+			{
+				{
+					std::lock_guard _(extract_mutex);
+					extracted_entries.clear();
+				}
+
+				std::error_code ec;
+				std::filesystem::remove_all(get_temp_path(), ec);
+			}
+		}
+
 		file::file(const std::string& filepath_)
 		{
 			this->initialize(filepath_);
@@ -37,7 +123,13 @@ namespace zonetool
 		{
 			this->initialize(other.filepath);
 			this->fp = other.fp;
+			this->staged_path = std::move(other.staged_path);
+			this->target_path = std::move(other.target_path);
+			this->buffer = std::move(other.buffer);
+			this->buffer_pos = other.buffer_pos;
+			this->buffered = other.buffered;
 			other.fp = nullptr;
+			other.buffered = false;
 		}
 
 		file& file::operator=(const file& other)
@@ -58,7 +150,13 @@ namespace zonetool
 				this->close();
 				this->initialize(other.filepath);
 				this->fp = other.fp;
+				this->staged_path = std::move(other.staged_path);
+				this->target_path = std::move(other.target_path);
+				this->buffer = std::move(other.buffer);
+				this->buffer_pos = other.buffer_pos;
+				this->buffered = other.buffered;
 				other.fp = nullptr;
+				other.buffered = false;
 			}
 
 			return *this;
@@ -71,13 +169,73 @@ namespace zonetool
 
 		FILE* file::get_fp()
 		{
+			if (this->buffered)
+			{
+				this->materialize();
+			}
+
 			return this->fp;
 		}
 
+		bool file::is_open()
+		{
+			return this->fp || this->buffered;
+		}
+
+		// hands a pack entry to code that reads through the raw FILE*, or moves a dump file to its staging file
+		// for code that writes through it
+		void file::materialize()
+		{
+			this->buffered = false;
+
+			if (!this->target_path.empty())
+			{
+				this->staged_path = dump_store::stage(this->target_path);
+				if (fopen_s(&this->fp, this->staged_path.data(), "wb") != 0 || !this->fp)
+				{
+					this->fp = nullptr;
+					this->staged_path.clear();
+					this->target_path.clear();
+					this->buffer.clear();
+					return;
+				}
+
+				if (!this->buffer.empty())
+				{
+					fwrite(this->buffer.data(), this->buffer.size(), 1, this->fp);
+				}
+
+				_fseeki64(this->fp, this->buffer_pos, SEEK_SET);
+
+				this->buffer.clear();
+				this->buffer.shrink_to_fit();
+				return;
+			}
+
+			// pack entries are extracted once, later opens of the same entry reuse the file
+			const auto path = extract_pack_entry(this->filepath.string(), &this->buffer);
+
+			this->buffer.clear();
+			this->buffer.shrink_to_fit();
+
+			if (path.empty() || fopen_s(&this->fp, (path + pack::normalize_name(this->filepath.string())).data(), "rb") != 0 || !this->fp)
+			{
+				this->fp = nullptr;
+				return;
+			}
+
+			_fseeki64(this->fp, this->buffer_pos, SEEK_SET);
+		}
+
 		bool file::exists(bool use_path)
 		{
+			if (use_path && pack_contains(this->filepath.string()))
+			{
+				return true;
+			}
+
 			this->open("rb", use_path);
-			if (this->fp)
+			if (this->is_open())
 			{
 				this->close();
 				return true;
@@ -101,12 +259,42 @@ namespace zonetool
 					{
 						return fopen_s(&this->fp, (path + this->filepath.string()).data(), mode.data());
 					}
+
+					auto data = read_pack_entry(this->filepath.string());
+					if (data.has_value())
+					{
+						this->buffer = std::move(data.value());
+						this->buffer_pos = 0;
+						this->buffered = true;
+						return 0;
+					}
 				}
 				if (mode[0] == 'w' || mode[0] == 'a')
 				{
 					auto path = get_dump_path();
 					auto dir = path + this->parent_path;
-					create_directory(dir);
+					if (mode[0] != 'w' || !dump_store::is_packed())
+					{
+						create_directory(dir);
+					}
+
+					if (mode[0] == 'w')
+					{
+						// close() only replaces the target if the content changed. binary files are written to memory,
+						// text mode and update files need a real file to translate line endings or read back
+						this->target_path = path + this->filepath.string();
+						if (mode.find('b') != std::string::npos && mode.find('+') == std::string::npos)
+						{
+							this->buffer.clear();
+							this->buffer_pos = 0;
+							this->buffered = true;
+							return 0;
+						}
+
+						this->staged_path = dump_store::stage(this->target_path);
+						return fopen_s(&this->fp, this->staged_path.data(), mode.data());
+					}
+
 					return fopen_s(&this->fp, (path + this->filepath.string()).data(), mode.data());
 				}
 			}
@@ -131,11 +319,7 @@ namespace zonetool
 
 		size_t file::write_string(const std::string& str)
 		{
-			if (this->fp)
-			{
-				return fwrite(str.data(), str.size() + 1, 1, this->fp);
-			}
-			return 0;
+			return this->write(str.data(), str.size() + 1, 1);
 		}
 
 		size_t file::write_string(const char* str)
@@ -145,6 +329,25 @@ namespace zonetool
 
 		size_t file::write(const void* buffer, size_t size, size_t count)
 		{
+			if (this->buffered)
+			{
+				// pack entries are read only
+				if (this->target_path.empty() || !size)
+				{
+					return 0;
+				}
+
+				const auto bytes = size * count;
+				if (this->buffer.size() < this->buffer_pos + bytes)
+				{
+					this->buffer.resize(this->buffer_pos + bytes);
+				}
+
+				std::memcpy(this->buffer.data() + this->buffer_pos, buffer, bytes);
+				this->buffer_pos += bytes;
+				return count;
+			}
+
 			if (this->fp)
 			{
 				return fwrite(buffer, size, count, this->fp);
@@ -159,11 +362,24 @@ namespace zonetool
 
 		int file::seek(size_t offset, int origin)
 		{
+			if (this->buffered)
+			{
+				// like a FILE*, a file being written can be seeked past its end
+				const auto base = origin == SEEK_CUR ? this->buffer_pos : origin == SEEK_END ? this->buffer.size() : 0;
+				this->buffer_pos = this->target_path.empty() ? std::min(base + offset, this->buffer.size()) : base + offset;
+				return 0;
+			}
+
 			return _fseeki64(this->fp, offset, origin);
 		}
 
 		size_t file::tell()
 		{
+			if (this->buffered)
+			{
+				return this->buffer_pos;
+			}
+
 			return _ftelli64(this->fp);
 		}
 
@@ -186,6 +402,23 @@ namespace zonetool
 
 		size_t file::read_string(std::string* str)
 		{
+			if (this->buffered)
+			{
+				if (this->buffer_pos >= this->buffer.size())
+				{
+					str->clear();
+					return 0;
+				}
+
+				const auto* start = this->buffer.data() + this->buffer_pos;
+				const auto* end = this->buffer.data() + this->buffer.size();
+				const auto* terminator = std::find(start, end, 0);
+
+				str->assign(reinterpret_cast<const char*>(start), terminator - start);
+				this->buffer_pos = std::min(static_cast<std::size_t>(terminator - this->buffer.data()) + 1, this->buffer.size());
+				return 0;
+			}
+
 			if (this->fp)
 			{
 				auto size = get_string_size(this->fp);
@@ -197,6 +430,19 @@ namespace zonetool
 
 		size_t file::read(void* buffer, size_t size, size_t count)
 		{
+			if (this->buffered)
+			{
+				if (!size || this->buffer_pos >= this->buffer.size())
+				{
+					return 0;
+				}
+
+				const auto bytes = std::min(size * count, this->buffer.size() - this->buffer_pos);
+				std::memcpy(buffer, this->buffer.data() + this->buffer_pos, bytes);
+				this->buffer_pos += bytes;
+				return bytes / size;
+			}
+
 			if (this->fp)
 			{
 				return fread(buffer, size, count, this->fp);
@@ -206,9 +452,33 @@ namespace zonetool
 
 		int file::close()
 		{
+			if (this->buffered)
+			{
+				if (!this->target_path.empty())
+				{
+					dump_store::commit(this->buffer.data(), this->buffer.size(), this->target_path, this->filepath.string());
+					this->target_path.clear();
+				}
+
+				this->buffer.clear();
+				this->buffer_pos = 0;
+				this->buffered = false;
+				return 0;
+			}
+
 			if (this->fp)
 			{
-				return fclose(this->fp);
+				const auto result = fclose(this->fp);
+				this->fp = nullptr;
+
+				if (!this->staged_path.empty())
+				{
+					dump_store::commit(this->staged_path, this->target_path, this->filepath.string());
+					this->staged_path.clear();
+					this->target_path.clear();
+				}
+
+				return result;
 			}
 			return -1;
 		}
@@ -220,6 +490,11 @@ namespace zonetool
 
 		std::size_t file::size()
 		{
+			if (this->buffered)
+			{
+				return this->buffer.size();
+			}
+
 			if (this->fp)
 			{
 				auto i = _ftelli64(this->fp);
@@ -236,6 +511,13 @@ namespace zonetool
 
 		std::vector<std::uint8_t> file::read_bytes(std::size_t size)
 		{
+			if (this->buffered && size)
+			{
+				std::vector<std::uint8_t> bytes(size);
+				this->read(bytes.data(), size, 1);
+				return bytes;
+			}
+
 			if (this->fp && size)
 			{
 				// alloc vector
@@ -305,6 +587,57 @@ namespace zonetool
 				extra_paths.begin(), extra_paths.end());
 		}
 
+		bool mount_pack(const std::string& path)
+		{
+			auto pack = std::make_unique<pack::reader>(path);
+			if (!pack->is_open())
+			{
+				return false;
+			}
+
+			get_packs().emplace_back(std::move(pack));
+			return true;
+		}
+
+		void unmount_packs()
+		{
+			get_packs().clear();
+			remove_temp_path();
+		}
+
+		std::string get_temp_path()
+		{
+			static const auto path = []
+			{
+				// a crash can't clean up, so the folder is named by process to keep instances apart
+				const auto temp_path = (std::filesystem::temp_directory_path() /
+					("zonetool_" + std::to_string(GetCurrentProcessId()))).string() + "\\";
+
+				std::atexit(remove_temp_path);
+				std::at_quick_exit(remove_temp_path);
+
+				return temp_path;
+			}();
+
+			return path;
+		}
+
+		void mount_packs_from_directory(const std::string& dir)
+		{
+			if (!utils::io::directory_exists(dir))
+			{
+				return;
+			}
+
+			for (const auto& path : utils::io::list_files(dir))
+			{
+				if (path.ends_with(pack::extension))
+				{
+					mount_pack(path);
+				}
+			}
+		}
+
 		void set_fastfile(const std::string& ff)
 		{
 			auto& search_paths = get_search_paths();
@@ -314,6 +647,13 @@ namespace zonetool
 			search_paths.emplace_back("zonetool\\");
 			add_paths_from_directory("zonetool_paths");
 
+			unmount_packs();
+			if (std::filesystem::exists("zonetool\\" + ff + pack::extension))
+			{
+				mount_pack("zonetool\\" + ff + pack::extension);
+			}
+			mount_packs_from_directory("zonetool_paths");
+
 			fastfile = ff;
 		}
 
@@ -345,7 +685,7 @@ namespace zonetool
 				}
 			}
 
-			return "";
+			return extract_pack_entry(name);
 		}
 
 		std::string get_dump_path()
@@ -27,6 +27,7 @@ namespace zonetool
 			void initialize(const std::filesystem::path& filepath);
 
 			FILE* get_fp();
+			bool is_open();
 			bool exists(bool use_path);
 			bool exists(void);
 
@@ -72,6 +73,17 @@ namespace zonetool
 			std::string parent_path;
 			std::string filename;
 
+			// set while a dump file is being written, see dump_store
+			std::string staged_path;
+			std::string target_path;
+
+			// entries read from a mounted pack and dump files opened with "wb" are kept in memory until
+			// the raw FILE* is requested
+			std::vector<std::uint8_t> buffer;
+			std::size_t buffer_pos = 0;
+			bool buffered = false;
+
+			void materialize();
 		};
 
 		void set_fastfile(const std::string& ff);
@@ -83,5 +95,13 @@ namespace zonetool
 		void add_path(const std::string& path, bool insert_at_beginning = false);
 		void add_paths_from_directory(const std::string& dir, bool insert_at_beginning = false);
 		std::vector<std::string>& get_search_paths();
+
+		// packs are searched after the loose files of every search path, get_file_path extracts entries that are only
+		// in a pack to the temp path so they can be opened by path
+		bool mount_pack(const std::string& path);
+		void unmount_packs();
+
+		// folder only this process uses, removed when the packs are unmounted and on exit
+		std::string get_temp_path();
 	}
 }
\ No newline at end of file
@@ -0,0 +1,376 @@
+#include <std_include.hpp>
+#include "pack.hpp"
+
+#include "../compression.hpp"
+#include "../utils.hpp"
+
+#include <utils/cryptography.hpp>
+
+namespace zonetool
+{
+	namespace filesystem
+	{
+		namespace pack
+		{
+			namespace
+			{
+				// small entries are stored as is, they rarely compress enough to be worth the frame overhead
+				constexpr auto min_compress_size = 0x100;
+				constexpr auto compression_level = 3;
+
+				bool read_toc(FILE* fp, toc& entries)
+				{
+					header hdr{};
+					_fseeki64(fp, 0, SEEK_SET);
+					if (fread(&hdr, sizeof(header), 1, fp) != 1 || hdr.magic != magic || hdr.version != version)
+					{
+						return false;
+					}
+
+					_fseeki64(fp, hdr.toc_offset, SEEK_SET);
+
+					entries.clear();
+					entries.reserve(hdr.entry_count);
+
+					std::string name;
+					for (auto i = 0u; i < hdr.entry_count; i++)
+					{
+						toc_entry entry{};
+						if (fread(&entry, sizeof(toc_entry), 1, fp) != 1)
+						{
+							return false;
+						}
+
+						name.resize(entry.name_length);
+						if (entry.name_length && fread(name.data(), entry.name_length, 1, fp) != 1)
+						{
+							return false;
+						}
+
+						entries[name] = entry;
+					}
+
+					return true;
+				}
+
+				void write_toc(FILE* fp, const std::uint64_t offset, const toc& entries)
+				{
+					_fseeki64(fp, offset, SEEK_SET);
+					for (const auto& [name, entry] : entries)
+					{
+						fwrite(&entry, sizeof(toc_entry), 1, fp);
+						fwrite(name.data(), name.size(), 1, fp);
+					}
+
+					// the header is updated last, until then readers still see the previous table
+					fflush(fp);
+
+					const header hdr{magic, version, offset, static_cast<std::uint32_t>(entries.size()), 0};
+					_fseeki64(fp, 0, SEEK_SET);
+					fwrite(&hdr, sizeof(header), 1, fp);
+				}
+
+				std::optional<std::vector<std::uint8_t>> read_entry(FILE* fp, const toc_entry& entry)
+				{
+					std::vector<std::uint8_t> stored(entry.stored_size);
+					_fseeki64(fp, entry.offset, SEEK_SET);
+					if (entry.stored_size && fread(stored.data(), entry.stored_size, 1, fp) != 1)
+					{
+						return {};
+					}
+
+					if (entry.flags & ENTRY_ZSTD)
+					{
+						return compression::decompress_zstd(stored.data(), stored.size(), entry.size);
+					}
+
+					return stored;
+				}
+			}
+
+			std::string normalize_name(const std::string& name)
+			{
+				std::string result;
+				result.reserve(name.size());
+
+				for (const auto c : name)
+				{
+					result.push_back(c == '/' ? '\\' : static_cast<char>(std::tolower(static_cast<unsigned char>(c))));
+				}
+
+				return result;
+			}
+
+			bool compact(const std::string& path)
+			{
+				FILE* in = nullptr;
+				if (fopen_s(&in, path.data(), "rb") != 0 || !in)
+				{
+					return false;
+				}
+
+				const auto _0 = gsl::finally([&]
+				{
+					if (in)
+					{
+						fclose(in);
+					}
+				});
+
+				toc entries;
+				if (!read_toc(in, entries))
+				{
+					return false;
+				}
+
+				const auto compact_path = path + ".compact.tmp";
+
+				FILE* out = nullptr;
+				if (fopen_s(&out, compact_path.data(), "wb") != 0 || !out)
+				{
+					return false;
+				}
+
+				// entries are copied as stored in the order they are in the pack, so the old file is read front to back
+				std::vector<toc_entry*> ordered;
+				ordered.reserve(entries.size());
+				for (auto& [name, entry] : entries)
+				{
+					ordered.push_back(&entry);
+				}
+
+				std::sort(ordered.begin(), ordered.end(), [](const toc_entry* a, const toc_entry* b)
+				{
+					return a->offset < b->offset;
+				});
+
+				const header hdr{magic, version, 0, 0, 0};
+				auto failed = fwrite(&hdr, sizeof(header), 1, out) != 1;
+
+				std::uint64_t end = sizeof(header);
+				std::vector<std::uint8_t> stored;
+				for (auto* entry : ordered)
+				{
+					if (failed)
+					{
+						break;
+					}
+
+					stored.resize(entry->stored_size);
+					_fseeki64(in, entry->offset, SEEK_SET);
+					failed = entry->stored_size && (fread(stored.data(), entry->stored_size, 1, in) != 1 ||
+						fwrite(stored.data(), entry->stored_size, 1, out) != 1);
+
+					entry->offset = end;
+					end += entry->stored_size;
+				}
+
+				if (!failed)
+				{
+					write_toc(out, end, entries);
+				}
+
+				failed |= ferror(out) != 0;
+				fclose(out);
+
+				fclose(in);
+				in = nullptr;
+
+				std::error_code ec;
+				if (!failed)
+				{
+					std::filesystem::rename(compact_path, path, ec);
+				}
+
+				if (failed || ec)
+				{
+					ZONETOOL_WARNING("Failed to compact pack \"%s\"", path.data());
+					std::filesystem::remove(compact_path, ec);
+					return false;
+				}
+
+				return true;
+			}
+
+			reader::reader(const std::string& path)
+				: path_(path)
+			{
+				if (fopen_s(&this->fp_, path.data(), "rb") != 0 || !this->fp_)
+				{
+					this->fp_ = nullptr;
+					return;
+				}
+
+				if (!read_toc(this->fp_, this->entries_))
+				{
+					ZONETOOL_ERROR("Pack \"%s\" is invalid", path.data());
+					fclose(this->fp_);
+					this->fp_ = nullptr;
+					this->entries_.clear();
+				}
+			}
+
+			reader::~reader()
+			{
+				if (this->fp_)
+				{
+					fclose(this->fp_);
+				}
+			}
+
+			bool reader::is_open() const
+			{
+				return this->fp_ != nullptr;
+			}
+
+			const std::string& reader::get_path() const
+			{
+				return this->path_;
+			}
+
+			bool reader::contains(const std::string& name) const
+			{
+				return this->entries_.contains(normalize_name(name));
+			}
+
+			std::optional<std::vector<std::uint8_t>> reader::read(const std::string& name)
+			{
+				const auto entry = this->entries_.find(normalize_name(name));
+				if (entry == this->entries_.end())
+				{
+					return {};
+				}
+
+				std::lock_guard _(this->mutex_);
+				return read_entry(this->fp_, entry->second);
+			}
+
+			writer::writer(const std::string& path, const bool compress)
+				: path_(path)
+				, compress_(compress)
+			{
+				// append to an existing pack, the old table of contents becomes dead space
+				if (fopen_s(&this->fp_, path.data(), "r+b") == 0 && this->fp_)
+				{
+					if (read_toc(this->fp_, this->entries_))
+					{
+						_fseeki64(this->fp_, 0, SEEK_END);
+						this->end_ = _ftelli64(this->fp_);
+						return;
+					}
+
+					ZONETOOL_WARNING("Pack \"%s\" is invalid, recreating it", path.data());
+					fclose(this->fp_);
+					this->fp_ = nullptr;
+					this->entries_.clear();
+				}
+
+				if (fopen_s(&this->fp_, path.data(), "w+b") != 0 || !this->fp_)
+				{
+					this->fp_ = nullptr;
+					ZONETOOL_ERROR("Failed to create pack \"%s\"", path.data());
+					return;
+				}
+
+				const header hdr{magic, version, 0, 0, 0};
+				fwrite(&hdr, sizeof(header), 1, this->fp_);
+
+				this->end_ = sizeof(header);
+				this->dirty_ = true;
+			}
+
+			writer::~writer()
+			{
+				this->close();
+			}
+
+			bool writer::is_open() const
+			{
+				return this->fp_ != nullptr;
+			}
+
+			bool writer::add(const std::string& name, const std::uint8_t* data, const std::size_t size)
+			{
+				if (!this->fp_)
+				{
+					return false;
+				}
+
+				const auto key = normalize_name(name);
+				const auto hash = utils::cryptography::fnv1a::compute(data, size);
+
+				const auto existing = this->entries_.find(key);
+				if (existing != this->entries_.end() && existing->second.size == size && existing->second.hash == hash)
+				{
+					const auto stored = read_entry(this->fp_, existing->second);
+					if (stored.has_value() && !std::memcmp(stored->data(), data, size))
+					{
+						return false;
+					}
+				}
+
+				toc_entry entry{};
+				entry.offset = this->end_;
+				entry.size = size;
+				entry.hash = hash;
+				entry.name_length = static_cast<std::uint32_t>(key.size());
+
+				std::vector<std::uint8_t> compressed;
+				if (this->compress_ && size >= min_compress_size)
+				{
+					compressed = compression::compress_zstd(data, size, compression_level);
+				}
+
+				_fseeki64(this->fp_, this->end_, SEEK_SET);
+
+				if (!compressed.empty() && compressed.size() < size)
+				{
+					entry.flags |= ENTRY_ZSTD;
+					entry.stored_size = compressed.size();
+					fwrite(compressed.data(), compressed.size(), 1, this->fp_);
+				}
+				else
+				{
+					entry.stored_size = size;
+					fwrite(data, size, 1, this->fp_);
+				}
+
+				this->end_ += entry.stored_size;
+				this->entries_[key] = entry;
+				this->dirty_ = true;
+
+				return true;
+			}
+
+			void writer::close()
+			{
+				if (!this->fp_)
+				{
+					return;
+				}
+
+				const auto dirty = this->dirty_;
+				if (dirty)
+				{
+					write_toc(this->fp_, this->end_, this->entries_);
+				}
+
+				fclose(this->fp_);
+				this->fp_ = nullptr;
+				this->dirty_ = false;
+
+				// every re-dump of a changed entry leaves its old data behind
+				std::uint64_t live = sizeof(header);
+				for (const auto& [name, entry] : this->entries_)
+				{
+					live += entry.stored_size;
+				}
+
+				if (dirty && this->end_ - live > live)
+				{
+					compact(this->path_);
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace zonetool
+{
+	namespace filesystem
+	{
+		// single file container for dumped files: entry data is appended, a table of contents is written
+		// behind it on close and the header points at the newest table, so an interrupted append keeps the old one
+		namespace pack
+		{
+			constexpr auto extension = ".zpk";
+			constexpr std::uint32_t magic = 0x4B50545A; // ZTPK
+			constexpr std::uint32_t version = 1;
+
+			enum entry_flags : std::uint32_t
+			{
+				ENTRY_ZSTD = 1 << 0,
+			};
+
+#pragma pack(push, 1)
+			struct header
+			{
+				std::uint32_t magic;
+				std::uint32_t version;
+				std::uint64_t toc_offset;
+				std::uint32_t entry_count;
+				std::uint32_t reserved;
+			};
+
+			// followed by `name_length` characters of the normalized entry name
+			struct toc_entry
+			{
+				std::uint64_t offset;
+				std::uint64_t stored_size;
+				std::uint64_t size;
+				std::uint64_t hash;
+				std::uint32_t flags;
+				std::uint32_t name_length;
+			};
+#pragma pack(pop)
+
+			using toc = std::unordered_map<std::string, toc_entry>;
+
+			// entry names are case insensitive and use backslashes, like the search paths
+			std::string normalize_name(const std::string& name);
+
+			// rewrites the pack with only its live entries, replaced entries and old tables of contents are dropped.
+			// the pack is left as it was when this fails
+			bool compact(const std::string& path);
+
+			class reader
+			{
+			public:
+				explicit reader(const std::string& path);
+				~reader();
+
+				reader(const reader&) = delete;
+				reader& operator=(const reader&) = delete;
+
+				bool is_open() const;
+				const std::string& get_path() const;
+
+				bool contains(const std::string& name) const;
+				std::optional<std::vector<std::uint8_t>> read(const std::string& name);
+
+			private:
+				std::string path_;
+				FILE* fp_ = nullptr;
+				std::mutex mutex_;
+				toc entries_;
+			};
+
+			class writer
+			{
+			public:
+				writer(const std::string& path, bool compress);
+				~writer();
+
+				writer(const writer&) = delete;
+				writer& operator=(const writer&) = delete;
+
+				bool is_open() const;
+
+				// returns false when the entry already holds the same bytes and nothing was appended
+				bool add(const std::string& name, const std::uint8_t* data, std::size_t size);
+
+				// writes the table of contents, entries added after this are lost. compacts the pack once more
+				// than half of it is dead space
+				void close();
+
+			private:
+				std::string path_;
+				FILE* fp_ = nullptr;
+				bool compress_;
+				bool dirty_ = false;
+				std::uint64_t end_ = 0;
+				toc entries_;
+			};
+		}
+	}
+}
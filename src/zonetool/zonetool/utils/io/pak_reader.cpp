@@ -0,0 +1,168 @@
+#include <std_include.hpp>
+#include "pak_reader.hpp"
+
+#include "../dump_queue.hpp"
+#include "../utils.hpp"
+
+namespace zonetool
+{
+	namespace filesystem
+	{
+		namespace pak_reader
+		{
+			namespace
+			{
+				// ranges are collected into batches so each batch can be ordered by offset before it is read
+				constexpr auto batch_size = 256u;
+
+				class mapped_pak
+				{
+				public:
+					explicit mapped_pak(const std::string& path)
+					{
+						this->file_ = CreateFileA(path.data(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr,
+							OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+						if (this->file_ == INVALID_HANDLE_VALUE)
+						{
+							return;
+						}
+
+						LARGE_INTEGER size{};
+						if (!GetFileSizeEx(this->file_, &size) || !size.QuadPart)
+						{
+							return;
+						}
+
+						this->mapping_ = CreateFileMappingA(this->file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+						if (!this->mapping_)
+						{
+							ZONETOOL_ERROR("Failed to map \"%s\" (%lu)", path.data(), GetLastError());
+							return;
+						}
+
+						this->view_ = static_cast<const std::uint8_t*>(MapViewOfFile(this->mapping_, FILE_MAP_READ, 0, 0, 0));
+						if (!this->view_)
+						{
+							ZONETOOL_ERROR("Failed to map \"%s\" (%lu)", path.data(), GetLastError());
+							return;
+						}
+
+						this->size_ = static_cast<std::uint64_t>(size.QuadPart);
+					}
+
+					~mapped_pak()
+					{
+						if (this->view_)
+						{
+							UnmapViewOfFile(this->view_);
+						}
+
+						if (this->mapping_)
+						{
+							CloseHandle(this->mapping_);
+						}
+
+						if (this->file_ != INVALID_HANDLE_VALUE)
+						{
+							CloseHandle(this->file_);
+						}
+					}
+
+					mapped_pak(const mapped_pak&) = delete;
+					mapped_pak& operator=(const mapped_pak&) = delete;
+
+					bool contains(const std::uint64_t offset, const std::uint64_t size) const
+					{
+						return this->view_ && offset <= this->size_ && size <= this->size_ - offset;
+					}
+
+					const std::uint8_t* data() const
+					{
+						return this->view_;
+					}
+
+				private:
+					HANDLE file_ = INVALID_HANDLE_VALUE;
+					HANDLE mapping_ = nullptr;
+					const std::uint8_t* view_ = nullptr;
+					std::uint64_t size_ = 0;
+				};
+
+				struct pending_read
+				{
+					const mapped_pak* pak;
+					std::uint64_t offset;
+					std::uint64_t size;
+					callback on_read;
+				};
+
+				std::mutex mutex;
+				std::unordered_map<std::string, std::unique_ptr<mapped_pak>> paks;
+				std::vector<pending_read> pending;
+
+				dump_queue& get_workers()
+				{
+					static dump_queue workers(std::thread::hardware_concurrency());
+					return workers;
+				}
+
+				// the queue starts tasks in push order, so workers fault the mapped pages in mostly ascending order
+				void dispatch()
+				{
+					std::sort(pending.begin(), pending.end(), [](const pending_read& a, const pending_read& b)
+					{
+						return a.pak != b.pak ? a.pak < b.pak : a.offset < b.offset;
+					});
+
+					auto& workers = get_workers();
+					for (auto& read : pending)
+					{
+						workers.push([read = std::move(read)]
+						{
+							read.on_read(read.pak->data() + read.offset, static_cast<std::size_t>(read.size));
+						});
+					}
+
+					pending.clear();
+				}
+			}
+
+			bool request(const std::string& path, const std::uint64_t offset, const std::uint64_t size, callback on_read)
+			{
+				std::lock_guard _(mutex);
+
+				auto& pak = paks[path];
+				if (!pak)
+				{
+					pak = std::make_unique<mapped_pak>(path);
+				}
+
+				if (!pak->contains(offset, size))
+				{
+					return false;
+				}
+
+				pending.emplace_back(pending_read{pak.get(), offset, size, std::move(on_read)});
+				if (pending.size() >= batch_size)
+				{
+					dispatch();
+				}
+
+				return true;
+			}
+
+			void finish()
+			{
+				{
+					std::lock_guard _(mutex);
+					dispatch();
+				}
+
+				get_workers().wait();
+
+				std::lock_guard _(mutex);
+				paks.clear();
+			}
+		}
+	}
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+
+namespace zonetool
+{
+	namespace filesystem
+	{
+		// reads byte ranges out of the game's .pak files (streamed image data): every pak is mapped once and stays
+		// mapped until finish(), queued ranges are handed to a worker pool in file offset order
+		namespace pak_reader
+		{
+			// runs on a pak reader worker, `data` points into the mapped pak and is only valid during the call
+			using callback = std::function<void(const std::uint8_t* data, std::size_t size)>;
+
+			// queues [offset, offset + size) of the pak at `path`, false when the pak can't be mapped or doesn't hold the range
+			bool request(const std::string& path, std::uint64_t offset, std::uint64_t size, callback on_read);
+
+			// hands out every queued range, waits for all callbacks and unmaps the paks
+			void finish();
+		}
+	}
+}
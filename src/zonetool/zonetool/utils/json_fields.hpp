@@ -0,0 +1,342 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "memory.hpp"
+
+namespace zonetool::json_fields
+{
+	template <typename J>
+	using read_handler = void(*)(void* field, const J& value, zone_memory* mem);
+
+	template <typename J>
+	struct field
+	{
+		const char* name;
+		std::size_t offset;
+		read_handler<J> read;
+	};
+
+	template <typename Type, typename J>
+	void read_scalar(void* field, const J& value, zone_memory*)
+	{
+		*static_cast<Type*>(field) = value.template get<Type>();
+	}
+
+	// fills an inline array, or allocates `Size` elements when the member is a pointer
+	template <typename Member, typename Type, std::size_t Size, typename J>
+	void read_array(void* field, const J& value, zone_memory* mem)
+	{
+		Type* dest = nullptr;
+		if constexpr (std::is_pointer_v<Member>)
+		{
+			dest = mem->allocate<Type>(Size);
+			*static_cast<Type**>(field) = dest;
+		}
+		else
+		{
+			dest = static_cast<Type*>(field);
+		}
+
+		for (auto i = 0u; i < Size; i++)
+		{
+			dest[i] = value.at(i).template get<Type>();
+		}
+	}
+
+	template <typename J>
+	void read_string(void* field, const J& value, zone_memory* mem)
+	{
+		*static_cast<const char**>(field) = mem->duplicate_string(value.template get<std::string>());
+	}
+
+	// like read_string, but an empty string is stored as null
+	template <typename J>
+	void read_string_or_null(void* field, const J& value, zone_memory* mem)
+	{
+		const auto& str = value.template get_ref<const std::string&>();
+		*static_cast<const char**>(field) = str.empty() ? nullptr : mem->duplicate_string(str);
+	}
+
+	// inline array of strings, null or empty entries stay null
+	template <std::size_t Size, typename J>
+	void read_string_array(void* field, const J& value, zone_memory* mem)
+	{
+		auto* strings = static_cast<const char**>(field);
+		for (auto i = 0u; i < Size; i++)
+		{
+			const auto& entry = value.at(i);
+			strings[i] = nullptr;
+			if (entry.is_string())
+			{
+				read_string_or_null(&strings[i], entry, mem);
+			}
+		}
+	}
+
+	// allocates a name-only stub of the referenced asset, empty names stay null
+	template <typename Member, typename J>
+	void read_asset(void* field, const J& value, zone_memory* mem)
+	{
+		static_assert(std::is_pointer_v<Member>, "Asset field is not a pointer");
+
+		if (!value.is_string())
+		{
+			return;
+		}
+
+		const auto& name = value.template get_ref<const std::string&>();
+		if (name.empty())
+		{
+			return;
+		}
+
+		auto* asset = mem->manual_allocate<std::remove_pointer_t<Member>>(sizeof(const char*));
+		asset->name = mem->duplicate_string(name);
+		*static_cast<Member*>(field) = asset;
+	}
+
+	// fills an inline array of asset pointers, or allocates `Size` of them when the member is a pointer
+	template <typename Member, std::size_t Size, typename J>
+	void read_asset_array(void* field, const J& value, zone_memory* mem)
+	{
+		using asset_ptr = std::remove_pointer_t<std::decay_t<Member>>;
+
+		asset_ptr* assets = nullptr;
+		if constexpr (std::is_array_v<Member>)
+		{
+			assets = static_cast<asset_ptr*>(field);
+		}
+		else
+		{
+			assets = mem->allocate<asset_ptr>(Size);
+			*static_cast<Member*>(field) = assets;
+		}
+
+		for (auto i = 0u; i < Size; i++)
+		{
+			read_asset<asset_ptr>(&assets[i], value.at(i), mem);
+		}
+	}
+
+	// resolves the referenced asset with `Find`, for games that look assets up while parsing instead of
+	// writing name stubs. an empty name clears the field, so it also overrides a copied base asset
+	template <typename Member, auto Find, typename J>
+	void read_asset_header(void* field, const J& value, zone_memory*)
+	{
+		static_assert(std::is_pointer_v<Member>, "Asset field is not a pointer");
+
+		auto* asset = static_cast<Member*>(field);
+		if (!value.is_string())
+		{
+			*asset = nullptr;
+			return;
+		}
+
+		const auto& name = value.template get_ref<const std::string&>();
+		*asset = name.empty() ? nullptr : static_cast<Member>(Find(name.data()));
+	}
+
+	template <typename Member, std::size_t Size, auto Find, typename J>
+	void read_asset_header_array(void* field, const J& value, zone_memory* mem)
+	{
+		using asset_ptr = std::remove_pointer_t<Member>;
+
+		auto* assets = mem->allocate<asset_ptr>(Size);
+		*static_cast<Member*>(field) = assets;
+
+		for (auto i = 0u; i < Size; i++)
+		{
+			read_asset_header<asset_ptr, Find>(&assets[i], value.at(i), mem);
+		}
+	}
+
+	// name stubs for every entry of a json array whose length is stored in `count`. lists sharing
+	// one count have to agree on it
+	template <typename T, typename Count, typename J>
+	void read_asset_list(T**& assets, const J& value, Count& count, zone_memory* mem)
+	{
+		if (count) assert(count == static_cast<Count>(value.size()));
+		count = static_cast<Count>(value.size());
+
+		if (value.is_null())
+		{
+			assets = nullptr;
+			return;
+		}
+
+		assets = mem->allocate<T*>(count);
+		for (auto i = 0u; i < count; i++)
+		{
+			read_asset<T*>(&assets[i], value[i], mem);
+		}
+	}
+
+	constexpr std::uint64_t hash_key(const std::string_view key)
+	{
+		auto hash = 0xCBF29CE484222325ull;
+		for (const auto c : key)
+		{
+			hash ^= static_cast<std::uint8_t>(c);
+			hash *= 0x100000001B3ull;
+		}
+
+		return hash;
+	}
+
+	// maps json keys to struct members, so an object is read in a single pass over its keys
+	// instead of looking up (and inserting) every known field by name. the fields are sorted
+	// by the hash of their name when the table is built, which happens at compile time
+	template <typename T, std::size_t N, typename J = nlohmann::json>
+	class field_table
+	{
+	public:
+		constexpr field_table(const field<J> (&fields)[N])
+		{
+			for (auto i = 0u; i < N; i++)
+			{
+				this->fields_[i] = {fields[i], hash_key(fields[i].name)};
+			}
+
+			std::sort(this->fields_.begin(), this->fields_.end(), [](const auto& a, const auto& b)
+			{
+				return a.hash < b.hash;
+			});
+
+			for (auto i = 1u; i < N; i++)
+			{
+				if (std::string_view(this->fields_[i - 1].entry.name) == this->fields_[i].entry.name)
+				{
+					throw std::logic_error("Field is in the table twice");
+				}
+			}
+		}
+
+		constexpr const field<J>* find(const std::string_view key) const
+		{
+			const auto hash = hash_key(key);
+			auto itr = std::lower_bound(this->fields_.begin(), this->fields_.end(), hash, [](const auto& entry, const std::uint64_t value)
+			{
+				return entry.hash < value;
+			});
+
+			for (; itr != this->fields_.end() && itr->hash == hash; ++itr)
+			{
+				if (key == itr->entry.name)
+				{
+					return &itr->entry;
+				}
+			}
+
+			return nullptr;
+		}
+
+		// unknown keys and null values are skipped, missing fields keep their current value
+		void read(T* object, const J& data, zone_memory* mem) const
+		{
+			if (!data.is_object())
+			{
+				return;
+			}
+
+			for (auto it = data.begin(); it != data.end(); ++it)
+			{
+				if (it->is_null())
+				{
+					continue;
+				}
+
+				const auto* entry = this->find(it.key());
+				if (entry)
+				{
+					entry->read(reinterpret_cast<std::uint8_t*>(object) + entry->offset, *it, mem);
+				}
+			}
+		}
+
+	private:
+		struct hashed_field
+		{
+			field<J> entry{};
+			std::uint64_t hash = 0;
+		};
+
+		std::array<hashed_field, N> fields_{};
+	};
+
+	// builds a table from a braced list of fields, the size is deduced from it:
+	// constexpr auto fields = make_field_table<Struct>({JSON_FIELD(...), ...});
+	template <typename T, typename J = nlohmann::json, std::size_t N>
+	constexpr field_table<T, N, J> make_field_table(const field<J> (&fields)[N])
+	{
+		return field_table<T, N, J>(fields);
+	}
+
+	// value of `key` in an object, or null when the key (or the object) isn't there. unlike operator[]
+	// this neither inserts the key nor asserts on a const object
+	template <typename J>
+	const J& get(const J& object, const typename J::object_t::key_type& key)
+	{
+		static const J null_value{};
+		if (!object.is_object())
+		{
+			return null_value;
+		}
+
+		const auto itr = object.find(key);
+		return itr != object.end() ? *itr : null_value;
+	}
+
+	// element `index` of an array, or null when it is out of range or not an array
+	template <typename J>
+	const J& get(const J& array, const std::size_t index)
+	{
+		static const J null_value{};
+		return array.is_array() && index < array.size() ? array[index] : null_value;
+	}
+}
+
+#define JSON_FIELD(__struct__, __type__, __field__) \
+	{#__field__, offsetof(__struct__, __field__), zonetool::json_fields::read_scalar<__type__>}
+
+#define JSON_FIELD_ARR(__struct__, __type__, __field__, __size__) \
+	{#__field__, offsetof(__struct__, __field__), \
+		zonetool::json_fields::read_array<decltype(__struct__::__field__), __type__, __size__>}
+
+#define JSON_FIELD_NAMED(__struct__, __type__, __field__, __name__) \
+	{__name__, offsetof(__struct__, __field__), zonetool::json_fields::read_scalar<__type__>}
+
+#define JSON_FIELD_STRING(__struct__, __field__) \
+	{#__field__, offsetof(__struct__, __field__), zonetool::json_fields::read_string}
+
+#define JSON_FIELD_STRING_NAMED(__struct__, __field__, __name__) \
+	{__name__, offsetof(__struct__, __field__), zonetool::json_fields::read_string}
+
+#define JSON_FIELD_STRING_OR_NULL(__struct__, __field__) \
+	{#__field__, offsetof(__struct__, __field__), zonetool::json_fields::read_string_or_null}
+
+#define JSON_FIELD_STRING_ARR(__struct__, __field__, __size__) \
+	{#__field__, offsetof(__struct__, __field__), zonetool::json_fields::read_string_array<__size__>}
+
+#define JSON_FIELD_ASSET(__struct__, __field__) \
+	{#__field__, offsetof(__struct__, __field__), zonetool::json_fields::read_asset<decltype(__struct__::__field__)>}
+
+#define JSON_FIELD_ASSET_ARR(__struct__, __field__, __size__) \
+	{#__field__, offsetof(__struct__, __field__), \
+		zonetool::json_fields::read_asset_array<decltype(__struct__::__field__), __size__>}
+
+#define JSON_FIELD_ASSET_HEADER(__struct__, __field__, __find__) \
+	{#__field__, offsetof(__struct__, __field__), \
+		zonetool::json_fields::read_asset_header<decltype(__struct__::__field__), __find__>}
+
+#define JSON_FIELD_ASSET_HEADER_ARR(__struct__, __field__, __size__, __find__) \
+	{#__field__, offsetof(__struct__, __field__), \
+		zonetool::json_fields::read_asset_header_array<decltype(__struct__::__field__), __size__, __find__>}
@@ -0,0 +1,224 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace zonetool
+{
+	// appends `value` to `out` as JSON string contents (without quotes), in a single pass
+	inline void json_escape(std::string& out, const std::string_view& value)
+	{
+		static constexpr char hex[] = "0123456789abcdef";
+
+		auto run_start = value.data();
+		const auto* end = value.data() + value.size();
+
+		for (const auto* c = value.data(); c < end; c++)
+		{
+			const auto ch = static_cast<unsigned char>(*c);
+			if (ch >= 0x20 && ch != '"' && ch != '\\')
+			{
+				continue;
+			}
+
+			out.append(run_start, c - run_start);
+			run_start = c + 1;
+
+			switch (ch)
+			{
+			case '"': out.append("\\\""); break;
+			case '\\': out.append("\\\\"); break;
+			case '\n': out.append("\\n"); break;
+			case '\r': out.append("\\r"); break;
+			case '\t': out.append("\\t"); break;
+			case '\b': out.append("\\b"); break;
+			case '\f': out.append("\\f"); break;
+			default:
+			{
+				const char escaped[] = {'\\', 'u', '0', '0', hex[ch >> 4], hex[ch & 0xF]};
+				out.append(escaped, sizeof(escaped));
+				break;
+			}
+			}
+		}
+
+		out.append(run_start, end - run_start);
+	}
+
+	// minimal streaming JSON writer, output is buffered and flushed to `fp` once it grows past `flush_size`
+	class json_writer
+	{
+	public:
+		json_writer(FILE* fp = nullptr, const std::size_t flush_size = 1024 * 1024)
+			: fp_(fp)
+			, flush_size_(flush_size)
+		{
+			this->buffer_.reserve(fp ? flush_size + 0x1000 : 0x1000);
+		}
+
+		~json_writer()
+		{
+			this->flush();
+		}
+
+		json_writer(const json_writer&) = delete;
+		json_writer& operator=(const json_writer&) = delete;
+
+		json_writer& begin_object()
+		{
+			this->separator();
+			this->buffer_.push_back('{');
+			this->first_.push_back(true);
+			return *this;
+		}
+
+		json_writer& end_object()
+		{
+			this->first_.pop_back();
+			this->buffer_.push_back('}');
+			this->check_flush();
+			return *this;
+		}
+
+		json_writer& begin_array()
+		{
+			this->separator();
+			this->buffer_.push_back('[');
+			this->first_.push_back(true);
+			return *this;
+		}
+
+		json_writer& end_array()
+		{
+			this->first_.pop_back();
+			this->buffer_.push_back(']');
+			this->check_flush();
+			return *this;
+		}
+
+		json_writer& key(const std::string_view& name)
+		{
+			this->separator();
+			this->write_string(name);
+			this->buffer_.push_back(':');
+			this->after_key_ = true;
+			return *this;
+		}
+
+		json_writer& value(const std::string_view& str)
+		{
+			this->separator();
+			this->write_string(str);
+			return *this;
+		}
+
+		json_writer& value(const char* str)
+		{
+			return this->value(std::string_view(str));
+		}
+
+		json_writer& value(const std::uint64_t number)
+		{
+			this->separator();
+			this->buffer_.append(std::to_string(number));
+			return *this;
+		}
+
+		json_writer& value(const bool boolean)
+		{
+			this->separator();
+			this->buffer_.append(boolean ? "true" : "false");
+			return *this;
+		}
+
+		// writes already serialized JSON (e.g. a cached fragment) as the next value
+		json_writer& raw(const std::string_view& json)
+		{
+			this->separator();
+			this->buffer_.append(json);
+			this->check_flush();
+			return *this;
+		}
+
+		// inserts a newline between values, keeps large outputs diffable without full pretty printing
+		json_writer& newline()
+		{
+			this->buffer_.push_back('\n');
+			return *this;
+		}
+
+		const std::string& get_buffer() const
+		{
+			return this->buffer_;
+		}
+
+		std::string release()
+		{
+			return std::move(this->buffer_);
+		}
+
+		std::size_t flush()
+		{
+			if (!this->fp_ || this->buffer_.empty())
+			{
+				return 0;
+			}
+
+			const auto written = std::fwrite(this->buffer_.data(), 1, this->buffer_.size(), this->fp_);
+			this->total_written_ += written;
+			this->buffer_.clear();
+			return written;
+		}
+
+		std::size_t size() const
+		{
+			return this->total_written_ + this->buffer_.size();
+		}
+
+	private:
+		void separator()
+		{
+			if (this->after_key_)
+			{
+				this->after_key_ = false;
+				return;
+			}
+
+			if (this->first_.empty())
+			{
+				return;
+			}
+
+			if (this->first_.back())
+			{
+				this->first_.back() = false;
+				return;
+			}
+
+			this->buffer_.push_back(',');
+		}
+
+		void write_string(const std::string_view& str)
+		{
+			this->buffer_.push_back('"');
+			json_escape(this->buffer_, str);
+			this->buffer_.push_back('"');
+		}
+
+		void check_flush()
+		{
+			if (this->fp_ && this->buffer_.size() >= this->flush_size_)
+			{
+				this->flush();
+			}
+		}
+
+		FILE* fp_;
+		std::size_t flush_size_;
+		std::size_t total_written_ = 0;
+		std::string buffer_;
+		std::vector<bool> first_;
+		bool after_key_ = false;
+	};
+}
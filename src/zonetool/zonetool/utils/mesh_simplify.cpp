@@ -0,0 +1,370 @@
+#include <std_include.hpp>
+#include "mesh_simplify.hpp"
+
+#include "utils.hpp"
+
+#include <array>
+#include <unordered_map>
+
+namespace zonetool::mesh_simplify
+{
+	namespace
+	{
+		// collapses that turn a triangle further than this (cosine between the normals) are rejected
+		constexpr auto min_normal_dot = 0.25;
+
+		struct vec3
+		{
+			double x;
+			double y;
+			double z;
+		};
+
+		vec3 sub(const vec3& a, const vec3& b)
+		{
+			return {a.x - b.x, a.y - b.y, a.z - b.z};
+		}
+
+		vec3 cross(const vec3& a, const vec3& b)
+		{
+			return {a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x};
+		}
+
+		double dot(const vec3& a, const vec3& b)
+		{
+			return a.x * b.x + a.y * b.y + a.z * b.z;
+		}
+
+		// symmetric 4x4 matrix of summed plane equations, evaluates to the weighted squared distance to those planes
+		struct quadric
+		{
+			double xx, xy, xz, xw;
+			double yy, yz, yw;
+			double zz, zw;
+			double ww;
+
+			void add_plane(const vec3& n, const double d, const double weight)
+			{
+				xx += weight * n.x * n.x;
+				xy += weight * n.x * n.y;
+				xz += weight * n.x * n.z;
+				xw += weight * n.x * d;
+				yy += weight * n.y * n.y;
+				yz += weight * n.y * n.z;
+				yw += weight * n.y * d;
+				zz += weight * n.z * n.z;
+				zw += weight * n.z * d;
+				ww += weight * d * d;
+			}
+
+			void add(const quadric& other)
+			{
+				xx += other.xx;
+				xy += other.xy;
+				xz += other.xz;
+				xw += other.xw;
+				yy += other.yy;
+				yz += other.yz;
+				yw += other.yw;
+				zz += other.zz;
+				zw += other.zw;
+				ww += other.ww;
+			}
+
+			double evaluate(const vec3& p) const
+			{
+				return xx * p.x * p.x + 2.0 * xy * p.x * p.y + 2.0 * xz * p.x * p.z + 2.0 * xw * p.x
+					+ yy * p.y * p.y + 2.0 * yz * p.y * p.z + 2.0 * yw * p.y
+					+ zz * p.z * p.z + 2.0 * zw * p.z
+					+ ww;
+			}
+		};
+
+		struct collapse
+		{
+			double cost;
+			std::uint32_t from;
+			std::uint32_t to;
+			std::uint32_t version;
+
+			bool operator>(const collapse& other) const
+			{
+				return cost > other.cost;
+			}
+		};
+
+		std::uint32_t get_edge_key(const std::uint32_t a, const std::uint32_t b)
+		{
+			return a < b ? (a << 16) | b : (b << 16) | a;
+		}
+	}
+
+	result simplify(const mesh& mesh, const std::size_t target_tri_count)
+	{
+		const auto vertex_count = mesh.vertex_count;
+		const auto tri_count = mesh.tri_count;
+
+		result result;
+		result.remap.resize(vertex_count);
+		for (auto v = 0u; v < vertex_count; v++)
+		{
+			result.remap[v] = static_cast<std::uint16_t>(v);
+		}
+
+		result.triangles.resize(tri_count);
+		for (auto t = 0u; t < tri_count; t++)
+		{
+			result.triangles[t] = t;
+		}
+
+		for (auto i = 0u; i < tri_count * 3; i++)
+		{
+			if (mesh.indices[i] >= vertex_count)
+			{
+				return result;
+			}
+		}
+
+		if (tri_count <= target_tri_count || vertex_count > 0x10000)
+		{
+			return result;
+		}
+
+		std::vector<vec3> positions(vertex_count);
+		for (auto v = 0u; v < vertex_count; v++)
+		{
+			const auto* xyz = reinterpret_cast<const float*>(reinterpret_cast<const std::uint8_t*>(mesh.positions) + v * mesh.position_stride);
+			positions[v] = {xyz[0], xyz[1], xyz[2]};
+		}
+
+		std::vector<std::array<std::uint32_t, 3>> tris(tri_count);
+		std::vector<bool> tri_alive(tri_count, true);
+		std::vector<std::vector<std::uint32_t>> vertex_tris(vertex_count);
+		std::unordered_map<std::uint32_t, std::uint32_t> edge_use;
+
+		for (auto t = 0u; t < tri_count; t++)
+		{
+			for (auto c = 0u; c < 3; c++)
+			{
+				tris[t][c] = mesh.indices[t * 3 + c];
+				vertex_tris[tris[t][c]].emplace_back(t);
+			}
+
+			for (auto c = 0u; c < 3; c++)
+			{
+				edge_use[get_edge_key(tris[t][c], tris[t][(c + 1) % 3])]++;
+			}
+		}
+
+		// seams are split vertices, so their edges are open like the mesh border. non manifold edges stay as well
+		std::vector<bool> locked(vertex_count, false);
+		for (const auto& [key, count] : edge_use)
+		{
+			if (count != 2)
+			{
+				locked[key >> 16] = true;
+				locked[key & 0xFFFF] = true;
+			}
+		}
+
+		std::vector<quadric> quadrics(vertex_count);
+		for (const auto& tri : tris)
+		{
+			const auto normal = cross(sub(positions[tri[1]], positions[tri[0]]), sub(positions[tri[2]], positions[tri[0]]));
+			const auto length = std::sqrt(dot(normal, normal));
+			if (length <= 0.0)
+			{
+				continue;
+			}
+
+			// weighted by area so large faces keep their shape
+			const vec3 n = {normal.x / length, normal.y / length, normal.z / length};
+			const auto d = -dot(n, positions[tri[0]]);
+			for (const auto v : tri)
+			{
+				quadrics[v].add_plane(n, d, length * 0.5);
+			}
+		}
+
+		std::vector<bool> vertex_dead(vertex_count, false);
+		std::vector<std::uint32_t> versions(vertex_count, 0);
+		std::priority_queue<collapse, std::vector<collapse>, std::greater<>> queue;
+
+		const auto same_group = [&](const std::uint32_t a, const std::uint32_t b)
+		{
+			return mesh.groups.empty() || mesh.groups[a] == mesh.groups[b];
+		};
+
+		const auto push_collapse = [&](const std::uint32_t from, const std::uint32_t to)
+		{
+			if (from == to || locked[from] || vertex_dead[from] || vertex_dead[to] || !same_group(from, to))
+			{
+				return;
+			}
+
+			queue.push({quadrics[from].evaluate(positions[to]), from, to, versions[from]});
+		};
+
+		const auto push_collapses = [&](const std::uint32_t from)
+		{
+			for (const auto t : vertex_tris[from])
+			{
+				if (!tri_alive[t])
+				{
+					continue;
+				}
+
+				for (const auto to : tris[t])
+				{
+					push_collapse(from, to);
+				}
+			}
+		};
+
+		for (auto v = 0u; v < vertex_count; v++)
+		{
+			push_collapses(v);
+		}
+
+		const auto contains = [&](const std::uint32_t t, const std::uint32_t v)
+		{
+			return tris[t][0] == v || tris[t][1] == v || tris[t][2] == v;
+		};
+
+		// moving `from` onto `to` must not fold any triangle that stays over
+		const auto flips = [&](const std::uint32_t from, const std::uint32_t to)
+		{
+			for (const auto t : vertex_tris[from])
+			{
+				if (!tri_alive[t] || contains(t, to))
+				{
+					continue;
+				}
+
+				auto moved = tris[t];
+				for (auto& v : moved)
+				{
+					if (v == from)
+					{
+						v = to;
+					}
+				}
+
+				const auto before = cross(sub(positions[tris[t][1]], positions[tris[t][0]]), sub(positions[tris[t][2]], positions[tris[t][0]]));
+				const auto after = cross(sub(positions[moved[1]], positions[moved[0]]), sub(positions[moved[2]], positions[moved[0]]));
+				const auto lengths = std::sqrt(dot(before, before) * dot(after, after));
+				if (lengths <= 0.0 || dot(before, after) < min_normal_dot * lengths)
+				{
+					return true;
+				}
+			}
+
+			return false;
+		};
+
+		auto live_tri_count = tri_count;
+		std::vector<std::uint32_t> collapsed_into(vertex_count);
+		for (auto v = 0u; v < vertex_count; v++)
+		{
+			collapsed_into[v] = v;
+		}
+
+		while (live_tri_count > target_tri_count && !queue.empty())
+		{
+			const auto entry = queue.top();
+			queue.pop();
+
+			const auto from = entry.from;
+			const auto to = entry.to;
+			if (vertex_dead[from] || vertex_dead[to] || versions[from] != entry.version)
+			{
+				continue;
+			}
+
+			// the edge may be gone since the entry was queued
+			auto shares_edge = false;
+			for (const auto t : vertex_tris[from])
+			{
+				if (tri_alive[t] && contains(t, to))
+				{
+					shares_edge = true;
+					break;
+				}
+			}
+
+			if (!shares_edge || flips(from, to))
+			{
+				continue;
+			}
+
+			for (const auto t : vertex_tris[from])
+			{
+				if (!tri_alive[t])
+				{
+					continue;
+				}
+
+				if (contains(t, to))
+				{
+					tri_alive[t] = false;
+					live_tri_count--;
+					continue;
+				}
+
+				for (auto& v : tris[t])
+				{
+					if (v == from)
+					{
+						v = to;
+					}
+				}
+
+				vertex_tris[to].emplace_back(t);
+			}
+
+			vertex_dead[from] = true;
+			vertex_tris[from].clear();
+			collapsed_into[from] = to;
+
+			quadrics[to].add(quadrics[from]);
+			versions[to]++;
+
+			// `to` carries more error now, its neighbours can collapse into it instead of `from`
+			push_collapses(to);
+			for (const auto t : vertex_tris[to])
+			{
+				if (!tri_alive[t])
+				{
+					continue;
+				}
+
+				for (const auto v : tris[t])
+				{
+					push_collapse(v, to);
+				}
+			}
+		}
+
+		for (auto v = 0u; v < vertex_count; v++)
+		{
+			auto target = v;
+			while (collapsed_into[target] != target)
+			{
+				target = collapsed_into[target];
+			}
+
+			result.remap[v] = static_cast<std::uint16_t>(target);
+		}
+
+		result.triangles.clear();
+		for (auto t = 0u; t < tri_count; t++)
+		{
+			if (tri_alive[t])
+			{
+				result.triangles.emplace_back(t);
+			}
+		}
+
+		return result;
+	}
+}
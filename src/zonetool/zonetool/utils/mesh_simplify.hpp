@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace zonetool::mesh_simplify
+{
+	struct mesh
+	{
+		const float* positions; // xyz of the first vertex
+		std::size_t position_stride; // bytes from one vertex position to the next
+		std::size_t vertex_count;
+		const std::uint16_t* indices;
+		std::size_t tri_count;
+
+		// vertices only collapse into vertices of the same group (rigid list, bone influences...), empty if all are alike
+		std::vector<std::uint32_t> groups;
+	};
+
+	struct result
+	{
+		// triangles that are left, in their original order
+		std::vector<std::uint32_t> triangles;
+
+		// vertex each vertex was collapsed into, its own index when it is kept
+		std::vector<std::uint16_t> remap;
+	};
+
+	// collapses edges into one of their vertices ordered by quadric error until `target_tri_count` triangles are left or
+	// nothing can be collapsed anymore. vertices keep their position and attributes, vertices on open edges (mesh borders
+	// and the uv or normal seams vertices are split at) are never collapsed
+	result simplify(const mesh& mesh, std::size_t target_tri_count);
+}
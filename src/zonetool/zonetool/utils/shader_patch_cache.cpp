@@ -0,0 +1,102 @@
+#include <std_include.hpp>
+#include "shader_patch_cache.hpp"
+
+#include "utils.hpp"
+
+#include <utils/cryptography.hpp>
+#include <utils/io.hpp>
+
+namespace zonetool::shader_patch_cache
+{
+	namespace
+	{
+		constexpr auto cache_path = "dump\\_cache\\shaders\\";
+
+		// bump when a patch function changes its output, persistent entries of older versions are ignored then
+		constexpr auto cache_version = 1;
+
+		std::atomic_bool persistent_enabled = false;
+
+		std::mutex cache_mutex;
+		std::unordered_map<std::string, std::shared_ptr<const std::string>> cache;
+
+		std::string get_key(const char* name, const std::string& program, const std::string& params)
+		{
+			std::string data;
+			data.reserve(program.size() + params.size() + 64);
+			data.append(std::to_string(cache_version)).push_back('\0');
+			data.append(name).push_back('\0');
+			data.append(std::to_string(params.size())).push_back('\0');
+			data.append(params);
+			data.append(program);
+
+			return utils::cryptography::sha1::compute(data, true);
+		}
+
+		std::shared_ptr<const std::string> find(const std::string& key)
+		{
+			std::lock_guard _(cache_mutex);
+			const auto entry = cache.find(key);
+			return entry != cache.end() ? entry->second : nullptr;
+		}
+
+		std::shared_ptr<const std::string> insert(const std::string& key, std::string program)
+		{
+			auto entry = std::make_shared<const std::string>(std::move(program));
+
+			std::lock_guard _(cache_mutex);
+			return cache.try_emplace(key, std::move(entry)).first->second;
+		}
+	}
+
+	void set_persistent(const bool enabled)
+	{
+		persistent_enabled = enabled;
+	}
+
+	bool is_persistent()
+	{
+		return persistent_enabled;
+	}
+
+	std::string get(const char* name, const std::string& program, const std::string& params, const std::function<std::string()>& patch)
+	{
+		const auto key = get_key(name, program, params);
+
+		if (const auto entry = find(key))
+		{
+			return *entry;
+		}
+
+		const auto path = cache_path + key + ".cso";
+
+		std::string patched;
+		if (persistent_enabled && utils::io::read_file(path, &patched))
+		{
+			return *insert(key, std::move(patched));
+		}
+
+		patched = patch();
+
+		if (persistent_enabled)
+		{
+			// written next to the entry first, a build running in parallel never reads half a shader
+			std::error_code ec;
+			const auto staged = path + "." + std::to_string(GetCurrentThreadId()) + ".tmp";
+			if (!utils::io::write_file(staged, patched, false))
+			{
+				ZONETOOL_WARNING("Failed to write shader cache entry \"%s\"", path.data());
+			}
+			else
+			{
+				std::filesystem::rename(staged, path, ec);
+				if (ec)
+				{
+					std::filesystem::remove(staged, ec);
+				}
+			}
+		}
+
+		return *insert(key, std::move(patched));
+	}
+}
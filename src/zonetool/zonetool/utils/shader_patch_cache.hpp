@@ -0,0 +1,24 @@
+#pragma once
+
+#include <functional>
+#include <string>
+#include <type_traits>
+
+namespace zonetool::shader_patch_cache
+{
+	// patched programs are also kept in dump\_cache\shaders\ for later runs, enabled with -shadercache
+	void set_persistent(bool enabled);
+	bool is_persistent();
+
+	// appends a value the patch depends on (constant buffer remaps, light type gates, argument layout...) to `params`
+	template <typename T>
+	void add_param(std::string& params, const T& value)
+	{
+		static_assert(std::is_trivially_copyable_v<T>);
+		params.append(reinterpret_cast<const char*>(&value), sizeof(T));
+	}
+
+	// returns `patch()` for this program, patch and parameters, the patch only runs the first time the combination is seen.
+	// `name` identifies the patch function and `params` must hold everything its output depends on besides the program
+	std::string get(const char* name, const std::string& program, const std::string& params, const std::function<std::string()>& patch);
+}
@@ -0,0 +1,165 @@
+#include <std_include.hpp>
+#include "string_table_builder.hpp"
+
+#include "utils.hpp"
+
+#include <utils/io.hpp>
+#include <utils/string.hpp>
+
+namespace zonetool
+{
+	void string_table_builder::parse(std::string_view data)
+	{
+		this->strings_.clear();
+		this->indices_.clear();
+		this->cells_.clear();
+		this->row_starts_ = {0};
+		this->max_columns_ = 0;
+		this->cell_bytes_ = 0;
+
+		this->intern({});
+
+		// csv::parser reads the file as a c string
+		data = data.substr(0, data.find('\0'));
+
+		std::string cell;
+		auto in_quote = false;
+		auto row_empty = true;
+
+		for (std::size_t i = 0; i < data.size(); i++)
+		{
+			const auto c = data[i];
+			if (c == '\\' && i + 1 < data.size() && (data[i + 1] == 'n' || data[i + 1] == 't'))
+			{
+				cell.push_back(data[++i] == 'n' ? '\n' : '\t');
+				row_empty = false;
+				continue;
+			}
+
+			if (c == '\r')
+			{
+				continue;
+			}
+
+			if (c == '\n')
+			{
+				if (!cell.empty())
+				{
+					this->add_cell(cell);
+				}
+
+				this->end_row();
+
+				cell.clear();
+				in_quote = false;
+				row_empty = true;
+				continue;
+			}
+
+			row_empty = false;
+
+			if (c == '"')
+			{
+				in_quote = !in_quote;
+			}
+			else if (c == ',' && !in_quote)
+			{
+				this->add_cell(cell);
+				cell.clear();
+			}
+			else
+			{
+				cell.push_back(c);
+			}
+		}
+
+		// the last line only counts when it has anything on it
+		if (!row_empty)
+		{
+			if (!cell.empty())
+			{
+				this->add_cell(cell);
+			}
+
+			this->end_row();
+		}
+	}
+
+	void string_table_builder::parse_file(const std::string& path)
+	{
+		std::string data{};
+		if (!utils::io::read_file(path, &data))
+		{
+			throw std::runtime_error(utils::string::va("CSV: Failed to open file \"%s\" for read!", path.data()));
+		}
+
+		this->parse(data);
+	}
+
+	int string_table_builder::get_num_rows() const
+	{
+		return static_cast<int>(this->row_starts_.size() - 1);
+	}
+
+	int string_table_builder::get_max_columns() const
+	{
+		return this->max_columns_;
+	}
+
+	const std::deque<std::string>& string_table_builder::get_strings() const
+	{
+		return this->strings_;
+	}
+
+	std::uint32_t string_table_builder::get_cell(const int row, const int column) const
+	{
+		const auto index = this->row_starts_[row] + column;
+		return index < this->row_starts_[row + 1] ? this->cells_[index] : 0;
+	}
+
+	std::size_t string_table_builder::get_cell_bytes() const
+	{
+		// cells past the end of their row are empty strings
+		const auto cell_count = static_cast<std::size_t>(this->get_num_rows()) * this->max_columns_;
+		return this->cell_bytes_ + (cell_count - this->cells_.size());
+	}
+
+	std::size_t string_table_builder::get_pooled_bytes() const
+	{
+		std::size_t bytes = 0;
+		for (const auto& string : this->strings_)
+		{
+			bytes += string.size() + 1;
+		}
+
+		return bytes;
+	}
+
+	std::uint32_t string_table_builder::intern(const std::string_view value)
+	{
+		if (const auto itr = this->indices_.find(value); itr != this->indices_.end())
+		{
+			return itr->second;
+		}
+
+		// deque elements don't move, so the key can point into them
+		const auto index = static_cast<std::uint32_t>(this->strings_.size());
+		const auto& string = this->strings_.emplace_back(value);
+		this->indices_.emplace(string, index);
+
+		return index;
+	}
+
+	void string_table_builder::add_cell(const std::string_view value)
+	{
+		this->cells_.emplace_back(this->intern(value));
+		this->cell_bytes_ += value.size() + 1;
+	}
+
+	void string_table_builder::end_row()
+	{
+		const auto row_start = this->row_starts_.back();
+		this->row_starts_.emplace_back(this->cells_.size());
+		this->max_columns_ = std::max(this->max_columns_, static_cast<int>(this->cells_.size() - row_start));
+	}
+}
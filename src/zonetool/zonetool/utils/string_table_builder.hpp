@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace zonetool
+{
+	// reads a string table csv in a single pass and keeps every distinct cell value once. parses like csv::parser:
+	// \n and \t are unescaped, quotes toggle whether commas split fields, a trailing empty field is dropped and
+	// cells past the end of a row are empty
+	class string_table_builder
+	{
+	public:
+		void parse(std::string_view data);
+
+		// throws like csv::parser when the file can't be read
+		void parse_file(const std::string& path);
+
+		int get_num_rows() const;
+		int get_max_columns() const;
+
+		// distinct cell values in order of first appearance, the empty string is always the first
+		const std::deque<std::string>& get_strings() const;
+
+		// index into get_strings() of a cell
+		std::uint32_t get_cell(int row, int column) const;
+
+		// bytes the table takes with a copy of the value for every cell, and with every distinct value once
+		std::size_t get_cell_bytes() const;
+		std::size_t get_pooled_bytes() const;
+
+	private:
+		std::deque<std::string> strings_;
+		std::unordered_map<std::string_view, std::uint32_t> indices_;
+
+		std::vector<std::uint32_t> cells_;
+		std::vector<std::size_t> row_starts_; // first cell of each row, followed by the number of cells
+
+		int max_columns_ = 0;
+		std::size_t cell_bytes_ = 0;
+
+		std::uint32_t intern(std::string_view value);
+		void add_cell(std::string_view value);
+		void end_row();
+	};
+}
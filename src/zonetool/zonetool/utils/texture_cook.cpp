@@ -0,0 +1,294 @@
+#include <std_include.hpp>
+#include "texture_cook.hpp"
+
+#include "dump_queue.hpp"
+#include "utils.hpp"
+
+#pragma warning( push )
+#pragma warning( disable : 4459 )
+#include <DirectXTex.h>
+#pragma warning( pop )
+
+#include <utils/concurrency.hpp>
+#include <utils/cryptography.hpp>
+#include <utils/io.hpp>
+
+namespace zonetool::texture_cook
+{
+	namespace
+	{
+		constexpr auto cache_path = "dump\\_cache\\images\\";
+
+		// bump when the format choice or compression settings change, older cache entries are ignored then
+		constexpr auto cache_version = 1u;
+		constexpr auto cache_magic = 0x4B4F4F43u; // COOK
+
+		// rows compressed by one task, has to stay a multiple of the 4x4 block size
+		constexpr auto strip_height = 64u;
+
+#pragma pack(push, 1)
+		struct cache_header
+		{
+			std::uint32_t magic;
+			std::uint32_t version;
+			std::uint32_t format;
+			std::uint32_t width;
+			std::uint32_t height;
+			std::uint32_t level_count;
+			std::uint64_t size;
+		};
+#pragma pack(pop)
+
+		struct strip
+		{
+			std::size_t level;
+			std::size_t row;
+			std::size_t height;
+			std::size_t offset;
+		};
+
+		std::atomic_bool cook_enabled = false;
+
+		dump_queue& get_queue()
+		{
+			// images are cooked one after another, the strips of each are spread over all cores
+			static dump_queue queue(1);
+			return queue;
+		}
+
+		std::string get_key(const std::string& source, const usage usage)
+		{
+			std::string data;
+			data.reserve(source.size() + 16);
+			data.append(std::to_string(cache_version)).push_back('\0');
+			data.append(std::to_string(static_cast<int>(usage))).push_back('\0');
+			data.append(source);
+
+			return utils::cryptography::sha1::compute(data, true);
+		}
+
+		DXGI_FORMAT get_format(const usage usage, const DirectX::ScratchImage& image)
+		{
+			switch (usage)
+			{
+			case usage::normal:
+				return DXGI_FORMAT_BC5_SNORM; // same layout the iwi normal maps are converted to
+			case usage::specular:
+				return DXGI_FORMAT_BC3_UNORM; // gloss is stored in alpha
+			default:
+				return image.IsAlphaAllOpaque() ? DXGI_FORMAT_BC1_UNORM : DXGI_FORMAT_BC3_UNORM;
+			}
+		}
+
+		std::optional<cooked_image> read_cache(const std::string& path, const allocator& alloc)
+		{
+			std::ifstream stream(path, std::ios::binary | std::ios::ate);
+			if (!stream.is_open())
+			{
+				return {};
+			}
+
+			const auto file_size = static_cast<std::uint64_t>(stream.tellg());
+
+			cache_header header{};
+			stream.seekg(0);
+			if (!stream.read(reinterpret_cast<char*>(&header), sizeof(cache_header)) ||
+				header.magic != cache_magic || header.version != cache_version || !header.size)
+			{
+				return {};
+			}
+
+			// a truncated or corrupted entry is cooked again instead of allocating whatever its header claims
+			if (header.size != file_size - sizeof(cache_header))
+			{
+				return {};
+			}
+
+			auto* pixels = alloc(static_cast<std::size_t>(header.size));
+			if (!stream.read(reinterpret_cast<char*>(pixels), static_cast<std::streamsize>(header.size)))
+			{
+				return {};
+			}
+
+			return {{static_cast<DXGI_FORMAT>(header.format), header.width, header.height, header.level_count,
+				pixels, static_cast<std::size_t>(header.size)}};
+		}
+
+		void write_cache(const std::string& path, const cooked_image& image)
+		{
+			const cache_header header{cache_magic, cache_version, static_cast<std::uint32_t>(image.format),
+				image.width, image.height, image.level_count, image.size};
+
+			std::string data;
+			data.reserve(sizeof(cache_header) + image.size);
+			data.append(reinterpret_cast<const char*>(&header), sizeof(cache_header));
+			data.append(reinterpret_cast<const char*>(image.pixels), image.size);
+
+			// written next to the entry first, a cook running in parallel never sees half an entry
+			const auto staged = path + "." + std::to_string(GetCurrentThreadId()) + ".tmp";
+			if (!utils::io::write_file(staged, data, false))
+			{
+				return;
+			}
+
+			std::error_code ec;
+			std::filesystem::rename(staged, path, ec);
+			if (ec)
+			{
+				std::filesystem::remove(staged, ec);
+			}
+		}
+
+		bool load_source(const std::string& path, const std::string& data, DirectX::ScratchImage& image)
+		{
+			if (path.ends_with(".tga"))
+			{
+				return SUCCEEDED(DirectX::LoadFromTGAMemory(data.data(), data.size(), nullptr, image));
+			}
+
+			// WIC needs COM on the worker thread
+			[[maybe_unused]] thread_local const auto com_initialized = CoInitializeEx(nullptr, COINIT_MULTITHREADED);
+
+			return SUCCEEDED(DirectX::LoadFromWICMemory(data.data(), data.size(), DirectX::WIC_FLAGS_NONE, nullptr, image));
+		}
+
+		std::optional<cooked_image> compress(const std::string& path, const DirectX::ScratchImage& image, const DXGI_FORMAT format, const allocator& alloc)
+		{
+			const auto& metadata = image.GetMetadata();
+
+			std::vector<strip> strips;
+			std::size_t size = 0;
+
+			for (auto level = 0u; level < metadata.mipLevels; level++)
+			{
+				const auto* src = image.GetImage(level, 0, 0);
+
+				std::size_t row_pitch{};
+				std::size_t slice_pitch{};
+				DirectX::ComputePitch(format, src->width, src->height, row_pitch, slice_pitch);
+
+				// rowPitch of a block compressed image spans a row of blocks
+				for (auto row = 0u; row < src->height; row += strip_height)
+				{
+					strips.push_back({level, row, std::min<std::size_t>(strip_height, src->height - row), size + (row / 4) * row_pitch});
+				}
+
+				size += slice_pitch;
+			}
+
+			auto* pixels = alloc(size);
+			std::atomic_bool failed = false;
+
+			utils::concurrency::parallel_for(strips.size(), 4, [&](const std::size_t index)
+			{
+				const auto& part = strips[index];
+				const auto* src = image.GetImage(part.level, 0, 0);
+
+				auto src_part = *src;
+				src_part.height = part.height;
+				src_part.slicePitch = src->rowPitch * part.height;
+				src_part.pixels = src->pixels + src->rowPitch * part.row;
+
+				DirectX::ScratchImage compressed;
+				if (FAILED(DirectX::Compress(src_part, format, DirectX::TEX_COMPRESS_DEFAULT, DirectX::TEX_THRESHOLD_DEFAULT, compressed)))
+				{
+					failed = true;
+					return;
+				}
+
+				std::memcpy(pixels + part.offset, compressed.GetPixels(), compressed.GetPixelsSize());
+			});
+
+			if (failed)
+			{
+				ZONETOOL_ERROR("Failed to compress image \"%s\"", path.data());
+				return {};
+			}
+
+			return {{format, static_cast<std::uint32_t>(metadata.width), static_cast<std::uint32_t>(metadata.height),
+				static_cast<std::uint32_t>(metadata.mipLevels), pixels, size}};
+		}
+
+		std::optional<cooked_image> cook(const std::string& path, const usage usage, const allocator& alloc)
+		{
+			std::string data;
+			if (!utils::io::read_file(path, &data))
+			{
+				ZONETOOL_ERROR("Failed to read image \"%s\"", path.data());
+				return {};
+			}
+
+			const auto cached_path = cache_path + get_key(data, usage) + ".bin";
+			if (auto cached = read_cache(cached_path, alloc))
+			{
+				return cached;
+			}
+
+			DirectX::ScratchImage source;
+			if (!load_source(path, data, source))
+			{
+				ZONETOOL_ERROR("Failed to load image \"%s\"", path.data());
+				return {};
+			}
+
+			const auto& metadata = source.GetMetadata();
+			if (metadata.dimension != DirectX::TEX_DIMENSION_TEXTURE2D || metadata.arraySize != 1 || metadata.depth != 1)
+			{
+				return {};
+			}
+
+			DirectX::ScratchImage mipped;
+			if (metadata.mipLevels > 1)
+			{
+				mipped = std::move(source);
+			}
+			else if (FAILED(DirectX::GenerateMipMaps(*source.GetImage(0, 0, 0), DirectX::TEX_FILTER_DEFAULT, 0, mipped)))
+			{
+				ZONETOOL_ERROR("Failed to generate mips for image \"%s\"", path.data());
+				return {};
+			}
+
+			auto cooked = compress(path, mipped, get_format(usage, mipped), alloc);
+			if (cooked.has_value())
+			{
+				write_cache(cached_path, *cooked);
+			}
+
+			return cooked;
+		}
+	}
+
+	void set_enabled(const bool enabled)
+	{
+		cook_enabled = enabled;
+	}
+
+	bool is_enabled()
+	{
+		return cook_enabled;
+	}
+
+	std::shared_future<std::optional<cooked_image>> cook_async(const std::string& path, const usage usage, allocator alloc)
+	{
+		auto task = std::make_shared<std::packaged_task<std::optional<cooked_image>()>>([=, alloc = std::move(alloc)]() -> std::optional<cooked_image>
+		{
+			try
+			{
+				return cook(path, usage, alloc);
+			}
+			catch (const std::exception& ex)
+			{
+				ZONETOOL_ERROR("Failed to cook image \"%s\": %s", path.data(), ex.what());
+				return {};
+			}
+		});
+
+		auto result = task->get_future().share();
+		get_queue().push([task]
+		{
+			(*task)();
+		});
+
+		return result;
+	}
+}
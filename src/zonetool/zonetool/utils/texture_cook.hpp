@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <optional>
+#include <string>
+
+#include <dxgiformat.h>
+
+namespace zonetool::texture_cook
+{
+	// what the texture is sampled as, decides the block format it is compressed to
+	enum class usage
+	{
+		color,
+		normal,
+		specular,
+	};
+
+	struct cooked_image
+	{
+		DXGI_FORMAT format;
+		std::uint32_t width;
+		std::uint32_t height;
+		std::uint32_t level_count;
+		std::uint8_t* pixels;
+		std::size_t size;
+	};
+
+	// returns zeroed memory the cooked pixels are written to, called from the cook workers
+	using allocator = std::function<std::uint8_t*(std::size_t)>;
+
+	// png/tga sources are block compressed with a full mip chain when loaded, enabled with -cookimages
+	void set_enabled(bool enabled);
+	bool is_enabled();
+
+	// compresses a png/tga file on the cook workers, results are kept in dump\_cache\images\ by source hash and
+	// settings so unchanged sources are read back directly. the future holds nothing when the source can't be cooked
+	std::shared_future<std::optional<cooked_image>> cook_async(const std::string& path, usage usage, allocator alloc);
+}
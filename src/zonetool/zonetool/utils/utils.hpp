@@ -6,10 +6,13 @@
 #include "io/assetmanager.hpp"
 
 #include "csv.hpp"
+#include "string_table_builder.hpp"
 
 #include "game/mode.hpp"
 #include "game/shared.hpp"
 
+#include "gsc_compiler.hpp"
+
 #include <utils/memory.hpp>
 
 namespace nlohmann
@@ -0,0 +1,288 @@
+#include <std_include.hpp>
+#include "vertex_cache.hpp"
+
+namespace zonetool::vertex_cache
+{
+	namespace
+	{
+		// linear-speed vertex cache optimisation (Forsyth), scores a vertex by its position in a
+		// simulated LRU cache and by how many triangles still need it
+		constexpr auto max_cache_size = 32;
+		constexpr auto max_valence = 32;
+		constexpr auto cache_decay_power = 1.5f;
+		constexpr auto last_tri_score = 0.75f;
+		constexpr auto valence_boost_scale = 2.0f;
+		constexpr auto valence_boost_power = 0.5f;
+
+		std::atomic_bool optimize_enabled = false;
+
+		struct score_table
+		{
+			float cache[max_cache_size];
+			float valence[max_valence + 1];
+
+			score_table()
+			{
+				for (auto i = 0; i < max_cache_size; i++)
+				{
+					if (i < 3)
+					{
+						this->cache[i] = last_tri_score;
+					}
+					else
+					{
+						const auto scaler = 1.0f / static_cast<float>(max_cache_size - 3);
+						this->cache[i] = std::pow(1.0f - static_cast<float>(i - 3) * scaler, cache_decay_power);
+					}
+				}
+
+				this->valence[0] = 0.0f;
+				for (auto i = 1; i <= max_valence; i++)
+				{
+					this->valence[i] = valence_boost_scale * std::pow(static_cast<float>(i), -valence_boost_power);
+				}
+			}
+		};
+
+		const score_table scores;
+
+		float get_vertex_score(const int cache_position, const std::uint32_t live_tris)
+		{
+			if (live_tris == 0)
+			{
+				return -1.0f;
+			}
+
+			auto score = cache_position >= 0 ? scores.cache[cache_position] : 0.0f;
+			if (live_tris <= max_valence)
+			{
+				score += scores.valence[live_tris];
+			}
+			else
+			{
+				score += valence_boost_scale * std::pow(static_cast<float>(live_tris), -valence_boost_power);
+			}
+
+			return score;
+		}
+
+		struct vertex_data
+		{
+			float score;
+			int cache_position;
+			std::uint32_t live_tris;
+			std::uint32_t tri_offset;
+		};
+	}
+
+	void set_enabled(const bool enabled)
+	{
+		optimize_enabled = enabled;
+	}
+
+	bool is_enabled()
+	{
+		return optimize_enabled;
+	}
+
+	std::size_t count_cache_misses(const std::uint16_t* indices, const std::size_t tri_count, const std::size_t cache_size)
+	{
+		// a vertex is cached while fewer than `cache_size` misses happened since it was loaded
+		std::vector<std::size_t> loaded_at(0x10000, 0);
+		auto misses = cache_size;
+
+		for (auto i = 0u; i < tri_count * 3; i++)
+		{
+			const auto vertex = indices[i];
+			if (misses - loaded_at[vertex] >= cache_size)
+			{
+				loaded_at[vertex] = ++misses;
+			}
+		}
+
+		return misses - cache_size;
+	}
+
+	std::vector<std::uint32_t> optimize_triangle_order(const std::uint16_t* indices, const std::size_t tri_count)
+	{
+		std::vector<std::uint32_t> order;
+		order.reserve(tri_count);
+
+		if (tri_count == 0)
+		{
+			return order;
+		}
+
+		std::size_t vertex_count = 0;
+		for (auto i = 0u; i < tri_count * 3; i++)
+		{
+			vertex_count = std::max(vertex_count, static_cast<std::size_t>(indices[i]) + 1);
+		}
+
+		// per-vertex list of triangles that still have to be emitted
+		std::vector<vertex_data> vertices(vertex_count);
+		for (auto i = 0u; i < tri_count * 3; i++)
+		{
+			vertices[indices[i]].live_tris++;
+		}
+
+		std::uint32_t offset = 0;
+		for (auto& vertex : vertices)
+		{
+			vertex.tri_offset = offset;
+			vertex.cache_position = -1;
+			vertex.score = get_vertex_score(-1, vertex.live_tris);
+			offset += vertex.live_tris;
+		}
+
+		std::vector<std::uint32_t> vertex_tris(tri_count * 3);
+		{
+			std::vector<std::uint32_t> fill(vertex_count, 0);
+			for (auto tri = 0u; tri < tri_count; tri++)
+			{
+				for (auto c = 0; c < 3; c++)
+				{
+					const auto vertex = indices[tri * 3 + c];
+					vertex_tris[vertices[vertex].tri_offset + fill[vertex]++] = tri;
+				}
+			}
+		}
+
+		std::vector<float> tri_scores(tri_count);
+		std::vector<bool> tri_added(tri_count, false);
+
+		auto best_tri = 0u;
+		for (auto tri = 0u; tri < tri_count; tri++)
+		{
+			tri_scores[tri] = vertices[indices[tri * 3 + 0]].score +
+				vertices[indices[tri * 3 + 1]].score +
+				vertices[indices[tri * 3 + 2]].score;
+
+			if (tri_scores[tri] > tri_scores[best_tri])
+			{
+				best_tri = tri;
+			}
+		}
+
+		std::vector<std::uint16_t> cache;
+		std::vector<std::uint16_t> new_cache;
+		cache.reserve(max_cache_size + 3);
+		new_cache.reserve(max_cache_size + 3);
+
+		auto has_best = true;
+		auto search_start = 0u;
+
+		while (order.size() < tri_count)
+		{
+			if (!has_best)
+			{
+				// nothing in the cache has live triangles left, restart from the best remaining triangle
+				auto best_score = -1.0f;
+				for (auto tri = search_start; tri < tri_count; tri++)
+				{
+					if (tri_added[tri])
+					{
+						if (tri == search_start)
+						{
+							search_start++;
+						}
+
+						continue;
+					}
+
+					if (tri_scores[tri] > best_score)
+					{
+						best_score = tri_scores[tri];
+						best_tri = tri;
+					}
+				}
+			}
+
+			order.emplace_back(best_tri);
+			tri_added[best_tri] = true;
+
+			const auto* tri_indices = &indices[best_tri * 3];
+
+			new_cache.clear();
+			for (auto c = 0; c < 3; c++)
+			{
+				const auto vertex = tri_indices[c];
+				auto& data = vertices[vertex];
+
+				auto* tris = &vertex_tris[data.tri_offset];
+				for (auto i = 0u; i < data.live_tris; i++)
+				{
+					if (tris[i] == best_tri)
+					{
+						tris[i] = tris[data.live_tris - 1];
+						break;
+					}
+				}
+
+				data.live_tris--;
+
+				if (std::find(new_cache.begin(), new_cache.end(), vertex) == new_cache.end())
+				{
+					new_cache.emplace_back(vertex);
+				}
+			}
+
+			for (const auto vertex : cache)
+			{
+				if (std::find(new_cache.begin(), new_cache.end(), vertex) == new_cache.end())
+				{
+					new_cache.emplace_back(vertex);
+				}
+			}
+
+			// vertices pushed out of the cache lose their cache score
+			for (auto i = max_cache_size; i < static_cast<int>(new_cache.size()); i++)
+			{
+				auto& data = vertices[new_cache[i]];
+				data.cache_position = -1;
+				data.score = get_vertex_score(-1, data.live_tris);
+			}
+
+			if (new_cache.size() > max_cache_size)
+			{
+				new_cache.resize(max_cache_size);
+			}
+
+			for (auto i = 0u; i < new_cache.size(); i++)
+			{
+				auto& data = vertices[new_cache[i]];
+				data.cache_position = static_cast<int>(i);
+				data.score = get_vertex_score(data.cache_position, data.live_tris);
+			}
+
+			has_best = false;
+			auto best_score = -1.0f;
+
+			for (const auto vertex : new_cache)
+			{
+				const auto& data = vertices[vertex];
+				const auto* tris = &vertex_tris[data.tri_offset];
+
+				for (auto i = 0u; i < data.live_tris; i++)
+				{
+					const auto tri = tris[i];
+					const auto score = vertices[indices[tri * 3 + 0]].score +
+						vertices[indices[tri * 3 + 1]].score +
+						vertices[indices[tri * 3 + 2]].score;
+
+					tri_scores[tri] = score;
+					if (score > best_score)
+					{
+						best_score = score;
+						best_tri = tri;
+						has_best = true;
+					}
+				}
+			}
+
+			std::swap(cache, new_cache);
+		}
+
+		return order;
+	}
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace zonetool::vertex_cache
+{
+	// cache size used when reporting ACMR (average cache miss ratio, transformed vertices per triangle)
+	constexpr std::size_t fifo_cache_size = 16;
+
+	// the surface optimisation pass is opt-in, enabled with -optimizesurfaces
+	void set_enabled(bool enabled);
+	bool is_enabled();
+
+	// number of vertices a FIFO post-transform cache has to transform for the given triangle list
+	std::size_t count_cache_misses(const std::uint16_t* indices, std::size_t tri_count,
+		std::size_t cache_size = fifo_cache_size);
+
+	// returns the triangle order with the best post-transform cache locality, triangles keep their winding
+	std::vector<std::uint32_t> optimize_triangle_order(const std::uint16_t* indices, std::size_t tri_count);
+}